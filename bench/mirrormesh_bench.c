@@ -0,0 +1,834 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_bench.c
+ * \brief Benchmark of the mesh replication on synthetic meshes.
+ * \copyright GNU Lesser General Public License.
+ *
+ * The base mesh is a structured box of cubes split into 6 tetra, of
+ * configurable size. For each base size, lattice of copies and number of
+ * threads of the sweep, the mesh is generated, replicated and optionally
+ * saved in a child process, so the peak memory of each run is measured
+ * separately. The wall and CPU time, the elements per second, the bytes per
+ * second, the bytes moved per output element and the peak memory of each
+ * phase are written in a CSV or JSON file and can be compared against a
+ * baseline.
+ *
+ * The replication is run with the default tiles of base elements (phase
+ * mirror) and without tiling, the copies being built one after the other
+ * (phase mirror_untiled). Each one runs in its own child process on a fresh
+ * heap, the order of the two processes being swapped at each repetition. The
+ * ratio of their wall times is the measured gain of the tiling.
+ *
+ * The bytes moved between the memory and the cache by the replication are
+ * measured by the last level cache misses of the process and of its threads
+ * (Linux perf events) times the size of a cache line. If the counters are not
+ * available, they are given by a model of the element replication, labelled
+ * as such in the results (see \ref BENCH_model).
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "mmg/mmg3d/libmmg3d.h"
+#include "mirrormesh/libmirrormesh.h"
+
+#define BENCH_MAXRUN   64  /*!< maximal number of values of each sweep */
+#define BENCH_NPHASE    4  /*!< generation, replications and save */
+#define BENCH_LINE     64  /*!< cache line size if the system doesn't give it */
+
+static const char *BENCH_phase[BENCH_NPHASE] = {"generate","mirror_untiled",
+                                                "mirror","save"};
+
+/** Source of the bytes moved per element */
+enum {
+  BENCH_NONE = 0, /*!< not evaluated */
+  BENCH_PERF,     /*!< measured by the cache misses */
+  BENCH_MODEL     /*!< modelled (see \ref BENCH_model) */
+};
+static const char *BENCH_traffic[3] = {"none","perf","model"};
+
+/** Measures of a phase */
+typedef struct {
+  double wall;  /*!< wall time (s) */
+  double cpu;   /*!< CPU time, user and system (s) */
+  double nelem; /*!< number of tetra produced */
+  double bytes; /*!< bytes written (mesh arrays or output file) */
+  double bpe;   /*!< bytes moved between the memory and the cache per output
+                     element (tetra, triangle or edge) */
+  int    src;   /*!< source of \a bpe (\ref BENCH_PERF or \ref BENCH_MODEL) */
+  double rss;   /*!< peak resident set size of the process of the phase (MB) */
+  int    done;  /*!< 1 if the phase has run */
+} BENCH_Phase;
+
+/** A run of the sweep */
+typedef struct {
+  long        ne;         /*!< requested number of base tetra */
+  int         nmir[3];    /*!< number of mirrors along each axis */
+  int         nthreads;   /*!< number of threads */
+  BENCH_Phase phase[BENCH_NPHASE];
+  int         ok;         /*!< 1 if the run succeeded */
+} BENCH_Run;
+
+/** Parameters of the sweep */
+typedef struct {
+  long   ne[BENCH_MAXRUN];
+  int    nne;
+  int    nmir[BENCH_MAXRUN][3];
+  int    nnmir;
+  int    nthreads[BENCH_MAXRUN];
+  int    nnthreads;
+  int    reps;
+  char   *savedir;
+  char   *out;
+  char   *baseline;
+  double tol;
+} BENCH_Param;
+
+static double BENCH_wall(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC,&t);
+  return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+static double BENCH_cpu(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF,&usage);
+  return usage.ru_utime.tv_sec + 1e-6*usage.ru_utime.tv_usec
+    + usage.ru_stime.tv_sec + 1e-6*usage.ru_stime.tv_usec;
+}
+
+/**
+ * \return a counter of the last level cache misses of the process and of the
+ * threads it creates afterwards, disabled, -1 if the counters are not
+ * available.
+ *
+ */
+static int BENCH_perfOpen(void) {
+#ifdef __linux__
+  struct perf_event_attr attr;
+
+  memset(&attr,0,sizeof(attr));
+  attr.size           = sizeof(attr);
+  attr.type           = PERF_TYPE_HARDWARE;
+  attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+  attr.disabled       = 1;
+  attr.inherit        = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+
+  return (int)syscall(SYS_perf_event_open,&attr,0,-1,-1,0);
+#else
+  return -1;
+#endif
+}
+
+/**
+ * \param fd counter of \ref BENCH_perfOpen
+ * \param on 1 to reset and start the counter, 0 to stop it
+ *
+ * \return the bytes moved since the counter was started (when stopping it),
+ * -1 if fail.
+ *
+ */
+static double BENCH_perfSwitch(int fd,int on) {
+#ifdef __linux__
+  unsigned long long count;
+  long               line;
+
+  if ( on ) {
+    if ( ioctl(fd,PERF_EVENT_IOC_RESET,0) || ioctl(fd,PERF_EVENT_IOC_ENABLE,0) )
+      return -1.;
+    return 0.;
+  }
+  /* The counts of the threads are summed with the one of the process */
+  if ( ioctl(fd,PERF_EVENT_IOC_DISABLE,0) ||
+       read(fd,&count,sizeof(count)) != sizeof(count) )
+    return -1.;
+
+  line = -1;
+#ifdef _SC_LEVEL1_DCACHE_LINESIZE
+  line = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+#endif
+  if ( line <= 0 ) line = BENCH_LINE;
+  return (double)count*line;
+#else
+  return -1.;
+#endif
+}
+
+/**
+ * \param mesh mesh to fill
+ * \param ne requested number of tetra
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Build a box of \a c x \a c x \a c unit cubes, \a c being chosen so the box
+ * holds about \a ne tetra. Each cube is split into the 6 tetra sharing its
+ * main diagonal (Kuhn subdivision, conforming between the cubes) and each
+ * boundary square into 2 triangles, referenced by the face of the box.
+ *
+ */
+static int BENCH_generate(MMG5_pMesh mesh,long ne) {
+  /* Permutations of the axes and their signature */
+  static const int perm[6][3] = {{0,1,2},{1,2,0},{2,0,1},{0,2,1},{2,1,0},{1,0,2}};
+  int    c,n,i,j,k,l,a,b,ok,ie,it,v[4],q[4];
+
+  c = (int)(cbrt(ne/6.)+0.5);
+  if ( c < 1 ) c = 1;
+  n = c+1;
+
+  if ( MMG3D_Set_meshSize(mesh,n*n*n,6*c*c*c,0,12*c*c,0,0) != 1 )
+    return 0;
+
+#define BENCH_IDX(i,j,k) (1 + (i) + n*((j) + n*(k)))
+
+  for ( k=0; k<n; ++k ) {
+    for ( j=0; j<n; ++j ) {
+      for ( i=0; i<n; ++i ) {
+        if ( MMG3D_Set_vertex(mesh,(double)i/c,(double)j/c,(double)k/c,0,
+                              BENCH_IDX(i,j,k)) != 1 ) return 0;
+      }
+    }
+  }
+
+  /* Tetra: path from the lower corner to the upper corner of the cube */
+  ie = 0;
+  for ( k=0; k<c; ++k ) {
+    for ( j=0; j<c; ++j ) {
+      for ( i=0; i<c; ++i ) {
+        for ( l=0; l<6; ++l ) {
+          int p[3] = {i,j,k};
+
+          v[0] = BENCH_IDX(p[0],p[1],p[2]);
+          for ( a=0; a<3; ++a ) {
+            ++p[perm[l][a]];
+            v[a+1] = BENCH_IDX(p[0],p[1],p[2]);
+          }
+          /* Odd permutations give negative volumes */
+          if ( l > 2 ) {
+            a = v[2]; v[2] = v[3]; v[3] = a;
+          }
+          if ( MMG3D_Set_tetrahedron(mesh,v[0],v[1],v[2],v[3],1,++ie) != 1 )
+            return 0;
+        }
+      }
+    }
+  }
+
+  /* Boundary triangles, split along the diagonal of the tetra faces and
+   * oriented outward */
+  it = 0;
+  for ( a=0; a<3; ++a ) {
+    int ua = (a+1)%3, wa = (a+2)%3;
+
+    for ( b=0; b<2; ++b ) {
+      for ( j=0; j<c; ++j ) {
+        for ( i=0; i<c; ++i ) {
+          int p[3];
+
+          for ( l=0; l<4; ++l ) {
+            p[a]  = b*c;
+            p[ua] = i + (l==1 || l==2);
+            p[wa] = j + (l>=2);
+            q[l]  = BENCH_IDX(p[0],p[1],p[2]);
+          }
+          /* (u,w,a) is direct: the lower face is reversed */
+          if ( b ) {
+            ok = MMG3D_Set_triangle(mesh,q[0],q[1],q[2],2*a+b+1,++it)
+              && MMG3D_Set_triangle(mesh,q[0],q[2],q[3],2*a+b+1,++it);
+          }
+          else {
+            ok = MMG3D_Set_triangle(mesh,q[0],q[2],q[1],2*a+b+1,++it)
+              && MMG3D_Set_triangle(mesh,q[0],q[3],q[2],2*a+b+1,++it);
+          }
+          if ( !ok ) return 0;
+        }
+      }
+    }
+  }
+#undef BENCH_IDX
+
+  return 1;
+}
+
+/**
+ * \param mesh mesh
+ *
+ * \return the size of the arrays of points and elements of the mesh.
+ *
+ */
+static double BENCH_meshBytes(MMG5_pMesh mesh) {
+  return (double)mesh->np*sizeof(MMG5_Point) + (double)mesh->ne*sizeof(MMG5_Tetra)
+    + (double)mesh->nt*sizeof(MMG5_Tria) + (double)mesh->na*sizeof(MMG5_Edge);
+}
+
+/**
+ * \param mesh mesh
+ *
+ * \return the size of the tetra, triangles and edges of the mesh.
+ *
+ */
+static double BENCH_eltBytes(MMG5_pMesh mesh) {
+  return (double)mesh->ne*sizeof(MMG5_Tetra) + (double)mesh->nt*sizeof(MMG5_Tria)
+    + (double)mesh->na*sizeof(MMG5_Edge);
+}
+
+/**
+ * \param base size of the base elements (\ref BENCH_eltBytes)
+ * \param mesh replicated mesh
+ * \param ncopy number of copies
+ * \param tile 1 if the base elements are tiled, 0 otherwise
+ *
+ * \return the bytes moved by the replication of the elements according to a
+ * model.
+ *
+ * Each element of the replicated mesh is written once. Without tiling, the
+ * base elements are read from memory once per copy; with the tiles, which
+ * fit in the cache, they are read once. The vertices, the welding and the
+ * write-allocate reads are not modelled.
+ *
+ */
+static double BENCH_model(double base,MMG5_pMesh mesh,int ncopy,int tile) {
+  return BENCH_eltBytes(mesh) + ( tile ? 1. : (double)ncopy )*base;
+}
+
+/**
+ * \param mesh base mesh, replaced by the replicated one
+ * \param info parameters of the replication
+ * \param tile size of the tiles of base elements (\ref MIRRORMESH_IPARAM_tile)
+ * \param fd cache misses counter (\ref BENCH_perfOpen), -1 if none
+ * \param ph phase filled with the measures
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Replicate the mesh with the given tiling of the base elements.
+ *
+ */
+static int BENCH_mirror(MMG5_pMesh mesh,MIRRORMESH_pInfo info,int tile,int fd,
+                        BENCH_Phase *ph) {
+  double w,t,base,moved,nout;
+  int    ier,ncopy,i;
+
+  if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_tile,tile) ) return 0;
+
+  base  = BENCH_eltBytes(mesh);
+  ncopy = 1;
+  for ( i=0; i<3; ++i ) ncopy *= info->nmir[i]+1;
+
+  moved = fd < 0 ? -1. : BENCH_perfSwitch(fd,1);
+  w  = BENCH_wall();
+  t  = BENCH_cpu();
+  ier = ( MIRRORMESH_mirrorlib(mesh,info) == MMG5_SUCCESS );
+  ph->wall  = BENCH_wall()-w;
+  ph->cpu   = BENCH_cpu()-t;
+  if ( moved >= 0. ) moved = BENCH_perfSwitch(fd,0);
+  ph->nelem = mesh->ne;
+  ph->bytes = BENCH_meshBytes(mesh);
+  ph->done  = 1;
+
+  if ( moved >= 0. ) {
+    ph->src = BENCH_PERF;
+  }
+  else {
+    moved   = BENCH_model(base,mesh,ncopy,tile >= 0);
+    ph->src = BENCH_MODEL;
+  }
+  nout    = (double)mesh->ne + mesh->nt + mesh->na;
+  ph->bpe = nout > 0. ? moved/nout : 0.;
+
+  return ier;
+}
+
+/**
+ * \param par parameters of the sweep
+ * \param run run to perform, filled with the measures
+ * \param tiled 1 for the tiled replication, 0 for the untiled one
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Generate and replicate the mesh of a run, in the current process, with or
+ * without tiling of the base elements. The tiled replication is also saved.
+ *
+ */
+static int BENCH_run(BENCH_Param *par,BENCH_Run *run,int tiled) {
+  MMG5_pMesh      mesh = NULL;
+  MMG5_pSol       met  = NULL;
+  MIRRORMESH_Info info;
+  BENCH_Phase     *ph;
+  double          w,t;
+  char            name[1024];
+  FILE            *f;
+  int             ier,fd;
+
+  /* Opened before the threads are created, so they are counted */
+  fd = BENCH_perfOpen();
+
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                  MMG5_ARG_end);
+  MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_verbose,-1);
+
+  MIRRORMESH_Init_parameters(&info);
+  MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nx,run->nmir[0]);
+  MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_ny,run->nmir[1]);
+  MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nz,run->nmir[2]);
+  MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nthreads,run->nthreads);
+
+  /* Generation of the base mesh */
+  ph = &run->phase[0];
+  w  = BENCH_wall();
+  t  = BENCH_cpu();
+  ier = BENCH_generate(mesh,run->ne);
+  ph->wall  = BENCH_wall()-w;
+  ph->cpu   = BENCH_cpu()-t;
+  ph->nelem = mesh->ne;
+  ph->bytes = BENCH_meshBytes(mesh);
+  ph->done  = 1;
+  if ( !ier ) goto end;
+
+  /* Replication with the default tiles or copy by copy */
+  ier = BENCH_mirror(mesh,&info,tiled ? 0 : -1,fd,&run->phase[tiled ? 2 : 1]);
+  if ( !ier || !tiled ) goto end;
+
+  /* Medit output */
+  if ( par->savedir ) {
+    ph = &run->phase[3];
+    snprintf(name,sizeof(name),"%s/mirrormesh_bench_%d.mesh",par->savedir,
+             (int)getpid());
+    w  = BENCH_wall();
+    t  = BENCH_cpu();
+    ier = MIRRORMESH_saveMesh(mesh,&info,name);
+    ph->wall  = BENCH_wall()-w;
+    ph->cpu   = BENCH_cpu()-t;
+    ph->nelem = mesh->ne;
+    ph->done  = 1;
+    if ( (f = fopen(name,"r")) ) {
+      fseek(f,0,SEEK_END);
+      ph->bytes = (double)ftell(f);
+      fclose(f);
+    }
+    remove(name);
+  }
+
+end:
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
+                 MMG5_ARG_end);
+  if ( fd >= 0 ) close(fd);
+  return ier;
+}
+
+/**
+ * \param par parameters of the sweep
+ * \param run run to perform
+ * \param tiled 1 for the tiled replication, 0 for the untiled one
+ * \param res filled with the measures of the child process
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Perform a run in a child process (see \ref BENCH_run).
+ *
+ */
+static int BENCH_child(BENCH_Param *par,BENCH_Run *run,int tiled,
+                       BENCH_Run *res) {
+  struct rusage usage;
+  pid_t         pid;
+  double        rss;
+  int           fd[2],l,status;
+
+  if ( pipe(fd) ) {
+    perror("pipe");
+    return 0;
+  }
+  fflush(NULL);
+  pid = fork();
+  if ( pid < 0 ) {
+    perror("fork");
+    return 0;
+  }
+  if ( !pid ) {
+    /* Child: the library output is discarded */
+    if ( !freopen("/dev/null","w",stdout) ) _exit(2);
+    close(fd[0]);
+    *res = *run;
+    memset(res->phase,0,sizeof(res->phase));
+    res->ok = BENCH_run(par,res,tiled);
+    if ( write(fd[1],res,sizeof(BENCH_Run)) != sizeof(BENCH_Run) ) _exit(2);
+    _exit(res->ok ? 0 : 1);
+  }
+
+  close(fd[1]);
+  if ( read(fd[0],res,sizeof(BENCH_Run)) != sizeof(BENCH_Run) ) res->ok = 0;
+  close(fd[0]);
+  if ( wait4(pid,&status,0,&usage) < 0 || !WIFEXITED(status)
+       || WEXITSTATUS(status) ) {
+    res->ok = 0;
+  }
+  if ( !res->ok ) return 0;
+
+#ifdef __APPLE__
+  rss = usage.ru_maxrss/1048576.;
+#else
+  rss = usage.ru_maxrss/1024.;
+#endif
+  for ( l=0; l<BENCH_NPHASE; ++l ) {
+    res->phase[l].rss = rss;
+  }
+  return 1;
+}
+
+/**
+ * \param par parameters of the sweep
+ * \param run run to perform, filled with the measures
+ *
+ * Perform the untiled and the tiled replications of a run \a par->reps times,
+ * each one in its own child process, the untiled one first at even
+ * repetitions and last at odd ones. Keep the fastest time of each phase.
+ *
+ */
+static void BENCH_spawn(BENCH_Param *par,BENCH_Run *run) {
+  BENCH_Run res;
+  int       r,v,l;
+
+  run->ok = 1;
+  memset(run->phase,0,sizeof(run->phase));
+  for ( r=0; r<par->reps; ++r ) {
+    for ( v=0; v<2; ++v ) {
+      if ( !BENCH_child(par,run,(r+v)%2,&res) ) {
+        run->ok = 0;
+        return;
+      }
+      for ( l=0; l<BENCH_NPHASE; ++l ) {
+        if ( !res.phase[l].done ) continue;
+        if ( !run->phase[l].done || res.phase[l].wall < run->phase[l].wall ) {
+          run->phase[l] = res.phase[l];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * \param f output file
+ * \param run runs of the sweep
+ * \param nrun number of runs
+ * \param json 1 for a JSON output, 0 for CSV
+ *
+ * Write one record per phase of each run.
+ *
+ */
+static void BENCH_write(FILE *f,BENCH_Run *run,int nrun,int json) {
+  BENCH_Phase *ph;
+  int         r,l,first;
+
+  if ( json ) fprintf(f,"[\n");
+  else fprintf(f,"ne,nx,ny,nz,nthreads,phase,wall_s,cpu_s,elements,"
+               "elements_per_s,gb_per_s,peak_rss_mb,bytes_per_element,"
+               "traffic\n");
+
+  first = 1;
+  for ( r=0; r<nrun; ++r ) {
+    if ( !run[r].ok ) continue;
+    for ( l=0; l<BENCH_NPHASE; ++l ) {
+      ph = &run[r].phase[l];
+      if ( !ph->done ) continue;
+
+      if ( json ) {
+        fprintf(f,"%s  {\"ne\": %ld, \"nx\": %d, \"ny\": %d, \"nz\": %d,"
+                " \"nthreads\": %d, \"phase\": \"%s\", \"wall_s\": %.6f,"
+                " \"cpu_s\": %.6f, \"elements\": %.0f, \"elements_per_s\": %.6e,"
+                " \"gb_per_s\": %.6f, \"peak_rss_mb\": %.1f,"
+                " \"bytes_per_element\": %.2f, \"traffic\": \"%s\"}",
+                first ? "" : ",\n",
+                run[r].ne,run[r].nmir[0],run[r].nmir[1],run[r].nmir[2],
+                run[r].nthreads,BENCH_phase[l],ph->wall,ph->cpu,ph->nelem,
+                ph->nelem/ph->wall,ph->bytes/ph->wall/1e9,ph->rss,ph->bpe,
+                BENCH_traffic[ph->src]);
+      }
+      else {
+        fprintf(f,"%ld,%d,%d,%d,%d,%s,%.6f,%.6f,%.0f,%.6e,%.6f,%.1f,%.2f,%s\n",
+                run[r].ne,run[r].nmir[0],run[r].nmir[1],run[r].nmir[2],
+                run[r].nthreads,BENCH_phase[l],ph->wall,ph->cpu,ph->nelem,
+                ph->nelem/ph->wall,ph->bytes/ph->wall/1e9,ph->rss,ph->bpe,
+                BENCH_traffic[ph->src]);
+      }
+      first = 0;
+    }
+  }
+  if ( json ) fprintf(f,"\n]\n");
+}
+
+/**
+ * \param par parameters of the sweep
+ * \param run runs of the sweep
+ * \param nrun number of runs
+ *
+ * \return the number of phases slower than the baseline, -1 if fail.
+ *
+ * Compare the elements per second of each phase with the record of the same
+ * run and phase in the CSV baseline file. A phase is slower if it processes
+ * less than (1 - \a tol) times the elements per second of the baseline.
+ *
+ */
+static int BENCH_compare(BENCH_Param *par,BENCH_Run *run,int nrun) {
+  FILE   *f;
+  char   line[512],phase[64];
+  long   ne;
+  int    nmir[3],nt,r,l,nslow;
+  double eps,cur;
+
+  f = fopen(par->baseline,"r");
+  if ( !f ) return -1;
+
+  nslow = 0;
+  while ( fgets(line,sizeof(line),f) ) {
+    if ( sscanf(line,"%ld,%d,%d,%d,%d,%63[^,],%*f,%*f,%*f,%lf",&ne,&nmir[0],
+                &nmir[1],&nmir[2],&nt,phase,&eps) != 7 ) continue;
+
+    for ( r=0; r<nrun; ++r ) {
+      if ( !run[r].ok || run[r].ne != ne || run[r].nthreads != nt ||
+           run[r].nmir[0] != nmir[0] || run[r].nmir[1] != nmir[1] ||
+           run[r].nmir[2] != nmir[2] ) continue;
+
+      for ( l=0; l<BENCH_NPHASE; ++l ) {
+        if ( strcmp(phase,BENCH_phase[l]) || !run[r].phase[l].done ) continue;
+
+        cur = run[r].phase[l].nelem/run[r].phase[l].wall;
+        if ( cur < (1.-par->tol)*eps ) {
+          fprintf(stdout,"  ## Slower: ne %ld, %d %d %d, %d threads, %s:"
+                  " %.3e elements/s (baseline %.3e)\n",ne,nmir[0],nmir[1],
+                  nmir[2],nt,phase,cur,eps);
+          ++nslow;
+        }
+      }
+    }
+  }
+  fclose(f);
+
+  return nslow;
+}
+
+static void BENCH_usage(char *prog) {
+  fprintf(stdout,"\nUsage: %s [opts..]\n",prog);
+  fprintf(stdout,"-ne n[,n..]      Number of tetra of the base meshes"
+          " (default is 100000)\n");
+  fprintf(stdout,"-nmir nx,ny,nz   Mirrors along each axis, may be repeated"
+          " (default is 1,1,1 and 2,2,2)\n");
+  fprintf(stdout,"-nt n[,n..]      Numbers of threads (default is 1 and the"
+          " OpenMP default)\n");
+  fprintf(stdout,"-reps n          Runs of each case, the fastest is kept"
+          " (default is 3)\n");
+  fprintf(stdout,"-save dir        Time the Medit output too, written in dir\n");
+  fprintf(stdout,"-out file        Results file, .json or .csv"
+          " (default is mirrormesh_bench.csv)\n");
+  fprintf(stdout,"-baseline file   CSV baseline to compare with (written if it"
+          " doesn't exist)\n");
+  fprintf(stdout,"-tol val         Relative slowdown allowed against the"
+          " baseline (default is 0.25)\n");
+}
+
+static int BENCH_list(char *arg,long *val,int *n) {
+  char *tok;
+
+  for ( tok=strtok(arg,","); tok; tok=strtok(NULL,",") ) {
+    if ( *n >= BENCH_MAXRUN ) return 0;
+    val[(*n)++] = atol(tok);
+    if ( val[*n-1] < 0 ) return 0;
+  }
+  return *n > 0;
+}
+
+static int BENCH_parsar(int argc,char *argv[],BENCH_Param *par) {
+  long val[BENCH_MAXRUN];
+  int  i,j,n;
+
+  memset(par,0,sizeof(BENCH_Param));
+  par->reps = 3;
+  par->out  = "mirrormesh_bench.csv";
+  par->tol  = 0.25;
+
+  for ( i=1; i<argc; ++i ) {
+    if ( i+1 >= argc ) {
+      BENCH_usage(argv[0]);
+      return 0;
+    }
+    if ( !strcmp(argv[i],"-ne") ) {
+      n = 0;
+      if ( !BENCH_list(argv[++i],val,&n) ) return 0;
+      for ( j=0; j<n && par->nne<BENCH_MAXRUN; ++j ) par->ne[par->nne++] = val[j];
+    }
+    else if ( !strcmp(argv[i],"-nmir") ) {
+      n = 0;
+      if ( par->nnmir >= BENCH_MAXRUN || !BENCH_list(argv[++i],val,&n) || n != 3 ) {
+        fprintf(stderr,"  ## Error: -nmir expects nx,ny,nz.\n");
+        return 0;
+      }
+      for ( j=0; j<3; ++j ) par->nmir[par->nnmir][j] = (int)val[j];
+      ++par->nnmir;
+    }
+    else if ( !strcmp(argv[i],"-nt") ) {
+      n = 0;
+      if ( !BENCH_list(argv[++i],val,&n) ) return 0;
+      for ( j=0; j<n && par->nnthreads<BENCH_MAXRUN; ++j )
+        par->nthreads[par->nnthreads++] = (int)val[j];
+    }
+    else if ( !strcmp(argv[i],"-reps") ) {
+      par->reps = atoi(argv[++i]);
+      if ( par->reps < 1 ) return 0;
+    }
+    else if ( !strcmp(argv[i],"-save") )     par->savedir  = argv[++i];
+    else if ( !strcmp(argv[i],"-out") )      par->out      = argv[++i];
+    else if ( !strcmp(argv[i],"-baseline") ) par->baseline = argv[++i];
+    else if ( !strcmp(argv[i],"-tol") )      par->tol      = atof(argv[++i]);
+    else {
+      fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+      BENCH_usage(argv[0]);
+      return 0;
+    }
+  }
+
+  /* Default sweep */
+  if ( !par->nne ) {
+    par->ne[par->nne++] = 100000;
+  }
+  if ( !par->nnmir ) {
+    for ( j=0; j<3; ++j ) {
+      par->nmir[0][j] = 1;
+      par->nmir[1][j] = 2;
+    }
+    par->nnmir = 2;
+  }
+  if ( !par->nnthreads ) {
+    par->nthreads[par->nnthreads++] = 1;
+    par->nthreads[par->nnthreads++] = 0;
+  }
+  return 1;
+}
+
+int main(int argc,char *argv[]) {
+  BENCH_Param par;
+  BENCH_Run   *run;
+  FILE        *f;
+  char        *ext;
+  int         i,j,l,r,nrun,nslow,ier;
+
+  if ( !BENCH_parsar(argc,argv,&par) ) return EXIT_FAILURE;
+
+  nrun = par.nne*par.nnmir*par.nnthreads;
+  run  = (BENCH_Run*)calloc(nrun,sizeof(BENCH_Run));
+  if ( !run ) return EXIT_FAILURE;
+
+  fprintf(stdout,"%10s %9s %8s %14s %10s %13s %9s %10s %14s\n","ne","nmir",
+          "threads","phase","wall (s)","elements/s","GB/s","RSS (MB)",
+          "bytes/element");
+
+  r   = 0;
+  ier = EXIT_SUCCESS;
+  for ( i=0; i<par.nne; ++i ) {
+    for ( j=0; j<par.nnmir; ++j ) {
+      for ( l=0; l<par.nnthreads; ++l, ++r ) {
+        BENCH_Run *cur = &run[r];
+        int       p;
+
+        cur->ne       = par.ne[i];
+        cur->nthreads = par.nthreads[l];
+        memcpy(cur->nmir,par.nmir[j],3*sizeof(int));
+        BENCH_spawn(&par,cur);
+
+        if ( !cur->ok ) {
+          fprintf(stderr,"  ## Error: run ne %ld, %d %d %d, %d threads"
+                  " failed.\n",cur->ne,cur->nmir[0],cur->nmir[1],cur->nmir[2],
+                  cur->nthreads);
+          ier = EXIT_FAILURE;
+          continue;
+        }
+        for ( p=0; p<BENCH_NPHASE; ++p ) {
+          BENCH_Phase *ph = &cur->phase[p];
+          if ( !ph->done ) continue;
+          fprintf(stdout,"%10ld %3d%3d%3d %8d %14s %10.4f %13.4e %9.3f %10.1f",
+                  cur->ne,cur->nmir[0],cur->nmir[1],cur->nmir[2],
+                  cur->nthreads,BENCH_phase[p],ph->wall,ph->nelem/ph->wall,
+                  ph->bytes/ph->wall/1e9,ph->rss);
+          if ( ph->src ) {
+            fprintf(stdout," %8.1f %5s",ph->bpe,BENCH_traffic[ph->src]);
+          }
+          fprintf(stdout,"\n");
+        }
+        /* Gain of the tiling */
+        fprintf(stdout,"%10s tiling: %.4f s saved, %.2fx faster than"
+                " untiled, %.1f bytes/element instead of %.1f (%s)\n","",
+                cur->phase[1].wall-cur->phase[2].wall,
+                cur->phase[1].wall/cur->phase[2].wall,cur->phase[2].bpe,
+                cur->phase[1].bpe,cur->phase[1].src == cur->phase[2].src ?
+                BENCH_traffic[cur->phase[2].src] : "perf and model mixed");
+      }
+    }
+  }
+
+  /* Results */
+  ext = strrchr(par.out,'.');
+  if ( !(f = fopen(par.out,"w")) ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",par.out);
+    free(run);
+    return EXIT_FAILURE;
+  }
+  BENCH_write(f,run,nrun,ext && !strcmp(ext,".json"));
+  fclose(f);
+
+  /* Baseline */
+  if ( par.baseline ) {
+    nslow = BENCH_compare(&par,run,nrun);
+    if ( nslow < 0 ) {
+      /* First run: store the baseline */
+      if ( !(f = fopen(par.baseline,"w")) ) {
+        fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",par.baseline);
+        free(run);
+        return EXIT_FAILURE;
+      }
+      BENCH_write(f,run,nrun,0);
+      fclose(f);
+      fprintf(stdout,"  %%%% Baseline stored in %s\n",par.baseline);
+    }
+    else if ( nslow ) {
+      fprintf(stdout,"  ## %d phase(s) slower than the baseline.\n",nslow);
+      ier = EXIT_FAILURE;
+    }
+  }
+
+  free(run);
+  return ier;
+}
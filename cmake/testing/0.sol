@@ -0,0 +1,2778 @@
+MeshVersionFormatted 2
+
+Dimension 3
+
+SolAtVertices
+2769
+3 1 2 3
+0.099 0.7 0.5 0 1.099 0.225 -0.6 2.099 0.2 3.099
+0.0723461 0.472717 0.456544 0.218436 1.07235 0.122222 -0.154281 2.07235 -0.0314728 3.07235
+0.0622609 0.350155 0.380742 0.00024572 1.06226 0.079892 -0.249909 2.06226 0.163977 3.06226
+0.0703063 0.450625 0.438969 0.0211748 1.07031 0.11557 -0.32945 2.07031 0.160516 3.07031
+0.0743917 0.493879 0.317005 0.0361163 1.07439 0.167688 -0.357763 2.07439 0.108985 3.07439
+0.0657816 0.397261 0.411328 0.0678926 1.06578 0.0957985 -0.229368 2.06578 0.105506 3.06578
+0.0640859 0.375312 0.348892 0.0585018 1.06409 0.100433 -0.21681 2.06409 0.0961658 3.06409
+0.063278 0.364389 0.422528 0.000225347 1.06328 0.0765625 -0.264164 2.06328 0.176533 3.06328
+0.058244 0.287124 0.465069 0.214745 1.05824 0.0272947 0.027621 2.05824 -0.0252243 3.05824
+0.0605225 0.324384 0.448064 0.000242227 1.06052 0.050176 -0.224142 2.06052 0.184177 3.06052
+0.0655263 0.394035 0.432751 0.0361596 1.06553 0.0888298 -0.257875 2.06553 0.143666 3.06553
+0.0605936 0.325478 0.391752 0.000394691 1.06059 0.064801 -0.225083 2.06059 0.167131 3.06059
+0.0668695 0.410725 0.410655 0.0533871 1.06687 0.102699 -0.257338 2.06687 0.119809 3.06687
+0.0504924 0.0701685 0.440661 0.695413 1.05049 -0.075081 0.725244 2.05049 -0.513215 3.05049
+0.0641665 0.376384 0.439513 0.0436231 1.06417 0.0783138 -0.232761 2.06417 0.138231 3.06417
+0.0647124 0.383568 0.407222 0.0415823 1.06471 0.0899785 -0.241986 2.06471 0.130584 3.06471
+0.0616921 0.341937 0.39976 1.27867e-47 1.06169 0.0710285 -0.241937 2.06169 0.169928 3.06169
+0.0629491 0.359849 0.44819 0.0314887 1.06295 0.067877 -0.22836 2.06295 0.152968 3.06295
+0.0606562 0.326439 0.419535 1.13291e-47 1.06066 0.0583357 -0.226439 2.06066 0.17586 3.06066
+0.05 -0.000152281 0.461989 0.00407338 1.05 -0.115573 0.104226 2.05 0.184523 3.05
+0.0625573 0.354363 0.44749 1.59536e-05 1.06256 0.065309 -0.254347 2.06256 0.184231 3.06256
+0.0635549 0.36817 0.429634 0.0638814 1.06355 0.0766765 -0.204289 2.06355 0.115009 3.06355
+0.060629 0.326021 0.422349 0.0423729 1.06063 0.0574233 -0.183648 2.06063 0.134332 3.06063
+0.0614947 0.339038 0.398384 0.0486586 1.06149 0.069923 -0.190379 2.06149 0.120857 3.06149
+0.0636048 0.368846 0.426222 0.0533888 1.0636 0.0778675 -0.215457 2.0636 0.124478 3.0636
+0.0669055 0.411163 0.301131 0.029178 1.06691 0.130299 -0.281985 2.06691 0.111161 3.06691
+0.0601882 0.319189 0.384058 0.00169334 1.06019 0.06358 -0.217496 2.06019 0.163524 3.06019
+0.0686794 0.432197 0.420343 0.00676852 1.06868 0.111013 -0.325428 2.06868 0.169334 3.06868
+0.0631285 0.362332 0.389187 0.0220556 1.06313 0.0838692 -0.240276 2.06313 0.144701 3.06313
+0.0612582 0.335532 0.397395 0.0290554 1.06126 0.0684172 -0.206477 2.06126 0.140163 3.06126
+0.0648346 0.385158 0.421671 0.0363986 1.06483 0.0871612 -0.248759 2.06483 0.140103 3.06483
+0.0645917 0.38199 0.422905 0.0481083 1.06459 0.0852688 -0.233882 2.06459 0.128763 3.06459
+0.0645577 0.381546 0.428754 0.0450956 1.06456 0.0835845 -0.23645 2.06456 0.133531 3.06456
+0.0631276 0.362321 0.392871 0.0476588 1.06313 0.0829427 -0.214662 2.06313 0.120203 3.06313
+0.0614278 0.338051 0.441971 0.0195191 1.06143 0.0585327 -0.218532 2.06143 0.163072 3.06143
+0.0633293 0.365093 0.443089 0.0469677 1.06333 0.0717742 -0.218125 2.06333 0.135959 3.06333
+0.0607153 0.327342 0.418705 0.02118 1.06072 0.0589948 -0.206162 2.06072 0.154431 3.06072
+0.0644119 0.37963 0.401048 0.00187607 1.06441 0.089553 -0.277754 2.06441 0.168438 3.06441
+0.0648195 0.384961 0.41183 0.037501 1.06482 0.089523 -0.24746 2.06482 0.136048 3.06482
+0.0633309 0.365115 0.446867 0.00803042 1.06333 0.0708408 -0.257085 2.06333 0.17603 3.06333
+0.0564126 0.25323 0.248891 0.120531 1.05641 0.0643923 -0.032699 2.05641 0.0041363 3.05641
+0.0625258 0.353919 0.481887 0.0135332 1.06253 0.0564877 -0.240386 2.06253 0.181033 3.06253
+0.0590534 0.300888 0.436651 0.0725943 1.05905 0.0412812 -0.128294 2.05905 0.108401 3.05905
+0.0647583 0.384166 0.415911 0.00266336 1.06476 0.0881053 -0.281503 2.06476 0.17211 3.06476
+0.0642645 0.377683 0.432528 0.0607447 1.06426 0.0807095 -0.216938 2.06426 0.119014 3.06426
+0.0647494 0.38405 0.416328 1.10236e-45 1.06475 0.087943 -0.28405 2.06475 0.174898 3.06475
+0.0594635 0.307628 0.42012 1.99863e-48 1.05946 0.048784 -0.207628 2.05946 0.176036 3.05946
+0.0641315 0.37592 0.399281 0.00362447 1.06413 0.0881397 -0.272296 2.06413 0.16616 3.06413
+0.0616479 0.341291 0.392604 0.00832038 1.06165 0.0724945 -0.232971 2.06165 0.159461 3.06165
+0.0643437 0.378731 0.437764 0.0387393 1.06434 0.0799245 -0.239992 2.06434 0.14259 3.06434
+0.0647167 0.383624 0.428582 0.0396571 1.06472 0.0846665 -0.243967 2.06472 0.138918 3.06472
+0.0643208 0.378429 0.399628 0.0362327 1.06432 0.0893075 -0.242196 2.06432 0.133656 3.06432
+0.0613237 0.336506 0.440661 0.00928489 1.06132 0.0580878 -0.227221 2.06132 0.172913 3.06132
+0.050458 0.0676782 0.20448 0.00576073 1.05046 -0.0172809 0.0380825 2.05046 0.105583 3.05046
+0.0655456 0.394279 0.158604 0.195982 1.06555 0.157489 -0.098297 2.06555 -0.0984008 3.06555
+0.0711788 0.460204 0.410514 0.0611834 1.07118 0.127474 -0.299021 2.07118 0.111971 3.07118
+0.0629944 0.360478 0.389226 0.0318576 1.06299 0.0829325 -0.22862 2.06299 0.13491 3.06299
+0.0621017 0.347875 0.39143 0.046391 1.0621 0.07608 -0.201484 2.0621 0.121038 3.0621
+0.0628833 0.358934 0.447944 7.17395e-51 1.06288 0.067481 -0.258934 2.06288 0.184383 3.06288
+0.063288 0.364527 0.447351 0.0393729 1.06329 0.0704257 -0.225154 2.06329 0.144832 3.06329
+0.0623427 0.351322 0.396188 0.0505344 1.06234 0.076614 -0.200788 2.06234 0.118322 3.06234
+0.0641112 0.375649 0.441124 0.0342635 1.06411 0.0775435 -0.241386 2.06411 0.148074 3.06411
+0.0606428 0.326233 0.416444 0.00586413 1.06064 0.0590055 -0.220369 2.06064 0.169069 3.06064
+0.0613218 0.336478 0.441408 0.00919064 1.06132 0.057887 -0.227287 2.06132 0.173232 3.06132
+0.061339 0.336735 0.441494 0.00925902 1.06134 0.057994 -0.227476 2.06134 0.173189 3.06134
+0.0634554 0.366816 0.391105 0.0170871 1.06346 0.0856317 -0.249729 2.06346 0.150244 3.06346
+0.060786 0.328421 0.43102 0.0344191 1.06079 0.0564555 -0.194002 2.06079 0.144887 3.06079
+0.099 0.7 0.4 0 1.099 0.25 -0.6 2.099 0.17 3.099
+0.0617105 0.342207 0.445353 0.00126547 1.06171 0.0597652 -0.240942 2.06171 0.18234 3.06171
+0.0500541 0.0232548 0.477268 0.0124074 1.05005 -0.10769 0.0891526 2.05005 0.180773 3.05005
+0.062854 0.358524 0.431508 0.0479917 1.06285 0.071385 -0.210532 2.06285 0.131461 3.06285
+0.0611518 0.333943 0.5 0.167522 1.06115 0.0419715 -0.066421 2.06115 0.032478 3.06115
+0.0634305 0.366476 0.390696 0.0154382 1.06343 0.085564 -0.251038 2.06343 0.151771 3.06343
+0.0609094 0.330294 0.403689 0.0430823 1.06091 0.0642247 -0.187212 2.06091 0.128024 3.06091
+0.0610836 0.332921 0.406452 0.000443619 1.06108 0.0648475 -0.232477 2.06108 0.171492 3.06108
+0.0613282 0.336573 0.441651 0.0093263 1.06133 0.0578738 -0.227247 2.06133 0.173169 3.06133
+0.0636301 0.36919 0.392408 0.0412894 1.06363 0.086493 -0.227901 2.06363 0.126433 3.06363
+0.0609004 0.330158 0.405036 0.00185405 1.0609 0.06382 -0.228304 2.0609 0.169657 3.0609
+0.0620727 0.347458 0.406983 0.0539196 1.06207 0.0719832 -0.193538 2.06207 0.118175 3.06207
+0.05 -2.53509e-07 0.208284 0.127532 1.05 -0.0520711 0.227532 2.05 -0.0150468 3.05
+0.0618714 0.344549 0.446852 0.0362836 1.06187 0.0605615 -0.208265 2.06187 0.147772 3.06187
+0.0613837 0.337397 0.395259 0.0377844 1.06138 0.0698837 -0.199613 2.06138 0.130793 3.06138
+0.0644372 0.379963 0.412083 0.0488597 1.06444 0.0869608 -0.231103 2.06444 0.124765 3.06444
+0.061081 0.332882 0.414415 0.0502988 1.06108 0.0628373 -0.182583 2.06108 0.124026 3.06108
+0.0801799 0.549363 0.455051 0.00168635 1.08018 0.160919 -0.447677 2.08018 0.184829 3.08018
+0.0640932 0.375409 0.435204 5.4675e-46 1.06409 0.0789035 -0.275409 2.06409 0.180561 3.06409
+0.0635488 0.368087 0.393607 0.00207408 1.06355 0.0856418 -0.266013 2.06355 0.166008 3.06355
+0.0629223 0.359475 0.390672 0.00364723 1.06292 0.0820695 -0.255828 2.06292 0.163554 3.06292
+0.061336 0.33669 0.440969 0.027515 1.06134 0.0581027 -0.209175 2.06134 0.154776 3.06134
+0.0636769 0.369823 0.413825 0.0538903 1.06368 0.0814553 -0.215933 2.06368 0.120257 3.06368
+0.0630531 0.361291 0.402784 0.0530733 1.06305 0.0799495 -0.208218 2.06305 0.117762 3.06305
+0.062149 0.348554 0.394747 0.00102461 1.06215 0.0755902 -0.247529 2.06215 0.167399 3.06215
+0.0646848 0.383207 0.430858 0.0182821 1.06468 0.083889 -0.264925 2.06468 0.160975 3.06468
+0.0610257 0.33205 0.27799 6.63307e-49 1.06103 0.0965275 -0.23205 2.06103 0.133397 3.06103
+0.0743001 0.492951 0.5 0.0162397 1.0743 0.121475 -0.376711 2.0743 0.18376 3.0743
+0.0539048 0.197605 0.46865 0.225173 1.0539 -0.01836 0.127568 2.0539 -0.034578 3.0539
+0.05 -8.45678e-18 0.4505 2.31825e-69 1.05 -0.112625 0.1 2.05 0.18515 3.05
+0.0677073 0.420801 0.398614 0.0933844 1.06771 0.110747 -0.227417 2.06771 0.0761998 3.06771
+0.0591013 0.301683 0.444169 0.050757 1.0591 0.0397992 -0.150926 2.0591 0.132494 3.0591
+0.0648719 0.385641 0.417219 0.0148638 1.06487 0.0885158 -0.270777 2.06487 0.160302 3.06487
+0.0647201 0.383668 0.428022 0.0242337 1.06472 0.0848285 -0.259434 2.06472 0.154173 3.06472
+0.086 0.6 0.5 0 1.086 0.175 -0.5 2.086 0.2 3.086
+0.0568999 0.262676 0.346712 0.0393042 1.0569 0.04466 -0.123372 2.0569 0.114709 3.0569
+0.0647446 0.383987 0.412267 0.00068141 1.06474 0.0889268 -0.283306 2.06474 0.172999 3.06474
+0.0638932 0.372735 0.395994 0.000893228 1.06389 0.087369 -0.271842 2.06389 0.167905 3.06389
+0.0637069 0.370228 0.394536 2.81434e-47 1.06371 0.08648 -0.270228 2.06371 0.168361 3.06371
+0.0700148 0.447379 0.395125 0.0136863 1.07001 0.124908 -0.333693 2.07001 0.154851 3.07001
+0.0639845 0.373958 0.442215 0.0271252 1.06398 0.0764253 -0.246833 2.06398 0.155539 3.06398
+0.0632243 0.363653 0.390638 0.0361218 1.06322 0.084167 -0.227531 2.06322 0.13107 3.06322
+0.0646518 0.382776 0.284467 0.0463617 1.06465 0.120271 -0.236414 2.06465 0.0889784 3.06465
+0.0648024 0.38474 0.42542 0.042372 1.0648 0.086015 -0.242368 2.0648 0.135254 3.0648
+0.0611835 0.334418 0.43429 0.0045138 1.06118 0.0586365 -0.229904 2.06118 0.175773 3.06118
+0.0611939 0.334573 0.436889 0.0019462 1.06119 0.0580642 -0.232627 2.06119 0.179121 3.06119
+0.0607598 0.328021 0.425667 0.00320105 1.06076 0.0575937 -0.22482 2.06076 0.174499 3.06076
+0.0647551 0.384124 0.413881 0.0066078 1.06476 0.0885918 -0.277516 2.06476 0.167556 3.06476
+0.0647293 0.383787 0.419569 0.0109619 1.06473 0.0870012 -0.272825 2.06473 0.164909 3.06473
+0.0642023 0.376859 0.438095 0.00816435 1.0642 0.0789057 -0.268695 2.0642 0.173264 3.0642
+0.0634353 0.366542 0.445941 0.00761902 1.06344 0.0717857 -0.258923 2.06344 0.176163 3.06344
+0.0505827 0.0763358 0.454655 0.00711834 1.05058 -0.0754959 0.0307825 2.05058 0.179278 3.05058
+0.0521577 0.146892 0.355366 0.254772 1.05216 -0.0153955 0.20788 2.05216 -0.0981622 3.05216
+0.0606955 0.327039 0.41069 0.035307 1.0607 0.060847 -0.191732 2.0607 0.1379 3.0607
+0.0624086 0.352259 0.388819 0.0409708 1.06241 0.0789247 -0.211288 2.06241 0.125675 3.06241
+0.0640049 0.374231 0.429522 0.0375273 1.064 0.079735 -0.236704 2.064 0.141329 3.064
+0.0615449 0.339777 0.393724 0.0434498 1.06154 0.0714575 -0.196327 2.06154 0.124667 3.06154
+0.0540914 0.202273 0.500001 0.067281 1.05409 -0.0238638 -0.034992 2.05409 0.132719 3.05409
+0.0647984 0.384686 0.426496 0.03133 1.0648 0.085719 -0.253356 2.0648 0.146619 3.0648
+0.0624254 0.352498 0.388875 0.0276594 1.06243 0.0790302 -0.224839 2.06243 0.139003 3.06243
+0.0674706 0.417979 0.369456 6.34588e-45 1.06747 0.116625 -0.317979 2.06747 0.160837 3.06747
+0.0635748 0.368439 0.391408 0.0282737 1.06357 0.0863675 -0.240165 2.06357 0.139149 3.06357
+0.0644124 0.379637 0.399987 0.0300369 1.06441 0.0898218 -0.2496 2.06441 0.139959 3.06441
+0.0612314 0.335133 0.434209 0.0485267 1.06123 0.0590143 -0.186606 2.06123 0.131736 3.06123
+0.0621842 0.349058 0.424519 0.0551115 1.06218 0.0683992 -0.193946 2.06218 0.122244 3.06218
+0.0628253 0.358124 0.414975 0.0557342 1.06283 0.0753183 -0.20239 2.06283 0.118758 3.06283
+0.0609937 0.331567 0.400879 0.0222043 1.06099 0.0655638 -0.209363 2.06099 0.148059 3.06099
+0.0643352 0.378618 0.399223 0.0240616 1.06434 0.0895033 -0.254556 2.06434 0.145705 3.06434
+0.0635731 0.368417 0.445883 0.0155744 1.06357 0.0727378 -0.252843 2.06357 0.16819 3.06357
+0.05 -1.14756e-08 0.133912 0.00153552 1.05 -0.033478 0.101536 2.05 0.0886381 3.05
+0.0638618 0.372314 0.443669 0.0213698 1.06386 0.0752397 -0.250944 2.06386 0.161731 3.06386
+0.0606178 0.325849 0.417045 0.0276797 1.06062 0.0586633 -0.198169 2.06062 0.147434 3.06062
+0.0641344 0.375958 0.432294 0.0491382 1.06413 0.0799055 -0.22682 2.06413 0.13055 3.06413
+0.0739093 0.488972 0.179715 8.20066e-48 1.07391 0.199557 -0.388972 2.07391 0.103915 3.07391
+0.0621077 0.347961 0.447219 0.0440321 1.06211 0.0621758 -0.203929 2.06211 0.140134 3.06211
+0.0644552 0.3802 0.435187 0.0126306 1.06446 0.0813032 -0.267569 2.06446 0.167925 3.06446
+0.0626937 0.356283 0.448546 0.0245529 1.06269 0.066005 -0.23173 2.06269 0.160011 3.06269
+0.0644295 0.379862 0.431471 0.00192194 1.06443 0.0820632 -0.27794 2.06443 0.177519 3.06443
+0.06426 0.377624 0.437915 0.00431197 1.06426 0.0793333 -0.273312 2.06426 0.177063 3.06426
+0.0621916 0.349165 0.389836 0.0344121 1.06219 0.0771235 -0.214753 2.06219 0.132539 3.06219
+0.0626557 0.355748 0.448634 0.0192359 1.06266 0.0657155 -0.236512 2.06266 0.165354 3.06266
+0.0609506 0.330917 0.403667 0.0106253 1.06095 0.0645418 -0.220292 2.06095 0.160475 3.06095
+0.0617864 0.343313 0.392728 0.0154888 1.06179 0.0734745 -0.227824 2.06179 0.15233 3.06179
+0.0634016 0.366082 0.446767 0.00694048 1.0634 0.0713493 -0.259142 2.0634 0.17709 3.0634
+0.063798 0.371457 0.444579 0.00218334 1.0638 0.0745837 -0.269274 2.0638 0.18119 3.0638
+0.0638082 0.371594 0.438687 0.000919889 1.06381 0.0761252 -0.270674 2.06381 0.180686 3.06381
+0.0626876 0.356197 0.445212 0.00119666 1.06269 0.0667955 -0.255 2.06269 0.182367 3.06269
+0.062329 0.351126 0.446425 0.00343726 1.06233 0.0639567 -0.247689 2.06233 0.18049 3.06233
+0.0531157 0.176514 0.275286 0.0296187 1.05312 0.0194355 -0.0468953 2.05312 0.102967 3.05312
+0.0558839 0.242567 0.433624 0.0205373 1.05588 0.0128775 -0.12203 2.05588 0.15955 3.05588
+0.0637755 0.371154 0.39467 0.00692582 1.06378 0.0869095 -0.264228 2.06378 0.161475 3.06378
+0.0609069 0.330256 0.43041 0.0139595 1.06091 0.0575255 -0.216297 2.06091 0.165163 3.06091
+0.0620268 0.346797 0.446438 0.0142628 1.06203 0.061789 -0.232534 2.06203 0.169669 3.06203
+0.0612024 0.334699 0.433882 0.00038709 1.0612 0.058879 -0.234312 2.0612 0.179778 3.0612
+0.0629799 0.360276 0.430417 0.0543752 1.06298 0.0725337 -0.205901 2.06298 0.12475 3.06298
+0.0611281 0.333589 0.401714 0.00234571 1.06113 0.066366 -0.231243 2.06113 0.168168 3.06113
+0.0609669 0.331163 0.401432 0.0026074 1.06097 0.0652235 -0.228556 2.06097 0.167822 3.06097
+0.0621379 0.348395 0.446441 0.000380174 1.06214 0.0625873 -0.248015 2.06214 0.183552 3.06214
+0.0646081 0.382206 0.404639 0.0123729 1.06461 0.0899432 -0.269833 2.06461 0.159019 3.06461
+0.0642627 0.377659 0.398476 0.0178177 1.06426 0.0892105 -0.259841 2.06426 0.151725 3.06426
+0.0625736 0.354593 0.402669 0.0223835 1.06257 0.0766292 -0.232209 2.06257 0.148417 3.06257
+0.0612893 0.335996 0.400349 0.016106 1.06129 0.0679108 -0.21989 2.06129 0.153999 3.06129
+0.0609932 0.331561 0.40088 0.0221287 1.06099 0.0655605 -0.209432 2.06099 0.148135 3.06099
+0.0615247 0.33948 0.393411 0.0167972 1.06152 0.0713872 -0.222683 2.06152 0.151226 3.06152
+0.0643334 0.378594 0.423862 0.0591282 1.06433 0.0833315 -0.219466 2.06433 0.11803 3.06433
+0.0646076 0.382198 0.432081 0.035825 1.06461 0.0830787 -0.246373 2.06461 0.143799 3.06461
+0.0606526 0.326384 0.419154 0.000726335 1.06065 0.0584035 -0.225658 2.06065 0.17502 3.06065
+0.0646025 0.382132 0.404459 0.0119355 1.0646 0.0899513 -0.270197 2.0646 0.159402 3.0646
+0.0680231 0.424536 0.457685 0.0431978 1.06802 0.0978468 -0.281338 2.06802 0.144108 3.06802
+0.0526717 0.163454 0.151555 0.192599 1.05267 0.0438382 0.129145 2.05267 -0.0971325 3.05267
+0.0725675 0.475052 0.412876 0.0322519 1.07257 0.134307 -0.3428 2.07257 0.141611 3.07257
+0.0742809 0.492756 0.398016 0.213718 1.07428 0.146874 -0.179038 2.07428 -0.0443132 3.07428
+0.0731687 0.481338 0.442621 0.0474088 1.07317 0.130014 -0.333929 2.07317 0.135377 3.07317
+0.0529617 0.172097 0.384674 0.102435 1.05296 -0.01012 0.030338 2.05296 0.0629672 3.05296
+0.0539989 0.199971 -6.89024e-06 0.278714 1.054 0.0999872 0.178743 2.054 -0.228716 3.054
+0.0698716 0.445775 0.421539 0.0499329 1.06987 0.117503 -0.295842 2.06987 0.126529 3.06987
+0.063955 0.373563 0.40573 0.0587828 1.06395 0.085349 -0.21478 2.06395 0.112936 3.06395
+0.0541323 0.203281 0.353139 0.12654 1.05413 0.0133557 0.023259 2.05413 0.0294017 3.05413
+0.0657081 0.396334 0.443131 0.0378791 1.06571 0.0873843 -0.258455 2.06571 0.14506 3.06571
+0.065159 0.389346 0.425022 0.0521131 1.06516 0.0884175 -0.237233 2.06516 0.125393 3.06516
+0.0791044 0.539485 0.427716 0.0323488 1.0791 0.162813 -0.407136 2.0791 0.145966 3.0791
+0.0605263 0.324442 0.437446 0.0715658 1.06053 0.0528595 -0.152876 2.06053 0.109668 3.06053
+0.0620414 0.347007 0.444652 0.0708504 1.06204 0.0623405 -0.176157 2.06204 0.112545 3.06204
+0.054601 0.2145 0.168415 0.0921329 1.0546 0.0651462 -0.0223671 2.0546 0.0083916 3.0546
+0.0589069 0.298444 0.406658 0.0606012 1.05891 0.0475575 -0.137843 2.05891 0.111396 3.05891
+0.0648938 0.385925 0.419179 0.0561387 1.06489 0.0881678 -0.229786 2.06489 0.119615 3.06489
+0.052072 0.143944 0.443127 0.603002 1.05207 -0.0388098 0.559058 2.05207 -0.420064 3.05207
+0.0838434 0.581751 0.414264 0.0850562 1.08384 0.18731 -0.396695 2.08384 0.089223 3.08384
+0.0666275 0.407768 0.418886 0.0590219 1.06663 0.0991625 -0.248746 2.06663 0.116644 3.06663
+0.0651795 0.389608 0.46712 0.0294643 1.06518 0.078024 -0.260144 2.06518 0.160672 3.06518
+0.064787 0.384538 0.414553 0.0654772 1.06479 0.0886307 -0.219061 2.06479 0.108889 3.06479
+0.0664452 0.405526 0.46721 0.214929 1.06645 0.0859605 -0.090597 2.06645 -0.024766 3.06645
+0.050581 0.0762259 0.408093 0.121252 1.05058 -0.0639103 0.145026 2.05058 0.0511759 3.05058
+0.0501763 0.0419864 0.430807 0.0691953 1.05018 -0.0867085 0.127209 2.05018 0.110047 3.05018
+0.0524461 0.156399 0.36717 0.133273 1.05245 -0.013593 0.076874 2.05245 0.026878 3.05245
+0.0591993 0.303303 0.38622 0.000448982 1.0592 0.0550965 -0.202854 2.0592 0.165417 3.0592
+0.0865183 0.604303 0.43786 0.166455 1.08652 0.192687 -0.337848 2.08652 0.014903 3.08652
+0.0526037 0.16136 0.467386 0.214065 1.0526 -0.0361665 0.152705 2.0526 -0.0238492 3.0526
+0.0655298 0.394078 0.439966 0.000576551 1.06553 0.0870475 -0.293501 2.06553 0.181413 3.06553
+0.078378 0.53271 0.438446 0.0216198 1.07838 0.156744 -0.41109 2.07838 0.159914 3.07838
+0.063306 0.364774 0.293324 0.25 1.06331 0.109056 -0.014774 2.06331 -0.112003 3.06331
+0.0661271 0.401586 0.362922 0.130852 1.06613 0.110062 -0.170734 2.06613 0.0280246 3.06613
+0.0648092 0.384827 0.366826 0.0957249 1.06481 0.100707 -0.189102 2.06481 0.0643229 3.06481
+0.0691565 0.437682 0.392854 6.43391e-45 1.06916 0.120628 -0.337682 2.06916 0.167856 3.06916
+0.0640372 0.374662 0.487484 0.0200442 1.06404 0.06546 -0.254618 2.06404 0.176201 3.06404
+0.05 5.85487e-09 0.233779 0.215797 1.05 -0.0584447 0.315797 2.05 -0.0956633 3.05
+0.051928 0.138854 0.431088 0.221993 1.05193 -0.038345 0.183139 2.05193 -0.0426666 3.05193
+0.0629027 0.359203 0.376602 0.064409 1.0629 0.085451 -0.194794 2.0629 0.0985716 3.0629
+0.0515726 0.125402 0.446269 0.259815 1.05157 -0.0488662 0.234413 2.05157 -0.0759343 3.05157
+0.0584312 0.290365 0.5 0.0760088 1.05843 0.0201825 -0.114356 2.05843 0.123991 3.05843
+0.060331 0.321419 0.399251 0.083248 1.06033 0.0608967 -0.138171 2.06033 0.0865273 3.06033
+0.0623592 0.351556 0.414275 0.0436377 1.06236 0.0722092 -0.207918 2.06236 0.130645 3.06236
+0.0666792 0.408402 0.410048 0.047145 1.06668 0.101689 -0.261257 2.06668 0.125869 3.06668
+0.0709247 0.457435 0.404163 0.0288648 1.07092 0.127677 -0.32857 2.07092 0.142384 3.07092
+0.0812315 0.558851 0.454721 0.00905632 1.08123 0.165745 -0.449795 2.08123 0.17736 3.08123
+0.0602557 0.320245 0.476327 0.117734 1.06026 0.0410408 -0.102511 2.06026 0.0751641 3.06026
+0.0555194 0.234933 0.470302 0.0627817 1.05552 -0.000109 -0.0721513 2.05552 0.128309 3.05552
+0.0563402 0.251797 0.413228 0.0922185 1.05634 0.0225915 -0.0595785 2.05634 0.0817499 3.05634
+0.0622426 0.349894 0.408567 0.0369543 1.06224 0.0728052 -0.21294 2.06224 0.135616 3.06224
+0.0822078 0.567519 0.5 0.102138 1.08221 0.158759 -0.365381 2.08221 0.097862 3.08221
+0.07234 0.472652 0.442924 0.0721356 1.07234 0.125595 -0.300516 2.07234 0.110742 3.07234
+0.065022 0.387583 0.38088 0.0681351 1.06502 0.0985715 -0.219448 2.06502 0.0961289 3.06502
+0.0583318 0.288649 0.263439 1.28583e-49 1.05833 0.0784647 -0.188649 2.05833 0.129032 3.05833
+0.0646321 0.382519 0.408911 0.0452605 1.06463 0.0890317 -0.237258 2.06463 0.127413 3.06463
+0.0652129 0.390037 0.428946 0.0460385 1.06521 0.087782 -0.243999 2.06521 0.132645 3.06521
+0.0573359 0.270849 0.416152 0.153775 1.05734 0.0313865 -0.017074 2.05734 0.0210706 3.05734
+0.0627571 0.357171 0.402828 0.0639531 1.06276 0.0778785 -0.193218 2.06276 0.106895 3.06276
+0.05 6.62674e-05 0.332463 0.013629 1.05 -0.0830826 0.113563 2.05 0.13611 3.05
+0.0646411 0.382637 0.451155 0.0228281 1.06464 0.0785298 -0.259809 2.06464 0.162518 3.06464
+0.0506728 0.0820236 0.404678 0.078658 1.05067 -0.0601577 0.0966344 2.05067 0.0927454 3.05067
+0.072359 0.472853 0.355627 0.0229546 1.07236 0.14752 -0.349898 2.07236 0.133734 3.07236
+0.0704633 0.452364 0.403638 0.0201347 1.07046 0.125273 -0.332229 2.07046 0.150957 3.07046
+0.0626414 0.355547 0.387458 0.0529873 1.06264 0.080909 -0.20256 2.06264 0.11325 3.06264
+0.0524011 0.154953 0.374441 0.37337 1.0524 -0.0161338 0.318417 2.0524 -0.211038 3.0524
+0.0523852 0.154442 0.376332 0.0751628 1.05239 -0.016862 0.0207208 2.05239 0.0877368 3.05239
+0.0521047 0.145075 0.474795 0.00253446 1.0521 -0.0461613 -0.0425405 2.0521 0.189904 3.0521
+0.0744196 0.494162 0.439611 0.0633238 1.07442 0.137178 -0.330838 2.07442 0.118559 3.07442
+0.057399 0.272011 0.381817 0.0487262 1.0574 0.0405512 -0.123285 2.0574 0.115819 3.0574
+0.0808558 0.55548 0.385178 0.0418638 1.08086 0.181445 -0.413616 2.08086 0.12369 3.08086
+0.0671955 0.414675 0.347208 0.06692 1.0672 0.120536 -0.247755 2.0672 0.0872424 3.0672
+0.0711921 0.460349 0.448596 0.0615545 1.07119 0.118026 -0.298795 2.07119 0.123024 3.07119
+0.0508167 0.0903701 0.466431 0.386256 1.05082 -0.0714227 0.395886 2.05082 -0.196327 3.05082
+0.05 0.000150466 0.49977 0.0314609 1.05 -0.124867 0.13131 2.05 0.16847 3.05
+0.0585065 0.29166 0.304575 0.115708 1.05851 0.0696862 -0.075952 2.05851 0.0256645 3.05851
+0.0633806 0.365795 0.414968 0.043508 1.06338 0.0791555 -0.222287 2.06338 0.130982 3.06338
+0.0580569 0.283848 0.397514 0.0567745 1.05806 0.0425455 -0.127073 2.05806 0.11248 3.05806
+0.0703092 0.450658 0.457014 0.0452096 1.07031 0.111076 -0.305448 2.07031 0.141895 3.07031
+0.0607491 0.327858 0.479141 0.0974338 1.06075 0.0441437 -0.130424 2.06075 0.0963085 3.06075
+0.0773487 0.52296 0.425466 0.00576763 1.07735 0.155113 -0.417192 2.07735 0.171872 3.07735
+0.0581964 0.286293 0.438777 0.0983233 1.0582 0.0334523 -0.0879697 2.0582 0.0833098 3.0582
+0.0584927 0.291422 0.470537 0.16085 1.05849 0.0280768 -0.030572 2.05849 0.0303111 3.05849
+0.063848 0.372129 0.402351 0.0502386 1.06385 0.0854767 -0.22189 2.06385 0.120467 3.06385
+0.0519631 0.140112 0.376175 0.19692 1.05196 -0.0239878 0.156808 2.05196 -0.0340675 3.05196
+0.0650296 0.38768 0.326358 0.116823 1.06503 0.112251 -0.170857 2.06503 0.0310844 3.06503
+0.0642089 0.376947 0.44129 0.0967884 1.06421 0.078151 -0.180159 2.06421 0.0855986 3.06421
+0.061967 0.345933 0.439108 0.103576 1.06197 0.0631895 -0.142357 2.06197 0.0781564 3.06197
+0.0664525 0.405617 0.0492333 0.0601873 1.06645 0.1905 -0.24543 2.06645 0.00458269 3.06645
+0.0691442 0.437541 0.384663 0.156693 1.06914 0.122605 -0.180848 2.06914 0.0087059 3.06914
+0.0614341 0.338144 0.276636 0.124455 1.06143 0.099913 -0.113689 2.06143 0.0085358 3.06143
+0.054 0.200001 0.500008 0.257794 1.054 -0.0250015 0.157793 2.054 -0.0577916 3.054
+0.0591283 0.302132 0.399262 0.00152406 1.05913 0.0512505 -0.200608 2.05913 0.168255 3.05913
+0.0503272 0.0572018 0.406566 0.0189936 1.05033 -0.0730406 0.0617918 2.05033 0.152976 3.05033
+0.05617 0.248395 0.0547798 0.196604 1.05617 0.110503 0.048209 2.05617 -0.13017 3.05617
+0.0660006 0.400007 0.343358 0.0492156 1.066 0.114164 -0.250791 2.066 0.103792 3.066
+0.0672344 0.415144 0.474821 0.00538236 1.06723 0.0888668 -0.309762 2.06723 0.187064 3.06723
+0.0501759 0.0419431 0.381431 0.0855407 1.05018 -0.0743862 0.143598 2.05018 0.0788886 3.05018
+0.0666336 0.407843 0.378387 0.0447882 1.06663 0.109325 -0.263055 2.06663 0.118728 3.06663
+0.0580218 0.283228 0.415493 0.0595433 1.05802 0.0377407 -0.123685 2.05802 0.115105 3.05802
+0.0639007 0.372836 0.412609 0.0342476 1.0639 0.0832657 -0.238588 2.0639 0.139535 3.0639
+0.0660682 0.400851 0.439363 0.0218586 1.06607 0.0905848 -0.278992 2.06607 0.15995 3.06607
+0.0694237 0.440723 0.378065 0.197268 1.06942 0.125845 -0.143455 2.06942 -0.0338485 3.06942
+0.0649052 0.386073 0.45524 0.0325812 1.06491 0.0792265 -0.253492 2.06491 0.153991 3.06491
+0.0521057 0.14511 0.285294 0.0393057 1.05211 0.0012315 -0.0058043 2.05211 0.0962825 3.05211
+0.0621041 0.347909 0.359465 0.0692931 1.0621 0.0840883 -0.178616 2.0621 0.0885464 3.0621
+0.0617365 0.342585 0.326355 0.224269 1.06174 0.0897037 -0.018316 2.06174 -0.0763625 3.06174
+0.0619693 0.345967 0.40312 0.176161 1.06197 0.0722035 -0.069806 2.06197 -0.005225 3.06197
+0.0547593 0.218158 0.420165 0.0671629 1.05476 0.00403775 -0.0509951 2.05476 0.108887 3.05476
+0.0630971 0.361899 0.390051 0.0654375 1.0631 0.0834368 -0.196462 2.0631 0.101578 3.0631
+0.071203 0.460467 0.401938 0.120736 1.0712 0.129749 -0.239731 2.0712 0.0498454 3.0712
+0.0597955 0.312977 0.352664 0.0312996 1.0598 0.0683225 -0.181677 2.0598 0.1245 3.0598
+0.0708441 0.456553 0.456683 0.0780553 1.07084 0.114106 -0.278498 2.07084 0.10895 3.07084
+0.0610272 0.332073 0.452843 0.0457835 1.06103 0.0528258 -0.186289 2.06103 0.140069 3.06103
+0.0592311 0.303828 0.32529 0.0393646 1.05923 0.0705915 -0.164463 2.05923 0.108222 3.05923
+0.069344 0.439818 0.352486 0.0246887 1.06934 0.131788 -0.315129 2.06934 0.131057 3.06934
+0.062761 0.357226 0.436525 0.0758442 1.06276 0.0694817 -0.181382 2.06276 0.105113 3.06276
+0.0553463 0.231221 0.223324 0.193286 1.05535 0.0597795 0.062065 2.05535 -0.0762888 3.05535
+0.099 0.7 0.1 0 1.099 0.325 -0.6 2.099 0.08 3.099
+0.0863193 0.602655 0.5 0.00947931 1.08632 0.176328 -0.493176 2.08632 0.190521 3.08632
+0.0636854 0.369938 0.465444 0.0872125 1.06369 0.068608 -0.182725 2.06369 0.102421 3.06369
+0.06277 0.357351 0.35113 0.0567874 1.06277 0.090893 -0.200564 2.06277 0.0985516 3.06277
+0.05 -1.13123e-08 0.07536 0.0163578 1.05 -0.01884 0.116358 2.05 0.0562502 3.05
+0.0672354 0.415155 0.417943 0.0690234 1.06724 0.103092 -0.246132 2.06724 0.106359 3.06724
+0.0652329 0.390294 0.369644 0.0155511 1.06523 0.102736 -0.274743 2.06523 0.145342 3.06523
+0.0651038 0.388636 0.403817 0.0555097 1.0651 0.0933637 -0.233126 2.0651 0.115635 3.0651
+0.0690067 0.435967 0.391506 0.0438314 1.06901 0.120107 -0.292136 2.06901 0.12362 3.06901
+0.0507587 0.0871008 1.17976e-07 0.144264 1.05076 0.0435504 0.157163 2.05076 -0.094264 3.05076
+0.058507 0.291667 0.328685 0.0793852 1.05851 0.0636623 -0.112282 2.05851 0.0692203 3.05851
+0.0503302 0.0574656 0.334739 0.678178 1.05033 -0.0549519 0.720712 2.05033 -0.527756 3.05033
+0.0634875 0.367254 0.406409 0.0692131 1.06349 0.0820248 -0.198041 2.06349 0.10271 3.06349
+0.0641777 0.376532 0.443917 0.0578816 1.06418 0.0772867 -0.21865 2.06418 0.125294 3.06418
+0.0628806 0.358896 0.3543 0.0869314 1.06288 0.090873 -0.171965 2.06288 0.0693586 3.06288
+0.0657466 0.39682 0.426786 0.053589 1.06575 0.0917135 -0.243231 2.06575 0.124447 3.06575
+0.0507275 0.0852958 0.286074 0.0130431 1.05073 -0.0288706 0.0277473 2.05073 0.122779 3.05073
+0.0539999 0.199999 3.52714e-07 0.259266 1.054 0.0999994 0.159267 2.054 -0.209266 3.054
+0.0656826 0.396012 0.237826 0.203056 1.06568 0.138549 -0.092956 2.06568 -0.0817082 3.06568
+0.0502225 0.0471675 0.387826 0.204776 1.05022 -0.0733728 0.257609 2.05022 -0.0384282 3.05022
+0.0583209 0.288461 0.177586 2.11709e-54 1.05832 0.099834 -0.188461 2.05832 0.103276 3.05832
+0.0508501 0.0922027 0.449204 0.230837 1.05085 -0.0661996 0.238634 2.05085 -0.0460758 3.05085
+0.090185 0.633917 0.119639 7.59965e-48 1.09018 0.287049 -0.533917 2.09018 0.0858917 3.09018
+0.0932523 0.657665 0.450941 0.0508866 1.09325 0.216097 -0.506778 2.09325 0.134396 3.09325
+0.0688962 0.434697 0.320287 0.0207169 1.0689 0.137277 -0.31398 2.0689 0.125369 3.0689
+0.059627 0.310275 0.361583 0.0472533 1.05963 0.0647418 -0.163022 2.05963 0.111222 3.05963
+0.0652263 0.390209 0.34906 0.0293834 1.06523 0.107839 -0.260826 2.06523 0.125335 3.06523
+0.0695196 0.44181 0.377877 0.010041 1.06952 0.126436 -0.331769 2.06952 0.153322 3.06952
+0.0551445 0.226814 0.306518 0.0379157 1.05514 0.0367775 -0.0888983 2.05514 0.10404 3.05514
+0.077529 0.524681 0.405045 0.0422973 1.07753 0.161079 -0.382384 2.07753 0.129216 3.07753
+0.0558715 0.242312 0.337917 0.00395513 1.05587 0.0366767 -0.138357 2.05587 0.14742 3.05587
+0.0523014 0.151704 0.454023 0.179647 1.0523 -0.0376537 0.127943 2.0523 0.0065599 3.0523
+0.0539999 0.199998 0.500037 0.317651 1.054 -0.0250102 0.217653 2.054 -0.11764 3.054
+0.0760105 0.510005 0.377206 0.0183591 1.07601 0.160701 -0.391646 2.07601 0.144803 3.07601
+0.0650599 0.38807 0.341566 0.0680057 1.06506 0.108644 -0.220064 2.06506 0.0844641 3.06506
+0.051737 0.131794 0.36254 0.163673 1.05174 -0.024738 0.131879 2.05174 -0.004911 3.05174
+0.0586903 0.294793 0.366108 0.0382596 1.05869 0.0558695 -0.156533 2.05869 0.121573 3.05869
+0.0636984 0.370113 0.410738 0.0484014 1.0637 0.082372 -0.221712 2.0637 0.12482 3.0637
+0.0739002 0.488878 0.422779 0.25 1.0739 0.138744 -0.138878 2.0739 -0.0731663 3.0739
+0.060423 0.322847 0.457367 0.102382 1.06042 0.0470817 -0.120465 2.06042 0.0848281 3.06042
+0.0583189 0.288425 0.375449 0.0455015 1.05832 0.0503502 -0.142923 2.05832 0.117133 3.05832
+0.0805336 0.552572 0.366647 0.0863705 1.08053 0.184624 -0.366201 2.08053 0.0736236 3.08053
+0.0669043 0.411148 0.5 0.149572 1.0669 0.080574 -0.161576 2.0669 0.050428 3.0669
+0.0524963 0.157997 0.459391 0.140162 1.0525 -0.0358492 0.082165 2.0525 0.0476553 3.0525
+0.0629069 0.359262 0.380825 0.0364698 1.06291 0.0844248 -0.222792 2.06291 0.127778 3.06291
+0.0723972 0.473257 0.32849 0.157329 1.0724 0.154506 -0.215928 2.0724 -0.008782 3.0724
+0.0629394 0.359713 0.432117 0.0288418 1.06294 0.0718273 -0.230871 2.06294 0.150793 3.06294
+0.061729 0.342476 0.43859 0.0556161 1.06173 0.0615905 -0.18686 2.06173 0.125961 3.06173
+0.0613851 0.337417 0.454545 0.0706272 1.06139 0.0550723 -0.16679 2.06139 0.115736 3.06139
+0.0679434 0.423597 0.437777 0.0762781 1.06794 0.102354 -0.247319 2.06794 0.105055 3.06794
+0.0658714 0.39839 0.444329 0.0505006 1.06587 0.0881128 -0.247889 2.06587 0.132798 3.06587
+0.066984 0.412116 0.399148 0.0541601 1.06698 0.106271 -0.257956 2.06698 0.115584 3.06698
+0.059225 0.303727 0.402689 0.0271132 1.05923 0.0511913 -0.176614 2.05923 0.143694 3.05923
+0.0539466 0.19866 0.000314376 0.272146 1.05395 0.0992514 0.173486 2.05395 -0.222052 3.05395
+0.0555159 0.234859 0.335595 0.0440383 1.05552 0.0335308 -0.0908207 2.05552 0.10664 3.05552
+0.0607253 0.327496 0.400158 0.0678617 1.06073 0.0637085 -0.159634 2.06073 0.102186 3.06073
+0.0635302 0.367834 0.419826 0.0176785 1.06353 0.0789605 -0.250155 2.06353 0.158269 3.06353
+0.0508339 0.0913193 0.0913485 0.00211058 1.05083 0.0228225 0.0107913 2.05083 0.075294 3.05083
+0.058337 0.288738 0.334049 0.129354 1.05834 0.0608568 -0.059384 2.05834 0.0208607 3.05834
+0.073197 0.481633 0.458659 0.117846 1.0732 0.126152 -0.263787 2.0732 0.0697517 3.0732
+0.0643196 0.378413 0.388356 0.0495681 1.06432 0.0921175 -0.228845 2.06432 0.116939 3.06432
+0.05 -8.92095e-07 0.220579 0.0330169 1.05 -0.0551452 0.133018 2.05 0.0831568 3.05
+0.0633319 0.365128 0.34452 0.0118692 1.06333 0.096434 -0.253259 2.06333 0.141487 3.06333
+0.05 4.29911e-05 0.458209 0.0581223 1.05 -0.114531 0.158079 2.05 0.12934 3.05
+0.0649446 0.386582 0.485337 0.0125922 1.06494 0.0719567 -0.27399 2.06494 0.183009 3.06494
+0.0732596 0.482282 0.38316 0.0533946 1.07326 0.145351 -0.328887 2.07326 0.111553 3.07326
+0.0601343 0.318344 0.379532 0.0469878 1.06013 0.064289 -0.171356 2.06013 0.116872 3.06013
+0.0589929 0.299882 0.434107 0.0399084 1.05899 0.0414142 -0.159974 2.05899 0.140324 3.05899
+0.0533844 0.183967 0.298159 0.152931 1.05338 0.0174437 0.068964 2.05338 -0.0134833 3.05338
+0.0687436 0.432939 0.381988 0.058566 1.06874 0.120973 -0.274373 2.06874 0.10603 3.06874
+0.0688405 0.434056 0.4152 0.0533501 1.06884 0.113228 -0.280706 2.06884 0.12121 3.06884
+0.0633449 0.365306 0.178881 0.151343 1.06334 0.137933 -0.113963 2.06334 -0.0476787 3.06334
+0.0663895 0.40484 0.413996 0.010807 1.06639 0.098921 -0.294033 2.06639 0.163392 3.06639
+0.0681069 0.425522 0.332025 0.137108 1.06811 0.129755 -0.188414 2.06811 0.0124995 3.06811
+0.0602585 0.320288 0.315397 0.0922107 1.06026 0.0812948 -0.128077 2.06026 0.0524084 3.06026
+0.0661616 0.402015 0.405634 0.0335444 1.06616 0.099599 -0.268471 2.06616 0.138146 3.06616
+0.0645948 0.382031 0.364774 0.0429815 1.06459 0.099822 -0.239049 2.06459 0.116451 3.06459
+0.0501965 0.044326 0.320192 0.00944922 1.0502 -0.057885 0.0651232 2.0502 0.136608 3.0502
+0.0588621 0.297693 0.399221 0.0822296 1.05886 0.0490412 -0.115463 2.05886 0.0875367 3.05886
+0.0595184 0.308519 0.406231 0.0443189 1.05952 0.0527017 -0.1642 2.05952 0.12755 3.05952
+0.055784 0.240499 0.329949 0.25 1.05578 0.0377622 0.109501 2.05578 -0.101015 3.05578
+0.0667892 0.409747 0.448351 0.0379418 1.06679 0.0927857 -0.271805 2.06679 0.146564 3.06679
+0.0718155 0.467071 0.415183 0.0403048 1.07182 0.12974 -0.326766 2.07182 0.13425 3.07182
+0.0763178 0.513009 0.459598 0.0751614 1.07632 0.141605 -0.337848 2.07632 0.112718 3.07632
+0.0656998 0.39623 0.476229 0.10813 1.0657 0.0790578 -0.1881 2.0657 0.0847387 3.0657
+0.0933296 0.658252 0.429649 0.092823 1.09333 0.221714 -0.465429 2.09333 0.0860717 3.09333
+0.0756129 0.506092 0.233468 0.100964 1.07561 0.194679 -0.305128 2.07561 0.0190764 3.07561
+0.0718367 0.467297 1.55405e-11 0.165075 1.07184 0.233648 -0.202222 2.07184 -0.115075 3.07184
+0.0591734 0.302877 0.234895 0.0696398 1.05917 0.0927148 -0.133237 2.05917 0.0508287 3.05917
+0.0677228 0.420984 0.397429 0.0502929 1.06772 0.111135 -0.270691 2.06772 0.118936 3.06772
+0.0547952 0.218979 0.152016 0.0576018 1.0548 0.0714855 -0.0613772 2.0548 0.038003 3.0548
+0.0591508 0.302502 0.452541 0.000283184 1.05915 0.0381157 -0.202219 2.05915 0.185479 3.05915
+0.063585 0.368578 0.449681 0.0634457 1.06359 0.0718688 -0.205132 2.06358 0.121459 3.06358
+0.0710652 0.458969 0.359668 0.0938424 1.07107 0.139568 -0.265127 2.07107 0.064058 3.07107
+0.0648431 0.385268 0.4142 0.02109 1.06484 0.089084 -0.264178 2.06484 0.15317 3.06484
+0.0511996 0.109527 0.372099 0.0961599 1.0512 -0.0382613 0.0866329 2.0512 0.0654698 3.0512
+0.0503055 0.0552679 0.27227 0.272514 1.05031 -0.0404335 0.317246 2.05031 -0.140833 3.05031
+0.05 2.36217e-10 0.5 0.328287 1.05 -0.125 0.428287 2.05 -0.128287 3.05
+0.0682566 0.427278 0.461054 0.0607404 1.06826 0.0983755 -0.266538 2.06826 0.127576 3.06826
+0.0602224 0.319726 0.344587 0.0499366 1.06022 0.0737163 -0.169789 2.06022 0.103439 3.06022
+0.0575438 0.27466 0.396347 0.000736961 1.05754 0.0382433 -0.173923 2.05754 0.168167 3.05754
+0.052056 0.143387 0.0551506 0.333965 1.05206 0.0579058 0.290578 2.05206 -0.26742 3.05206
+0.0622597 0.350138 0.460552 0.118767 1.06226 0.059931 -0.131371 2.06226 0.0693986 3.06226
+0.0827415 0.572202 0.4148 0.00599045 1.08274 0.182401 -0.466212 2.08274 0.16845 3.08274
+0.0599159 0.314895 0.444699 0.00394151 1.05992 0.0462727 -0.210953 2.05992 0.179468 3.05992
+0.0548937 0.221217 0.243873 0.0435135 1.05489 0.0496402 -0.0777035 2.05489 0.0796484 3.05489
+0.0619402 0.345546 0.432832 0.0448697 1.06194 0.064565 -0.200676 2.06194 0.13498 3.06194
+0.0549763 0.223076 0.44285 0.25 1.05498 0.0008255 0.126924 2.05498 -0.067145 3.05498
+0.0625142 0.353755 0.421197 0.0676067 1.06251 0.0715782 -0.186148 2.06251 0.108752 3.06251
+0.0735787 0.485579 0.467229 0.0596516 1.07358 0.125982 -0.325927 2.07358 0.130517 3.07358
+0.063976 0.373845 0.464903 0.0283036 1.06398 0.0706967 -0.245541 2.06398 0.161167 3.06398
+0.0791492 0.5399 0.330775 0.144023 1.07915 0.187256 -0.295877 2.07915 0.0052095 3.07915
+0.0595873 0.309634 0.441238 0.0617128 1.05959 0.0445075 -0.147921 2.05959 0.120659 3.05959
+0.0611354 0.333697 0.415115 0.0755055 1.06114 0.0630698 -0.158192 2.06114 0.099029 3.06114
+0.0564144 0.253266 2.52384e-07 0.181012 1.05641 0.126633 0.027746 2.05641 -0.131012 3.05641
+0.0552558 0.229254 0.438414 0.0799585 1.05526 0.0050235 -0.0492955 2.05526 0.101566 3.05526
+0.0616827 0.341799 0.406482 0.0268875 1.06168 0.069279 -0.214912 2.06168 0.145057 3.06168
+0.0631907 0.36319 0.348074 0.11313 1.06319 0.0945765 -0.15006 2.06319 0.0412922 3.06319
+0.0513426 0.11587 0.114289 2.48246e-48 1.05134 0.0293627 -0.01587 2.05134 0.0842867 3.05134
+0.05 -2.61116e-12 0.0714386 0.361238 1.05 -0.0178597 0.461238 2.05 -0.289806 3.05
+0.0820529 0.566153 0.455829 0.0248524 1.08205 0.169119 -0.441301 2.08205 0.161896 3.08205
+0.0632807 0.364427 0.453481 0.0509686 1.06328 0.0688432 -0.213458 2.06328 0.135076 3.06328
+0.05697 0.264008 0.396544 0.0410804 1.05697 0.032868 -0.122928 2.05697 0.127883 3.05697
+0.0582616 0.287431 0.307207 0.0653065 1.05826 0.0669137 -0.122124 2.05826 0.0768556 3.05826
+0.0604137 0.322703 0.358682 0.0230391 1.06041 0.071681 -0.199664 2.06041 0.134566 3.06041
+0.0562322 0.249643 0.374321 0.25 1.05623 0.0312412 0.100357 2.05623 -0.0877037 3.05623
+0.0571539 0.267467 0.395252 0.0307332 1.05715 0.0349205 -0.136734 2.05715 0.137842 3.05715
+0.0663313 0.40412 0.427471 0.0366205 1.06633 0.0951922 -0.2675 2.06633 0.141621 3.06633
+0.0721972 0.471139 0.0563955 0.00675631 1.0722 0.221471 -0.364383 2.0722 0.0601623 3.0722
+0.0529987 0.173168 0.336316 0.175943 1.053 0.002505 0.102775 2.053 -0.0250482 3.053
+0.0787548 0.536235 0.476303 0.0807528 1.07875 0.149042 -0.355482 2.07875 0.112138 3.07875
+0.054 0.2 3.45837e-12 0.769645 1.054 0.1 0.669645 2.054 -0.719645 3.054
+0.0629391 0.359709 0.481381 0.0320153 1.06294 0.0595092 -0.227694 2.06294 0.162399 3.06294
+0.0743821 0.493782 0.378315 0.139108 1.07438 0.152312 -0.254674 2.07438 0.0243865 3.07438
+0.0536934 0.192182 0.321217 0.000655454 1.05369 0.0157868 -0.0915265 2.05369 0.14571 3.05369
+0.0576784 0.277099 0.373176 0.000334474 1.05768 0.0452555 -0.176765 2.05768 0.161618 3.05768
+0.0689535 0.435356 0.225655 0.0964006 1.06895 0.161264 -0.238955 2.06895 0.0212959 3.06895
+0.0620068 0.346508 0.376155 0.0123393 1.06201 0.0792152 -0.234169 2.06201 0.150507 3.06201
+0.0520817 0.14428 0.0899526 0.0254938 1.05208 0.0496518 -0.0187862 2.05208 0.051492 3.05208
+0.0554731 0.233946 0.43655 0.155052 1.05547 0.0078355 0.021106 2.05547 0.025913 3.05547
+0.0737011 0.486838 0.0941121 0.19374 1.0737 0.219891 -0.193098 2.0737 -0.115506 3.0737
+0.0647814 0.384465 0.474468 0.00234095 1.06478 0.0736155 -0.282124 2.06478 0.189999 3.06478
+0.0508865 0.0941546 0.314792 0.270547 1.05089 -0.0316207 0.276392 2.05089 -0.126109 3.05089
+0.0812393 0.558922 0.44994 0.126469 1.08124 0.166976 -0.332453 2.08124 0.058513 3.08124
+0.05 -2.12747e-11 0.444644 0.400478 1.05 -0.111161 0.500478 2.05 -0.217085 3.05
+0.0573755 0.271579 0.354311 0.0791148 1.05738 0.0472118 -0.0924642 2.05738 0.0771785 3.05738
+0.0663084 0.403837 0.302978 0.0749181 1.06631 0.126174 -0.228919 2.06631 0.0659753 3.06631
+0.05 2.69089e-08 0.5 0.189611 1.05 -0.125 0.289611 2.05 0.010389 3.05
+0.0659707 0.399634 0.382425 0.0405514 1.06597 0.104211 -0.259083 2.06597 0.124176 3.06597
+0.0548335 0.219853 0.461572 2.59175e-51 1.05483 -0.0054665 -0.119853 2.05483 0.188472 3.05483
+0.06776 0.421426 0.461855 0.117678 1.06776 0.0952493 -0.203748 2.06776 0.0708785 3.06776
+0.0624069 0.352234 0.442866 0.0595814 1.06241 0.0654005 -0.192653 2.06241 0.123278 3.06241
+0.0718444 0.46738 0.105142 0.0910355 1.07184 0.207405 -0.276344 2.07184 -0.0094929 3.07184
+0.0670664 0.413115 0.357411 0.0264043 1.06707 0.117205 -0.286711 2.06707 0.130819 3.06707
+0.0634328 0.366508 0.214915 0.0177901 1.06343 0.129525 -0.248718 2.06343 0.0966844 3.06343
+0.0668612 0.410624 0.475669 0.00994525 1.06686 0.0863947 -0.300679 2.06686 0.182755 3.06686
+0.0502664 0.0516092 0.5 0.352325 1.05027 -0.0991954 0.400716 2.05027 -0.152325 3.05027
+0.0706944 0.454911 0.359819 7.79454e-49 1.07069 0.137501 -0.354911 2.07069 0.157946 3.07069
+0.0732417 0.482097 0.402555 0.0470091 1.07324 0.14041 -0.335088 2.07324 0.123757 3.07324
+0.0537344 0.193247 0.462708 0.102043 1.05373 -0.0190535 0.008796 2.05373 0.0867694 3.05373
+0.059074 0.301231 0.4331 0.030834 1.05907 0.0423405 -0.170397 2.05907 0.149096 3.05907
+0.0616385 0.341152 0.3563 0.0308082 1.06164 0.081501 -0.210344 2.06164 0.126082 3.06164
+0.0613358 0.336687 0.114213 0.131368 1.06134 0.13979 -0.105319 2.06134 -0.0471041 3.06134
+0.0568434 0.261598 0.260365 0.037339 1.05684 0.0657077 -0.124259 2.05684 0.0907705 3.05684
+0.051095 0.10464 0.439351 0.507543 1.0511 -0.0575177 0.502903 2.0511 -0.325738 3.0511
+0.0685678 0.430904 0.389346 0.0701491 1.06857 0.118115 -0.260755 2.06857 0.0966547 3.06857
+0.0655209 0.393966 0.385537 0.0530431 1.06552 0.100599 -0.240923 2.06552 0.112618 3.06552
+0.05 3.31645e-13 0.306421 0.586735 1.05 -0.0766052 0.686735 2.05 -0.444809 3.05
+0.0609483 0.330882 0.381439 0.0365519 1.06095 0.0700813 -0.19433 2.06095 0.12788 3.06095
+0.0706281 0.454182 0.450941 0.121306 1.07063 0.114356 -0.232876 2.07063 0.0639763 3.07063
+0.0617516 0.342805 0.334704 0.173168 1.06175 0.0877265 -0.069637 2.06175 -0.0227568 3.06175
+0.0633245 0.365027 0.356007 0.0417451 1.06332 0.0935117 -0.223282 2.06332 0.115057 3.06332
+0.0837854 0.581252 0.35031 0.0720958 1.08379 0.203048 -0.409156 2.08379 0.0829972 3.08379
+0.0695002 0.44159 0.260779 0.0117266 1.0695 0.1556 -0.329863 2.0695 0.116507 3.0695
+0.0608802 0.329851 0.447345 0.0149166 1.06088 0.0530893 -0.214934 2.06088 0.169287 3.06088
+0.0619478 0.345656 0.410956 0.0832358 1.06195 0.070089 -0.16242 2.06195 0.090051 3.06195
+0.07934 0.541664 0.239146 0.25 1.07934 0.211046 -0.191664 2.07934 -0.128256 3.07934
+0.0540817 0.202033 0.455407 0.00971511 1.05408 -0.0128353 -0.0923179 2.05408 0.176907 3.05408
+0.0555425 0.235424 0.5 0.141506 1.05554 -0.007288 0.006082 2.05554 0.058494 3.05554
+0.0509959 0.0997952 0.407926 0.256018 1.051 -0.0520839 0.256223 2.051 -0.0836402 3.051
+0.0519468 0.139529 0.137736 0.0480419 1.05195 0.0353305 0.0085129 2.05195 0.0432789 3.05195
+0.0506921 0.083193 0.398212 0.00775377 1.05069 -0.0579565 0.0245608 2.05069 0.16171 3.05069
+0.0588076 0.296776 0.41162 0.000329324 1.05881 0.045483 -0.196447 2.05881 0.173157 3.05881
+0.064147 0.376125 0.457802 0.0466794 1.06415 0.073612 -0.229446 2.06415 0.140661 3.06415
+0.0504349 0.0659455 0.271265 0.487047 1.05043 -0.0348435 0.521101 2.05043 -0.355668 3.05043
+0.0636417 0.369346 0.39302 0.0108287 1.06364 0.086418 -0.258517 2.06364 0.157077 3.06364
+0.0706045 0.453922 0.449924 0.0901561 1.0706 0.11448 -0.263766 2.0706 0.0948211 3.0706
+0.0535478 0.188355 0.433645 0.205149 1.05355 -0.0142338 0.116794 2.05355 -0.0250555 3.05355
+0.0525463 0.159571 0.459771 0.0571734 1.05255 -0.0351573 -0.0023976 2.05255 0.130758 3.05255
+0.0778797 0.528013 0.132549 0.0429055 1.07788 0.230869 -0.385107 2.07788 0.0468592 3.07788
+0.0617795 0.343213 0.349491 0.0381805 1.06178 0.0842337 -0.205032 2.06178 0.116667 3.06178
+0.0635177 0.367664 0.401353 0.0368594 1.06352 0.0834937 -0.230805 2.06352 0.133547 3.06352
+0.0704678 0.452414 0.478086 0.0273357 1.07047 0.106685 -0.325078 2.07047 0.16609 3.07047
+0.0779879 0.529036 0.0847016 0.0660446 1.07799 0.243343 -0.362991 2.07799 0.00936588 3.07799
+0.053152 0.177537 0.454006 0.326637 1.05315 -0.024733 0.2491 2.05315 -0.140435 3.05315
+0.0607239 0.327473 0.350331 0.123632 1.06072 0.0761538 -0.103841 2.06072 0.0314673 3.06072
+0.099 0.7 0 0 1.099 0.35 -0.6 2.099 0.05 3.099
+0.0560465 0.245896 0.309978 0.0294848 1.05605 0.0454535 -0.116411 2.05605 0.113509 3.05605
+0.0724415 0.473724 0.18747 0.1158 1.07244 0.189994 -0.257924 2.07244 -0.009559 3.07244
+0.0581479 0.285445 0.411442 0.00146122 1.05815 0.039862 -0.183984 2.05815 0.171971 3.05815
+0.0502858 0.053461 0.5 5.56613e-64 1.05029 -0.0982695 0.046539 2.05029 0.2 3.05029
+0.0587567 0.295917 0.374656 0.162306 1.05876 0.0542945 -0.033611 2.05876 9.08e-05 3.05876
+0.0523804 0.154285 0.354103 0.432459 1.05238 -0.0113832 0.378174 2.05238 -0.276228 3.05238
+0.0639822 0.373928 0.413873 0.106114 1.06398 0.0834957 -0.167814 2.06398 0.0680479 3.06398
+0.0614149 0.33786 0.482141 0.0252759 1.06141 0.0483948 -0.212584 2.06141 0.169366 3.06141
+0.05897 0.2995 0.398453 0.0502652 1.05897 0.0501367 -0.149235 2.05897 0.119271 3.05897
+0.0501764 0.0419951 0.500677 0.0259799 1.05018 -0.104172 0.0839848 2.05018 0.174223 3.05018
+0.0626604 0.355814 0.436752 0.0698427 1.06266 0.068719 -0.185971 2.06266 0.111183 3.06266
+0.0630649 0.361454 0.316817 0.0203914 1.06306 0.101523 -0.241063 2.06306 0.124654 3.06306
+0.0545351 0.212958 0.5 0.00124451 1.05454 -0.018521 -0.111713 2.05454 0.198755 3.05454
+0.06837 0.428602 0.430228 0.118928 1.06837 0.106744 -0.209674 2.06837 0.0601404 3.06837
+0.071599 0.464748 0.419852 0.0259126 1.0716 0.127411 -0.338835 2.0716 0.150043 3.0716
+0.0679658 0.423861 0.23962 0.152618 1.06797 0.152025 -0.171243 2.06797 -0.030732 3.06797
+0.0586065 0.293368 0.417888 0.213899 1.05861 0.042212 0.020531 2.05861 -0.0385326 3.05861
+0.0675907 0.419412 0.235194 0.0350559 1.06759 0.150907 -0.284356 2.06759 0.0855023 3.06759
+0.0687963 0.433547 0.370537 0.125016 1.0688 0.124139 -0.208531 2.0688 0.0361451 3.0688
+0.0569955 0.26449 0.372641 0.00172187 1.057 0.0390848 -0.162768 2.057 0.16007 3.057
+0.0656266 0.395305 0.355952 0.00177374 1.06563 0.108665 -0.293531 2.06563 0.155012 3.06563
+0.0752555 0.502548 0.365152 0.174293 1.07526 0.159986 -0.228255 2.07526 -0.0147474 3.07526
+0.062156 0.348655 0.408471 0.0593163 1.06216 0.0722098 -0.189339 2.06216 0.113225 3.06216
+0.060749 0.327857 0.330773 0.0283787 1.06075 0.0812353 -0.199478 2.06075 0.120853 3.06075
+0.0584919 0.291409 0.390731 0.116776 1.05849 0.0480217 -0.074633 2.05849 0.0504433 3.05849
+0.073873 0.4886 0.352856 0.0295252 1.07387 0.156086 -0.359075 2.07387 0.126332 3.07387
+0.0613048 0.336227 0.397018 0.00506081 1.0613 0.068859 -0.231166 2.0613 0.164045 3.0613
+0.0716379 0.465165 0.429462 0.10435 1.07164 0.125217 -0.260815 2.07164 0.0744886 3.07164
+0.0500901 0.0300198 0.388845 0.0427093 1.05009 -0.0822014 0.11269 2.05009 0.123944 3.05009
+0.0649713 0.386928 0.443532 0.0353408 1.06497 0.082581 -0.251587 2.06497 0.147719 3.06497
+0.0656654 0.395795 0.420983 0.0573247 1.06567 0.0926518 -0.23847 2.06567 0.11897 3.06567
+0.0946411 0.66814 0.433247 0.00123847 1.09464 0.225758 -0.566902 2.09464 0.178736 3.09464
+0.0598204 0.313375 0.340717 0.146055 1.05982 0.0715083 -0.06732 2.05982 0.0061601 3.05982
+0.0665503 0.406821 0.430612 0.164092 1.06655 0.0957575 -0.142729 2.06655 0.0150916 3.06655
+0.0671944 0.414662 0.430772 0.029845 1.06719 0.099638 -0.284817 2.06719 0.149387 3.06719
+0.0700452 0.447719 0.414155 0.0386692 1.07005 0.120321 -0.30905 2.07005 0.135577 3.07005
+0.0626395 0.35552 0.200585 0.11824 1.06264 0.127614 -0.13728 2.06264 -0.0080645 3.06264
+0.063891 0.372706 0.345702 0.0946301 1.06389 0.0999275 -0.178076 2.06389 0.0590805 3.06389
+0.052195 0.148156 0.062272 0.469268 1.05219 0.05851 0.421112 2.0522 -0.400586 3.0522
+0.0744257 0.494224 0.5 0.0622406 1.07443 0.122112 -0.331983 2.07443 0.137759 3.07443
+0.0637463 0.37076 0.373427 0.0720009 1.06375 0.0920232 -0.198759 2.06375 0.0900272 3.06375
+0.0626403 0.355531 0.376708 0.0821724 1.06264 0.0835885 -0.173359 2.06264 0.08084 3.06264
+0.0660046 0.400058 0.477937 0.0764433 1.066 0.0805448 -0.223615 2.066 0.116938 3.066
+0.0671396 0.413999 0.403166 0.0724067 1.06714 0.106208 -0.241592 2.06714 0.0985431 3.06714
+0.0540052 0.200129 0.00115034 0.270209 1.05401 0.0997769 0.17008 2.05401 -0.219864 3.05401
+0.0503434 0.0586026 0.0637184 7.12136e-47 1.05034 0.0133717 0.0413974 2.05034 0.0691155 3.05034
+0.0666661 0.408241 0.4368 0.012707 1.06667 0.0949205 -0.295534 2.06667 0.168333 3.06667
+0.0610944 0.333083 0.344549 0.0813982 1.06109 0.0804043 -0.151685 2.06109 0.0719665 3.06109
+0.0588202 0.296989 0.27066 0.0335057 1.05882 0.0808295 -0.163483 2.05882 0.0976923 3.05882
+0.0777417 0.526704 0.433113 0.0638474 1.07774 0.155074 -0.362857 2.07774 0.116086 3.07774
+0.0601414 0.318455 0.431546 0.00130738 1.06014 0.051341 -0.217148 2.06014 0.178156 3.06014
+0.05392 0.197991 0.453714 0.162548 1.05392 -0.014433 0.064557 2.05392 0.0235662 3.05392
+0.0684147 0.429123 0.421221 0.0822951 1.06841 0.109256 -0.246828 2.06841 0.0940712 3.06841
+0.0636051 0.368851 0.458173 0.0190987 1.06361 0.0698822 -0.249752 2.06361 0.168353 3.06361
+0.061157 0.334021 0.344544 0.0601567 1.06116 0.0808745 -0.173864 2.06116 0.0932065 3.06116
+0.0563382 0.251757 0.0521748 0.123148 1.05634 0.112835 -0.028609 2.05634 -0.0574956 3.05634
+0.0517682 0.132972 0.0768273 0.239065 1.05177 0.0472792 0.206093 2.05177 -0.166017 3.05177
+0.0502414 0.0491297 0.450036 0.317155 1.05024 -0.0879441 0.368025 2.05024 -0.132144 3.05024
+0.0540001 0.200002 0.500031 0.270297 1.054 -0.0250067 0.170295 2.054 -0.0702877 3.054
+0.0539959 0.199897 0.0297387 0.25 1.054 0.0925138 0.150103 2.054 -0.191078 3.054
+0.0653288 0.39152 0.453565 0.017379 1.06533 0.0823687 -0.274141 2.06533 0.16869 3.06533
+0.0814165 0.560505 0.322711 5.07207e-45 1.08142 0.199575 -0.460505 2.08142 0.146813 3.08142
+0.0591975 0.303273 0.25185 0.1195 1.0592 0.088674 -0.083773 2.0592 0.006055 3.0592
+0.0613004 0.336161 0.469764 0.0103216 1.0613 0.0506395 -0.225839 2.0613 0.180608 3.0613
+0.0917058 0.645801 0.289702 0.00535632 1.09171 0.250475 -0.540445 2.09171 0.131554 3.09171
+0.0588011 0.296667 0.0641565 0.0339955 1.0588 0.132294 -0.162672 2.0588 0.0352515 3.0588
+0.0611369 0.333719 0.461218 0.0404692 1.06114 0.051555 -0.19325 2.06114 0.147896 3.06114
+0.0667831 0.409672 0.481893 0.0578069 1.06678 0.0843627 -0.251865 2.06678 0.136761 3.06678
+0.0532825 0.181176 0.471736 0.257379 1.05328 -0.027346 0.176203 2.05328 -0.0658582 3.05328
+0.0648161 0.384917 0.380345 0.0228702 1.06482 0.0973723 -0.262047 2.06482 0.141233 3.06482
+0.06363 0.369188 0.461811 0.00969548 1.06363 0.0691413 -0.259493 2.06363 0.178848 3.06363
+0.065034 0.387737 0.37609 0.0110933 1.06503 0.099846 -0.276644 2.06503 0.151734 3.06503
+0.0612192 0.334951 0.366631 0.00694361 1.06122 0.0758178 -0.228007 2.06122 0.153046 3.06122
+0.0674178 0.417347 0.388189 0.0451587 1.06742 0.111626 -0.272188 2.06742 0.121298 3.06742
+0.05 5.23042e-08 0.317518 0.150686 1.05 -0.0793795 0.250686 2.05 -0.0054306 3.05
+0.0615513 0.339872 0.380415 0.0626245 1.06155 0.0748323 -0.177248 2.06155 0.1015 3.06155
+0.0562784 0.250567 0.26169 0.0864022 1.05628 0.059861 -0.0641648 2.05628 0.0421048 3.05628
+0.0503632 0.0602629 0.177224 0.298133 1.05036 -0.0141745 0.33787 2.05036 -0.194966 3.05036
+0.0678093 0.422011 0.400883 0.0423196 1.06781 0.110785 -0.279691 2.06781 0.127945 3.06781
+0.0508114 0.0900762 0.499997 0.0780607 1.05081 -0.0799612 0.0879845 2.05081 0.121938 3.05081
+0.0587782 0.296281 0.46845 6.30608e-49 1.05878 0.031028 -0.196281 2.05878 0.190535 3.05878
+0.099 0.7 0.332387 0.0795799 1.099 0.266903 -0.52042 2.099 0.0701362 3.099
+0.0782389 0.531403 0.316222 0.00193959 1.07824 0.186646 -0.429463 2.07824 0.142927 3.07824
+0.0662209 0.402751 0.429594 0.0781718 1.06622 0.093977 -0.224579 2.06622 0.100706 3.06622
+0.0605277 0.324463 0.5 0.000482971 1.06053 0.0372315 -0.22398 2.06053 0.199517 3.06053
+0.0676933 0.420634 0.204394 1.63704e-48 1.06769 0.159219 -0.320634 2.06769 0.111318 3.06769
+0.0666259 0.407749 0.275923 0.0350255 1.06663 0.134894 -0.272723 2.06663 0.0977514 3.06663
+0.0671483 0.414105 0.354482 0.0461157 1.06715 0.118432 -0.267989 2.06715 0.110229 3.06715
+0.071263 0.461118 0.374142 0.000389203 1.07126 0.137023 -0.360729 2.07126 0.161853 3.07126
+0.067815 0.422078 0.420772 0.0259492 1.06781 0.105846 -0.296129 2.06781 0.150282 3.06781
+0.0616264 0.340974 0.5 0.122608 1.06163 0.045487 -0.118366 2.06163 0.077392 3.06163
+0.0857368 0.597803 0.187075 0.105966 1.08574 0.252133 -0.391837 2.08574 0.0001565 3.08574
+0.0534517 0.185788 0.500042 0.300292 1.05345 -0.0321165 0.214504 2.05345 -0.100279 3.05345
+0.0648231 0.385008 0.411955 0.0330924 1.06482 0.0895153 -0.251916 2.06482 0.140494 3.06482
+0.0593329 0.305498 0.350587 0.0739638 1.05933 0.0651023 -0.131534 2.05933 0.0812123 3.05933
+0.060766 0.328116 0.394263 0.0465761 1.06077 0.0654923 -0.18154 2.06077 0.121703 3.06077
+0.0539999 0.199998 0.478082 0.316823 1.054 -0.0195215 0.216825 2.054 -0.123398 3.054
+0.0609918 0.331538 0.4693 0.0169417 1.06099 0.048444 -0.214596 2.06099 0.173848 3.06099
+0.056557 0.256067 0.456088 0.219752 1.05656 0.0140115 0.063685 2.05656 -0.0329256 3.05656
+0.0792507 0.540839 0.326848 0.0930472 1.07925 0.188707 -0.347792 2.07925 0.0550072 3.07925
+0.055204 0.228122 0.30271 0.203546 1.0552 0.0383835 0.075424 2.0552 -0.062733 3.0552
+0.0625169 0.353792 0.5 0.0106934 1.06252 0.051896 -0.243099 2.06252 0.189307 3.06252
+0.0908263 0.638954 0.416793 0.0281353 1.09083 0.215279 -0.510819 2.09083 0.146903 3.09083
+0.0666269 0.407761 0.457369 0.0420918 1.06663 0.0895382 -0.265669 2.06663 0.145119 3.06663
+0.0630826 0.361698 0.301057 0.0265945 1.06308 0.105585 -0.235104 2.06308 0.113723 3.06308
+0.0501349 0.0367266 0.39327 0.368251 1.05013 -0.0799542 0.431524 2.05013 -0.20027 3.05013
+0.0768354 0.518029 0.273135 0.01692 1.07684 0.190731 -0.401109 2.07684 0.11502 3.07684
+0.0516818 0.129685 0.352111 0.0376276 1.05168 -0.0231853 0.0079426 2.05168 0.118006 3.05168
+0.0619069 0.345064 0.415318 0.065387 1.06191 0.0687025 -0.179677 2.06191 0.109208 3.06191
+0.056664 0.258147 0.426547 0.25 1.05666 0.0224368 0.091853 2.05666 -0.0720359 3.05666
+0.0606858 0.326892 0.145069 0.00408979 1.06069 0.127179 -0.222802 2.06069 0.0894309 3.06069
+0.0876528 0.613619 0.0761328 0.105485 1.08765 0.287776 -0.408134 2.08765 -0.0326452 3.08765
+0.063534 0.367885 0.350637 0.018203 1.06353 0.0962833 -0.249682 2.06353 0.136988 3.06353
+0.0530589 0.174898 0.476091 0.237414 1.05306 -0.0315737 0.162516 2.05306 -0.0445867 3.05306
+0.0644379 0.379973 0.155006 0.0951275 1.06444 0.151235 -0.184845 2.06444 0.0013743 3.06444
+0.099 0.7 0.138887 0.00245047 1.099 0.315278 -0.59755 2.099 0.0892156 3.099
+0.0521952 0.148163 0.151546 0.0837565 1.0522 0.036195 0.0355935 2.0522 0.0117073 3.0522
+0.0505612 0.0749125 0.455413 0.188679 1.05056 -0.076397 0.213767 2.05056 -0.0020551 3.05056
+0.063532 0.367859 0.110061 0.0487576 1.06353 0.156414 -0.219101 2.06353 0.0342607 3.06353
+0.0612222 0.334996 0.38534 0.0832818 1.06122 0.071163 -0.151714 2.06122 0.0823202 3.06122
+0.06462 0.382361 0.354351 0.00677288 1.06462 0.102593 -0.275588 2.06462 0.149532 3.06462
+0.061978 0.346092 0.472969 0.00603664 1.06198 0.0548038 -0.240055 2.06198 0.185854 3.06198
+0.0520827 0.144315 0.471617 0.520124 1.05208 -0.0457468 0.475809 2.05208 -0.328639 3.05208
+0.099 0.7 0.219603 0.14306 1.099 0.295099 -0.45694 2.099 -0.0271791 3.099
+0.0558225 0.241299 0.0908092 0.0573173 1.05582 0.0979472 -0.0839817 2.05582 0.0199255 3.05582
+0.0630872 0.361763 0.331882 0.00465741 1.06309 0.097911 -0.257106 2.06309 0.144907 3.06309
+0.0704817 0.452567 0.323665 0.0925164 1.07048 0.145367 -0.260051 2.07048 0.0545831 3.07048
+0.0553539 0.231385 0.420418 0.195907 1.05535 0.010588 0.064522 2.05535 -0.0197816 3.05535
+0.0528222 0.167993 0.500001 0.344492 1.05282 -0.0410038 0.276499 2.05282 -0.144492 3.05282
+0.0640058 0.374244 0.457251 0.0361603 1.06401 0.0728093 -0.238084 2.06401 0.151015 3.06401
+0.0642032 0.376871 0.455333 0.0139487 1.0642 0.0746023 -0.262922 2.0642 0.172651 3.0642
+0.079748 0.545418 0.5 0.00217768 1.07975 0.147709 -0.44324 2.07975 0.197822 3.07975
+0.0516753 0.129433 0.266149 0.115289 1.05168 -0.00182075 0.085856 2.05168 0.0145557 3.05168
+0.0575003 0.273866 0.180812 0.0701994 1.0575 0.09173 -0.103667 2.0575 0.0340442 3.0575
+0.099 0.7 0.432006 0.182517 1.099 0.241998 -0.417483 2.099 -0.0029152 3.099
+0.0635814 0.36853 0.39421 0.0582197 1.06358 0.0857125 -0.21031 2.06358 0.110043 3.06358
+0.061414 0.337846 0.440275 2.06831e-47 1.06141 0.0588542 -0.237846 2.06141 0.182082 3.06141
+0.0621876 0.349107 0.411788 0.000351924 1.06219 0.0716065 -0.248755 2.06219 0.173184 3.06219
+0.0576145 0.275943 0.268137 0.102699 1.05761 0.0709372 -0.073244 2.05761 0.0277421 3.05761
+0.0611836 0.334419 0.421308 0.0579043 1.06118 0.0618825 -0.176515 2.06118 0.118488 3.06118
+0.059786 0.312825 0.282898 0.194497 1.05979 0.085688 -0.018328 2.05979 -0.0596276 3.05979
+0.0683713 0.428617 0.379621 0.104181 1.06837 0.119403 -0.224436 2.06837 0.0597053 3.06837
+0.0570433 0.265393 0.387008 0.215068 1.05704 0.0359445 0.049675 2.05704 -0.0489656 3.05704
+0.0629585 0.35998 0.325035 0.00842049 1.06296 0.0987313 -0.25156 2.06296 0.13909 3.06296
+0.061628 0.340998 0.408424 0.107098 1.06163 0.068393 -0.1339 2.06163 0.0654292 3.06163
+0.068518 0.430325 0.261653 0.0253253 1.06852 0.149749 -0.305 2.06852 0.103171 3.06852
+0.0665434 0.406736 0.326896 0.0275512 1.06654 0.121644 -0.279185 2.06654 0.120518 3.06654
+0.0659875 0.399844 0.391708 0.0362973 1.06599 0.101995 -0.263547 2.06599 0.131215 3.06599
+0.0683035 0.427826 0.420367 0.0704426 1.0683 0.108821 -0.257383 2.0683 0.105668 3.0683
+0.0674303 0.417496 0.392972 0.0299737 1.06743 0.110505 -0.287522 2.06743 0.137918 3.06743
+0.0650143 0.387483 0.39863 0.204179 1.06501 0.094084 -0.083304 2.06501 -0.03459 3.06501
+0.0575455 0.274691 0.343685 0.21746 1.05755 0.0514243 0.042769 2.05755 -0.0643545 3.05755
+0.0653037 0.391199 0.412248 0.121243 1.0653 0.0925375 -0.169956 2.0653 0.0524314 3.0653
+0.0514706 0.121268 0.317334 0.200511 1.05147 -0.0186995 0.179243 2.05147 -0.0553108 3.05147
+0.0770173 0.519782 0.282527 0.0452456 1.07702 0.189259 -0.374536 2.07702 0.0895125 3.07702
+0.0649059 0.386082 0.437244 0.044684 1.06491 0.08373 -0.241398 2.06491 0.136489 3.06491
+0.0655324 0.394111 0.389135 0.111822 1.06553 0.0997717 -0.182289 2.06553 0.0549185 3.06553
+0.0656246 0.39528 0.393757 0.0158581 1.06562 0.0992008 -0.279422 2.06562 0.152269 3.06562
+0.0632053 0.363391 0.403041 0.0320018 1.06321 0.0809353 -0.231389 2.06321 0.13891 3.06321
+0.0502324 0.0482097 0.451524 0.106861 1.05023 -0.0887761 0.158651 2.05023 0.0785962 3.05023
+0.0620984 0.347827 0.343255 0.0193896 1.0621 0.0880998 -0.228437 2.0621 0.133587 3.0621
+0.0706088 0.453969 0.416874 0.0085837 1.07061 0.122766 -0.345385 2.07061 0.166479 3.07061
+0.0643098 0.378283 0.214001 0.25 1.06431 0.135641 -0.028283 2.06431 -0.1358 3.06431
+0.0652456 0.390456 0.363016 0.0226013 1.06525 0.104474 -0.267855 2.06525 0.136303 3.06525
+0.050526 0.0725289 0.500004 0.252772 1.05053 -0.0887365 0.280243 2.05053 -0.0527708 3.05053
+0.0710321 0.458608 0.322294 0.0142679 1.07103 0.14873 -0.34434 2.07103 0.13242 3.07103
+0.0584322 0.290382 0.401657 0.0113654 1.05843 0.0447767 -0.179017 2.05843 0.159132 3.05843
+0.0692636 0.438903 0.188604 0.0800933 1.06926 0.1723 -0.25881 2.06926 0.0264879 3.06926
+0.054 0.2 0.5 0.302544 1.054 -0.025 0.202544 2.054 -0.102544 3.054
+0.0515961 0.126337 0.5 0.459298 1.0516 -0.0618315 0.432961 2.0516 -0.259298 3.0516
+0.0629429 0.359763 0.415811 0.0316117 1.06294 0.0759288 -0.228151 2.06294 0.143132 3.06294
+0.0613991 0.337626 0.432181 0.0825988 1.0614 0.0607677 -0.155027 2.0614 0.0970555 3.0614
+0.0634391 0.366594 0.451995 0.0579584 1.06344 0.0702982 -0.208636 2.06344 0.12764 3.06344
+0.0673329 0.416328 0.427219 0.0359404 1.06733 0.101359 -0.280388 2.06733 0.142225 3.06733
+0.0690866 0.436882 0.313986 0.0089788 1.06909 0.139944 -0.327903 2.06909 0.135217 3.06909
+0.0605007 0.324048 0.366113 0.201291 1.0605 0.0704957 -0.022757 2.0605 -0.0414571 3.0605
+0.0505386 0.0733878 0.411574 0.230637 1.05054 -0.0661996 0.257249 2.05054 -0.0571648 3.05054
+0.0651163 0.388797 0.42614 0.0635349 1.06512 0.0878635 -0.225262 2.06512 0.114307 3.06512
+0.0548439 0.220088 0.110448 0.0290928 1.05484 0.082432 -0.0909952 2.05484 0.0540416 3.05484
+0.0772069 0.521602 0.252941 0.070054 1.07721 0.197566 -0.351548 2.07721 0.0558283 3.07721
+0.0703636 0.45126 0.426761 0.146528 1.07036 0.11894 -0.204732 2.07036 0.0315003 3.07036
+0.0613452 0.336826 0.261512 0.0748188 1.06135 0.103035 -0.162007 2.06135 0.0536348 3.06135
+0.0602509 0.32017 0.386784 0.0120628 1.06025 0.063389 -0.208107 2.06025 0.153972 3.06025
+0.0513621 0.116711 0.414426 0.373553 1.05136 -0.045251 0.356842 2.05136 -0.199225 3.05136
+0.0526258 0.162042 0.474021 0.344618 1.05263 -0.0374843 0.282576 2.05263 -0.152412 3.05263
+0.0567131 0.259096 0.460835 0.103022 1.05671 0.0143392 -0.056074 2.05671 0.0852285 3.05671
+0.0627123 0.356543 0.460867 0.0448628 1.06271 0.0630547 -0.21168 2.06271 0.143397 3.06271
+0.0719421 0.468424 0.383052 0.00682089 1.07194 0.138449 -0.361603 2.07194 0.158095 3.07194
+0.0784242 0.533144 0.289643 0.105618 1.07842 0.194161 -0.327526 2.07842 0.0312749 3.07842
+0.0671694 0.41436 0.426303 0.0506664 1.06717 0.100604 -0.263694 2.06717 0.127225 3.06717
+0.0574119 0.272247 0.425034 0.0706731 1.05741 0.029865 -0.101574 2.05741 0.106837 3.05741
+0.0596417 0.310511 0.276166 0.0599059 1.05964 0.086214 -0.150605 2.05964 0.0729439 3.05964
+0.0592147 0.303558 0.374594 0.0433476 1.05921 0.0581305 -0.16021 2.05921 0.119031 3.05921
+0.0752778 0.50277 0.366029 0.00146933 1.07528 0.159878 -0.401301 2.07528 0.158339 3.07528
+0.0742306 0.492246 0.47307 0.0467872 1.07423 0.127856 -0.345459 2.07423 0.145134 3.07423
+0.0594561 0.307507 0.322414 0.04773 1.05946 0.07315 -0.159777 2.05946 0.0989942 3.05946
+0.0699837 0.447031 0.400516 0.0335585 1.06998 0.123387 -0.313473 2.06998 0.136596 3.06998
+0.0683754 0.428666 0.431091 0.0416376 1.06838 0.10656 -0.287028 2.06838 0.13769 3.06838
+0.0685508 0.430706 0.321024 0.0761686 1.06855 0.135097 -0.254537 2.06855 0.0701386 3.06855
+0.0658846 0.398554 0.255466 0.100909 1.06588 0.13541 -0.197645 2.06588 0.0257308 3.06588
+0.0641441 0.376087 0.418569 0.0250262 1.06414 0.0834012 -0.251061 2.06414 0.150545 3.06414
+0.0508311 0.0911657 0.130394 0.221742 1.05083 0.0129843 0.230576 2.05083 -0.132624 3.05083
+0.0514128 0.118862 0.196969 0.27949 1.05141 0.0101887 0.260628 2.05141 -0.170399 3.05141
+0.0540001 0.200002 0.186069 0.25 1.054 0.0534838 0.149998 2.054 -0.144179 3.054
+0.0571101 0.266648 0.425167 0.0583762 1.05711 0.0270322 -0.108272 2.05711 0.119174 3.05711
+0.0813546 0.559952 0.292103 0.186074 1.08135 0.20695 -0.273878 2.08135 -0.0484431 3.08135
+0.051315 0.114674 0.388886 0.00239702 1.05131 -0.0398845 -0.012277 2.05131 0.164269 3.05131
+0.0922745 0.650189 0.344985 0.017691 1.09227 0.238848 -0.532498 2.09227 0.135804 3.09227
+0.0572846 0.269899 -3.65186e-11 0.0121821 1.05728 0.13495 -0.157717 2.05728 0.0378179 3.05728
+0.0801239 0.548852 0.5 0.0166316 1.08012 0.149426 -0.43222 2.08012 0.183368 3.08012
+0.0624002 0.352139 0.356488 0.0796231 1.0624 0.0869475 -0.172516 2.0624 0.0773233 3.0624
+0.0595569 0.309143 0.426102 0.0101188 1.05956 0.048046 -0.199024 2.05956 0.167712 3.05956
+0.0641822 0.376593 0.418777 0.0438621 1.06418 0.0836023 -0.232731 2.06418 0.131771 3.06418
+0.0516715 0.129288 0.245587 0.327954 1.05167 0.00324725 0.298666 2.05167 -0.204278 3.05167
+0.0627478 0.357041 0.462859 0.035403 1.06275 0.0628057 -0.221638 2.06275 0.153455 3.06275
+0.0661358 0.401694 0.325102 0.0707416 1.06614 0.119571 -0.230952 2.06614 0.076789 3.06614
+0.0810867 0.557554 0.360683 0.000750247 1.08109 0.188606 -0.456804 2.08109 0.157455 3.08109
+0.0622922 0.350602 0.485561 0.0493792 1.06229 0.0539108 -0.201223 2.06229 0.146289 3.06229
+0.0655136 0.393873 0.360535 0.111299 1.06551 0.106803 -0.182574 2.06551 0.0468615 3.06551
+0.0619693 0.345967 0.417092 0.00164383 1.06197 0.0687105 -0.244323 2.06197 0.173484 3.06197
+0.0822561 0.567945 0.451665 2.81391e-40 1.08226 0.171056 -0.467945 2.08226 0.185499 3.08226
+0.0502166 0.0465397 0.345247 0.546591 1.05022 -0.0630419 0.600051 2.05022 -0.393017 3.05022
+0.0777109 0.526411 0.0614463 0.137211 1.07771 0.247844 -0.2892 2.07771 -0.0687771 3.07771
+0.0622741 0.350344 0.4544 0.0397984 1.06227 0.061572 -0.210546 2.06227 0.146522 3.06227
+0.0687041 0.432482 0.287854 0.0151823 1.0687 0.144278 -0.3173 2.0687 0.121174 3.0687
+0.0619474 0.34565 0.427604 0.000149378 1.06195 0.065924 -0.245501 2.06195 0.178132 3.06195
+0.0688976 0.434714 0.207767 0.0377347 1.0689 0.165415 -0.296979 2.0689 0.0745954 3.0689
+0.058981 0.299684 0.321068 0.00203546 1.05898 0.069575 -0.197649 2.05898 0.144285 3.05898
+0.0699045 0.446145 0.192357 0.163836 1.0699 0.174983 -0.182309 2.0699 -0.0561289 3.0699
+0.0642263 0.377177 0.169478 0.0625504 1.06423 0.146219 -0.214627 2.06423 0.038293 3.06423
+0.065669 0.39584 0.428397 0.0040245 1.06567 0.0908208 -0.291816 2.06567 0.174495 3.06567
+0.0639063 0.372911 0.407357 0.0403862 1.06391 0.0846162 -0.232525 2.06391 0.131821 3.06391
+0.0664553 0.405651 0.394588 0.00542282 1.06646 0.104178 -0.300228 2.06646 0.162954 3.06646
+0.0516572 0.128731 0.0495783 1.82548e-48 1.05166 0.0519709 -0.028731 2.05166 0.0648735 3.05166
+0.085073 0.592224 0.398089 0.00135496 1.08507 0.19659 -0.490869 2.08507 0.168072 3.08507
+0.054 0.2 0.234876 0.36 1.054 0.041281 0.26 2.054 -0.239537 3.054
+0.0592622 0.304338 0.366667 0.00310195 1.05926 0.0605022 -0.201236 2.05926 0.156898 3.05926
+0.0629785 0.360257 0.408788 0.0125007 1.06298 0.0779315 -0.247756 2.06298 0.160136 3.06298
+0.0750007 0.500007 0.386778 0.00915181 1.075 0.153309 -0.390855 2.075 0.156882 3.075
+0.063215 0.363524 0.40871 0.0606196 1.06322 0.0795845 -0.202904 2.06322 0.111993 3.06322
+0.051537 0.123976 0.5 0.566697 1.05154 -0.063012 0.542721 2.05154 -0.366697 3.05154
+0.056746 0.259731 0.292911 0.0761465 1.05675 0.0566378 -0.0835845 2.05675 0.0617268 3.05675
+0.0504062 0.0637372 0.380462 0.412689 1.05041 -0.0632469 0.448952 2.05041 -0.24855 3.05041
+0.0584886 0.291352 0.189562 0.0389211 1.05849 0.0982855 -0.152431 2.05849 0.0679475 3.05849
+0.0503608 0.0600678 0.241781 0.38881 1.05036 -0.0304114 0.428742 2.05036 -0.266276 3.05036
+0.0592857 0.304725 0.42655 0.0841679 1.05929 0.045725 -0.120557 2.05929 0.0937971 3.05929
+0.0655266 0.394038 0.488018 0.0653469 1.06553 0.0750145 -0.228691 2.06553 0.131058 3.06553
+0.0639779 0.37387 0.467625 0.0340647 1.06398 0.0700287 -0.239805 2.06398 0.156223 3.06398
+0.083435 0.57823 0.410196 0.25 1.08343 0.186566 -0.22823 2.08344 -0.0769412 3.08344
+0.0757271 0.507219 0.252118 0.145314 1.07573 0.19058 -0.261905 2.07573 -0.0196786 3.07573
+0.0697945 0.44491 0.383952 0.0756478 1.06979 0.126467 -0.269262 2.06979 0.0895378 3.06979
+0.054 0.2 0.433086 0.578865 1.054 -0.0082715 0.478865 2.054 -0.398939 3.054
+0.0820529 0.566153 0.395747 1.84124e-42 1.08205 0.18414 -0.466153 2.08205 0.168724 3.08205
+0.0618321 0.343979 0.46304 0.0873624 1.06183 0.0562295 -0.156617 2.06183 0.10155 3.06183
+0.0672894 0.415805 0.36145 0.012221 1.06729 0.11754 -0.303584 2.06729 0.146214 3.06729
+0.054233 0.205742 0.384999 0.0393647 1.05423 0.00662125 -0.0663773 2.05423 0.126135 3.05423
+0.06384 0.372022 0.401638 0.0337665 1.06384 0.0856015 -0.238256 2.06384 0.136725 3.06384
+0.0905598 0.636865 0.5 0.0259751 1.09056 0.193433 -0.51089 2.09056 0.174025 3.09056
+0.069108 0.437127 0.427822 0.0358576 1.06911 0.111608 -0.301269 2.06911 0.142489 3.06911
+0.0707258 0.455256 0.419789 0.0873388 1.07073 0.122681 -0.267917 2.07073 0.0885979 3.07073
+0.0594078 0.306722 0.396793 0.00397069 1.05941 0.0541627 -0.202751 2.05941 0.165067 3.05941
+0.0737286 0.48712 0.375022 0.110661 1.07373 0.149805 -0.276459 2.07373 0.0518456 3.07373
+0.0700653 0.447943 0.47359 0.0107071 1.07007 0.105574 -0.337236 2.07007 0.18137 3.07007
+0.0607364 0.327665 0.393951 0.0961355 1.06074 0.0653447 -0.131529 2.06074 0.0720498 3.06074
+0.062758 0.357183 0.457294 0.000401343 1.06276 0.064268 -0.256782 2.06276 0.186787 3.06276
+0.0634417 0.366629 0.403396 0.0570388 1.06344 0.0824655 -0.20959 2.06344 0.11398 3.06344
+0.0580552 0.283816 0.383088 0.03716 1.05806 0.046136 -0.146656 2.05806 0.127766 3.05806
+0.0696854 0.443683 0.26518 0.0372149 1.06969 0.155546 -0.306468 2.06969 0.0923391 3.06969
+0.066402 0.404994 0.378074 0.0702179 1.0664 0.107979 -0.234776 2.0664 0.0932043 3.0664
+0.0642334 0.377272 0.460376 0.0584807 1.06423 0.073542 -0.218791 2.06423 0.129632 3.06423
+0.0645581 0.38155 0.451892 0.0394049 1.06456 0.077802 -0.242145 2.06456 0.146163 3.06456
+0.0651566 0.389315 0.20994 0.0777146 1.06516 0.142173 -0.2116 2.06516 0.0352674 3.06516
+0.0613104 0.336309 0.463089 0.03332 1.06131 0.0523823 -0.202989 2.06131 0.155607 3.06131
+0.0915408 0.644522 0.224407 0.0234616 1.09154 0.266159 -0.52106 2.09154 0.0938605 3.09154
+0.07227 0.471911 0.457572 0.0254798 1.07227 0.121563 -0.346431 2.07227 0.161792 3.07227
+0.0636941 0.370056 0.353387 0.0231056 1.06369 0.0966812 -0.24695 2.06369 0.13291 3.06369
+0.05 -1.04413e-06 0.301198 0.0721565 1.05 -0.0753 0.172158 2.05 0.0682029 3.05
+0.0627192 0.35664 0.430587 0.00271581 1.06272 0.0706733 -0.253924 2.06272 0.17646 3.06272
+0.0569003 0.262684 0.346313 0.0945505 1.0569 0.0447637 -0.0681335 2.0569 0.0593434 3.0569
+0.0693639 0.440044 0.456157 0.0255288 1.06936 0.105983 -0.314515 2.06936 0.161318 3.06936
+0.0503604 0.0600323 0.373392 1.22598e-56 1.05036 -0.0633318 0.0399677 2.05036 0.162018 3.05036
+0.0582089 0.286513 0.330869 0.0191421 1.05821 0.0605393 -0.167371 2.05821 0.130119 3.05821
+0.05 -4.19412e-07 0.140825 0.0310073 1.05 -0.0352065 0.131008 2.05 0.0612402 3.05
+0.0503595 0.0599544 0.5 0.146543 1.05036 -0.0950228 0.186589 2.05036 0.053457 3.05036
+0.0643998 0.379471 0.348828 0.0367552 1.0644 0.102528 -0.242716 2.0644 0.117893 3.0644
+0.099 0.7 0.0621183 0.00580493 1.099 0.33447 -0.594195 2.099 0.0628306 3.099
+0.0667504 0.409272 0.365134 0.0904977 1.06675 0.113353 -0.218774 2.06675 0.0690425 3.06675
+0.0548016 0.219125 0.44076 0.226466 1.0548 -0.0006275 0.107341 2.0548 -0.044238 3.0548
+0.0638148 0.371682 0.312707 0.00116782 1.06381 0.107664 -0.270514 2.06381 0.142644 3.06381
+0.0608375 0.329204 0.483913 0.0370692 1.06084 0.0436238 -0.192135 2.06084 0.158105 3.06084
+0.0501391 0.0372905 0.286798 0.0424258 1.05014 -0.0530542 0.105135 2.05014 0.0936136 3.05014
+0.0651245 0.388902 0.347279 0.0191611 1.06512 0.107631 -0.269741 2.06512 0.135023 3.06512
+0.0584431 0.290571 0.300017 0.0480421 1.05844 0.0702813 -0.142529 2.05844 0.091963 3.05844
+0.0635615 0.368259 0.427625 0.0444519 1.06356 0.0772233 -0.223807 2.06356 0.133836 3.06356
+0.0531201 0.176639 0.309215 0.0522303 1.05312 0.0110157 -0.0244087 2.05312 0.0905342 3.05312
+0.07278 0.477284 0.388141 0.0427204 1.07278 0.141607 -0.334564 2.07278 0.123722 3.07278
+0.0731694 0.481346 0.478045 0.0369609 1.07317 0.121162 -0.344385 2.07317 0.156453 3.07317
+0.0655727 0.394622 0.276636 0.132343 1.06557 0.128152 -0.162279 2.06557 0.0006478 3.06557
+0.05 1.12119e-05 0.328296 0.00414762 1.05 -0.0820684 0.104136 2.05 0.144341 3.05
+0.0797444 0.545384 0.212034 0.0665416 1.07974 0.219683 -0.378842 2.07974 0.0470686 3.07974
+0.0567139 0.259112 0.457121 0.135249 1.05671 0.0152758 -0.023863 2.05671 0.0518873 3.05671
+0.0593052 0.305044 0.469496 0.039046 1.05931 0.035148 -0.165998 2.05931 0.151803 3.05931
+0.0504548 0.0674361 0.321381 0.364483 1.05045 -0.0466272 0.397047 2.05045 -0.218069 3.05045
+0.0621325 0.348317 0.351462 0.0241559 1.06213 0.086293 -0.224161 2.06213 0.131283 3.06213
+0.0672916 0.415832 0.43245 0.104766 1.06729 0.0998035 -0.211066 2.06729 0.074969 3.06729
+0.0557424 0.239633 0.106129 0.159712 1.05574 0.0932843 0.020079 2.05574 -0.0778733 3.05574
+0.0668354 0.410309 0.364063 0.0330539 1.06684 0.114139 -0.277255 2.06684 0.126165 3.06684
+0.0626945 0.356293 0.372296 0.00195839 1.06269 0.0850725 -0.254335 2.06269 0.15973 3.06269
+0.0617097 0.342195 0.424153 0.0390623 1.06171 0.0650593 -0.203133 2.06171 0.138184 3.06171
+0.05585 0.241867 0.269329 0.169372 1.05585 0.0536013 0.027505 2.05585 -0.0385733 3.05585
+0.0673405 0.416419 0.419183 0.0406258 1.06734 0.103414 -0.275793 2.06734 0.135129 3.06734
+0.0595958 0.30977 0.0583357 0.082174 1.0596 0.140301 -0.127596 2.0596 -0.0146733 3.0596
+0.060272 0.320499 0.277361 0.00592818 1.06027 0.0909092 -0.214571 2.06027 0.12728 3.06027
+0.0689833 0.435698 0.385435 0.0304782 1.06898 0.12149 -0.30522 2.06898 0.135152 3.06898
+0.0804241 0.55158 0.461709 0.0404817 1.08042 0.160363 -0.411098 2.08042 0.148031 3.08042
+0.068325 0.428078 0.324339 0.0465509 1.06832 0.132954 -0.281527 2.06833 0.100751 3.06833
+0.0729416 0.478974 0.41816 0.0550122 1.07294 0.134947 -0.323962 2.07294 0.120436 3.07294
+0.0658282 0.397846 0.336458 0.0342995 1.06583 0.114808 -0.263546 2.06583 0.116638 3.06583
+0.0723229 0.472471 0.435614 0.0350362 1.07232 0.127332 -0.337435 2.07232 0.145648 3.07232
+0.0643759 0.379155 0.451545 0.0528716 1.06438 0.0766913 -0.226283 2.06438 0.132592 3.06438
+0.0885687 0.621037 0.392608 0.0169954 1.08857 0.212366 -0.504042 2.08857 0.150787 3.08857
+0.0683882 0.428814 0.367818 0.0317775 1.06839 0.122452 -0.297036 2.06839 0.128568 3.06839
+0.0653365 0.391619 0.44335 0.115936 1.06534 0.084972 -0.175683 2.06534 0.067069 3.06534
+0.0629116 0.359327 0.421529 0.0626299 1.06291 0.0742813 -0.196697 2.06291 0.113829 3.06291
+0.0644969 0.380748 0.41016 0.0607867 1.0645 0.087834 -0.219961 2.0645 0.112261 3.0645
+0.055781 0.240437 0.393113 0.033227 1.05578 0.0219403 -0.10721 2.05578 0.134707 3.05578
+0.0633296 0.365097 0.483068 0.008668 1.06333 0.0617815 -0.256429 2.06333 0.186252 3.06333
+0.055581 0.236242 0.472613 0.25 1.05558 -3.225e-05 0.113758 2.05558 -0.0582161 3.05558
+0.0623103 0.35086 0.486496 0.0191225 1.06231 0.053806 -0.231737 2.06231 0.176826 3.06231
+0.0603166 0.321195 0.206386 0.196059 1.06032 0.109001 -0.025136 2.06032 -0.0841432 3.06032
+0.0575482 0.27474 0.479581 0.0212891 1.05755 0.0174747 -0.153451 2.05755 0.172585 3.05755
+0.0737483 0.487322 0.422561 0.010337 1.07375 0.138021 -0.376985 2.07375 0.166431 3.07375
+0.0590025 0.300041 0.307708 0.0231384 1.059 0.0730935 -0.176903 2.059 0.119174 3.059
+0.0638134 0.371664 0.378054 0.0337254 1.06381 0.0913185 -0.237939 2.06381 0.129691 3.06381
+0.054 0.199999 0.338704 0.25 1.054 0.0153235 0.150001 2.054 -0.0983888 3.054
+0.0595499 0.30903 0.394578 0.100948 1.05955 0.0558705 -0.108082 2.05955 0.0674254 3.05955
+0.0640094 0.374292 0.332294 0.0570523 1.06401 0.104073 -0.21724 2.06401 0.0926359 3.06401
+0.0515582 0.124829 0.193728 0.131582 1.05156 0.0139825 0.106753 2.05156 -0.0234636 3.05156
+0.0503601 0.0600094 0.136272 0.00254221 1.05036 -0.0040633 0.0425328 2.05036 0.0883394 3.05036
+0.0592112 0.303499 0.402897 0.0352187 1.05921 0.0510253 -0.16828 2.05921 0.13565 3.05921
+0.065205 0.389936 0.447281 0.0464019 1.0652 0.0831478 -0.243534 2.06521 0.137782 3.06521
+0.0661537 0.401916 0.404279 0.0387522 1.06615 0.0998882 -0.263164 2.06615 0.132531 3.06615
+0.099 0.7 0.154393 0.25 1.099 0.311402 -0.35 2.099 -0.153682 3.099
+0.079108 0.539518 0.136896 0.120954 1.07911 0.235535 -0.318564 2.07911 -0.0298852 3.07911
+0.0655362 0.39416 0.43394 0.0420242 1.06554 0.088595 -0.252136 2.06554 0.138158 3.06554
+0.0524415 0.156252 -1.00216e-12 0.00308647 1.05244 0.078126 -0.0531655 2.05244 0.0469135 3.05244
+0.0696545 0.443334 0.44351 0.07341 1.06965 0.110789 -0.269924 2.06965 0.109643 3.06965
+0.0666131 0.407592 0.412559 0.104798 1.06661 0.100656 -0.202794 2.06661 0.0689697 3.06661
+0.0577799 0.278925 0.40182 0.0689843 1.05778 0.0390075 -0.109941 2.05778 0.101562 3.05778
+0.0703585 0.451204 0.5 0.020328 1.07036 0.100602 -0.330876 2.07036 0.179672 3.07036
+0.0633735 0.365697 0.436023 0.0335898 1.06337 0.0738427 -0.232107 2.06337 0.147217 3.06337
+0.0617956 0.343447 0.404652 0.0700276 1.0618 0.0705605 -0.173419 2.0618 0.101368 3.0618
+0.0622269 0.34967 0.239733 0.11407 1.06223 0.114902 -0.1356 2.06223 0.0078499 3.06223
+0.062993 0.360458 0.308371 0.0363308 1.06299 0.103136 -0.224127 2.06299 0.106181 3.06299
+0.0701959 0.449398 0.224366 0.0080382 1.0702 0.168608 -0.34136 2.0702 0.109272 3.0702
+0.0612699 0.335707 0.451476 0.208377 1.06127 0.0549845 -0.02733 2.06127 -0.0229342 3.06127
+0.0581798 0.286004 0.5 0.0221654 1.05818 0.018002 -0.163839 2.05818 0.177835 3.05818
+0.0710475 0.458775 0.435378 0.0514115 1.07105 0.120543 -0.307364 2.07105 0.129202 3.07105
+0.0570122 0.264806 0.274163 0.0221254 1.05701 0.0638622 -0.142681 2.05701 0.110123 3.05701
+0.0567642 0.260081 0.228069 0.0725077 1.05676 0.0730233 -0.0875733 2.05676 0.045913 3.05676
+0.05 -1.55489e-11 0.239947 0.467298 1.05 -0.0599868 0.567298 2.05 -0.345314 3.05
+0.0773272 0.522754 0.308742 0.0235477 1.07733 0.184192 -0.399206 2.07733 0.119075 3.07733
+0.061212 0.334843 0.373756 0.00346324 1.06121 0.0739825 -0.23138 2.06121 0.158664 3.06121
+0.0603787 0.322159 0.224512 0.0161045 1.06038 0.104951 -0.206054 2.06038 0.101249 3.06038
+0.0554076 0.232543 0.359068 0.0178417 1.05541 0.0265045 -0.114701 2.05541 0.139879 3.05541
+0.05 -9.48704e-11 0.432815 0.240402 1.05 -0.108204 0.340402 2.05 -0.0605575 3.05
+0.0727977 0.477469 0.056041 0.0301172 1.0728 0.224724 -0.347352 2.0728 0.0366951 3.0728
+0.0801532 0.54912 0.446094 0.207465 1.08015 0.163037 -0.241655 2.08015 -0.0236368 3.08015
+0.0680865 0.425282 0.379689 0.00269809 1.06809 0.117719 -0.322584 2.06809 0.161209 3.06809
+0.059818 0.313337 0.416938 0.0703004 1.05982 0.052434 -0.143037 2.05982 0.104781 3.05982
+0.05 3.14614e-15 0.41325 0.734177 1.05 -0.103312 0.834177 2.05 -0.560202 3.05
+0.0657864 0.397321 0.410107 0.0038939 1.06579 0.0961337 -0.293427 2.06579 0.169138 3.06579
+0.053132 0.176975 0.499995 0.00364068 1.05313 -0.0365113 -0.0733343 2.05313 0.196358 3.05313
+0.0539607 0.199016 0.371246 0.0539684 1.05396 0.0066965 -0.0450476 2.05396 0.107405 3.05396
+0.0624623 0.353019 0.405267 0.0184364 1.06246 0.0751928 -0.234583 2.06246 0.153144 3.06246
+0.054 0.2 0.416376 0.704381 1.054 -0.004094 0.604381 2.054 -0.529468 3.054
+0.0837901 0.581292 0.395508 0.122894 1.08379 0.191769 -0.358398 2.08379 0.0457584 3.08379
+0.0622056 0.349365 0.322983 0.0509665 1.06221 0.0939367 -0.198398 2.06221 0.0959284 3.06221
+0.0503871 0.0622155 0.439548 2.98737e-60 1.05039 -0.0787792 0.0377845 2.05039 0.181864 3.05039
+0.0627619 0.357238 0.5 0.00440797 1.06276 0.053619 -0.25283 2.06276 0.195592 3.06276
+0.0569628 0.263871 0.470839 0.0720273 1.05696 0.0142258 -0.0918437 2.05696 0.119224 3.05696
+0.0525497 0.159679 0.500003 0.247045 1.05255 -0.0451613 0.187366 2.05255 -0.0470441 3.05255
+0.0515246 0.123476 0.42298 0.283407 1.05152 -0.044007 0.259931 2.05152 -0.106513 3.05152
+0.0678568 0.422573 0.329515 0.0905188 1.06786 0.128908 -0.232054 2.06786 0.0583357 3.06786
+0.0628332 0.358234 0.46772 0.00313587 1.06283 0.062187 -0.255098 2.06283 0.18718 3.06283
+0.0701068 0.448406 0.479139 0.000547277 1.07011 0.104418 -0.347859 2.07011 0.193194 3.07011
+0.0505854 0.0765128 0.443287 0.266351 1.05059 -0.0725654 0.289838 2.05059 -0.0833649 3.05059
+0.0678946 0.42302 0.404403 0.00903199 1.06789 0.110409 -0.313988 2.06789 0.162289 3.06789
+0.0688031 0.433626 0.404053 0.00195707 1.0688 0.1158 -0.331669 2.0688 0.169259 3.0688
+0.0502017 0.0449088 0.49991 0.00260889 1.0502 -0.102523 0.0577001 2.0502 0.197364 3.0502
+0.099 0.7 0.0949073 0.165337 1.099 0.326273 -0.434663 2.099 -0.0868648 3.099
+0.0570012 0.264597 0.395844 0.0814306 1.057 0.0333375 -0.0831664 2.057 0.0873226 3.057
+0.0599954 0.316156 0.335524 0.0589156 1.06 0.074197 -0.15724 2.06 0.0917416 3.06
+0.0530657 0.17509 0.353886 0.0854645 1.05307 -0.0009265 0.0103745 2.05307 0.0707013 3.05307
+0.0500889 0.0298085 0.348855 0.0570875 1.05009 -0.0723095 0.127279 2.05009 0.097569 3.05009
+0.0593884 0.306406 0.310799 0.0772026 1.05939 0.0755033 -0.129203 2.05939 0.0660371 3.05939
+0.073254 0.482224 0.376965 0.0923656 1.07325 0.146871 -0.289858 2.07325 0.0707239 3.07325
+0.067177 0.414452 0.48449 0.0363853 1.06718 0.0861035 -0.278067 2.06718 0.158962 3.06718
+0.0657616 0.397009 0.387647 0.060798 1.06576 0.101593 -0.236211 2.06576 0.105496 3.06576
+0.0584571 0.290811 0.410382 0.0421413 1.05846 0.04281 -0.14867 2.05846 0.130973 3.05846
+0.0644082 0.379581 0.5 0.0344617 1.06441 0.0647905 -0.245119 2.06441 0.165538 3.06441
+0.0603918 0.322364 0.0610789 0.00601486 1.06039 0.145912 -0.216349 2.06039 0.0623088 3.06039
+0.0538015 0.194974 0.244709 0.135132 1.0538 0.0363098 0.040158 2.0538 -0.0117193 3.0538
+0.0679419 0.423578 0.413753 0.0316712 1.06794 0.108351 -0.291907 2.06794 0.142455 3.06794
+0.0526889 0.163978 0.0382398 0.263957 1.05269 0.0724291 0.199979 2.05269 -0.202485 3.05269
+0.0533858 0.184007 0.42245 0.0655046 1.05339 -0.013609 -0.0185024 2.05339 0.11123 3.05339
+0.0645155 0.380992 0.481154 0.0888309 1.06452 0.0702075 -0.192161 2.06452 0.105515 3.06452
+0.068869 0.434385 0.337202 0.033935 1.06887 0.132892 -0.30045 2.06887 0.117226 3.06887
+0.0684391 0.429408 0.352959 0.0838592 1.06844 0.126464 -0.245549 2.06844 0.0720285 3.06844
+0.0522525 0.150082 0.465995 0.248793 1.05225 -0.0414578 0.198711 2.05225 -0.0589945 3.05225
+0.0651349 0.389036 0.425 0.0796684 1.06513 0.088268 -0.209368 2.06513 0.0978316 3.06513
+0.0548697 0.220674 0.475314 0.0357328 1.05487 -0.0084915 -0.0849412 2.05487 0.156861 3.05487
+0.051045 0.102227 0.213982 0.621813 1.05105 -0.002382 0.619586 2.05104 -0.507618 3.05104
+0.054 0.2 0.446446 0.36 1.054 -0.0116115 0.26 2.054 -0.176066 3.054
+0.0706654 0.454592 0.420159 0.0136918 1.07067 0.122256 -0.3409 2.07067 0.162356 3.07067
+0.0583052 0.288188 0.134271 0.0395039 1.05831 0.110526 -0.148684 2.05831 0.0507774 3.05831
+0.0643576 0.378915 0.5 3.34549e-46 1.06436 0.0644575 -0.278915 2.06436 0.2 3.06436
+0.0547253 0.217377 0.276078 0.0319731 1.05473 0.039669 -0.0854039 2.05473 0.10085 3.05473
+0.0613817 0.337368 0.299187 0.0257444 1.06138 0.0938873 -0.211624 2.06138 0.114012 3.06138
+0.0900849 0.633127 0.22492 0.25 1.09008 0.260333 -0.283127 2.09008 -0.132524 3.09008
+0.051121 0.105879 0.401657 0.0222954 1.05112 -0.0474747 0.0164164 2.05112 0.148202 3.05112
+0.0637587 0.370927 0.393219 0.0324944 1.06376 0.0871588 -0.238433 2.06376 0.135471 3.06376
+0.0636435 0.369372 0.415498 0.0593715 1.06364 0.0808115 -0.21 2.06364 0.115278 3.06364
+0.0604692 0.323561 0.363693 0.0569329 1.06047 0.0708572 -0.166628 2.06047 0.102175 3.06047
+0.0621818 0.349024 0.436426 0.0397531 1.06218 0.0654055 -0.209271 2.06218 0.141175 3.06218
+0.0636698 0.369727 0.37252 0.0385896 1.06367 0.0917335 -0.231137 2.06367 0.123166 3.06367
+0.0522747 0.150823 0.433196 0.252717 1.05227 -0.0328875 0.201894 2.05227 -0.0727582 3.05227
+0.0534865 0.186722 0.363559 0.031216 1.05349 0.00247125 -0.055506 2.05349 0.127852 3.05349
+0.0658736 0.398417 0.451879 0.0342307 1.06587 0.0862388 -0.264186 2.06587 0.151333 3.06587
+0.0764892 0.514676 0.359026 0.0265088 1.07649 0.167581 -0.388167 2.07649 0.131199 3.07649
+0.0636838 0.369916 0.273136 0.0109232 1.06368 0.116674 -0.258993 2.06368 0.121018 3.06368
+0.0618782 0.344648 0.395326 0.0779512 1.06188 0.0734925 -0.166697 2.06188 0.0906466 3.06188
+0.0660562 0.400702 0.37325 0.0294234 1.06606 0.107038 -0.271279 2.06606 0.132552 3.06606
+0.0606761 0.326743 0.464707 0.0043604 1.06068 0.0471948 -0.222383 2.06068 0.185052 3.06068
+0.0647788 0.384431 0.30146 0.026876 1.06478 0.116851 -0.257555 2.06478 0.113562 3.06478
+0.0644058 0.379549 0.259467 0.0766409 1.06441 0.124908 -0.202908 2.06441 0.0511992 3.06441
+0.0701716 0.449128 0.303812 0.00435581 1.07017 0.148611 -0.344772 2.07017 0.136788 3.07017
+0.0627765 0.357442 7.9358e-09 0.174985 1.06278 0.178721 -0.082457 2.06278 -0.124985 3.06278
+0.0554605 0.233678 0.368348 0.0341393 1.05546 0.024752 -0.0995387 2.05546 0.126365 3.05546
+0.0500604 0.0245737 0.499957 0.000724545 1.05006 -0.112702 0.0761508 2.05006 0.199263 3.05006
+0.0657893 0.397357 0.397553 0.0676741 1.06579 0.0992903 -0.229683 2.06579 0.101592 3.06579
+0.0586677 0.294409 0.388913 0.0444627 1.05867 0.0499762 -0.149946 2.05867 0.122211 3.05867
+0.0515971 0.126376 0.500015 0.261534 1.0516 -0.0618158 0.235158 2.0516 -0.0615295 3.0516
+0.061848 0.344209 0.419245 0.0595298 1.06185 0.0672932 -0.184679 2.06185 0.116244 3.06185
+0.0735842 0.485636 0.394398 0.0256998 1.07358 0.144218 -0.359936 2.07358 0.14262 3.07358
+0.054 0.2 0.5 0.301355 1.054 -0.025 0.201355 2.054 -0.101355 3.054
+0.052671 0.163432 0.433103 0.34088 1.05267 -0.0265598 0.277448 2.05267 -0.160949 3.05267
+0.0706788 0.45474 0.425067 0.0330297 1.07068 0.121103 -0.32171 2.07068 0.14449 3.07068
+0.0651208 0.388854 0.479851 0.035033 1.06512 0.0744642 -0.253821 2.06512 0.158922 3.06512
+0.0552172 0.228412 0.273447 0.0205188 1.05522 0.0458443 -0.107893 2.05522 0.111515 3.05522
+0.0677593 0.421418 0.5 0.0240932 1.06776 0.085709 -0.297325 2.06776 0.175907 3.06776
+0.0520776 0.14414 0.499997 0.306575 1.05208 -0.0529293 0.262435 2.05208 -0.106576 3.05208
+0.0560521 0.246011 0.417314 0.0291564 1.05605 0.018677 -0.116855 2.05605 0.146038 3.05605
+0.0530511 0.174675 0.405708 0.0251541 1.05305 -0.0140895 -0.0495209 2.05305 0.146558 3.05305
+0.0568391 0.261517 0.271229 0.22293 1.05684 0.0629513 0.061413 2.05684 -0.0915613 3.05684
+0.0583721 0.289345 0.37283 0.0255825 1.05837 0.051465 -0.163763 2.05837 0.136267 3.05837
+0.0539962 0.199906 0.46317 0.25 1.054 -0.0158395 0.150094 2.054 -0.061049 3.054
+0.05899 0.299834 0.479964 0.0507085 1.05899 0.029926 -0.149125 2.05899 0.143281 3.05899
+0.0540288 0.200718 0.489008 0.273483 1.05403 -0.021893 0.172765 2.05403 -0.0767806 3.05403
+0.0737893 0.487742 0.438385 0.10352 1.07379 0.134275 -0.284222 2.07379 0.0779955 3.07379
+0.0608774 0.329808 0.298737 0.0175352 1.06088 0.0902198 -0.212273 2.06088 0.122086 3.06088
+0.0598366 0.313634 0.448334 0.0278533 1.05984 0.0447335 -0.185781 2.05984 0.156647 3.05984
+0.0729233 0.478783 0.427512 0.0193995 1.07292 0.132514 -0.359384 2.07292 0.158854 3.07292
+0.05 1.13772e-09 0.346205 0.227636 1.05 -0.0865512 0.327636 2.05 -0.0737745 3.05
+0.057361 0.271311 0.366826 0.135533 1.05736 0.043949 -0.035778 2.05736 0.0245148 3.05736
+0.0790504 0.538984 0.388125 0.121022 1.07905 0.172461 -0.317962 2.07905 0.0454155 3.07905
+0.0504186 0.0646991 0.5 0.524597 1.05042 -0.0926504 0.559898 2.05042 -0.324597 3.05042
+0.0782087 0.531118 0.5 0.0583501 1.07821 0.140559 -0.372768 2.07821 0.14165 3.07821
+0.099 0.7 0.403996 0.0270498 1.099 0.249001 -0.57295 2.099 0.144149 3.099
+0.0627679 0.357322 0.421064 0.0928679 1.06277 0.073395 -0.164454 2.06277 0.0834513 3.06277
+0.0548963 0.221277 0.463999 0.196199 1.0549 -0.00536125 0.074922 2.0549 -0.0069993 3.0549
+0.05 -6.59789e-05 0.418597 0.00267877 1.05 -0.104682 0.102745 2.05 0.1729 3.05
+0.064542 0.38134 0.472588 0.00562413 1.06454 0.072523 -0.275716 2.06454 0.186152 3.06454
+0.0594505 0.307417 0.418507 0.0342758 1.05945 0.0490817 -0.173141 2.05945 0.141276 3.05945
+0.0549341 0.222128 0.439324 0.0571132 1.05493 0.001233 -0.0650148 2.05493 0.124684 3.05493
+0.0681353 0.425856 0.41482 0.0150503 1.06814 0.109223 -0.310806 2.06814 0.159396 3.06814
+0.0629488 0.359845 0.4034 0.04183 1.06295 0.0790725 -0.218015 2.06295 0.12919 3.06295
+0.0618036 0.343564 0.373476 0.151929 1.0618 0.078413 -0.091635 2.0618 0.0101138 3.0618
+0.0708435 0.456547 0.407947 0.0521546 1.07084 0.126287 -0.304392 2.07084 0.12023 3.07084
+0.061067 0.332671 0.0484465 0.164427 1.06107 0.154224 -0.068244 2.06107 -0.099893 3.06107
+0.0517953 0.13399 0.273444 0.45372 1.0518 -0.001366 0.41973 2.0518 -0.321687 3.0518
+0.0595438 0.30893 0.413759 0.049974 1.05954 0.0510252 -0.158956 2.05954 0.124154 3.05954
+0.0606452 0.32627 0.447326 0.0518689 1.06065 0.0513035 -0.174401 2.06065 0.132329 3.06065
+0.0636458 0.369403 0.404264 0.0451359 1.06365 0.0836355 -0.224267 2.06365 0.126143 3.06365
+0.0622352 0.349789 0.398397 0.0573187 1.06224 0.0752953 -0.19247 2.06224 0.1122 3.06224
+0.0606153 0.325811 0.372084 0.0166884 1.06062 0.0698845 -0.209123 2.06062 0.144937 3.06062
+0.0650188 0.387542 0.467998 0.0531061 1.06502 0.0767715 -0.234436 2.06502 0.137293 3.06502
+0.0574015 0.272057 0.313395 1.23869e-50 1.0574 0.0576798 -0.172057 2.0574 0.144018 3.0574
+0.0542444 0.20602 0.337439 0.091113 1.05424 0.0186503 -0.014907 2.05424 0.0601187 3.05424
+0.06036 0.32187 0.378055 0.027682 1.06036 0.0664213 -0.194188 2.06036 0.135734 3.06036
+0.0653721 0.392073 0.379547 0.0456432 1.06537 0.10115 -0.24643 2.06537 0.118221 3.06537
+0.0632343 0.36379 0.465449 0.100853 1.06323 0.0655328 -0.162937 2.06323 0.0887817 3.06323
+0.0697256 0.444136 0.138789 0.057168 1.06973 0.187371 -0.286968 2.06973 0.0344687 3.06973
+0.0502272 0.0476668 0.170812 0.419533 1.05023 -0.0188696 0.471866 2.05023 -0.318289 3.05023
+0.074557 0.49555 0.434085 0.00165086 1.07456 0.139254 -0.393899 2.07456 0.178575 3.07456
+0.0635674 0.36834 0.472699 0.0473722 1.06357 0.0659953 -0.220968 2.06357 0.144437 3.06357
+0.0628897 0.359023 0.375615 0.0551844 1.06289 0.0856077 -0.203839 2.06289 0.1075 3.06289
+0.0613913 0.33751 0.466107 0.0755751 1.06139 0.0522282 -0.161935 2.06139 0.114257 3.06139
+0.0523654 0.153798 0.435291 0.0842745 1.05237 -0.0319238 0.0304765 2.05237 0.0963128 3.05237
+0.0623108 0.350868 0.297653 0.152171 1.06231 0.101021 -0.098697 2.06231 -0.0128751 3.06231
+0.054682 0.21638 0.486899 0.234372 1.05468 -0.0135348 0.117992 2.05468 -0.0383023 3.05468
+0.059 0.3 0.159821 0.25 1.059 0.110045 0.05 2.059 -0.152054 3.059
+0.0649534 0.386696 0.359068 0.169207 1.06495 0.103581 -0.117489 2.06495 -0.0114866 3.06495
+0.0650745 0.388259 4.00609e-10 0.106911 1.06507 0.194129 -0.181348 2.06507 -0.056911 3.06507
+0.0620388 0.34697 0.482707 0.0709216 1.06204 0.0528083 -0.176048 2.06204 0.123891 3.06204
+0.0592992 0.304945 0.362772 0.000260382 1.0593 0.0617795 -0.204685 2.0593 0.158571 3.0593
+0.0757164 0.507114 0.400632 0.100529 1.07572 0.153399 -0.306585 2.07572 0.0696606 3.07572
+0.0902966 0.634796 0.0575776 0.0160039 1.0903 0.303004 -0.518792 2.0903 0.0512694 3.0903
+0.0608988 0.330133 0.190568 0.0732432 1.0609 0.117425 -0.15689 2.0609 0.0339272 3.0609
+0.0632422 0.363898 0.427176 0.0140947 1.06324 0.075155 -0.249803 2.06324 0.164058 3.06324
+0.0651254 0.388914 0.285812 0.172933 1.06513 0.123004 -0.115981 2.06513 -0.0371894 3.06513
+0.0625105 0.353702 0.425111 0.0350567 1.06251 0.0705733 -0.218645 2.06251 0.142477 3.06251
+0.0629084 0.359282 0.211202 0.0518034 1.06291 0.12684 -0.207479 2.06291 0.0615572 3.06291
+0.0691354 0.43744 0.45419 0.0387031 1.06914 0.105173 -0.298737 2.06914 0.147554 3.06914
+0.071732 0.466176 0.284878 0.0464936 1.07173 0.161868 -0.319682 2.07173 0.0889698 3.07173
+0.0512751 0.112921 0.500001 0.372565 1.05128 -0.0685398 0.359644 2.05128 -0.172565 3.05128
+0.05 -1.76864e-10 0.170977 0.330272 1.05 -0.0427443 0.430272 2.05 -0.228979 3.05
+0.0617589 0.342912 0.5 0.20979 1.06176 0.046456 -0.033122 2.06176 -0.00979 3.06176
+0.0503638 0.0603142 0.300215 0.194482 1.05036 -0.0448967 0.234168 2.05036 -0.0544175 3.05036
+0.0601459 0.318527 0.41778 0.058261 1.06015 0.0548185 -0.160266 2.06015 0.117073 3.06015
+0.0652943 0.391079 0.388647 0.000491229 1.06529 0.0983777 -0.290588 2.06529 0.166103 3.06529
+0.0697741 0.44468 0.480884 0.0397892 1.06977 0.102119 -0.304891 2.06977 0.154476 3.06977
+0.0502412 0.0491156 0.3963 0.00113028 1.05024 -0.0745172 0.0520147 2.05024 0.16776 3.05024
+0.0680586 0.424955 0.456807 0.0300615 1.06806 0.0982758 -0.294894 2.06806 0.156981 3.06806
+0.0500801 0.0282989 0.441237 0.0202094 1.05008 -0.0961598 0.0919105 2.05008 0.162162 3.05008
+0.0627438 0.356985 0.354354 0.028586 1.06274 0.089904 -0.228399 2.06274 0.12772 3.06274
+0.0658244 0.397799 0.5 0.0569798 1.06582 0.0738995 -0.240819 2.06582 0.14302 3.06582
+0.0577597 0.278562 0.356948 0.0916668 1.05776 0.050044 -0.0868952 2.05776 0.0654176 3.05776
+0.0650965 0.388543 0.101883 0.0859983 1.0651 0.168801 -0.202545 2.0651 -0.0054334 3.0651
+0.0587582 0.295942 0.372642 0.0108985 1.05876 0.0548105 -0.185043 2.05876 0.150894 3.05876
+0.0667486 0.40925 0.410828 0.0420021 1.06675 0.101918 -0.267248 2.06675 0.131246 3.06675
+0.099 0.7 0.286332 0.0280482 1.099 0.278417 -0.571952 2.099 0.107851 3.099
+0.0671114 0.413659 0.321069 0.00377847 1.06711 0.126562 -0.309881 2.06711 0.142542 3.06711
+0.0587218 0.295327 0.411335 0.07324 1.05872 0.0448298 -0.122087 2.05872 0.10016 3.05872
+0.0596709 0.310981 0.426746 0.106759 1.05967 0.048804 -0.104222 2.05967 0.0712648 3.05967
+0.0528219 0.167985 0.441739 0.304525 1.05282 -0.0264423 0.23654 2.05282 -0.122003 3.05282
+0.0647797 0.384444 0.287705 0.0711611 1.06478 0.120296 -0.213283 2.06478 0.0651504 3.06478
+0.054 0.2 0.5 0.498562 1.054 -0.025 0.398562 2.054 -0.298562 3.054
+0.0651903 0.389747 0.399565 0.0335583 1.06519 0.0949823 -0.256189 2.06519 0.136311 3.06519
+0.0633917 0.365946 0.292995 1.80152e-47 1.06339 0.109724 -0.265946 2.06339 0.137899 3.06339
+0.0608727 0.329738 0.331296 0.0397832 1.06087 0.082045 -0.189955 2.06087 0.109606 3.06087
+0.0582015 0.286382 0.416882 0.0273193 1.0582 0.0389705 -0.159063 2.0582 0.147745 3.0582
+0.0503576 0.0597998 0.246208 0.115428 1.05036 -0.0316521 0.155628 2.05036 0.0084344 3.05036
+0.0711997 0.460432 0.185885 0.058157 1.0712 0.183745 -0.302275 2.0712 0.0476085 3.0712
+0.0690492 0.436454 0.47183 0.0024672 1.06905 0.100269 -0.333987 2.06905 0.189082 3.06905
+0.0632921 0.364583 0.41572 0.00779871 1.06329 0.0783615 -0.256784 2.06329 0.166917 3.06329
+0.0651608 0.389369 0.5 0.00328093 1.06516 0.0696845 -0.286088 2.06516 0.196719 3.06516
+0.0609734 0.331261 0.376753 0.0749241 1.06097 0.0714423 -0.156337 2.06097 0.0881018 3.06097
+0.070965 0.457876 0.355993 0.0342883 1.07096 0.13994 -0.323588 2.07097 0.12251 3.07097
+0.0660914 0.401141 0.398305 0.0505572 1.06609 0.100994 -0.250584 2.06609 0.118934 3.06609
+0.05 -4.34738e-06 0.384523 0.00894728 1.05 -0.0961329 0.108952 2.05 0.15641 3.05
+0.0898679 0.63141 0.06268 2.30547e-45 1.08987 0.300035 -0.53141 2.08987 0.068804 3.08987
+0.0502042 0.0451926 0.0369103 0.00197831 1.0502 0.0133687 0.0567857 2.0502 0.0590948 3.0502
+0.0654007 0.392438 0.410117 0.0752518 1.0654 0.0936898 -0.217186 2.0654 0.0977833 3.0654
+0.0501521 0.038999 0.417866 0.0102186 1.05015 -0.084967 0.0712196 2.05015 0.165141 3.05015
+0.0616165 0.340829 0.5 1.07528e-48 1.06162 0.0454145 -0.240829 2.06162 0.2 3.06162
+0.0592959 0.304892 0.452923 0.0772064 1.0593 0.0392152 -0.127686 2.0593 0.108671 3.0593
+0.05 0.000209908 0.499681 0.0501715 1.05 -0.124815 0.149962 2.05 0.149733 3.05
+0.0627911 0.357647 0.462643 0.0142251 1.06279 0.0631627 -0.243422 2.06279 0.174568 3.06279
+0.0514114 0.118803 0.353956 0.0598899 1.05141 -0.0290875 0.0410869 2.05141 0.0962969 3.05141
+0.0651466 0.389186 0.415895 0.0485478 1.06515 0.0906192 -0.240638 2.06515 0.126221 3.06515
+0.0604914 0.323904 0.439316 0.0221572 1.06049 0.052123 -0.201747 2.06049 0.159638 3.06049
+0.0648285 0.385077 0.421851 0.0704968 1.06483 0.0870758 -0.21458 2.06483 0.106058 3.06483
+0.0689122 0.434881 0.467474 0.0340322 1.06891 0.100572 -0.300849 2.06891 0.15621 3.06891
+0.0501737 0.0416744 0.499991 0.0696673 1.05017 -0.104161 0.127993 2.05017 0.13033 3.05017
+0.0674216 0.417391 0.440972 0.0398574 1.06742 0.0984525 -0.277534 2.06742 0.142434 3.06742
+0.05 -9.99264e-09 0.0920857 0.115861 1.05 -0.0230214 0.215861 2.05 -0.0382353 3.05
+0.0923997 0.651151 0.397705 0.134081 1.0924 0.226149 -0.41707 2.0924 0.0352305 3.0924
+0.0527842 0.166859 0.453563 0.276449 1.05278 -0.0299612 0.20959 2.05278 -0.0903801 3.05278
+0.0633644 0.365573 0.415228 0.00140468 1.06336 0.0789795 -0.264168 2.06336 0.173164 3.06336
+0.0517226 0.131246 0.416461 0.0672418 1.05172 -0.0384923 0.0359958 2.05172 0.107697 3.05172
+0.055105 0.225941 0.376612 0.0625798 1.0551 0.0188175 -0.0633612 2.05511 0.100404 3.05511
+0.066664 0.408215 0.435517 0.0897095 1.06666 0.0952283 -0.218505 2.06666 0.0909456 3.06666
+0.0681852 0.426441 0.383384 0.0228367 1.06819 0.117375 -0.303604 2.06819 0.142178 3.06819
+0.0618948 0.344888 0.427778 0.0714962 1.06189 0.0654995 -0.173392 2.06189 0.106837 3.06189
+0.0500515 0.0226922 0.500392 0.0080531 1.05005 -0.113752 0.0853609 2.05005 0.192064 3.05005
+0.0620112 0.346571 0.412864 0.00468194 1.06201 0.0700695 -0.241889 2.06201 0.169177 3.06201
+0.05 2.7773e-11 0.124401 0.195523 1.05 -0.0311002 0.295523 2.05 -0.108203 3.05
+0.0653669 0.392006 0.282799 0.0879299 1.06537 0.125303 -0.204076 2.06537 0.0469098 3.06537
+0.0520547 0.143344 0.474693 0.281332 1.05205 -0.0470012 0.237988 2.05205 -0.0889241 3.05205
+0.0801318 0.548924 0.292656 0.0591553 1.08013 0.201298 -0.389769 2.08013 0.0786415 3.08013
+0.0670698 0.413156 0.458913 0.136592 1.06707 0.0918498 -0.176564 2.06707 0.0510819 3.06707
+0.0670889 0.413387 0.368864 0.0192611 1.06709 0.114477 -0.294126 2.06709 0.141398 3.06709
+0.0635009 0.367435 0.302634 0.0773883 1.0635 0.108059 -0.190047 2.0635 0.0634019 3.0635
+0.064775 0.384383 0.381219 0.0269879 1.06478 0.0968867 -0.257395 2.06478 0.137378 3.06478
+0.065565 0.394526 0.467543 0.158899 1.06557 0.0803772 -0.135627 2.06556 0.0313639 3.06556
+0.0630446 0.361174 0.423693 0.0517493 1.06304 0.0746638 -0.209425 2.06304 0.125359 3.06304
+0.0639957 0.374109 0.422446 0.064185 1.064 0.081443 -0.209924 2.064 0.112549 3.064
+0.0638401 0.372023 0.341081 0.0320823 1.06384 0.100741 -0.239941 2.06384 0.120242 3.06384
+0.0645717 0.381729 0.371251 0.00245082 1.06457 0.0980517 -0.279278 2.06457 0.158924 3.06457
+0.0513674 0.116935 0.329075 0.0233333 1.05137 -0.0238013 0.0063983 2.05137 0.125389 3.05137
+0.0509949 0.0997431 0.450938 0.0344515 1.05099 -0.062863 0.0347084 2.05099 0.15083 3.05099
+0.064771 0.384331 0.0868455 0.189818 1.06477 0.170454 -0.094513 2.06477 -0.113764 3.06477
+0.05 -3.01119e-08 0.5 0.129839 1.05 -0.125 0.229839 2.05 0.070161 3.05
+0.05042 0.064811 0.082258 0.295845 1.05042 0.011841 0.331034 2.05042 -0.221168 3.05042
+0.0685501 0.430699 0.458253 0.0724248 1.06855 0.100786 -0.258274 2.06855 0.115051 3.06855
+0.099 0.7 0.197844 3.13764e-47 1.099 0.300539 -0.6 2.099 0.109353 3.099
+0.0515304 0.123708 0.446466 0.00855372 1.05153 -0.0497625 -0.0151543 2.05153 0.175386 3.05153
+0.0563032 0.251061 0.216644 0.0473088 1.0563 0.0713695 -0.103752 2.0563 0.0676844 3.0563
+0.0539977 0.199943 0.100207 0.25 1.054 0.0749198 0.150057 2.054 -0.169938 3.054
+0.0623386 0.351263 0.291705 0.0439978 1.06234 0.102705 -0.207265 2.06234 0.0935137 3.06234
+0.0515883 0.126028 0.115579 0.0075079 1.05159 0.0341193 -0.0185201 2.05159 0.0771658 3.05159
+0.0513713 0.117103 0.474111 0.0150584 1.05137 -0.0599763 -0.0020446 2.05137 0.177175 3.05137
+0.0505153 0.0717832 0.5 0.59927 1.05052 -0.0891084 0.627487 2.05052 -0.39927 3.05052
+0.0587964 0.296588 0.346351 0.00532294 1.0588 0.0617063 -0.191265 2.0588 0.148582 3.0588
+0.05 -0.000663408 0.472857 0.0266418 1.05 -0.118546 0.127305 2.05 0.165215 3.05
+0.064774 0.384369 0.5 0.00855469 1.06477 0.0671845 -0.275814 2.06477 0.191445 3.06477
+0.0517796 0.133403 0.269571 0.0599182 1.05178 -0.00069125 0.0265152 2.05178 0.0709531 3.05178
+0.0705584 0.453414 0.446165 0.000594436 1.07056 0.115166 -0.35282 2.07056 0.183255 3.07056
+0.0811613 0.558223 0.31905 0.010657 1.08116 0.199349 -0.447566 2.08116 0.135058 3.08116
+0.0511776 0.108519 0.415068 1.40898e-55 1.05118 -0.0495075 -0.008519 2.05118 0.17452 3.05118
+0.0647475 0.384025 0.33915 0.000233442 1.06475 0.107225 -0.283792 2.06475 0.151512 3.06475
+0.05 2.09294e-15 -4.53899e-11 0.181388 1.05 1.13485e-11 0.281388 2.05 -0.131388 3.05
+0.0512601 0.112255 1.00853e-06 0.253518 1.05126 0.0561272 0.241263 2.05126 -0.203518 3.05126
+0.0635271 0.367792 0.369722 0.0238369 1.06353 0.0914655 -0.243955 2.06353 0.13708 3.06353
+0.0557124 0.239007 0.379325 0.0465215 1.05571 0.0246722 -0.0924855 2.05571 0.117276 3.05571
+0.0527063 0.164508 0.307532 0.52657 1.05271 0.005371 0.462062 2.05271 -0.38431 3.05271
+0.0591137 0.301888 0.5 0.0422118 1.05911 0.025944 -0.159676 2.05911 0.157788 3.05911
+0.0722041 0.471213 0.30911 0.0215365 1.0722 0.158329 -0.349677 2.0722 0.121196 3.0722
+0.063848 0.372129 0.5 0.25 1.06385 0.0610645 -0.022129 2.06385 -0.05 3.06385
+0.050335 0.0578835 0.0689451 0.0082096 1.05034 0.0117055 0.0503261 2.05034 0.0624739 3.05034
+0.0867946 0.606586 0.442293 0.108835 1.08679 0.19272 -0.397751 2.08679 0.0738529 3.08679
+0.0628769 0.358844 0.363613 0.00488792 1.06288 0.0885187 -0.253956 2.06288 0.154196 3.06288
+0.0674217 0.417393 0.239147 0.0814443 1.06742 0.14891 -0.235949 2.06742 0.0402998 3.06742
+0.05409 0.202237 0.348527 0.0394968 1.05409 0.0139868 -0.0627402 2.05409 0.115061 3.05409
+0.0535528 0.188488 0.213936 0.0401481 1.05355 0.04076 -0.0483399 2.05355 0.0740327 3.05355
+0.0599173 0.314917 0.456545 0.0455725 1.05992 0.0433223 -0.169345 2.05992 0.141391 3.05992
+0.0603951 0.322415 0.311821 0.0576653 1.0604 0.0832522 -0.16475 2.0604 0.085881 3.0604
+0.068863 0.434315 0.353035 0.041808 1.06886 0.128899 -0.292507 2.06886 0.114102 3.06886
+0.0636228 0.369091 0.334364 0.0659505 1.06362 0.100955 -0.203141 2.06362 0.0843587 3.06362
+0.0684408 0.429428 0.325706 0.172053 1.06844 0.133288 -0.157375 2.06844 -0.0243412 3.06844
+0.0584648 0.290944 0.372083 0.0732601 1.05846 0.0524512 -0.117684 2.05846 0.0883648 3.05846
+0.0628062 0.357858 0.39847 0.0365138 1.06281 0.0793115 -0.221344 2.06281 0.133027 3.06281
+0.0631425 0.362526 0.427178 0.0697848 1.06314 0.0744685 -0.192741 2.06314 0.108369 3.06314
+0.0509673 0.0983491 0.439922 0.0556785 1.05097 -0.0608059 0.0573294 2.05097 0.126298 3.05097
+0.0780085 0.529231 0.5 0.0283426 1.07801 0.139616 -0.400888 2.07801 0.171657 3.07801
+0.0501141 0.0337786 0.380351 0.0140762 1.05011 -0.0781985 0.0802976 2.05011 0.150029 3.05011
+0.0614933 0.339018 0.432854 0.0629113 1.06149 0.0612955 -0.176107 2.06149 0.116945 3.06149
+0.0540175 0.200436 0.484999 0.263569 1.05402 -0.0210318 0.163133 2.05402 -0.0680693 3.05402
+0.0561716 0.248427 0.393686 0.0222429 1.05617 0.025792 -0.126184 2.05617 0.145863 3.05617
+0.0501685 0.0410451 0.296622 0.0216997 1.05017 -0.0536329 0.0806546 2.05017 0.117287 3.05017
+0.0547613 0.218205 0.306757 0.0544366 1.05476 0.0324133 -0.0637684 2.05476 0.0875905 3.05476
+0.0528424 0.168594 0.34567 0.0489999 1.05284 -0.0021205 -0.0195941 2.05284 0.104701 3.05284
+0.0623561 0.351512 0.5 0.0952587 1.06236 0.050756 -0.156253 2.06236 0.104741 3.06236
+0.0761519 0.511389 0.46682 0.00454344 1.07615 0.138989 -0.406846 2.07615 0.185503 3.07615
+0.0568175 0.261104 0.32813 0.0362533 1.05682 0.0485195 -0.124851 2.05682 0.112186 3.05682
+0.0637727 0.371116 0.386222 0.0542187 1.06377 0.0890025 -0.216897 2.06377 0.111648 3.06377
+0.0696318 0.443078 0.476454 0.0636732 1.06963 0.102426 -0.279405 2.06963 0.129263 3.06963
+0.062169 0.348842 0.451074 0.0531002 1.06217 0.0616525 -0.195742 2.06217 0.132222 3.06217
+0.0673204 0.416178 0.430285 0.0658946 1.06732 0.100518 -0.250283 2.06732 0.113191 3.06732
+0.0694543 0.44107 0.35135 0.00604443 1.06945 0.132698 -0.335026 2.06945 0.149361 3.06945
+0.0696716 0.443526 0.308306 0.0459721 1.06967 0.144686 -0.297554 2.06967 0.0965197 3.06967
+0.0653872 0.392265 0.5 0.000615925 1.06539 0.0711325 -0.291649 2.06539 0.199384 3.06539
+0.075974 0.509647 0.37168 1.3144e-42 1.07597 0.161903 -0.409647 2.07597 0.161504 3.07597
+0.0511847 0.108844 0.0661483 0.0789805 1.05118 0.0378849 0.0701365 2.05118 -0.00913601 3.05118
+0.0501753 0.0418668 0.451724 0.235553 1.05018 -0.0919976 0.293686 2.05018 -0.0500358 3.05018
+0.0569573 0.263768 0.124172 0.102161 1.05696 0.100841 -0.061607 2.05696 -0.0149094 3.05696
+0.0614987 0.339097 0.308499 0.0417147 1.0615 0.0924237 -0.197382 2.0615 0.100835 3.0615
+0.0871671 0.609648 0.0776763 0.04953 1.08717 0.285405 -0.460118 2.08717 0.0237729 3.08717
+0.0665465 0.406774 0.41879 0.0198144 1.06655 0.0986895 -0.28696 2.06655 0.155823 3.06655
+0.0634932 0.367331 0.427436 0.0234124 1.06349 0.0768065 -0.243919 2.06349 0.154818 3.06349
+0.0500001 -0.00096189 0.459803 0.016889 1.05 -0.115432 0.117851 2.05 0.171052 3.05
+0.086 0.6 1.21431e-17 0 1.086 0.3 -0.5 2.086 0.05 3.086
+0.0745435 0.495414 0.353833 0.00473412 1.07454 0.159249 -0.39068 2.07454 0.151416 3.07454
+0.0579976 0.282799 0.142666 0.192516 1.058 0.105733 0.009717 2.058 -0.0997162 3.058
+0.0733711 0.483437 0.401255 0.0843364 1.07337 0.141405 -0.299101 2.07337 0.0860401 3.07337
+0.0621301 0.348283 0.422751 0.0156498 1.06213 0.0684538 -0.232633 2.06213 0.161176 3.06213
+0.0748038 0.498034 0.326191 0.0630044 1.0748 0.167469 -0.33503 2.0748 0.0848529 3.0748
+0.0603927 0.322377 0.421168 0.0795425 1.06039 0.0558965 -0.142835 2.06039 0.0968079 3.06039
+0.0788763 0.537367 0.397506 0.0109473 1.07888 0.169307 -0.42642 2.07888 0.158305 3.07888
+0.0623808 0.351863 0.344209 0.00242727 1.06238 0.0898792 -0.249436 2.06238 0.150835 3.06238
+0.0580233 0.283254 0.382881 0.0139513 1.05802 0.0459067 -0.169303 2.05802 0.150913 3.05802
+0.0677442 0.421239 0.342634 0.0524881 1.06774 0.124961 -0.268751 2.06774 0.100302 3.06774
+0.0681746 0.426317 0.477557 0.0163818 1.06817 0.0937692 -0.309935 2.06817 0.176885 3.06817
+0.0547785 0.218598 0.39231 0.22614 1.05478 0.0112215 0.107542 2.05478 -0.058447 3.05478
+0.0519027 0.137938 0.456024 0.719447 1.0519 -0.045037 0.681509 2.0519 -0.53264 3.0519
+0.0808226 0.555181 0.355962 0.0257748 1.08082 0.1886 -0.429406 2.08082 0.131014 3.08082
+0.0546839 0.216422 0.222961 0.067959 1.05468 0.0524708 -0.048463 2.05468 0.0489293 3.05468
+0.0630687 0.361507 0.324569 0.0959367 1.06307 0.0996113 -0.16557 2.06307 0.051434 3.06307
+0.0588061 0.296751 0.447633 0.141007 1.05881 0.0364672 -0.055744 2.05881 0.0432829 3.05881
+0.0609063 0.330246 0.5 0.0157775 1.06091 0.040123 -0.214468 2.06091 0.184223 3.06091
+0.0642225 0.377127 0.395962 0.0565619 1.06422 0.089573 -0.220565 2.06422 0.112227 3.06422
+0.0665736 0.407107 0.424813 0.0256031 1.06657 0.0973502 -0.281504 2.06657 0.151841 3.06657
+0.0717547 0.46642 0.347043 0.074599 1.07175 0.146449 -0.291821 2.07175 0.0795139 3.07175
+0.058476 0.291136 0.226435 0.0929834 1.05848 0.0889593 -0.0981526 2.05848 0.0249471 3.05848
+0.05 4.46691e-17 0.369174 1 1.05 -0.0922935 1.1 2.05 -0.839248 3.05
+0.0697008 0.443856 0.419669 0.000595388 1.0697 0.117011 -0.343261 2.0697 0.175305 3.0697
+0.0625946 0.354889 0.453677 0.0622788 1.06259 0.0640253 -0.19261 2.06259 0.123824 3.06259
+0.0656787 0.395964 0.393309 0.0935083 1.06568 0.0996547 -0.202456 2.06568 0.0744844 3.06568
+0.0621541 0.348628 0.402879 0.0317316 1.06215 0.0735942 -0.216896 2.06215 0.139132 3.06215
+0.0594409 0.307261 0.5 1.32662e-49 1.05944 0.0286305 -0.207261 2.05944 0.2 3.05944
+0.0620505 0.347138 0.313729 0.116027 1.06205 0.0951368 -0.131111 2.06205 0.0280917 3.06205
+0.0872779 0.610556 0.378298 0.0900878 1.08728 0.210703 -0.420468 2.08728 0.0734016 3.08728
+0.0504101 0.0640413 0.200234 0.178579 1.05041 -0.0180379 0.214538 2.05041 -0.0685088 3.05041
+0.0544826 0.211721 0.352393 0.0498701 1.05448 0.0177622 -0.0618509 2.05448 0.105848 3.05448
+0.0593674 0.306061 0.355116 0.0615187 1.05937 0.0642515 -0.144542 2.05937 0.0950161 3.05937
+0.0585661 0.29268 0.456817 0.0275222 1.05857 0.0321358 -0.165158 2.05857 0.159523 3.05857
+0.0709072 0.457244 0.319842 0.0509837 1.07091 0.148662 -0.30626 2.07091 0.0949689 3.07091
+0.0610185 0.331942 0.248962 0.029566 1.06102 0.103731 -0.202376 2.06102 0.0951226 3.06102
+0.0686357 0.431691 0.421749 0.062008 1.06864 0.110408 -0.269683 2.06864 0.114517 3.06864
+0.0661851 0.402307 0.424842 0.0296076 1.06619 0.094943 -0.272699 2.06619 0.147845 3.06619
+0.0885541 0.620919 0.351856 6.5973e-43 1.08855 0.222496 -0.520919 2.08855 0.155557 3.08855
+0.0609613 0.331079 0.167195 0.0453485 1.06096 0.123741 -0.185731 2.06096 0.05481 3.06096
+0.0676002 0.419526 0.475122 0.0684303 1.0676 0.0909825 -0.251096 2.0676 0.124106 3.0676
+0.0601199 0.318117 0.446287 0.0908745 1.06012 0.0474867 -0.127242 2.06012 0.0930116 3.06012
+0.0715393 0.464104 0.262543 0.00231609 1.07154 0.166416 -0.361788 2.07154 0.126447 3.07154
+0.0506808 0.0825132 0.500014 0.032418 1.05068 -0.0837469 0.0499048 2.05068 0.167586 3.05068
+0.0583606 0.289148 0.425875 0.0681736 1.05836 0.0381053 -0.120974 2.05836 0.109589 3.05836
+0.0524598 0.156836 0.460235 0.392112 1.05246 -0.0366407 0.335276 2.05246 -0.204042 3.05246
+0.0632357 0.363808 0.465015 0.055004 1.06324 0.0656503 -0.208804 2.06324 0.134501 3.06324
+0.0502374 0.0487203 0.481723 0.0221374 1.05024 -0.0960706 0.0734171 2.05024 0.17238 3.05024
+0.055264 0.229434 0.262063 0.000999105 1.05526 0.0492013 -0.128435 2.05526 0.12762 3.05526
+0.0636644 0.369654 0.471972 0.0762469 1.06366 0.066834 -0.193407 2.06366 0.115345 3.06366
+0.0652651 0.390706 0.433393 0.0545036 1.06527 0.0870048 -0.236202 2.06527 0.125514 3.06527
+0.0703267 0.450851 0.449651 0.0333949 1.07033 0.113013 -0.317456 2.07033 0.1515 3.07033
+0.064045 0.374767 0.378265 0.044635 1.06404 0.0928173 -0.230132 2.06405 0.118845 3.06405
+0.0717488 0.466356 0.459808 0.0377329 1.07175 0.118226 -0.328623 2.07175 0.150209 3.07175
+0.0663108 0.403867 0.439464 0.026586 1.06631 0.0920675 -0.277281 2.06631 0.155253 3.06631
+0.0607343 0.327633 0.329073 0.0206734 1.06073 0.0815483 -0.20696 2.06073 0.128049 3.06073
+0.05 4.4886e-17 3.0892e-11 0.461942 1.05 -7.72298e-12 0.561942 2.05 -0.411942 3.05
+0.0642756 0.377831 0.5 0.116439 1.06428 0.0639155 -0.161392 2.06428 0.083561 3.06428
+0.0885835 0.621156 0.25976 4.04757e-45 1.08858 0.245638 -0.521156 2.08858 0.127928 3.08858
+0.0759962 0.509865 0.104441 1.77295e-48 1.076 0.228822 -0.409865 2.076 0.0813323 3.076
+0.0632277 0.3637 0.443619 0.0544385 1.06323 0.0709453 -0.209262 2.06323 0.128647 3.06323
+0.0567598 0.259996 0.468086 0.0302265 1.05676 0.0129765 -0.12977 2.05676 0.160199 3.05676
+0.0650105 0.387433 0.393223 0.0410754 1.06501 0.0954108 -0.246358 2.06501 0.126891 3.06501
+0.0646056 0.382173 0.306872 0.0876782 1.06461 0.114368 -0.194495 2.06461 0.0543834 3.06461
+0.0847467 0.589463 0.275179 0.12413 1.08475 0.225937 -0.365333 2.08475 0.0084237 3.08475
+0.0601703 0.318908 0.372955 0.0913014 1.06017 0.0662153 -0.127607 2.06017 0.0705851 3.06017
+0.0767069 0.516787 0.42725 1.06952e-42 1.07671 0.151581 -0.416787 2.07671 0.178175 3.07671
+0.0653609 0.391929 0.344831 0.0114147 1.06536 0.109757 -0.280514 2.06536 0.142035 3.06536
+0.0730846 0.480464 0.5 0.192627 1.07308 0.115232 -0.187837 2.07308 0.007373 3.07308
+0.0832034 0.576224 0.300688 0.079702 1.0832 0.21294 -0.396522 2.0832 0.0605044 3.0832
+0.0685958 0.431229 0.468555 0.163565 1.0686 0.0984757 -0.167664 2.0686 0.0270015 3.0686
+0.0862282 0.601898 0.286303 0.0141955 1.08623 0.229373 -0.487703 2.08623 0.121695 3.08623
+0.0560656 0.246285 0.389829 0.00756962 1.05607 0.0256853 -0.138715 2.05607 0.159379 3.05607
+0.0783805 0.532733 0.5 0.00912929 1.07838 0.141367 -0.423604 2.07838 0.190871 3.07838
+0.0639429 0.373402 0.286565 0.108299 1.06394 0.11506 -0.165103 2.06394 0.0276705 3.06394
+0.0603517 0.321741 0.386076 0.0419327 1.06035 0.0643515 -0.179808 2.06035 0.12389 3.06035
+0.0618944 0.344882 0.417561 0.0092411 1.06189 0.0680508 -0.235641 2.06189 0.166027 3.06189
+0.0593107 0.305134 0.187724 0.010856 1.05931 0.105636 -0.194278 2.05931 0.0954612 3.05931
+0.0501176 0.0342924 0.470952 0.0060016 1.05012 -0.100592 0.0717092 2.05012 0.185284 3.05012
+0.0646285 0.382472 0.365183 0.0368158 1.06463 0.0999402 -0.245656 2.06463 0.122739 3.06463
+0.0661257 0.401568 0.421765 0.0689293 1.06613 0.0953427 -0.232639 2.06613 0.1076 3.06613
+0.0656248 0.395283 0.412868 0.0535215 1.06562 0.0944245 -0.241761 2.06562 0.120339 3.06562
+0.0628868 0.358982 0.414173 0.0513438 1.06289 0.0759478 -0.207638 2.06289 0.122908 3.06289
+0.0621882 0.349116 0.325705 0.0665861 1.06219 0.0931317 -0.18253 2.06219 0.0811254 3.06219
+0.062981 0.360292 0.434936 0.0622947 1.06298 0.071412 -0.197997 2.06298 0.118186 3.06298
+0.0749474 0.499474 0.393569 0.00358464 1.07495 0.151345 -0.395889 2.07495 0.164486 3.07495
+0.0636717 0.369752 0.400739 0.0636293 1.06367 0.0846913 -0.206123 2.06367 0.106592 3.06367
+0.0514312 0.119632 -8.6346e-09 0.555928 1.05143 0.059816 0.536296 2.05143 -0.505928 3.05143
+0.0548337 0.219857 0.428715 0.007112 1.05483 0.00274975 -0.112745 2.05483 0.171503 3.05483
+0.0651279 0.388946 0.46523 0.0359084 1.06513 0.0781655 -0.253038 2.06513 0.153661 3.06513
+0.0514118 0.11882 0.052743 0.0140517 1.05141 0.0462242 -0.0047683 2.05141 0.0517712 3.05141
+0.0511145 0.105571 0.5 0.218956 1.05111 -0.0722145 0.213385 2.05111 -0.018956 3.05111
+0.0902149 0.634152 0.327033 0.0905873 1.09021 0.235318 -0.443565 2.09021 0.0575226 3.09021
+0.0662655 0.403305 0.468949 0.0371866 1.06627 0.0844153 -0.266118 2.06627 0.153498 3.06627
+0.0539938 0.199845 0.164538 9.31779e-52 1.05399 0.058788 -0.099845 2.05399 0.0993614 3.05399
+0.0647346 0.383856 0.330775 0.0422195 1.06473 0.109234 -0.241636 2.06473 0.107013 3.06473
+0.0739934 0.489831 0.35667 0.0410383 1.07399 0.155748 -0.348793 2.07399 0.115963 3.07399
+0.0653265 0.391491 0.430322 0.0586109 1.06533 0.088165 -0.23288 2.06533 0.120486 3.06533
+0.063686 0.369946 0.419886 0.0485236 1.06369 0.0800015 -0.221422 2.06369 0.127442 3.06369
+0.0508493 0.092157 0.432909 0.324091 1.05085 -0.0621487 0.331934 2.05085 -0.144218 3.05085
+0.0641457 0.376107 0.474345 0.124017 1.06415 0.0694673 -0.15209 2.06415 0.0682865 3.06415
+0.050136 0.0368721 0.432175 0.00366738 1.05014 -0.0896077 0.0667953 2.05014 0.175985 3.05014
+0.0648015 0.384728 0.417283 0.0446173 1.0648 0.0880433 -0.240111 2.0648 0.130568 3.0648
+0.0707237 0.455233 0.37818 0.0259072 1.07072 0.133072 -0.329326 2.07072 0.137547 3.07072
+0.05 0 0.5 0.0239407 1.05 -0.125 0.123941 2.05 0.176059 3.05
+0.0502968 0.0544806 0.499999 0.297961 1.0503 -0.0977595 0.34348 2.0503 -0.0979613 3.0503
+0.0618116 0.34368 0.39669 0.0633762 1.06181 0.0726675 -0.180304 2.06181 0.105631 3.06181
+0.0561599 0.24819 0.174102 0.0295098 1.05616 0.0805695 -0.11868 2.05616 0.0727208 3.05616
+0.0579785 0.282462 0.434718 0.0140398 1.05798 0.0325515 -0.168422 2.05798 0.166376 3.05798
+0.058804 0.296716 0.426283 0.0478073 1.0588 0.0417872 -0.148909 2.0588 0.130078 3.0588
+0.0576684 0.276918 0.341739 0.00308482 1.05767 0.0530242 -0.173833 2.05767 0.149437 3.05767
+0.0621431 0.348469 0.402383 0.0439096 1.06214 0.0736387 -0.204559 2.06214 0.126805 3.06214
+0.0712517 0.460996 0.438019 0.0270608 1.07125 0.120993 -0.333935 2.07125 0.154345 3.07125
+0.0564412 0.253794 0.441647 0.0074019 1.05644 0.0164853 -0.146392 2.05644 0.175092 3.05644
+0.0607956 0.328567 0.299983 0.0736101 1.0608 0.0892877 -0.154957 2.0608 0.0663848 3.0608
+0.0836454 0.580047 0.376583 0.0147883 1.08365 0.195878 -0.465259 2.08365 0.148187 3.08365
+0.0550213 0.224083 0.458188 0.0135403 1.05502 -0.0025055 -0.110543 2.05502 0.173916 3.05502
+0.0648422 0.385256 0.413107 0.0272197 1.06484 0.0893512 -0.258036 2.06484 0.146712 3.06484
+0.0539634 0.199083 0.0858458 0.0899886 1.05396 0.0780801 -0.0090944 2.05396 -0.0142349 3.05396
+0.0775359 0.524746 -3.08574e-14 0.0174859 1.07754 0.262373 -0.40726 2.07754 0.0325141 3.07754
+0.0545366 0.212992 0.432245 0.00149514 1.05454 -0.00156525 -0.111497 2.05454 0.178178 3.05454
+0.0654324 0.392841 0.437307 0.0306702 1.06543 0.0870937 -0.262171 2.06543 0.150522 3.06543
+0.0542785 0.206846 0.465921 0.0517779 1.05428 -0.0130572 -0.0550681 2.05428 0.137998 3.05428
+0.05 0 0.5 0.0828281 1.05 -0.125 0.182828 2.05 0.117172 3.05
+0.099 0.7 0.388445 0.25 1.099 0.252889 -0.35 2.099 -0.0834665 3.099
+0.0841269 0.584182 0.405428 0.0266877 1.08413 0.190734 -0.457494 2.08413 0.144941 3.08413
+0.0694196 0.440676 0.413639 0.0442921 1.06942 0.116928 -0.296384 2.06942 0.1298 3.06942
+0.0548011 0.219115 0.174378 0.137302 1.0548 0.065963 0.018187 2.0548 -0.0349886 3.0548
+0.0626009 0.354978 0.233732 1.74911e-49 1.0626 0.119056 -0.254978 2.0626 0.12012 3.0626
+0.0606393 0.32618 0.43823 0.125093 1.06064 0.0535325 -0.101087 2.06064 0.056376 3.06064
+0.0664047 0.405027 0.450553 0.00294584 1.0664 0.0898753 -0.302081 2.0664 0.18222 3.0664
+0.0504385 0.0662211 0.419454 0.586045 1.05044 -0.0717529 0.619824 2.05044 -0.410209 3.05044
+0.0501519 0.0389774 0.436799 0.158252 1.05015 -0.0897111 0.219275 2.05015 0.0227877 3.05015
+0.0520134 0.141894 0.500006 0.229114 1.05201 -0.0540545 0.18722 2.05201 -0.0291122 3.05201
+0.0685671 0.430896 0.407134 0.0261204 1.06857 0.113665 -0.304776 2.06857 0.14602 3.06857
+0.0500004 0.00212037 0.474065 0.0102385 1.05 -0.117456 0.108118 2.05 0.181981 3.05
+0.0705512 0.453335 0.396629 0.043323 1.07055 0.12751 -0.310012 2.07055 0.125666 3.07055
+0.0731209 0.480842 0.120838 0.0270075 1.07312 0.210211 -0.353834 2.07312 0.0592439 3.07312
+0.0624156 0.352357 0.429953 0.000935215 1.06242 0.0686902 -0.251422 2.06242 0.178051 3.06242
+0.0765851 0.515607 0.441169 0.0466835 1.07659 0.147511 -0.368924 2.07659 0.135667 3.07659
+0.0645565 0.38153 0.387982 0.0439188 1.06456 0.0937695 -0.237611 2.06456 0.122476 3.06456
+0.0526586 0.163054 0.5 0.15634 1.05266 -0.043473 0.093286 2.05266 0.04366 3.05266
+0.0626471 0.355628 0.40141 0.138387 1.06265 0.0774615 -0.117241 2.06265 0.032036 3.06265
+0.0695214 0.44183 0.5 0.0942943 1.06952 0.095915 -0.247536 2.06952 0.105706 3.06952
+0.0603566 0.321817 0.481976 0.00164129 1.06036 0.0404145 -0.220176 2.06036 0.192952 3.06036
+0.0715721 0.464458 0.230103 0.0302891 1.07157 0.174703 -0.334169 2.07157 0.0887418 3.07157
+0.0656907 0.396114 0.424697 0.0382612 1.06569 0.0918828 -0.257853 2.06569 0.139148 3.06569
+0.0676895 0.420589 0.45356 0.018946 1.06769 0.0969045 -0.301643 2.06769 0.167122 3.06769
+0.0593964 0.306536 0.475519 0.00763686 1.0594 0.0343882 -0.198899 2.0594 0.185019 3.0594
+0.0838343 0.581672 0.282505 0.00231819 1.08383 0.22021 -0.479354 2.08383 0.132433 3.08383
+0.0741664 0.491594 4.43948e-12 0.0718746 1.07417 0.245797 -0.319719 2.07417 -0.0218746 3.07417
+0.0623815 0.351873 0.430844 0.0624926 1.06238 0.0682255 -0.18938 2.06238 0.116761 3.06238
+0.0593964 0.306535 0.224371 0.0473791 1.0594 0.0971748 -0.159156 2.0594 0.0699322 3.0594
+0.0665702 0.407065 0.382602 0.0497241 1.06657 0.107882 -0.257341 2.06657 0.115056 3.06657
+0.0856221 0.596843 0.423232 0.0436576 1.08562 0.192613 -0.453185 2.08562 0.133312 3.08562
+0.0500569 0.0238528 0.477801 0.0212996 1.05006 -0.107524 0.0974468 2.05006 0.172041 3.05006
+0.0810837 0.557528 0.5 0.043587 1.08108 0.153764 -0.413941 2.08108 0.156413 3.08108
+0.0667596 0.409385 0.337342 0.00814808 1.06676 0.120357 -0.301237 2.06676 0.143055 3.06676
+0.0671466 0.414085 0.459362 0.0365784 1.06715 0.092202 -0.277507 2.06715 0.15123 3.06715
+0.0513173 0.114775 0.373158 0.378028 1.05132 -0.035902 0.363253 2.05132 -0.216081 3.05132
+0.0653307 0.391544 0.170532 0.0390331 1.06533 0.153139 -0.252511 2.06533 0.0621265 3.06533
+0.0519721 0.140433 0.397275 0.0127933 1.05197 -0.0291022 -0.0276397 2.05197 0.156389 3.05197
+0.0632352 0.363803 0.393547 0.0534587 1.06324 0.0835147 -0.210344 2.06324 0.114605 3.06324
+0.0639137 0.373011 0.311807 0.0475866 1.06391 0.108554 -0.225424 2.06391 0.0959555 3.06391
+0.0678447 0.42243 0.343707 0.106516 1.06784 0.125288 -0.215914 2.06784 0.0465961 3.06784
+0.054992 0.223428 0.351018 0.0745332 1.05499 0.0239595 -0.0488948 2.05499 0.0807722 3.05499
+0.051064 0.103149 0.472549 0.250867 1.05106 -0.0665628 0.247718 2.05106 -0.0591023 3.05106
+0.0626229 0.355288 0.416718 0.0397726 1.06262 0.0734645 -0.215515 2.06262 0.135243 3.06262
+0.0678076 0.42199 0.23924 0.0180153 1.06781 0.151185 -0.303975 2.06781 0.103757 3.06781
+0.0500103 0.0101279 0.498525 0.0221788 1.05001 -0.119567 0.112051 2.05001 0.177379 3.05001
+0.05 2.11038e-10 0.5 0.255928 1.05 -0.125 0.355928 2.05 -0.055928 3.05
+0.056545 0.255833 0.306576 0.148767 1.05655 0.0512725 -0.007066 2.05654 -0.0067942 3.05654
+0.0696349 0.443112 0.400236 0.0819348 1.06963 0.121497 -0.261177 2.06963 0.088136 3.06963
+0.0694486 0.441006 0.297333 0.113523 1.06945 0.14617 -0.227483 2.06945 0.0256769 3.06945
+0.0531713 0.178081 -7.58942e-19 1.89297e-53 1.05317 0.0890405 -0.078081 2.05317 0.05 3.05317
+0.0670905 0.413407 0.479022 0.0912305 1.06709 0.086948 -0.222176 2.06709 0.102476 3.06709
+0.0576981 0.277455 0.400952 0.024696 1.0577 0.0384895 -0.152759 2.0577 0.14559 3.0577
+0.054 0.2 0.5 0.424197 1.054 -0.025 0.324197 2.054 -0.224197 3.054
+0.0745071 0.495047 0.303851 0.00398093 1.07451 0.171561 -0.391066 2.07451 0.137174 3.07451
+0.0692883 0.439184 0.293798 0.0256745 1.06929 0.146143 -0.313509 2.06929 0.112465 3.06929
+0.0632952 0.364626 0.350733 0.0677602 1.0633 0.0946297 -0.196866 2.0633 0.0874597 3.0633
+0.0544235 0.210322 0.414171 0.0192228 1.05442 0.00161825 -0.0910992 2.05442 0.155029 3.05442
+0.0693267 0.439622 0.397827 0.0522175 1.06933 0.120354 -0.287405 2.06933 0.117131 3.06933
+0.0501249 0.0353458 0.42638 0.0491786 1.05012 -0.0889221 0.113833 2.05012 0.128735 3.05012
+0.0682209 0.42686 0.32668 0.0604735 1.06822 0.13176 -0.266387 2.06822 0.0875305 3.06822
+0.061881 0.344689 0.199572 0.0287617 1.06188 0.122452 -0.215927 2.06188 0.0811099 3.06188
+0.0545958 0.214377 0.263228 0.0764623 1.0546 0.0413815 -0.0379147 2.0546 0.0525061 3.0546
+0.0626821 0.35612 0.37283 0.25 1.06268 0.0848525 -0.00612 2.06268 -0.088151 3.06268
+0.0857541 0.597947 0.241396 0.0346623 1.08575 0.238625 -0.463285 2.08575 0.0877565 3.08575
+0.0564884 0.254723 0.426157 0.0113273 1.05649 0.0208222 -0.143396 2.05649 0.16652 3.05649
+0.0664063 0.405047 0.433134 0.00720057 1.06641 0.09424 -0.297846 2.06641 0.17274 3.06641
+0.0608341 0.329152 0.36195 0.036713 1.06083 0.0740885 -0.192439 2.06083 0.121872 3.06083
+0.0859309 0.599424 0.0636177 0.00416796 1.08593 0.283808 -0.495256 2.08593 0.0649173 3.08593
+0.0593434 0.305669 0.212724 0.00554114 1.05934 0.0996535 -0.200128 2.05934 0.108276 3.05934
+0.0526847 0.163852 0.303411 0.0074827 1.05268 0.00607325 -0.0563693 2.05268 0.133541 3.05268
+0.0585274 0.292017 0.342074 0.0249506 1.05853 0.06049 -0.167066 2.05853 0.127672 3.05853
+0.0662563 0.403191 0.208777 0.0108926 1.06626 0.149401 -0.292298 2.06626 0.10174 3.06626
+0.0708372 0.456478 0.433258 0.0429932 1.07084 0.119925 -0.313485 2.07084 0.136984 3.07084
+0.0770482 0.520079 0.309512 0.0723741 1.07705 0.182661 -0.347705 2.07705 0.0704795 3.07705
+0.0541673 0.204139 0.5 0.0119593 1.05417 -0.0229305 -0.0921797 2.05417 0.188041 3.05417
+0.0724114 0.473406 0.405307 0.00127647 1.07241 0.135376 -0.37213 2.07241 0.170316 3.07241
+0.0588313 0.297175 0.380477 0.0509419 1.05883 0.0534683 -0.146233 2.05883 0.113201 3.05883
+0.0664461 0.405539 0.431491 0.0170837 1.06645 0.0948967 -0.288455 2.06645 0.162364 3.06645
+0.0657039 0.396282 0.27141 0.0171011 1.0657 0.130289 -0.279181 2.0657 0.114322 3.0657
+0.05 8.75898e-06 0.394046 0.0635032 1.05 -0.0985071 0.163494 2.05 0.104711 3.05
+0.067996 0.424217 0.265185 0.0495824 1.068 0.145812 -0.274635 2.068 0.0799731 3.068
+0.0569632 0.26388 0.479064 0.0836681 1.05696 0.012174 -0.0802119 2.05696 0.110051 3.05696
+0.0560998 0.246979 0.28535 0.0121619 1.0561 0.052152 -0.134817 2.0561 0.123443 3.0561
+0.0678362 0.422329 0.434481 0.0569162 1.06784 0.102544 -0.265413 2.06784 0.123428 3.06784
+0.0703312 0.450902 0.265677 0.25 1.07033 0.159032 -0.100902 2.07033 -0.120297 3.07033
+0.0761339 0.511213 0.340615 0.00995734 1.07613 0.170453 -0.401256 2.07613 0.142227 3.07613
+0.0663299 0.404102 0.420038 0.0533324 1.06633 0.0970415 -0.25077 2.06633 0.122679 3.06633
+0.0509115 0.0954741 0.114915 0.820728 1.05091 0.0190083 0.825254 2.05091 -0.736254 3.05091
+0.0574466 0.272885 0.117687 0.0159869 1.05745 0.107021 -0.156898 2.05745 0.0693192 3.05745
+0.0644007 0.379482 0.423292 0.0411681 1.0644 0.083918 -0.238314 2.0644 0.13582 3.0644
+0.0511825 0.108741 0.412351 0.203649 1.05118 -0.0487173 0.194908 2.05118 -0.0299437 3.05118
+0.05 0 0.5 0.0766205 1.05 -0.125 0.176621 2.05 0.12338 3.05
+0.0661729 0.402156 0.411521 0.0145562 1.06617 0.0981978 -0.2876 2.06617 0.1589 3.06617
+0.0657159 0.396433 0.41982 0.0236804 1.06572 0.0932615 -0.272753 2.06572 0.152266 3.06572
+0.0821524 0.567031 0.224399 0.0192846 1.08215 0.227416 -0.447746 2.08215 0.0980351 3.08215
+0.0520492 0.14315 0.381913 0.0270351 1.05205 -0.0239033 -0.0161149 2.05205 0.137539 3.05205
+0.0677543 0.421358 0.415512 0.0546181 1.06775 0.106801 -0.26674 2.06775 0.120035 3.06775
+0.0525087 0.158388 0.446741 1.09157e-53 1.05251 -0.0324912 -0.058388 2.05251 0.184022 3.05251
+0.0595729 0.309401 0.447374 0.0184841 1.05957 0.042857 -0.190917 2.05957 0.165728 3.05957
+0.0540005 0.200012 0.413523 0.25 1.054 -0.00337475 0.149988 2.054 -0.0759431 3.054
+0.0704807 0.452556 0.340831 0.0186209 1.07048 0.14107 -0.333935 2.07048 0.133628 3.07048
+0.0645904 0.381974 0.342899 0.0242506 1.06459 0.105262 -0.257723 2.06459 0.128619 3.06459
+0.061684 0.341819 0.41914 0.0462062 1.06168 0.0661245 -0.195613 2.06168 0.129536 3.06168
+0.0626713 0.355968 0.470932 2.70993e-48 1.06267 0.060251 -0.255968 2.06267 0.19128 3.06267
+0.0504747 0.0689021 0.451339 0.00142228 1.05047 -0.0783837 0.0325202 2.05047 0.183979 3.05047
+0.0566603 0.258075 0.458904 0.177951 1.05666 0.0143115 0.019876 2.05666 0.0097202 3.05666
+0.0636239 0.369105 0.365307 0.0126841 1.06362 0.0932258 -0.256421 2.06362 0.146908 3.06362
+0.0563072 0.251142 0.32691 0.0801453 1.05631 0.0438435 -0.0709967 2.05631 0.0679277 3.05631
+0.0664107 0.405101 0.206852 0.119093 1.06641 0.150837 -0.186008 2.06641 -0.0070374 3.06641
+0.0818975 0.564778 0.450329 0.0625072 1.0819 0.169807 -0.402271 2.0819 0.122591 3.0819
+0.0693428 0.439805 0.300372 0.0611719 1.06934 0.14481 -0.278633 2.06934 0.0789397 3.06934
+0.0766765 0.516493 0.383789 0.0320041 1.07668 0.162299 -0.384489 2.07668 0.133133 3.07668
+0.0609453 0.330837 0.420224 0.0660526 1.06095 0.0603625 -0.164784 2.06095 0.110015 3.06095
+0.0503223 0.056771 0.233717 0.0232962 1.05032 -0.0300438 0.0665252 2.05032 0.0968189 3.05032
+0.074853 0.498527 0.448825 0.034469 1.07485 0.137057 -0.364058 2.07485 0.150178 3.07485
+0.0627103 0.356516 0.185879 0.0109462 1.06271 0.131788 -0.24557 2.06271 0.0948175 3.06271
+0.0663895 0.404839 0.445081 0.0778745 1.06639 0.0911493 -0.226965 2.06639 0.10565 3.06639
+0.0596834 0.311182 0.464034 0.055875 1.05968 0.0395825 -0.155307 2.05968 0.133335 3.05968
+0.065384 0.392224 0.30674 0.0536722 1.06538 0.119427 -0.238552 2.06538 0.0883498 3.06538
+0.0635064 0.367511 0.487555 0.0382474 1.06351 0.0618667 -0.229264 2.06351 0.158019 3.06351
+0.0605032 0.324087 0.462742 0.0669599 1.0605 0.046358 -0.157127 2.0605 0.121863 3.0605
+0.0645402 0.381317 0.324941 0.0325317 1.06454 0.109423 -0.248785 2.06454 0.114951 3.06454
+0.0592459 0.304071 0.392392 0.0689894 1.05925 0.0539375 -0.135082 2.05925 0.0987282 3.05925
+0.05151 0.122882 0.336029 0.00914259 1.05151 -0.0225663 -0.0137394 2.05151 0.141666 3.05151
+0.05 -1.95649e-09 0.406723 0.165919 1.05 -0.101681 0.265919 2.05 0.0060979 3.05
+0.0666681 0.408266 0.303833 0.0989932 1.06667 0.128175 -0.209273 2.06667 0.0421567 3.06667
+0.0582649 0.287488 0.358007 0.109803 1.05826 0.0542423 -0.077685 2.05826 0.0475991 3.05826
+0.0563204 0.251403 0.420048 0.0386563 1.05632 0.0206895 -0.112747 2.05632 0.137358 3.05632
+0.075054 0.500539 0.424934 0.130804 1.07505 0.144036 -0.269735 2.07505 0.0466762 3.07505
+0.0566184 0.257262 0.382376 0.0706659 1.05662 0.033037 -0.0865961 2.05662 0.0940469 3.05662
+0.0624417 0.352728 0.48333 0.0847188 1.06244 0.0555315 -0.168009 2.06244 0.11028 3.06244
+0.0741261 0.491183 0.429986 0.0281566 1.07413 0.138095 -0.363026 2.07413 0.150839 3.07413
+0.0656702 0.395856 0.412731 0.0616806 1.06567 0.0947452 -0.234175 2.06567 0.112139 3.06567
+0.0562864 0.250726 0.450244 0.0477884 1.05629 0.012802 -0.102938 2.05629 0.137285 3.05629
+0.0647488 0.384041 0.398425 0.0514582 1.06475 0.0924143 -0.232583 2.06475 0.118069 3.06475
+0.0666275 0.407768 0.267713 0.0786555 1.06663 0.136956 -0.229112 2.06663 0.0516584 3.06663
+0.066904 0.411145 0.386614 0.0399502 1.0669 0.108919 -0.271195 2.0669 0.126034 3.0669
+0.06119 0.334514 0.382283 0.0220286 1.06119 0.0716862 -0.212485 2.06119 0.142656 3.06119
+0.0689402 0.435203 0.433971 0.00245497 1.06894 0.109109 -0.332748 2.06894 0.177736 3.06894
+0.0646815 0.383165 0.338828 0.00295598 1.06468 0.106875 -0.280209 2.06468 0.148692 3.06468
+0.0683397 0.428249 0.476191 0.0489309 1.06834 0.0950768 -0.279318 2.06834 0.143926 3.06834
+0.0507485 0.0865139 0.413831 0.299722 1.05075 -0.0602008 0.313208 2.05075 -0.125573 3.05075
+0.0645452 0.381382 0.428554 0.0533778 1.06455 0.0835525 -0.228004 2.06455 0.125188 3.06455
+0.0669599 0.411824 0.371421 0.00792794 1.06696 0.113057 -0.303896 2.06696 0.153498 3.06696
+0.0501601 0.0400172 0.499582 0.014872 1.05016 -0.104887 0.0748548 2.05016 0.185003 3.05016
+0.0748457 0.498454 0.466807 0.0101397 1.07485 0.132525 -0.388314 2.07485 0.179902 3.07485
+0.0589591 0.299318 0.426633 0.0151793 1.05896 0.0430007 -0.184139 2.05896 0.162811 3.05896
+0.0580294 0.283362 0.5 0.0628799 1.05803 0.016681 -0.120482 2.05803 0.13712 3.05803
+0.0685145 0.430285 0.485677 0.0307837 1.06851 0.0937232 -0.299501 2.06851 0.164919 3.06851
+0.0757976 0.507914 0.382445 0.0600464 1.0758 0.158346 -0.347868 2.0758 0.104687 3.0758
+0.0560288 0.245535 0.338318 0.113534 1.05603 0.038188 -0.032001 2.05603 0.0379614 3.05603
+0.0734817 0.484579 0.401861 0.01597 1.07348 0.141824 -0.368609 2.07348 0.154588 3.07348
+0.0637958 0.371427 0.241165 0.0135561 1.0638 0.125422 -0.257871 2.0638 0.108793 3.0638
+0.0572862 0.26993 0.473439 0.00233396 1.05729 0.0166053 -0.167596 2.05729 0.189698 3.05729
+0.0891821 0.625956 0.243953 0.0679591 1.08918 0.25199 -0.457997 2.08918 0.0552268 3.08918
+0.0569831 0.264256 0.215753 0.0157234 1.05698 0.0781898 -0.148533 2.05698 0.0990025 3.05698
+0.0591266 0.302103 0.432153 0.02314 1.05913 0.0430133 -0.178963 2.05913 0.156506 3.05913
+0.066568 0.407038 0.421771 0.00204533 1.06657 0.0980763 -0.304993 2.06657 0.174486 3.06657
+0.0653574 0.391885 0.422411 0.0968169 1.06536 0.0903397 -0.195068 2.06536 0.0799064 3.06536
+0.0878751 0.615427 0.439968 0.0683811 1.08788 0.197721 -0.447046 2.08788 0.113609 3.08788
+0.0545652 0.213664 0.202386 0.0119204 1.05457 0.0562355 -0.101744 2.05457 0.0987954 3.05457
+0.0706756 0.454704 0.386029 0.0538501 1.07068 0.130845 -0.300854 2.07068 0.111959 3.07068
+0.0648954 0.385946 0.379308 0.0381505 1.0649 0.098146 -0.247796 2.0649 0.125642 3.0649
+0.0754935 0.504911 0.202342 0.00554968 1.07549 0.20187 -0.399361 2.07549 0.105153 3.07549
+0.0615823 0.340328 0.390607 0.0695916 1.06158 0.0725123 -0.170736 2.06158 0.0975905 3.06158
+0.067041 0.412807 0.5 0.0149873 1.06704 0.0814035 -0.29782 2.06704 0.185013 3.06704
+0.0643225 0.378451 0.481742 0.0550529 1.06432 0.06879 -0.223398 2.06432 0.13947 3.06432
+0.0572443 0.269152 0.5 0.25 1.05724 0.009576 0.080848 2.05724 -0.05 3.05724
+0.0616266 0.340979 0.455445 0.0121655 1.06163 0.0566282 -0.228813 2.06163 0.174468 3.06163
+0.0639357 0.373305 0.425404 0.0296916 1.06394 0.0803015 -0.243613 2.06394 0.14793 3.06394
+0.0661993 0.402484 0.307003 0.0471496 1.0662 0.124491 -0.255334 2.0662 0.0949513 3.0662
+0.0827418 0.572204 0.313127 0.0406456 1.08274 0.20782 -0.431558 2.08274 0.103293 3.08274
+0.0561254 0.247496 0.293918 0.00414817 1.05613 0.0502685 -0.143348 2.05613 0.134027 3.05613
+0.0698323 0.445335 0.425105 0.072869 1.06983 0.116391 -0.272466 2.06983 0.104662 3.06983
+0.0564339 0.253651 0.5 0.118036 1.05643 0.0018255 -0.035615 2.05643 0.081964 3.05643
+0.0529226 0.170957 0.337724 0.224875 1.05292 0.0010475 0.153918 2.05292 -0.0735578 3.05292
+0.0765445 0.515213 0.428001 0.0140907 1.07654 0.150606 -0.401122 2.07654 0.16431 3.07654
+0.0613981 0.337611 0.411596 0.0409026 1.0614 0.0659065 -0.196708 2.0614 0.132576 3.0614
+0.0666696 0.408285 0.438011 0.0342898 1.06667 0.0946398 -0.273995 2.06667 0.147114 3.06667
+0.0589704 0.299506 0.183908 0.110938 1.05897 0.103776 -0.088568 2.05897 -0.0057656 3.05897
+0.0578537 0.280244 0.41669 0.0063148 1.05785 0.0359495 -0.173929 2.05785 0.168692 3.05785
+0.0508972 0.0947206 0.368208 0.312842 1.0509 -0.0446917 0.318121 2.0509 -0.15238 3.0509
+0.0686065 0.431353 0.3843 0.0485017 1.06861 0.119601 -0.282851 2.06861 0.116788 3.06861
+0.05 0.000514316 0.499568 0.00299025 1.05 -0.124635 0.102476 2.05 0.19688 3.05
+0.052107 0.145156 0.43462 0.114698 1.05211 -0.036077 0.069542 2.05211 0.065688 3.05211
+0.0564343 0.25366 0.341204 0.18109 1.05643 0.041529 0.02743 2.05643 -0.0287288 3.05643
+0.0682193 0.42684 0.403637 0.076374 1.06822 0.112511 -0.250466 2.06822 0.0947171 3.06822
+0.0581756 0.285931 0.378798 0.0888738 1.05818 0.048266 -0.0970572 2.05818 0.0747656 3.05818
+0.0502923 0.0540624 0.240836 0.0625318 1.05029 -0.0331778 0.108469 2.05029 0.059719 3.05029
+0.0691231 0.4373 0.429471 1.81069e-45 1.06912 0.111282 -0.3373 2.06912 0.178841 3.06912
+0.0839442 0.582616 0.160803 4.34714e-48 1.08394 0.251107 -0.482616 2.08394 0.0982409 3.08394
+0.0671151 0.413704 0.448507 0.0731083 1.06712 0.0947253 -0.240596 2.06712 0.111444 3.06712
+0.0551109 0.226072 0.416736 0.0432388 1.05511 0.008852 -0.0828332 2.05511 0.131782 3.05511
+0.06174 0.342637 0.230161 0.0396386 1.06174 0.113778 -0.202998 2.06174 0.0794097 3.06174
+0.060133 0.318324 0.311063 3.65903e-49 1.06013 0.0813963 -0.218324 2.06013 0.143319 3.06013
+0.0597864 0.312832 0.404597 0.0637715 1.05979 0.0552668 -0.14906 2.05979 0.107608 3.05979
+0.0500002 0.00153509 0.490818 0.0217969 1.05 -0.121937 0.120262 2.05 0.175449 3.05
+0.05 -8.27392e-10 0.4497 0.302386 1.05 -0.112425 0.402386 2.05 -0.117476 3.05
+0.0625101 0.353696 0.471335 0.0504348 1.06251 0.0590143 -0.203261 2.06251 0.140966 3.06251
+0.0537226 0.192941 0.373357 0.07263 1.05372 0.00313125 -0.020311 2.05372 0.0893771 3.05372
+0.073775 0.487596 0.433759 0.0845376 1.07377 0.135358 -0.303058 2.07377 0.0955901 3.07377
+0.0618053 0.343588 0.385229 0.054751 1.06181 0.0754868 -0.188837 2.06181 0.110818 3.06181
+0.0710695 0.459016 0.414021 0.00397642 1.07107 0.126003 -0.35504 2.07107 0.17023 3.07107
+0.0572914 0.270027 0.364194 0.0667877 1.05729 0.043965 -0.103239 2.05729 0.0924705 3.05729
+0.0568808 0.262312 2.4503e-17 1.25055e-51 1.05688 0.131156 -0.162312 2.05688 0.05 3.05688
+0.0844505 0.586945 0.215879 0.00585583 1.08445 0.239503 -0.481089 2.08445 0.108908 3.08445
+0.0713677 0.462252 0.353862 0.118481 1.07137 0.14266 -0.243771 2.07137 0.0376776 3.07137
+0.0526493 0.162768 0.5 0.392547 1.05265 -0.043616 0.329779 2.05265 -0.192547 3.05265
+0.0693566 0.439961 0.43474 0.0163421 1.06936 0.111295 -0.323619 2.06936 0.16408 3.06936
+0.0579023 0.28111 0.360121 0.0429671 1.0579 0.0505248 -0.138143 2.0579 0.115069 3.0579
+0.0529535 0.171857 0.377823 0.26277 1.05295 -0.00852725 0.190913 2.05295 -0.0994231 3.05295
+0.0608588 0.329526 0.48175 0.0601366 1.06086 0.0443255 -0.169389 2.06086 0.134388 3.06086
+0.05 -8.93662e-07 0.337675 5.28585e-65 1.05 -0.0844192 0.100001 2.05 0.151303 3.05
+0.0665758 0.407133 0.473369 0.000600072 1.06658 0.0852243 -0.306533 2.06658 0.191411 3.06658
+0.0602548 0.320231 0.357595 0.0114953 1.06025 0.0707167 -0.208736 2.06025 0.145783 3.06025
+0.05 -4.13812e-08 0.172243 0.0663745 1.05 -0.0430608 0.166375 2.05 0.0352984 3.05
+0.0576219 0.276077 0.414735 0.0806664 1.05762 0.0343548 -0.0954106 2.05762 0.0937541 3.05762
+0.0593932 0.306483 0.377344 0.133927 1.05939 0.0589055 -0.072556 2.05939 0.0292762 3.05939
+0.06295 0.35986 0.5 0.0456677 1.06295 0.05493 -0.214192 2.06295 0.154332 3.06295
+0.054 0.200001 0.359962 0.319862 1.054 0.01001 0.219861 2.054 -0.161873 3.054
+0.0553687 0.231704 0.44682 0.0354847 1.05537 0.004147 -0.0962193 2.05537 0.148561 3.05537
+0.0600065 0.31633 0.373327 0.0393177 1.06001 0.0648332 -0.177012 2.06001 0.12268 3.06001
+0.0587356 0.295561 0.480522 0.0312049 1.05874 0.02765 -0.164356 2.05874 0.162952 3.05874
+0.0912359 0.642152 0.162655 0.14202 1.09124 0.280412 -0.400132 2.09124 -0.0432235 3.09124
+0.0604298 0.322952 0.466767 0.140855 1.06043 0.0447843 -0.082097 2.06043 0.0491751 3.06043
+0.05 -3.64292e-17 0.5 0.799087 1.05 -0.125 0.899087 2.05 -0.599087 3.05
+0.0641588 0.376282 0.419121 0.0557609 1.06416 0.0833607 -0.220521 2.06416 0.119975 3.06416
+0.0556797 0.238321 0.393725 0.00114114 1.05568 0.0207293 -0.13718 2.05568 0.166976 3.05568
+0.099 0.7 0.5 0.00939447 1.099 0.225 -0.590606 2.099 0.190606 3.099
+0.0511621 0.107799 0.428254 0.42636 1.05116 -0.053164 0.418561 2.05116 -0.247884 3.05116
+0.0501303 0.0360943 0.465686 0.0305191 1.05013 -0.0983743 0.0944248 2.05013 0.159187 3.05013
+0.0516232 0.127407 0.261237 0.16509 1.05162 -0.00160575 0.137683 2.05162 -0.0367189 3.05162
+0.0919677 0.647825 0.243632 0.108937 1.09197 0.263004 -0.438888 2.09197 0.0141526 3.09197
+0.0644804 0.380532 0.427043 0.0878615 1.06448 0.0835052 -0.19267 2.06448 0.0902514 3.06448
+0.0689956 0.435839 0.128457 0.137175 1.069 0.185805 -0.198664 2.069 -0.0486379 3.069
+0.0585854 0.293008 0.466012 0.114825 1.05859 0.030001 -0.078183 2.05859 0.0749786 3.05859
+0.0874738 0.612158 0.366278 0.00710904 1.08747 0.214509 -0.505049 2.08747 0.152774 3.08747
+0.0583732 0.289364 0.40179 8.50205e-50 1.05837 0.0442345 -0.189364 2.05837 0.170537 3.05837
+0.0634311 0.366485 0.391802 0.0723782 1.06343 0.085292 -0.194107 2.06343 0.0951624 3.06343
+0.05708 0.266084 0.5 0.0901495 1.05708 0.008042 -0.0759345 2.05708 0.109851 3.05708
+0.0515911 0.126139 0.477938 0.327395 1.05159 -0.056415 0.301256 2.05159 -0.134014 3.05159
+0.0642521 0.37752 0.409186 0.0547083 1.06425 0.0864635 -0.222812 2.06425 0.118047 3.06425
+0.0501847 0.0429814 0.26851 0.00579439 1.05018 -0.0456368 0.062813 2.05018 0.124759 3.05018
+0.05717 0.267768 0.11481 0.00502399 1.05717 0.105182 -0.162744 2.05717 0.079419 3.05717
+0.0529461 0.171643 0.20706 0.102436 1.05295 0.0340565 0.030793 2.05295 0.009682 3.05295
+0.0665627 0.406973 0.339204 0.0414934 1.06656 0.118685 -0.26548 2.06656 0.110268 3.06656
+0.0631024 0.361972 0.478891 0.0263694 1.0631 0.0612633 -0.235603 2.0631 0.167298 3.0631
+0.054 0.2 0.347687 1 1.054 0.0130782 0.9 2.054 -0.845694 3.054
+0.0529521 0.171818 0.410958 0.00623723 1.05295 -0.0168305 -0.0655808 2.05295 0.16705 3.05295
+0.0597734 0.312624 0.450629 0.0350941 1.05977 0.0436548 -0.17753 2.05977 0.150095 3.05977
+0.099 0.7 0.426067 0.111894 1.099 0.243483 -0.488106 2.099 0.0659261 3.099
+0.0634296 0.366465 0.437598 0.0700942 1.06343 0.073833 -0.196371 2.06343 0.111185 3.06343
+0.065503 0.393739 0.376758 0.0336293 1.0655 0.10268 -0.26011 2.0655 0.129398 3.0655
+0.05 5.22585e-17 0.210382 1 1.05 -0.0525955 1.1 2.05 -0.886885 3.05
+0.0646324 0.382524 0.385875 0.0753888 1.06463 0.0947932 -0.207135 2.06463 0.0903737 3.06463
+0.05 2.80331e-15 0.314146 0.765571 1.05 -0.0785365 0.865571 2.05 -0.621327 3.05
+0.0557023 0.238794 0.468102 0.0229185 1.0557 0.0023715 -0.115875 2.0557 0.167512 3.0557
+0.0514404 0.120017 0.395296 0.285346 1.05144 -0.0388155 0.265329 2.05144 -0.116757 3.05144
+0.0721119 0.470233 0.180716 0.0366443 1.07211 0.189938 -0.333589 2.07211 0.0675705 3.07211
+0.055854 0.24195 0.468171 0.000671538 1.05585 0.00393225 -0.141278 2.05585 0.18978 3.05585
+0.0627534 0.35712 0.370966 0.0273008 1.06275 0.0858185 -0.229819 2.06275 0.133989 3.06275
+0.0691461 0.437562 0.304222 0.0357009 1.06915 0.142726 -0.301861 2.06915 0.105566 3.06915
+0.0526252 0.162025 0.339972 0.0253803 1.05263 -0.0039805 -0.0366447 2.05263 0.126611 3.05263
+0.0660154 0.400193 0.416473 0.0457714 1.06602 0.0959783 -0.254422 2.06602 0.129171 3.06602
+0.0564017 0.253016 0.486691 0.0557946 1.0564 0.00483525 -0.0972214 2.0564 0.140213 3.0564
+0.05 -1.92437e-11 0.0715759 0.264739 1.05 -0.017894 0.364739 2.05 -0.193266 3.05
+0.099 0.7 0.34152 0.00663746 1.099 0.26462 -0.593363 2.099 0.145819 3.099
+0.0575627 0.275004 0.475264 0.0563948 1.05756 0.018686 -0.118609 2.05756 0.136184 3.05756
+0.0790158 0.538663 0.168661 0.00261918 1.07902 0.227166 -0.436044 2.07902 0.0979791 3.07902
+0.0539766 0.199414 0.139334 0.00781977 1.05398 0.0648735 -0.0915942 2.05398 0.0839804 3.05398
+0.05 4.87566e-14 0.109428 0.511326 1.05 -0.027357 0.611326 2.05 -0.428498 3.05
+0.0605587 0.324941 0.314002 0.132553 1.06056 0.08397 -0.092388 2.06056 0.0116476 3.06056
+0.0687545 0.433064 0.477886 0.108073 1.06875 0.0970605 -0.224991 2.06875 0.0852928 3.06875
+0.0664169 0.405178 0.466931 0.0313487 1.06642 0.0858562 -0.273829 2.06642 0.158731 3.06642
+0.05 -2.81973e-09 0.0682425 0.0519193 1.05 -0.0170606 0.151919 2.05 0.0185534 3.05
+0.0951687 0.672076 0.458952 0.0256487 1.09517 0.2213 -0.546427 2.09517 0.162037 3.09517
+0.0598475 0.313808 0.330753 0.0692005 1.05985 0.0742157 -0.144607 2.05985 0.0800254 3.05985
+0.0544411 0.210739 0.385983 0.000781933 1.05444 0.00887375 -0.109957 2.05444 0.165013 3.05444
+0.0735861 0.485655 0.5 0.0876011 1.07359 0.117828 -0.298054 2.07359 0.112399 3.07359
+0.0727382 0.476846 0.279055 0.0325518 1.07274 0.168659 -0.344294 2.07274 0.101165 3.07274
+0.0730187 0.479778 0.0804691 0.25 1.07302 0.219772 -0.129778 2.07302 -0.175859 3.07302
+0.0535019 0.187133 0.0501365 0.218541 1.0535 0.0810324 0.131408 2.0535 -0.1535 3.0535
+0.0589125 0.298538 0.329907 0.055628 1.05891 0.0667923 -0.14291 2.05891 0.0933441 3.05891
+0.0618054 0.34359 0.432693 0.0200634 1.06181 0.0636218 -0.223527 2.06181 0.159745 3.06181
+0.057629 0.276206 0.328009 0.0467872 1.05763 0.0561008 -0.129419 2.05763 0.101615 3.05763
+0.0611737 0.334271 0.394679 0.057869 1.06117 0.0684657 -0.176402 2.06117 0.110535 3.06117
+0.0642726 0.377791 0.250811 0.057798 1.06427 0.126193 -0.219993 2.06427 0.0674453 3.06427
+0.0654865 0.393528 0.414847 0.0350818 1.06549 0.0930522 -0.258446 2.06549 0.139372 3.06549
+0.051 0.1 0.5 0 1.051 -0.075 0 2.051 0.2 3.051
+0.0500001 -0.000922917 0.445854 0.0257865 1.05 -0.111925 0.126709 2.05 0.15797 3.05
+0.0568346 0.26143 0.334543 0.00737065 1.05683 0.0470793 -0.154059 2.05683 0.142992 3.05683
+0.0768367 0.518041 0.301438 0.011167 1.07684 0.183661 -0.406874 2.07684 0.129264 3.07684
+0.0635405 0.367974 0.361716 0.0794827 1.06354 0.093558 -0.188491 2.06354 0.0790321 3.06354
+0.0608518 0.329421 0.365226 0.000862381 1.06085 0.073404 -0.228559 2.06085 0.158705 3.06085
+0.0563287 0.251569 0.500001 0.0168284 1.05633 0.00078425 -0.134741 2.05633 0.183172 3.05633
+0.0504924 0.0701719 1.69416e-13 0.00713089 1.05049 0.0350859 0.036959 2.05049 0.0428691 3.05049
+0.0601581 0.318718 0.321512 0.0147002 1.06016 0.078981 -0.204018 2.06016 0.131753 3.06016
+0.0540558 0.20139 0.473053 0.00134562 1.05406 -0.0175682 -0.100044 2.05406 0.19057 3.05406
+0.052588 0.160871 0.355041 0.330835 1.05259 -0.00832475 0.269964 2.05259 -0.174323 3.05259
+0.056804 0.260845 0.174383 0.0469269 1.0568 0.0868267 -0.113918 2.0568 0.055388 3.0568
+0.0653349 0.391597 0.414455 0.0393326 1.06533 0.0921847 -0.252264 2.06533 0.135004 3.06533
+0.0540547 0.201363 0.00598047 0.262035 1.05405 0.0991864 0.160672 2.05405 -0.210241 3.05405
+0.0744892 0.494866 0.251816 0.00832037 1.07449 0.184479 -0.386546 2.07449 0.117224 3.07449
+0.0743287 0.493241 0.206435 0.19665 1.07433 0.195012 -0.196591 2.07433 -0.0847195 3.07433
+0.062572 0.35457 0.39851 0.0861061 1.06257 0.0776575 -0.168464 2.06257 0.0834469 3.06257
+0.0645574 0.381541 0.5 0.142797 1.06456 0.0657705 -0.138744 2.06456 0.057203 3.06456
+0.0932264 0.657468 0.433865 0.00972303 1.09323 0.220268 -0.547745 2.09323 0.170436 3.09323
+0.0629344 0.359644 0.432677 0.0200897 1.06293 0.0716528 -0.239554 2.06293 0.159713 3.06293
+0.0500025 0.0050395 0.494356 0.0149742 1.05 -0.121069 0.109935 2.05 0.183333 3.05
+0.0675513 0.418943 0.325642 0.0139206 1.06755 0.128061 -0.305022 2.06755 0.133772 3.06755
+0.0619982 0.346383 0.433646 0.0323852 1.062 0.06478 -0.213998 2.062 0.147709 3.062
+0.0643215 0.378438 0.397736 0.0625903 1.06432 0.089785 -0.215848 2.06432 0.10673 3.06432
+0.0714018 0.462621 0.472627 0.00538008 1.0714 0.113154 -0.357241 2.0714 0.186408 3.0714
+0.0723661 0.472929 0.366331 0.0142304 1.07237 0.144882 -0.358699 2.07237 0.145669 3.07237
+0.0622416 0.34988 0.354172 0.00896591 1.06224 0.086397 -0.240914 2.06224 0.147286 3.06224
+0.0539999 0.199999 -4.46238e-07 0.330348 1.054 0.0999996 0.230349 2.054 -0.280348 3.054
+0.0664634 0.405751 0.319764 0.0595604 1.06646 0.122934 -0.246191 2.06646 0.0863688 3.06646
+0.0667368 0.409106 0.411843 0.0857716 1.06674 0.101592 -0.223334 2.06674 0.0877813 3.06674
+0.0617891 0.343352 0.296892 0.00372438 1.06179 0.097453 -0.239628 2.06179 0.135343 3.06179
+0.0586428 0.293987 0.285146 0.0846354 1.05864 0.075707 -0.109352 2.05864 0.0509084 3.05864
+0.0925376 0.652208 0.373474 0.0505062 1.09254 0.232736 -0.501702 2.09254 0.111536 3.09254
+0.0710794 0.459124 0.364195 0.0605128 1.07108 0.138513 -0.298611 2.07108 0.0987457 3.07108
+0.0532902 0.181389 0.500001 0.18952 1.05329 -0.0343058 0.108131 2.05329 0.0104803 3.05329
+0.0509904 0.0995184 0.324855 0.141313 1.05099 -0.0314545 0.141795 2.05099 0.0061435 3.05099
+0.0745159 0.495135 0.27025 0.114448 1.07452 0.180005 -0.280687 2.07452 0.016627 3.07452
+0.0644361 0.379949 0.323726 0.0723213 1.06444 0.109043 -0.207628 2.06444 0.0747965 3.06444
+0.0650944 0.388515 0.331565 0.0524507 1.06509 0.111366 -0.236064 2.06509 0.0970188 3.06509
+0.0533989 0.184361 0.401201 0.182299 1.0534 -0.00811975 0.097938 2.0534 -0.0119387 3.0534
+0.0633872 0.365886 0.336724 0.137921 1.06339 0.098762 -0.127965 2.06339 0.0130962 3.06339
+0.0645936 0.382016 0.293133 0.0355784 1.06459 0.117725 -0.246438 2.06459 0.102361 3.06459
+0.0688613 0.434296 0.323954 0.0278723 1.06886 0.136159 -0.306424 2.06886 0.119314 3.06886
+0.0503981 0.0630982 0.330988 0.0653058 1.0504 -0.0511979 0.102208 2.0504 0.0839906 3.0504
+0.0671244 0.413816 0.35714 0.0559546 1.06712 0.117623 -0.257861 2.06712 0.101187 3.06712
+0.0688979 0.434717 0.38794 0.00520307 1.0689 0.120374 -0.329514 2.0689 0.161179 3.0689
+0.0565677 0.256275 0.356524 0.0268615 1.05657 0.0390065 -0.129413 2.05657 0.130096 3.05657
+0.0654105 0.392562 0.423339 0.0416578 1.06541 0.0904463 -0.250904 2.06541 0.135344 3.06541
+0.068887 0.434592 0.359197 0.0569441 1.06889 0.127497 -0.277648 2.06889 0.100815 3.06889
+0.0675647 0.419103 0.199652 0.0531721 1.06756 0.159639 -0.265931 2.06756 0.0567235 3.06756
+0.0514523 0.12051 0.500001 0.112693 1.05145 -0.0647453 0.092183 2.05145 0.0873073 3.05145
+0.0528584 0.169069 0.499989 0.0242189 1.05286 -0.0404628 -0.0448501 2.05286 0.175778 3.05286
+0.050597 0.0772676 0.0897026 0.417149 1.0506 0.0162082 0.439881 2.0506 -0.340238 3.0506
+0.0546303 0.21518 0.5 0.170859 1.05463 -0.01741 0.055679 2.05463 0.029141 3.05463
+0.0655342 0.394135 0.482772 0.0510603 1.06553 0.0763745 -0.243075 2.06553 0.143771 3.06553
+0.0697459 0.444364 0.379414 0.036285 1.06975 0.127329 -0.308079 2.06975 0.127539 3.06975
+0.0675685 0.419147 0.5 0.00677911 1.06757 0.0845735 -0.312368 2.06757 0.193221 3.06757
+0.0541614 0.203996 0.397711 0.00441665 1.05416 0.00257025 -0.0995794 2.05416 0.164897 3.05416
+0.0639051 0.372895 0.385205 0.0629036 1.06391 0.0901462 -0.209991 2.06391 0.102658 3.06391
+0.0597017 0.311476 0.43834 0.176738 1.0597 0.046153 -0.034738 2.0597 0.004764 3.0597
+0.0683236 0.428061 0.5 0.00119462 1.06832 0.0890305 -0.326866 2.06832 0.198805 3.06832
+0.0610932 0.333064 0.364221 0.0625412 1.06109 0.0754768 -0.170523 2.06109 0.0967251 3.06109
+0.0668977 0.411068 0.32878 6.37591e-46 1.0669 0.123339 -0.311068 2.0669 0.148634 3.0669
+0.0509375 0.096826 0.5 0.706976 1.05094 -0.076587 0.71015 2.05094 -0.506976 3.05094
+0.0602934 0.320834 0.293341 0.034561 1.06029 0.0870817 -0.186273 2.06029 0.103441 3.06029
+0.0504812 0.0693678 0.379114 0.0266864 1.05048 -0.0600946 0.0573186 2.05048 0.137048 3.05048
+0.0778331 0.527571 0.426021 0.112294 1.07783 0.15728 -0.315277 2.07783 0.0655123 3.07783
+0.0580382 0.283516 0.45952 0.0773151 1.05804 0.026878 -0.106201 2.05804 0.110541 3.05804
+0.0587694 0.296132 0.456989 0.0616981 1.05877 0.0338188 -0.134434 2.05877 0.125399 3.05877
+0.0693656 0.440064 0.277177 0.0849579 1.06937 0.150738 -0.255106 2.06937 0.0481952 3.06937
+0.0865242 0.604352 0.5 0.143215 1.08652 0.177176 -0.361137 2.08652 0.056785 3.08652
+0.072511 0.474458 0.314844 0.074001 1.07251 0.158518 -0.300457 2.07251 0.0704522 3.07251
+0.052067 0.143772 0.211918 0.20079 1.05207 0.0189065 0.157018 2.05207 -0.0872146 3.05207
+0.099 0.7 0.270152 0.25 1.099 0.282462 -0.35 2.099 -0.118954 3.099
+0.0539999 0.199997 0.500036 0.312698 1.054 -0.0250105 0.212701 2.054 -0.112687 3.054
+0.0554239 0.232893 0.231846 0.024616 1.05542 0.058485 -0.108277 2.05542 0.0949378 3.05542
+0.0650808 0.38834 0.380414 0.00495843 1.06508 0.0990665 -0.283382 2.06508 0.159166 3.06508
+0.0685024 0.430144 0.397144 0.0176868 1.0685 0.115786 -0.312457 2.0685 0.151456 3.0685
+0.051269 0.112648 0.219317 0.0410362 1.05127 0.00149475 0.0283882 2.05127 0.0747589 3.05127
+0.0640218 0.374456 0.412725 0.0665301 1.06402 0.0840468 -0.207926 2.06402 0.107287 3.06402
+0.064013 0.374339 0.386687 0.036472 1.06401 0.0904977 -0.237867 2.06401 0.129534 3.06401
+0.0568357 0.261452 0.372594 0.0573042 1.05684 0.0375775 -0.104148 2.05684 0.104474 3.05684
+0.0595102 0.308386 0.27218 0.021197 1.05951 0.086148 -0.187189 2.05951 0.110457 3.05951
+0.0553337 0.230948 0.464802 0.00471725 1.05533 -0.0007265 -0.126231 2.05533 0.184723 3.05533
+0.0770701 0.52029 0.258951 0.00221124 1.07707 0.195407 -0.418079 2.07707 0.125474 3.07707
+0.0657743 0.397168 0.452379 0.0552245 1.06577 0.0854893 -0.241944 2.06577 0.130489 3.06577
+0.0524005 0.154934 0.12975 0.122377 1.0524 0.0450295 0.067443 2.0524 -0.033452 3.0524
+0.0814523 0.560824 0.423902 0.0162339 1.08145 0.174436 -0.44459 2.08145 0.160937 3.08145
+0.062873 0.358789 0.5 0.00095651 1.06287 0.0543945 -0.257832 2.06287 0.199043 3.06287
+0.0561323 0.247634 0.298678 0.102439 1.05613 0.0491475 -0.045195 2.05613 0.0371644 3.05613
+0.0509458 0.0972507 0.407476 0.848943 1.05095 -0.0532437 0.851692 2.05095 -0.6767 3.05095
+0.0690038 0.435934 0.441423 0.0301679 1.069 0.107611 -0.305766 2.069 0.152259 3.069
+0.0559327 0.243571 0.367664 0.0873849 1.05593 0.0298695 -0.0561861 2.05593 0.0729143 3.05593
+0.052224 0.14913 0.309631 0.269712 1.05222 -0.00284275 0.220582 2.05222 -0.126823 3.05222
+0.0570049 0.264668 0.26363 0.0605184 1.057 0.0664265 -0.10415 2.057 0.0685706 3.057
+0.057129 0.267002 0.431503 0.0279072 1.05713 0.0256253 -0.139095 2.05713 0.151544 3.05713
+0.0648852 0.385814 0.419026 0.0405505 1.06489 0.0881505 -0.245263 2.06489 0.135157 3.06489
+0.0640238 0.374484 0.5 0.0544636 1.06402 0.062242 -0.22002 2.06402 0.145536 3.06402
+0.0562266 0.249531 0.475539 0.0436139 1.05623 0.00588075 -0.105917 2.05623 0.149048 3.05623
+0.0601309 0.318291 0.43898 0.0411515 1.06013 0.0494005 -0.177139 2.06013 0.140542 3.06013
+0.0623717 0.351735 0.397588 0.06989 1.06237 0.0764705 -0.181845 2.06237 0.0993864 3.06237
+0.0574715 0.27334 0.233812 0.152815 1.05747 0.078217 -0.020525 2.05747 -0.0326714 3.05747
+0.0667413 0.409161 0.371669 0.0585562 1.06674 0.111663 -0.250605 2.06674 0.102945 3.06674
+0.0631381 0.362465 0.44663 0.085446 1.06314 0.069575 -0.177019 2.06314 0.098543 3.06314
+0.0603082 0.321064 0.404215 0.0507647 1.06031 0.0594783 -0.170299 2.06031 0.1205 3.06031
+0.0727726 0.477206 0.290888 0.0104893 1.07277 0.165881 -0.366717 2.07277 0.126777 3.07277
+0.0529418 0.171518 0.471767 0.306155 1.05294 -0.0321827 0.234637 2.05294 -0.114625 3.05294
+0.0594068 0.306705 0.410858 0.0929519 1.05941 0.050638 -0.113753 2.05941 0.0803055 3.05941
+0.0649865 0.387124 0.453239 0.0613554 1.06499 0.0802523 -0.225769 2.06499 0.124616 3.06499
+0.0662256 0.40281 0.399572 0.0581772 1.06623 0.101512 -0.244633 2.06623 0.111694 3.06623
+0.0543577 0.208751 0.500001 0.210788 1.05436 -0.0206248 0.102037 2.05436 -0.0107877 3.05436
+0.066994 0.412237 0.345972 0.0183719 1.06699 0.119626 -0.293865 2.06699 0.13542 3.06699
+0.0537846 0.194541 0.000113543 0.269415 1.05378 0.0972421 0.174874 2.05378 -0.219381 3.05378
+0.0659378 0.399222 0.364953 0.0767986 1.06594 0.108373 -0.222423 2.06594 0.0826873 3.06594
+0.0576712 0.276969 0.433444 0.0454347 1.05767 0.0301235 -0.131534 2.05767 0.134599 3.05767
+0.0612069 0.334767 0.409973 0.0595464 1.06121 0.0648902 -0.175221 2.06121 0.113445 3.06121
+0.0662819 0.403508 0.442867 0.060499 1.06628 0.0910372 -0.243009 2.06628 0.122361 3.06628
+0.0548106 0.21933 0.3511 0.0085021 1.05481 0.02189 -0.110828 2.05481 0.146828 3.05481
+0.0621986 0.349265 0.478376 0.0010952 1.0622 0.0550385 -0.24817 2.0622 0.192418 3.0622
+0.0535927 0.189544 1.54367e-07 0.126224 1.05359 0.094772 0.03668 2.05359 -0.076224 3.05359
+0.0671962 0.414683 0.457479 0.0837532 1.0672 0.0929718 -0.23093 2.0672 0.10349 3.0672
+0.0569316 0.26328 0.452714 0.0847075 1.05693 0.0184615 -0.0785725 2.05693 0.101107 3.05693
+0.0500697 0.0264028 0.460655 0.0161147 1.05007 -0.101962 0.0897119 2.05007 0.172082 3.05007
+0.0572499 0.269256 0.39775 0.00935134 1.05725 0.0351905 -0.159905 2.05725 0.159974 3.05725
+0.0639128 0.372998 0.425176 0.0565285 1.06391 0.080205 -0.216469 2.06391 0.121024 3.06391
+0.0689082 0.434835 0.374828 0.0431989 1.06891 0.123711 -0.291636 2.06891 0.119249 3.06891
+0.054 0.2 0.303718 0.449365 1.054 0.0240705 0.349365 2.054 -0.30825 3.054
+0.0657231 0.396524 0.363009 0.0653692 1.06572 0.10751 -0.231155 2.06572 0.0935335 3.06572
+0.0512547 0.112015 0.246997 0.019507 1.05125 -0.00574175 0.007492 2.05125 0.104592 3.05125
+0.0596034 0.309894 0.332377 0.105733 1.0596 0.0718528 -0.104161 2.0596 0.0439801 3.0596
+0.099 0.7 0 0.0528881 1.099 0.35 -0.547112 2.099 -0.0028881 3.099
+0.0675346 0.418744 0.44122 0.000787721 1.06753 0.099067 -0.317956 2.06753 0.181578 3.06753
+0.0594451 0.307329 0.5 0.0576222 1.05945 0.0286645 -0.149707 2.05945 0.142378 3.05945
+0.0674701 0.417972 0.418829 0.00465403 1.06747 0.104279 -0.313318 2.06747 0.170995 3.06747
+0.0606857 0.32689 0.369615 0.0450999 1.06069 0.0710413 -0.18179 2.06069 0.115785 3.06069
+0.0546702 0.216106 0.4172 0.0298382 1.05467 0.003753 -0.0862678 2.05467 0.145322 3.05467
+0.05 1.32679e-08 0.0796838 0.00364455 1.05 -0.0199209 0.103645 2.05 0.0702606 3.05
+0.0865015 0.604165 1.07688e-16 0.00535996 1.0865 0.302082 -0.498805 2.0865 0.04464 3.0865
+0.0514962 0.12232 0.175566 0.0178386 1.0515 0.0172685 -0.0044814 2.0515 0.0848312 3.0515
+0.0661775 0.402212 0.456276 0.0477407 1.06618 0.087037 -0.254471 2.06618 0.139142 3.06618
+0.0674064 0.41721 1.36198e-11 0.015494 1.06741 0.208605 -0.301716 2.06741 0.034506 3.06741
+0.081107 0.557737 0.0759572 0.0194997 1.08111 0.259879 -0.438237 2.08111 0.0532875 3.08111
+0.0504743 0.0688663 0.46821 0.028805 1.05047 -0.0826194 0.0599387 2.05047 0.161658 3.05047
+0.099 0.7 0.100919 0.0810423 1.099 0.32477 -0.518958 2.099 -0.0007666 3.099
+0.0623536 0.351477 0.366809 0.0604326 1.06235 0.0840362 -0.191044 2.06235 0.0996101 3.06235
+0.0515574 0.124797 0.324453 0.325262 1.05156 -0.0187147 0.300465 2.05156 -0.177926 3.05156
+0.0830643 0.575016 0.5 0.066008 1.08306 0.162508 -0.409008 2.08306 0.133992 3.08306
+0.0648881 0.385851 0.467365 0.0457915 1.06489 0.0760843 -0.240059 2.06489 0.144418 3.06489
+0.0525864 0.160822 0.39524 0.332112 1.05259 -0.018399 0.27129 2.05259 -0.16354 3.05259
+0.0534949 0.186947 0.268891 0.0550189 1.05349 0.0262508 -0.0319281 2.05349 0.0756484 3.05349
+0.0542191 0.205405 0.327995 0.0627586 1.05422 0.0207038 -0.0426464 2.05422 0.0856399 3.05422
+0.0577486 0.278363 0.434397 0.000377957 1.05775 0.0305823 -0.177985 2.05775 0.179941 3.05775
+0.0803129 0.550571 0.42814 0.0948092 1.08031 0.168251 -0.355762 2.08031 0.0836328 3.08031
+0.058947 0.299115 0.331221 0.170968 1.05895 0.0667523 -0.028147 2.05895 -0.0216017 3.05895
+0.0643848 0.379273 0.414055 0.0404781 1.06438 0.0861228 -0.238795 2.06438 0.133738 3.06438
+0.0534166 0.184841 0.360042 0.0148361 1.05342 0.00241 -0.0700049 2.05342 0.143176 3.05342
+0.0577875 0.27906 0.308953 0.0317789 1.05779 0.0622917 -0.147281 2.05779 0.110907 3.05779
+0.052766 0.166313 0.221213 0.0101804 1.05277 0.0278532 -0.0561326 2.05277 0.106183 3.05277
+0.0639321 0.373258 0.419992 0.0390853 1.06393 0.081631 -0.234173 2.06393 0.136912 3.06393
+0.0550549 0.22483 0.471716 0.0837368 1.05505 -0.005514 -0.0410932 2.05505 0.107778 3.05505
+0.051134 0.106489 0.291035 0.0807418 1.05113 -0.0195142 0.0742528 2.05113 0.0565687 3.05113
+0.0626424 0.355561 0.410787 0.0735179 1.06264 0.0750838 -0.182043 2.06264 0.0997182 3.06264
+0.0677671 0.421511 0.370613 0.0492226 1.06777 0.118102 -0.272288 2.06777 0.111961 3.06777
+0.0673398 0.416411 0.326089 0.0362747 1.06734 0.126683 -0.280136 2.06734 0.111552 3.06734
+0.0672059 0.414799 0.387265 0.0725421 1.06721 0.110583 -0.242257 2.06721 0.0936374 3.06721
+0.0551126 0.22611 0.5 0.0907116 1.05511 -0.011945 -0.0353984 2.05511 0.109288 3.05511
+0.0574485 0.27292 0.422947 0.00224178 1.05745 0.0307232 -0.170678 2.05745 0.174642 3.05745
+0.0511143 0.105561 0.461692 0.292918 1.05111 -0.0626425 0.287357 2.05111 -0.10441 3.05111
+0.0573861 0.271774 0.371372 0.0103906 1.05739 0.043044 -0.161383 2.05739 0.151021 3.05739
+0.0712417 0.460887 0.485142 0.0371171 1.07124 0.109158 -0.32377 2.07124 0.158425 3.07124
+0.0513585 0.116557 0.451437 0.35072 1.05136 -0.0545807 0.334163 2.05136 -0.165289 3.05136
+0.0636703 0.369734 0.473075 0.0213673 1.06367 0.0665982 -0.248367 2.06367 0.170555 3.06367
+0.0502956 0.0543663 0.461034 0.0158897 1.0503 -0.0880753 0.0615234 2.0503 0.17242 3.0503
+0.0711921 0.460349 0.280479 0.199226 1.07119 0.160055 -0.161123 2.07119 -0.0650823 3.07119
+0.0657278 0.396582 0.5 0.0942571 1.06573 0.073291 -0.202325 2.06573 0.105743 3.06573
+0.0634093 0.366187 0.287357 0.0183697 1.06341 0.111254 -0.247817 2.06341 0.117837 3.06341
+0.0903009 0.63483 0.433759 2.04834e-40 1.0903 0.208975 -0.53483 2.0903 0.180128 3.0903
+0.0502544 0.0504348 0.343434 0.0362922 1.05025 -0.0606411 0.0858574 2.05025 0.116738 3.05025
+0.0549061 0.221498 0.400741 0.07864 1.05491 0.0105637 -0.042858 2.05491 0.0915823 3.05491
+0.0644899 0.380656 0.299835 0.00577757 1.06449 0.115369 -0.274878 2.06449 0.134173 3.06449
+0.05 2.14748e-05 0.309243 0.0292802 1.05 -0.0773 0.129259 2.05 0.113493 3.05
+0.0563302 0.251599 0.344707 0.0126864 1.05633 0.0396228 -0.138913 2.05633 0.140726 3.05633
+0.0599658 0.315686 0.432123 0.0490513 1.05997 0.0498123 -0.166635 2.05997 0.130586 3.05997
+0.054 0.2 0.401008 0.459615 1.054 -0.000252 0.359615 2.054 -0.289313 3.054
+0.0609248 0.330527 0.3847 0.0502238 1.06092 0.0690885 -0.180303 2.06092 0.115186 3.06092
+0.0580067 0.282961 0.396536 0.044819 1.05801 0.0423465 -0.138142 2.05801 0.124142 3.05801
+0.0673204 0.416178 0.434065 0.0451318 1.06732 0.0995728 -0.271046 2.06732 0.135088 3.06732
+0.0685073 0.430201 0.35941 0.25 1.06851 0.125248 -0.080201 2.06851 -0.092177 3.06851
+0.0500603 0.0245586 0.471817 0.0660197 1.05006 -0.105675 0.141461 2.05006 0.125525 3.05006
+0.0560905 0.24679 0.342986 3.74836e-51 1.05609 0.0376485 -0.14679 2.05609 0.152896 3.05609
+0.0606231 0.325931 0.396048 0.0386231 1.06062 0.0639535 -0.187308 2.06062 0.130191 3.06062
+0.0690877 0.436895 0.446875 0.0576526 1.06909 0.106729 -0.279242 2.06909 0.12641 3.06909
+0.0756878 0.506832 0.221088 0.0189733 1.07569 0.198144 -0.387859 2.07569 0.0973531 3.07569
+0.0629102 0.359308 0.419072 0.0263595 1.06291 0.074886 -0.232949 2.06291 0.149362 3.06291
+0.0663377 0.404199 0.466797 0.0615903 1.06634 0.0854002 -0.242609 2.06634 0.128449 3.06634
+0.0537084 0.192573 0.421857 0.0913357 1.05371 -0.00917775 -0.0012373 2.05371 0.0852214 3.05371
+0.0598248 0.313446 0.44939 0.0122126 1.05982 0.0443755 -0.201233 2.05982 0.172604 3.05982
+0.0623784 0.351829 0.362859 0.0972806 1.06238 0.0851998 -0.154548 2.06238 0.0615771 3.06238
+0.0598763 0.314265 0.282994 0.0139974 1.05988 0.086384 -0.200268 2.05988 0.120901 3.05988
+0.0656492 0.395591 0.459518 0.0949765 1.06565 0.082916 -0.200615 2.06565 0.0928789 3.06565
+0.0596626 0.310847 0.372942 0.0790787 1.05966 0.062188 -0.131768 2.05966 0.0828039 3.05966
+0.0769185 0.518831 0.335645 0.25 1.07692 0.175504 -0.168831 2.07692 -0.0993065 3.07692
+0.0532752 0.180974 0.107752 0.00171875 1.05328 0.063549 -0.0792552 2.05328 0.0806068 3.05328
+0.061613 0.340779 0.378377 0.0320405 1.06161 0.0757952 -0.208738 2.06161 0.131473 3.06161
+0.0705192 0.452981 0.391057 0.0641586 1.07052 0.128726 -0.288822 2.07052 0.103159 3.07052
+0.0540001 0.200002 0.394743 0.293223 1.054 0.00131525 0.193221 2.054 -0.1248 3.054
+0.0641573 0.376262 0.237662 0.0234744 1.06416 0.128715 -0.252788 2.06416 0.0978242 3.06416
+0.0620409 0.347001 0.430249 0.0251732 1.06204 0.0659383 -0.221828 2.06204 0.153901 3.06204
+0.0732823 0.482518 0.342803 0.0547296 1.07328 0.155558 -0.327788 2.07328 0.0981113 3.07328
+0.099 0.7 2.24972e-18 0.00935297 1.099 0.35 -0.590647 2.099 0.040647 3.099
+0.0579329 0.281655 0.414836 0.0194746 1.05793 0.0371185 -0.16218 2.05793 0.154976 3.05793
+0.0508061 0.0897808 0.382846 0.170951 1.05081 -0.0508211 0.18117 2.05081 -0.0060972 3.05081
+0.056578 0.256475 0.171643 0.00191338 1.05658 0.0853268 -0.154562 2.05658 0.0995795 3.05658
+0.0530313 0.174107 0.208807 0.162481 1.05303 0.0348518 0.088374 2.05303 -0.0498389 3.05303
+0.0556585 0.237876 0.0473583 0.25 1.05566 0.107098 0.112124 2.05566 -0.185793 3.05566
+0.0578318 0.279853 0.342939 0.0638778 1.05783 0.0541918 -0.115975 2.05783 0.0890039 3.05783
+0.0695136 0.441742 0.414669 0.0306708 1.06951 0.117204 -0.311071 2.06951 0.14373 3.06951
+0.0613508 0.33691 0.293436 0.0098145 1.06135 0.095096 -0.227095 2.06135 0.128216 3.06135
+0.0628734 0.358795 0.441883 0.0658379 1.06287 0.0689267 -0.192957 2.06287 0.116727 3.06287
+0.0605862 0.325364 0.41662 0.147127 1.06059 0.058527 -0.078237 2.06059 0.027859 3.06059
+0.064602 0.382126 0.432574 0.0419034 1.0646 0.0829195 -0.240223 2.0646 0.137869 3.0646
+0.0621175 0.348101 0.5 0.035472 1.06212 0.0490505 -0.212629 2.06212 0.164528 3.06212
+0.0562766 0.250531 0.382909 0.11472 1.05628 0.0295383 -0.035811 2.05628 0.0501527 3.05628
+0.099 0.7 0.22237 0.0628327 1.099 0.294407 -0.537167 2.099 0.0538783 3.099
+0.0602143 0.319599 0.394692 0.0328791 1.06021 0.0611265 -0.18672 2.06021 0.135528 3.06021
+0.0552041 0.228125 0.4533 0.107055 1.0552 0.0007375 -0.02107 2.0552 0.078935 3.0552
+0.0633623 0.365545 0.365981 0.0317121 1.06336 0.0912773 -0.233833 2.06336 0.128082 3.06336
+0.0592098 0.303476 0.401992 0.00746163 1.05921 0.05124 -0.196014 2.05921 0.163136 3.05921
+0.0694011 0.440467 0.424774 0.0264424 1.0694 0.11404 -0.314025 2.0694 0.15099 3.0694
+0.0605662 0.325056 0.3017 0.000850057 1.06057 0.087103 -0.224206 2.06057 0.13966 3.06057
+0.0664771 0.40592 0.403719 0.0649524 1.06648 0.10203 -0.240968 2.06648 0.106163 3.06648
+0.0564375 0.253723 0.441204 0.0013081 1.05644 0.0165605 -0.152415 2.05644 0.181053 3.05644
+0.0510897 0.104389 -8.67288e-09 0.0779216 1.05109 0.0521945 0.0735326 2.05109 -0.0279216 3.05109
+0.0670939 0.413448 0.295757 0.0529095 1.06709 0.132785 -0.260539 2.06709 0.0858176 3.06709
+0.0630847 0.361728 0.4241 0.0810255 1.06308 0.074839 -0.180702 2.06308 0.0962045 3.06308
+0.0652923 0.391054 0.266067 0.0274872 1.06529 0.12901 -0.263567 2.06529 0.102333 3.06529
+0.0548914 0.221166 0.500001 0.0045047 1.05489 -0.0144173 -0.116661 2.05489 0.195496 3.05489
+0.0631016 0.361961 0.435967 0.0584038 1.0631 0.0719887 -0.203557 2.0631 0.122386 3.0631
+0.0876293 0.613427 0.450866 0.00272518 1.08763 0.193997 -0.510702 2.08763 0.182535 3.08763
+0.0665123 0.406353 0.0490506 0.0029072 1.06651 0.190914 -0.303446 2.06651 0.061808 3.06651
+0.0560872 0.246722 0.415012 0.0678777 1.05609 0.019608 -0.0788443 2.05609 0.106626 3.05609
+0.0658311 0.397883 0.364327 0.0496821 1.06583 0.10786 -0.248201 2.06583 0.109616 3.06583
+0.0626247 0.355312 0.43921 0.0358853 1.06262 0.0678535 -0.219427 2.06262 0.145878 3.06262
+0.0694357 0.440859 0.346497 0.0119928 1.06944 0.133805 -0.328866 2.06944 0.141956 3.06944
+0.0666191 0.407666 0.361588 0.00405464 1.06662 0.113436 -0.303611 2.06662 0.154422 3.06662
+0.0671182 0.413742 0.448064 0.0307313 1.06712 0.094855 -0.283011 2.06712 0.153688 3.06712
+0.083728 0.580758 0.463079 0.0866643 1.08373 0.174609 -0.394094 2.08373 0.102259 3.08373
+0.0536079 0.189944 0.471871 0.195184 1.05361 -0.0229957 0.10524 2.05361 -0.0036227 3.05361
+0.0709917 0.458168 0.375082 0.00247595 1.07099 0.135314 -0.355692 2.07099 0.160049 3.07099
+0.0548205 0.219557 0.500001 0.0257362 1.05482 -0.0152218 -0.0938208 2.05482 0.174264 3.05482
+0.0538317 0.195747 0.255321 0.0168357 1.05383 0.0340432 -0.0789113 2.05383 0.109761 3.05383
+0.0778024 0.52728 0.5 0.0806732 1.0778 0.13864 -0.346607 2.0778 0.119327 3.0778
+0.0618284 0.343925 0.370985 0.0245661 1.06183 0.0792162 -0.219359 2.06183 0.136729 3.06183
+0.0602979 0.320904 0.357883 0.0700559 1.0603 0.0709813 -0.150848 2.0603 0.087309 3.0603
+0.0651898 0.389741 0.442815 0.0100204 1.06519 0.0841667 -0.279721 2.06519 0.172824 3.06519
+0.0599985 0.316204 0.416439 0.00186591 1.06 0.0539922 -0.214338 2.06 0.173066 3.06
+0.0924007 0.651158 0.169998 0.0482479 1.0924 0.283079 -0.50291 2.0924 0.0527515 3.0924
+0.05 3.66199e-08 0.178309 1.31812e-62 1.05 -0.0445772 0.1 2.05 0.103493 3.05
+0.0598062 0.313149 0.372276 0.0530502 1.05981 0.0635055 -0.160099 2.05981 0.108633 3.05981
+0.066244 0.403039 0.471936 0.044873 1.06624 0.0835355 -0.258166 2.06624 0.146708 3.06624
+0.0858652 0.598876 0.351748 0.14529 1.08587 0.211501 -0.353586 2.08587 0.0102344 3.08587
+0.0629904 0.360422 0.40712 0.0477331 1.06299 0.078431 -0.212689 2.06299 0.124403 3.06299
+0.0546041 0.214572 0.380551 0.0243734 1.0546 0.0121483 -0.0901986 2.0546 0.139792 3.0546
+0.057517 0.274171 0.450099 0.0369474 1.05752 0.0245607 -0.137224 2.05752 0.148082 3.05752
+0.063057 0.361344 0.349456 0.0327494 1.06306 0.093308 -0.228595 2.06306 0.122087 3.06306
+0.0503482 0.0590096 0.480299 0.0102052 1.05035 -0.0905699 0.0511956 2.05035 0.183885 3.05035
+0.0656147 0.395154 0.348705 0.0572573 1.06561 0.110401 -0.237897 2.06561 0.0973542 3.06561
+0.0563356 0.251706 0.312888 0.0586722 1.05634 0.047631 -0.0930338 2.05634 0.0851942 3.05634
+0.0514948 0.12226 0.257911 0.00374384 1.05149 -0.00334775 -0.0185162 2.05149 0.123629 3.05149
+0.0579619 0.282168 0.473052 0.000501477 1.05796 0.022821 -0.181667 2.05796 0.191414 3.05796
+0.0540066 0.200166 0.490973 0.289027 1.05401 -0.0226602 0.188861 2.05401 -0.0917351 3.05401
+0.0849588 0.59126 0.323629 0.0220242 1.08496 0.214723 -0.469236 2.08496 0.125065 3.08496
+0.0556294 0.237263 0.357816 0.150493 1.05563 0.0291775 0.01323 2.05563 0.0068518 3.05563
+0.0763099 0.512932 0.329356 0.0514325 1.07631 0.174127 -0.3615 2.07631 0.0973743 3.07631
+0.0503564 0.0596958 0.464916 0.0756353 1.05036 -0.0863811 0.11594 2.05036 0.113839 3.05036
+0.0626982 0.356346 0.479369 0.0589084 1.0627 0.0583308 -0.197438 2.0627 0.134902 3.0627
+0.052712 0.164682 0.264508 0.22092 1.05271 0.016214 0.156238 2.05271 -0.0915676 3.05271
+0.0559183 0.243276 0.343241 0.0336811 1.05592 0.0358277 -0.109595 2.05592 0.119291 3.05592
+0.0642908 0.378032 0.399297 0.0412157 1.06429 0.0891917 -0.236816 2.06429 0.128573 3.06429
+0.0643631 0.378987 0.446471 0.0658071 1.06436 0.0778758 -0.21318 2.06436 0.118134 3.06436
+0.0559762 0.244462 0.350829 0.0626061 1.05598 0.0345238 -0.0818559 2.05598 0.0926426 3.05598
+0.0630858 0.361743 0.274619 0.0321505 1.06309 0.112217 -0.229592 2.06309 0.100235 3.06309
+0.0620859 0.347648 0.406074 0.0931581 1.06209 0.0723055 -0.15449 2.06209 0.0786641 3.06209
+0.0624985 0.353532 0.281317 0.0755687 1.0625 0.106437 -0.177963 2.0625 0.0588264 3.0625
+0.0576314 0.276249 0.358109 0.0170763 1.05763 0.0485973 -0.159173 2.05763 0.140356 3.05763
+0.0692443 0.438683 0.447052 0.0507603 1.06924 0.107578 -0.287923 2.06924 0.133355 3.06924
+0.0639947 0.374095 0.433684 0.136976 1.06399 0.0786265 -0.137119 2.06399 0.0431292 3.06399
+0.059002 0.300033 0.470678 0.0146939 1.059 0.032347 -0.185339 2.059 0.176509 3.059
+0.0681711 0.426276 0.445822 0.0359175 1.06817 0.101682 -0.290358 2.06817 0.147829 3.06817
+0.0737614 0.487457 0.428951 0.173622 1.07376 0.136491 -0.213835 2.07376 0.0050633 3.07376
+0.0567311 0.259444 0.394499 0.0145818 1.05673 0.0310973 -0.144862 2.05673 0.153768 3.05673
+0.0589266 0.298773 0.425411 0.056049 1.05893 0.0430338 -0.142724 2.05893 0.121574 3.05893
+0.0519843 0.140865 0.450139 0.307517 1.05198 -0.0421023 0.266652 2.05198 -0.122475 3.05198
+0.0537875 0.194614 0.314734 0.0397109 1.05379 0.0186235 -0.0549031 2.05379 0.104709 3.05379
+0.0739232 0.489114 0.465113 0.0864968 1.07392 0.128279 -0.302617 2.07392 0.103037 3.07392
+0.0561893 0.248783 0.400208 0.0532177 1.05619 0.0243395 -0.0955653 2.05619 0.116845 3.05619
+0.0621891 0.34913 0.463834 0.0272246 1.06219 0.0586065 -0.221905 2.06219 0.161926 3.06219
+0.0519085 0.138149 0.499999 0.0689095 1.05191 -0.0559253 0.0307605 2.05191 0.13109 3.05191
+0.0593234 0.305342 0.375661 0.0335465 1.05932 0.0587557 -0.171795 2.05932 0.129152 3.05932
+0.0876983 0.613989 0.307698 0.25 1.0877 0.23007 -0.263989 2.0877 -0.107691 3.0877
+0.0536191 0.19024 0.5 0.0430252 1.05362 -0.02988 -0.0472148 2.05362 0.156975 3.05362
+0.0618039 0.343567 0.473548 0.0446852 1.0618 0.0533965 -0.198882 2.0618 0.147379 3.0618
+0.0691639 0.437766 0.371898 0.0171231 1.06916 0.125908 -0.320643 2.06916 0.144446 3.06916
+0.0527452 0.165686 -2.21269e-06 0.197289 1.05275 0.0828436 0.131603 2.05275 -0.14729 3.05275
+0.0658244 0.397799 0.421996 0.0488989 1.06582 0.0934005 -0.2489 2.06582 0.1277 3.06582
+0.0520541 0.143321 0.28037 0.0164864 1.05205 0.001568 -0.0268346 2.05205 0.117625 3.05205
+0.0649372 0.386486 0.440745 0.056101 1.06494 0.0830567 -0.230385 2.06494 0.126122 3.06494
+0.0694563 0.441093 0.394188 0.0265333 1.06946 0.122 -0.31456 2.06946 0.141723 3.06946
+0.0658716 0.398392 0.312407 0.152425 1.06587 0.121094 -0.145967 2.06587 -0.0087029 3.06587
+0.0908227 0.638926 0.29697 0.0417721 1.09082 0.245221 -0.497154 2.09082 0.0973189 3.09082
+0.05682 0.26115 0.352317 0.0502825 1.05682 0.0424957 -0.110867 2.05682 0.105413 3.05682
+0.0841386 0.584282 0.5 0.0266549 1.08414 0.167141 -0.457627 2.08414 0.173345 3.08414
+0.0584113 0.290022 0.5 0.207226 1.05841 0.020011 0.017204 2.05841 -0.007226 3.05841
+0.066673 0.408326 0.403247 0.0187981 1.06667 0.103351 -0.289528 2.06667 0.152176 3.06667
+0.0631903 0.363184 0.410118 0.0372959 1.06319 0.0790625 -0.225888 2.06319 0.13574 3.06319
+0.0775422 0.524807 0.5 5.10986e-41 1.07754 0.137404 -0.424807 2.07754 0.2 3.07754
+0.0602659 0.320404 0.44136 0.0804723 1.06027 0.049862 -0.139932 2.06027 0.101936 3.06027
+0.0579079 0.28121 0.436488 0.0832564 1.05791 0.031483 -0.0979536 2.05791 0.09769 3.05791
+0.0670325 0.412705 0.348926 0.0338136 1.06703 0.119121 -0.278891 2.06703 0.120864 3.06703
+0.099 0.7 0.430466 0.00515394 1.099 0.242383 -0.594846 2.099 0.173986 3.099
+0.0570602 0.265711 0.469114 2.66998e-50 1.05706 0.015577 -0.165711 2.05706 0.190734 3.05706
+0.0654118 0.392579 0.300354 0.011272 1.06541 0.121201 -0.281307 2.06541 0.128834 3.06541
+0.099 0.7 0.165229 0.0342408 1.099 0.308693 -0.565759 2.099 0.0653279 3.099
+0.099 0.7 0.240287 0.00705816 1.099 0.289928 -0.592942 2.099 0.115028 3.099
+0.05 3.11718e-12 0.345039 0.447212 1.05 -0.0862597 0.547212 2.05 -0.2937 3.05
+0.0500911 0.0301822 0.368147 0.0257296 1.05009 -0.0769457 0.0955474 2.05009 0.134715 3.05009
+0.0625423 0.354151 0.439034 0.0514203 1.06254 0.067317 -0.202731 2.06254 0.13029 3.06254
+0.0604079 0.322612 0.25707 0.0939141 1.06041 0.0970385 -0.128698 2.06041 0.0332069 3.06041
+0.0606595 0.326489 0.396888 0.124154 1.06066 0.0640225 -0.102335 2.06066 0.0449124 3.06066
+0.0606488 0.326325 0.404021 0.0590282 1.06065 0.0621572 -0.167297 2.06065 0.112178 3.06065
+0.0687877 0.433448 0.275554 0.0642531 1.06879 0.147836 -0.269195 2.06879 0.0684131 3.06879
+0.0519607 0.140027 0.499974 0.0111764 1.05196 -0.05498 -0.0288506 2.05196 0.188816 3.05196
+0.0698927 0.446013 0.466859 0.0190029 1.06989 0.106292 -0.32701 2.06989 0.171055 3.06989
+0.068783 0.433394 0.398248 0.0374592 1.06878 0.117135 -0.295935 2.06878 0.132015 3.06878
+0.0750362 0.500361 0.38783 0.0426223 1.07504 0.153223 -0.357739 2.07504 0.123727 3.07504
+0.074235 0.49229 2.73761e-18 6.96936e-48 1.07424 0.246145 -0.39229 2.07423 0.05 3.07423
+0.0523693 0.153925 0.475196 0.430112 1.05237 -0.0418365 0.376187 2.05237 -0.237553 3.05237
+0.0606753 0.326731 0.457652 0.0232221 1.06068 0.0489525 -0.203509 2.06068 0.164073 3.06068
+0.0670529 0.412951 0.415232 0.0353659 1.06705 0.102668 -0.277585 2.06705 0.139204 3.06705
+0.0604073 0.322604 0.5 0.00258474 1.06041 0.036302 -0.220019 2.06041 0.197415 3.06041
+0.055051 0.224744 0.30115 2.50229e-52 1.05505 0.0370845 -0.124744 2.05505 0.140345 3.05505
+0.0729795 0.479369 0.5 0.0306231 1.07298 0.114684 -0.348746 2.07298 0.169377 3.07298
+0.0503094 0.0556211 0.3238 0.104107 1.05031 -0.0531394 0.148486 2.05031 0.043033 3.05031
+0.054 0.2 0.220587 0.443258 1.054 0.0448533 0.343258 2.054 -0.327082 3.054
+0.099 0.7 0.437319 0.0637339 1.099 0.24067 -0.536266 2.099 0.117462 3.099
+0.0722934 0.472159 0.467853 0.147764 1.07229 0.119116 -0.224395 2.07229 0.0425919 3.07229
+0.0537766 0.194334 0.302942 0.0250638 1.05378 0.0214315 -0.0692702 2.05378 0.115819 3.05378
+0.059307 0.305073 0.422574 0.0626034 1.05931 0.046893 -0.14247 2.05931 0.114169 3.05931
+0.0789197 0.53777 0.385555 0.0619034 1.07892 0.172496 -0.375867 2.07892 0.103763 3.07892
+0.0673015 0.41595 0.409747 0.0276477 1.0673 0.105538 -0.288302 2.0673 0.145276 3.0673
+0.0526695 0.163386 0.285883 0.340358 1.05267 0.0102223 0.276972 2.05267 -0.204593 3.05267
+0.066167 0.402082 0.436269 0.0544318 1.06617 0.0919737 -0.24765 2.06617 0.126449 3.06617
+0.0671808 0.414498 0.267481 5.7224e-47 1.06718 0.140379 -0.314498 2.06718 0.130244 3.06718
+0.051239 0.111309 0.5 0.165726 1.05124 -0.0693455 0.154417 2.05124 0.034274 3.05124
+0.0673547 0.416589 0.157776 0.00382685 1.06735 0.16885 -0.312762 2.06735 0.093506 3.06735
+0.0649133 0.386178 0.438911 0.0622637 1.06491 0.0833613 -0.223914 2.06491 0.11941 3.06491
+0.0505618 0.074951 0.348831 0.0169221 1.05056 -0.0497322 0.0419711 2.05056 0.137727 3.05056
+0.0616669 0.341568 0.318352 0.0325723 1.06167 0.091196 -0.208996 2.06167 0.112933 3.06167
+0.0662068 0.402577 0.382448 0.0246647 1.06621 0.105677 -0.277912 2.06621 0.14007 3.06621
+0.0754829 0.504806 0.171386 0.0211427 1.07548 0.209556 -0.383663 2.07548 0.0802731 3.07548
+0.0634036 0.36611 0.339235 0.0793903 1.0634 0.0982462 -0.18672 2.0634 0.0723802 3.0634
+0.0584237 0.290236 0.449594 0.00172792 1.05842 0.0327195 -0.188508 2.05842 0.18315 3.05842
+0.0700486 0.447756 0.5 0.0117885 1.07005 0.098878 -0.335967 2.07005 0.188211 3.07005
+0.0813478 0.559891 0.157174 0.0193777 1.08135 0.240652 -0.440513 2.08135 0.0777745 3.08135
+0.0612282 0.335085 0.373213 0.0143721 1.06123 0.0742393 -0.220713 2.06123 0.147592 3.06123
+0.063522 0.367723 0.164601 8.0725e-49 1.06352 0.142711 -0.267723 2.06352 0.0993803 3.06352
+0.069844 0.445466 0.377297 0.0866199 1.06984 0.128409 -0.258846 2.06984 0.0765692 3.06984
+0.0537653 0.194045 0.168352 0.0236923 1.05377 0.0549345 -0.0703527 2.05377 0.0768133 3.05377
+0.0631754 0.362979 0.32811 0.0281468 1.06318 0.099462 -0.234832 2.06318 0.120286 3.06318
+0.0723986 0.473272 0.477804 0.0179554 1.0724 0.117185 -0.355317 2.0724 0.175386 3.0724
+0.0756031 0.505995 0.174547 0.0742557 1.0756 0.209361 -0.331739 2.0756 0.0281084 3.0756
+0.0536362 0.190689 0.412606 0.0116661 1.05364 -0.007807 -0.0790229 2.05364 0.162116 3.05364
+0.0531871 0.178525 0.500001 0.0916005 1.05319 -0.0357378 0.0130755 2.05319 0.1084 3.05319
+0.053045 0.174498 0.438216 0.241132 1.05305 -0.022305 0.166634 2.05305 -0.0596672 3.05305
+0.0583121 0.288308 0.309964 0.0134511 1.05831 0.066663 -0.174857 2.05831 0.129538 3.05831
+0.0710014 0.458273 0.325649 0.0288126 1.071 0.147724 -0.32946 2.071 0.118882 3.071
+0.0734933 0.484699 0.307481 0.0549534 1.07349 0.165479 -0.329746 2.07349 0.0872909 3.07349
+0.065277 0.390858 0.40202 0.0432677 1.06528 0.094924 -0.24759 2.06528 0.127338 3.06528
+0.0582791 0.287734 0.5 0.0114933 1.05828 0.018867 -0.176241 2.05828 0.188507 3.05828
+0.0646144 0.382288 0.328035 0.0152289 1.06461 0.109135 -0.267059 2.06461 0.133182 3.06461
+0.0680019 0.424287 0.24181 0.0651628 1.068 0.151691 -0.259124 2.068 0.0573802 3.068
+0.0592285 0.303784 0.286081 0.147147 1.05923 0.0803718 -0.056637 2.05923 -0.0113227 3.05923
+0.0864179 0.603473 0.443026 0.0140613 1.08642 0.19098 -0.489412 2.08642 0.168847 3.08642
+0.0635721 0.368403 0.449329 0.071996 1.06357 0.0718692 -0.196407 2.06357 0.112803 3.06357
+0.0585174 0.291845 0.47097 0.089984 1.05852 0.02818 -0.101861 2.05852 0.101307 3.05852
+0.0602255 0.319774 0.5 0.0298248 1.06023 0.034887 -0.189949 2.06023 0.170175 3.06023
+0.0624875 0.353376 0.42197 0.0598388 1.06249 0.0711955 -0.193537 2.06249 0.116752 3.06249
+0.0623554 0.351502 0.380973 0.0486011 1.06236 0.0805077 -0.202901 2.06236 0.115691 3.06236
+0.0589722 0.299537 0.471892 0.00303794 1.05897 0.0317955 -0.196499 2.05897 0.18853 3.05897
+0.0559743 0.244424 0.418365 0.00371138 1.05597 0.0176208 -0.140713 2.05597 0.171798 3.05597
+0.0651543 0.389286 0.443971 0.0415332 1.06515 0.0836503 -0.247753 2.06515 0.141658 3.06515
+0.0801837 0.549397 0.418361 0.0508157 1.08018 0.170108 -0.398581 2.08018 0.124693 3.08018
+0.0736465 0.486277 0.414709 0.00579842 1.07365 0.139461 -0.380479 2.07365 0.168614 3.07365
+0.0726034 0.47543 0.229255 0.0838257 1.0726 0.180401 -0.291604 2.0726 0.0349508 3.0726
+0.0701855 0.449282 0.333631 0.0607419 1.07019 0.141233 -0.28854 2.07019 0.0893474 3.07019
+0.06102 0.331963 0.459675 0.00201167 1.06102 0.0510628 -0.229951 2.06102 0.185891 3.06102
+0.056683 0.258515 0.376035 0.0991032 1.05668 0.0352487 -0.0594118 2.05668 0.0637073 3.05668
+0.0622488 0.349983 0.467229 0.0202782 1.06225 0.0581842 -0.229705 2.06225 0.16989 3.06225
+0.05 2.3695e-13 0.217439 0.663691 1.05 -0.0543597 0.763691 2.05 -0.548459 3.05
+0.0554315 0.233055 0.5 0.25 1.05543 -0.0084725 0.116945 2.05543 -0.05 3.05543
+0.0651406 0.38911 0.396817 0.0471722 1.06514 0.0953508 -0.241938 2.06514 0.121873 3.06514
+0.0578671 0.280483 0.476536 0.0419235 1.05787 0.0211075 -0.138559 2.05787 0.151037 3.05787
+0.0571287 0.266997 0.232364 0.00141526 1.05713 0.0754075 -0.165582 2.05713 0.118294 3.05713
+0.0643739 0.379129 0.4855 0.0455119 1.06437 0.0681895 -0.233617 2.06437 0.150138 3.06437
+0.0694822 0.441386 0.5 0.0316414 1.06948 0.095693 -0.309745 2.06948 0.168359 3.06948
+0.0623318 0.351167 0.320768 0.0138978 1.06233 0.0953915 -0.237269 2.06233 0.132333 3.06233
+0.0541375 0.203408 -1.80501e-09 0.0551572 1.05414 0.101704 -0.0482508 2.05414 -0.0051572 3.05414
+0.05 0 0 0.886393 1.05 0 0.986393 2.05 -0.836393 3.05
+0.0584325 0.290387 0.36958 0.00136455 1.05843 0.0527985 -0.189022 2.05843 0.159509 3.05843
+0.0556667 0.238048 0.403686 0.133898 1.05567 0.0181025 -0.00415 2.05567 0.0372078 3.05567
+0.0576141 0.275937 0.451392 0.0207596 1.05761 0.0251205 -0.155177 2.05761 0.164658 3.05761
+0.0724553 0.47387 0.472442 0.0759125 1.07246 0.118825 -0.297957 2.07246 0.11582 3.07246
+0.0601511 0.318608 0.476396 0.0823638 1.06015 0.040205 -0.136244 2.06015 0.110555 3.06015
+0.0676921 0.420619 0.369448 0.0693395 1.06769 0.117948 -0.251279 2.06769 0.0914949 3.06769
+0.0535065 0.187256 0.277624 0.00291275 1.05351 0.024222 -0.0843432 2.05351 0.130374 3.05351
+0.0504145 0.0643813 0.124823 0.0187251 1.05041 0.0009849 0.0543438 2.05041 0.0687218 3.05041
+0.0585643 0.292649 1.30457e-08 0.11338 1.05856 0.146324 -0.079269 2.05856 -0.06338 3.05856
+0.0714448 0.463085 0.325904 0.0400064 1.07144 0.150066 -0.323079 2.07144 0.107765 3.07144
+0.0756703 0.506659 0.5 0.045475 1.07567 0.128329 -0.361184 2.07567 0.154525 3.07567
+0.0750721 0.50072 0.34733 0.0919657 1.07507 0.163528 -0.308754 2.07507 0.0622333 3.07507
+0.0523755 0.154127 0.414051 0.1944 1.05238 -0.0264493 0.140273 2.05238 -0.0201847 3.05238
+0.068217 0.426814 0.415931 0.0423092 1.06822 0.109424 -0.284505 2.06822 0.13247 3.06822
+0.053793 0.194755 0.5 0.124325 1.05379 -0.0276225 0.02957 2.05379 0.075675 3.05379
+0.0537685 0.194126 0.297605 0.0760926 1.05377 0.0226617 -0.0180334 2.05377 0.0631889 3.05377
+0.0723566 0.472828 0.399257 0.0627643 1.07236 0.1366 -0.310064 2.07236 0.107013 3.07236
+0.0634191 0.366321 0.429266 0.0488104 1.06342 0.075844 -0.217511 2.06342 0.129969 3.06342
+0.0670453 0.41286 0.5 0.0420403 1.06705 0.08143 -0.27082 2.06705 0.15796 3.06705
+0.0624103 0.352282 0.280648 0.0930685 1.06241 0.105979 -0.159213 2.06241 0.0411259 3.06241
+0.0679609 0.423803 0.338762 0.0251873 1.06796 0.127211 -0.298616 2.06796 0.126441 3.06796
+0.0639548 0.373561 0.384217 0.0239273 1.06395 0.0907262 -0.249634 2.06395 0.141338 3.06395
+0.0683835 0.42876 0.428917 0.0102901 1.06838 0.107151 -0.31847 2.06838 0.168385 3.06838
+0.0572974 0.270138 0.466162 0.25 1.0573 0.0185285 0.079862 2.0573 -0.0601514 3.0573
+0.0536378 0.190731 0.0552999 0.0378286 1.05364 0.0815405 -0.0529024 2.05364 0.0287614 3.05364
+0.0707341 0.455347 0.5 0.0696597 1.07073 0.102674 -0.285687 2.07073 0.13034 3.07073
+0.05 1.11203e-10 0.383619 0.314696 1.05 -0.0959047 0.414696 2.05 -0.14961 3.05
+0.0560888 0.246755 0.423974 0.0521735 1.05609 0.017384 -0.0945815 2.05609 0.125019 3.05609
+0.0684457 0.429484 0.413863 0.0377482 1.06845 0.111276 -0.291736 2.06845 0.136411 3.06845
+0.0506521 0.0807527 0.361978 0.472757 1.05065 -0.0501182 0.492004 2.05065 -0.314164 3.05065
+0.0594886 0.308036 0.353226 0.0405017 1.05949 0.0657115 -0.167534 2.05949 0.115466 3.05949
+0.0553041 0.230306 0.313007 0.000839935 1.0553 0.0369013 -0.129466 2.0553 0.143062 3.0553
+0.0540027 0.200066 0.46824 0.281905 1.054 -0.017027 0.181839 2.054 -0.091433 3.054
+0.0760073 0.509973 0.413897 0.0236655 1.07601 0.151512 -0.386308 2.07601 0.150504 3.07601
+0.054 0.2 0.356868 0.407604 1.054 0.010783 0.307604 2.054 -0.250544 3.054
+0.0519348 0.139097 0.425817 0.0383246 1.05193 -0.0369058 -0.0007724 2.05193 0.139421 3.05193
+0.0520979 0.144841 0.328145 0.104768 1.0521 -0.00961575 0.059927 2.0521 0.0436755 3.0521
+0.0867874 0.606526 0.326647 0.0588478 1.08679 0.221601 -0.447678 2.08679 0.0891463 3.08679
+0.056569 0.256301 0.5 0.0695147 1.05657 0.0031505 -0.0867863 2.05657 0.130485 3.05657
+0.053823 0.195526 -4.00758e-05 0.260611 1.05382 0.097773 0.165085 2.05382 -0.210623 3.05382
+0.0523287 0.1526 6.24848e-11 0.0184432 1.05233 0.0763 -0.0341568 2.05233 0.0315568 3.05233
+0.050886 0.0941275 0.0906034 0.608781 1.05089 0.0244129 0.614653 2.05089 -0.5316 3.05089
+0.099 0.7 0.5 0.0442979 1.099 0.225 -0.555702 2.099 0.155702 3.099
+0.0798118 0.546002 0.369425 0.00508019 1.07981 0.180645 -0.440922 2.07981 0.155747 3.07981
+0.0566972 0.25879 0.323451 0.0203366 1.0567 0.0485323 -0.138453 2.0567 0.126699 3.0567
+0.0517119 0.130841 0.499989 0.0383473 1.05171 -0.0595767 0.0075063 2.05171 0.161649 3.05171
+0.059 0.3 0.44561 0.25 1.059 0.0385975 0.05 2.059 -0.066317 3.059
+0.0507043 0.0839222 0.499981 0.0519114 1.0507 -0.0830342 0.0679892 2.0507 0.148083 3.0507
+0.0575671 0.275084 0.0855061 1.82951e-52 1.05757 0.116165 -0.175084 2.05757 0.0756518 3.05757
+0.062333 0.351184 0.382448 0.0703311 1.06233 0.07998 -0.180853 2.06233 0.0944033 3.06233
+0.0681093 0.42555 0.101647 2.93657e-49 1.06811 0.187363 -0.32555 2.06811 0.0804941 3.06811
+0.0579807 0.282501 0.41786 0.0353645 1.05798 0.0367855 -0.147137 2.05798 0.139993 3.05798
+0.05 0 0.5 0 1.05 -0.125 0.1 2.05 0.2 3.05
+0.0696821 0.443645 0.218098 0.00151052 1.06968 0.167298 -0.342134 2.06968 0.113919 3.06968
+0.0566586 0.258042 0.368364 0.0382755 1.05666 0.03693 -0.119766 2.05666 0.122234 3.05666
+0.0634499 0.366741 0.391771 0.0965617 1.06345 0.0854277 -0.170179 2.06345 0.0709696 3.06345
+0.0663124 0.403886 0.422775 0.0405275 1.06631 0.0962493 -0.263359 2.06631 0.136305 3.06631
+0.0539231 0.198067 0.499479 0.253871 1.05392 -0.0258363 0.155804 2.05392 -0.0540273 3.05392
+0.0670904 0.413406 0.395619 0.000742573 1.06709 0.107798 -0.312663 2.06709 0.167943 3.06709
+0.057377 0.271607 0.5 0.050502 1.05738 0.0108035 -0.121105 2.05738 0.149498 3.05738
+0.0587606 0.295983 0.269575 0.0460699 1.05876 0.0805977 -0.149913 2.05876 0.0848026 3.05876
+0.0564631 0.254226 0.431909 4.63433e-50 1.05646 0.0191358 -0.154226 2.05646 0.179573 3.05646
+0.0564061 0.253103 0.500001 0.00765161 1.05641 0.00155125 -0.145451 2.05641 0.192349 3.05641
+0.0600332 0.316753 0.439289 6.14789e-48 1.06003 0.0485543 -0.216753 2.06003 0.181787 3.06003
+0.054 0.2 0.457954 0.415906 1.054 -0.0144885 0.315906 2.054 -0.22852 3.054
+0.0518294 0.135255 0.364634 0.292855 1.05183 -0.023531 0.2576 2.05183 -0.133465 3.05183
+0.0792009 0.540379 0.397362 0.020788 1.0792 0.170849 -0.419591 2.0792 0.148421 3.0792
+0.0525944 0.161072 0.249534 5.09567e-53 1.05259 0.0181525 -0.061072 2.05259 0.12486 3.05259
+0.0648626 0.385521 0.465015 3.97292e-46 1.06486 0.0765067 -0.285521 2.06486 0.189505 3.06486
+0.05 8.38977e-05 0.368726 0.0240113 1.05 -0.0921396 0.123927 2.05 0.136607 3.05
+0.0717496 0.466365 0.467038 0.0977229 1.07175 0.116423 -0.268642 2.07175 0.0923885 3.07175
+0.053092 0.175842 0.383938 0.00123525 1.05309 -0.0080635 -0.0746067 2.05309 0.163946 3.05309
+0.0605546 0.324879 0.468337 4.09855e-48 1.06055 0.0453552 -0.224879 2.06055 0.190501 3.06055
+0.0653421 0.39169 0.354897 0.0426868 1.06534 0.107121 -0.249003 2.06534 0.113782 3.06534
+0.0782385 0.531399 0.467959 0.0163746 1.07824 0.14871 -0.415024 2.07824 0.174013 3.07824
+0.0617694 0.343066 0.442396 0.0891152 1.06177 0.060934 -0.153951 2.06177 0.0936036 3.06177
+0.0585403 0.292237 0.425077 0.00121926 1.05854 0.0398493 -0.191018 2.05854 0.176304 3.05854
+0.0587836 0.296372 0.307156 0.0054399 1.05878 0.071397 -0.190932 2.05878 0.136707 3.05878
+0.0801702 0.549274 0.392439 0.0296893 1.08017 0.176527 -0.419585 2.08017 0.138042 3.08017
+0.0723412 0.472665 0.377637 0.0752273 1.07234 0.141923 -0.297438 2.07234 0.0880638 3.07234
+0.0772943 0.522439 0.379594 0.0802935 1.07729 0.166321 -0.342145 2.07729 0.0835847 3.07729
+0.0561114 0.247213 0.385184 1.48829e-50 1.05611 0.0273105 -0.147213 2.05611 0.165555 3.05611
+0.0597469 0.3122 0.413849 0.0156328 1.05975 0.0526377 -0.196567 2.05975 0.158522 3.05975
+0.0656722 0.395881 0.359834 0.0351491 1.06567 0.107982 -0.260732 2.06567 0.122801 3.06567
+0.0626156 0.355185 0.5 0.0257014 1.06262 0.0525925 -0.229484 2.06262 0.174299 3.06262
+0.0531681 0.177992 0.454243 0.00619387 1.05317 -0.0245647 -0.0717981 2.05317 0.180079 3.05317
+0.0702111 0.449567 0.374486 0.0463961 1.07021 0.131162 -0.303171 2.07021 0.11595 3.07021
+0.075129 0.501289 0.456343 0.0215697 1.07513 0.136559 -0.379719 2.07513 0.165333 3.07513
+0.0600849 0.317568 0.48597 0.0698604 1.06008 0.0372915 -0.147708 2.06008 0.125931 3.06008
+0.0540001 0.200002 0.29539 0.3025 1.054 0.0261535 0.202498 2.054 -0.163883 3.054
+0.0526327 0.162255 0.326297 6.01579e-54 1.05263 -0.00044675 -0.062255 2.05263 0.147889 3.05263
+0.0796879 0.544866 0.408074 0.0743844 1.07969 0.170414 -0.370482 2.07969 0.0980378 3.07969
+0.0665076 0.406296 0.378225 0.0356484 1.06651 0.108592 -0.270648 2.06651 0.127819 3.06651
+0.0652405 0.390391 0.404993 0.0504489 1.06524 0.0939472 -0.239942 2.06524 0.121049 3.06524
+0.05 -8.17384e-06 0.372436 0.00204984 1.05 -0.0931131 0.102058 2.05 0.159681 3.05
+0.0644635 0.380309 0.409591 0.0924093 1.06446 0.0877568 -0.1879 2.06446 0.080468 3.06446
+0.0645229 0.381089 0.482137 0.0693912 1.06452 0.0700103 -0.211698 2.06452 0.12525 3.06452
+0.05 -0.000432752 0.431169 0.00912696 1.05 -0.108009 0.10956 2.05 0.170224 3.05
+0.0554517 0.233488 0.500001 0.0526435 1.05545 -0.00825625 -0.0808445 2.05545 0.147357 3.05545
+0.0661011 0.401262 0.410345 0.0500533 1.0661 0.0980447 -0.251209 2.0661 0.12305 3.0661
+0.0573683 0.271445 0.5 0.160706 1.05737 0.0107225 -0.010739 2.05737 0.039294 3.05737
+0.0543815 0.20932 0.390172 0.160574 1.05438 0.007117 0.051254 2.05438 0.0064776 3.05438
+0.0672001 0.41473 0.372111 0.000927201 1.0672 0.114337 -0.313803 2.0672 0.160706 3.0672
+0.0665951 0.40737 0.423702 0.0447484 1.0666 0.0977595 -0.262622 2.0666 0.132362 3.0666
+0.0669104 0.411222 0.390318 0.0644165 1.06691 0.108031 -0.246805 2.06691 0.102679 3.06691
+0.0580724 0.28412 0.457569 0.0498906 1.05807 0.0276677 -0.134229 2.05807 0.13738 3.05807
+0.0507418 0.0861272 0.468756 0.457702 1.05074 -0.0741254 0.471575 2.05074 -0.267075 3.05074
+0.0512788 0.113083 0.359823 2.18807e-57 1.05128 -0.0334142 -0.013083 2.05128 0.157947 3.05128
+0.0656515 0.39562 0.423489 0.0445694 1.06565 0.0919378 -0.251051 2.06565 0.132477 3.06565
+0.0636489 0.369444 0.401852 0.0266215 1.06365 0.084259 -0.242822 2.06365 0.143934 3.06365
+0.065874 0.398422 0.344988 0.0236222 1.06587 0.112964 -0.2748 2.06587 0.129874 3.06587
+0.0669458 0.411653 0.460546 0.0139412 1.06695 0.09069 -0.297712 2.06695 0.174223 3.06695
+0.0812582 0.559091 0.351345 0.040111 1.08126 0.191709 -0.41898 2.08126 0.115293 3.08126
+0.059812 0.313241 0.37898 0.00698326 1.05981 0.0618755 -0.206258 2.05981 0.156711 3.05981
+0.059159 0.302639 0.337927 0.0130127 1.05916 0.0668378 -0.189626 2.05916 0.138365 3.05916
+0.0652542 0.390566 0.402907 0.0619739 1.06525 0.0945563 -0.228592 2.06525 0.108898 3.06525
+0.0502961 0.0544124 0.18644 0.52304 1.0503 -0.0194038 0.568628 2.0503 -0.417108 3.0503
+0.0661548 0.40193 0.415167 0.0375323 1.06615 0.0971733 -0.264398 2.06615 0.137018 3.06615
+0.099 0.7 0.135015 0.0129808 1.099 0.316246 -0.587019 2.099 0.0775237 3.099
+0.0660616 0.400769 0.167695 0.0140923 1.06606 0.158461 -0.286677 2.06606 0.0862162 3.06606
+0.0667753 0.409576 0.442962 0.0515473 1.06678 0.0940475 -0.258029 2.06678 0.131341 3.06678
+0.066754 0.409316 0.335277 0.0010972 1.06675 0.120839 -0.308219 2.06675 0.149486 3.06675
+0.0643808 0.379221 0.380892 0.0833864 1.06438 0.0943875 -0.195835 2.06438 0.0808812 3.06438
+0.0723065 0.472298 0.336973 0.00856159 1.07231 0.151906 -0.363736 2.07231 0.14253 3.07231
+0.0732038 0.481703 0.338897 0.204355 1.0732 0.156127 -0.177348 2.0732 -0.0526859 3.0732
+0.0630238 0.360885 0.41424 0.0644604 1.06302 0.0768825 -0.196425 2.06302 0.109812 3.06302
+0.0500808 0.0284188 0.447654 0.0109312 1.05008 -0.0977041 0.0825124 2.05008 0.173365 3.05008
+0.0744759 0.494731 0.313274 0.0928201 1.07448 0.169047 -0.301911 2.07448 0.0511621 3.07448
+0.052702 0.164377 0.209267 0.06303 1.0527 0.0298717 -0.001347 2.0527 0.0497501 3.0527
+0.0613375 0.336713 0.252019 0.0581091 1.06134 0.105352 -0.178604 2.06134 0.0674966 3.06134
+0.0693046 0.43937 0.450268 0.011781 1.0693 0.107118 -0.327589 2.0693 0.173299 3.0693
+0.0600369 0.316811 0.475339 0.000465546 1.06004 0.0395708 -0.216345 2.06004 0.192136 3.06004
+0.0503445 0.0586901 0.5 0.429091 1.05034 -0.095655 0.470401 2.05034 -0.229091 3.05034
+0.0623673 0.351672 0.247772 0.00663944 1.06237 0.113893 -0.245033 2.06237 0.117692 3.06237
+0.05904 0.300665 0.477473 0.0675298 1.05904 0.0309643 -0.133135 2.05904 0.125712 3.05904
+0.054 0.2 0 0.298675 1.054 0.1 0.198675 2.054 -0.248675 3.054
+0.0647786 0.38443 0.367502 2.5333e-46 1.06478 0.100339 -0.28443 2.06478 0.160251 3.06478
+0.0910345 0.640582 0.434903 0.204431 1.09103 0.211565 -0.336151 2.09103 -0.0239601 3.09103
+0.0584015 0.289853 0.437808 4.30401e-51 1.0584 0.0354745 -0.189853 2.0584 0.181342 3.0584
+0.0567527 0.259859 0.431011 0.0785271 1.05675 0.0221768 -0.0813319 2.05675 0.100776 3.05675
+0.0605341 0.324563 0.29717 0.047466 1.06053 0.087989 -0.177097 2.06053 0.091685 3.06053
+0.0694356 0.440858 0.407377 0.0646842 1.06944 0.118585 -0.276174 2.06944 0.107529 3.06944
+0.0774025 0.523474 0.469874 0.055811 1.0774 0.144268 -0.367663 2.0774 0.135151 3.0774
+0.0688252 0.43388 0.160705 0.105474 1.06883 0.176764 -0.228406 2.06883 -0.0072625 3.06883
+0.065363 0.391957 0.0642748 0.0233131 1.06536 0.17991 -0.268644 2.06536 0.0459693 3.06536
+0.0679045 0.423137 0.402068 0.0575089 1.0679 0.111051 -0.265628 2.0679 0.113111 3.0679
+0.0550639 0.225032 0.396103 0.0130689 1.05506 0.0134903 -0.111963 2.05506 0.155762 3.05506
+0.0651633 0.389401 0.407778 0.0835624 1.06516 0.092756 -0.205839 2.06516 0.088771 3.06516
+0.0617641 0.342989 0.373379 0.0431497 1.06176 0.0781497 -0.199839 2.06176 0.118864 3.06176
+0.0608466 0.329342 0.402775 0.0542275 1.06085 0.0639773 -0.175115 2.06085 0.116605 3.06085
+0.0534407 0.185492 0.483276 0.282687 1.05344 -0.028073 0.197195 2.05344 -0.0877042 3.05344
+0.0508041 0.089674 0.290976 0.0404526 1.0508 -0.027907 0.0507786 2.0508 0.0968402 3.0508
+0.0623205 0.351006 0.370658 0.0186907 1.06232 0.0828385 -0.232315 2.06232 0.142507 3.06232
+0.064652 0.38278 0.366528 0.0303176 1.06465 0.099758 -0.252462 2.06465 0.129641 3.06465
+0.0527869 0.166939 0.36684 0.00583153 1.05279 -0.0082405 -0.0611075 2.05279 0.15422 3.05279
+0.0587013 0.29498 0.447342 0.00731791 1.0587 0.0356545 -0.187662 2.0587 0.176885 3.0587
+0.065555 0.394398 0.420693 0.0281622 1.06556 0.0920258 -0.266236 2.06555 0.148046 3.06555
+0.0719437 0.468441 0.5 0.117237 1.07194 0.10922 -0.251204 2.07194 0.082763 3.07194
+0.0645368 0.381272 0.449022 0.030084 1.06454 0.0783805 -0.251188 2.06454 0.154623 3.06454
+0.099 0.7 0.303001 1.32307e-44 1.099 0.27425 -0.6 2.099 0.1409 3.099
+0.0672645 0.415506 0.5 0.0743267 1.06726 0.082753 -0.241179 2.06726 0.125673 3.06726
+0.0585651 0.292662 0.344454 0.00933169 1.05857 0.0602175 -0.18333 2.05857 0.144005 3.05857
+0.0626861 0.356175 0.403711 0.0266528 1.06269 0.0771598 -0.229522 2.06269 0.14446 3.06269
+0.0639822 0.373928 0.453507 0.183528 1.06398 0.0735872 -0.0904 2.06398 0.0025241 3.06398
+0.0640155 0.374372 0.377074 0.0291395 1.06402 0.0929175 -0.245232 2.06402 0.133983 3.06402
+0.0543616 0.208845 0.410423 1.70215e-53 1.05436 0.00181675 -0.108845 2.05436 0.173127 3.05436
+0.0603097 0.321087 0.207365 0.00105956 1.06031 0.108702 -0.220027 2.06031 0.11115 3.06031
+0.0525762 0.160507 0.31457 0.0712199 1.05258 0.001611 0.0107129 2.05258 0.0731511 3.05258
+0.0739082 0.48896 0.36709 0.0627033 1.07391 0.152707 -0.326257 2.07391 0.0974237 3.07391
+0.0517337 0.13167 0.176379 0.454373 1.05173 0.0217403 0.422703 2.05173 -0.351459 3.05173
+0.0712753 0.461251 0.472714 0.0499743 1.07128 0.112447 -0.311277 2.07128 0.14184 3.07128
+0.0795644 0.543731 0.263423 0.00939392 1.07956 0.20601 -0.434337 2.07956 0.119633 3.07956
+0.0690208 0.436129 0.430752 0.0489082 1.06902 0.110376 -0.287221 2.06902 0.130317 3.06902
+0.0856847 0.597367 0.467882 0.043328 1.08568 0.181713 -0.454039 2.08568 0.147037 3.08568
+0.0637772 0.371176 0.352781 0.0276246 1.06378 0.0973928 -0.243551 2.06378 0.12821 3.06378
+0.0647437 0.383975 0.214345 0.00245743 1.06474 0.138401 -0.281518 2.06474 0.111846 3.06474
+0.0628926 0.359063 0.333271 0.0382559 1.06289 0.0962138 -0.220807 2.06289 0.111725 3.06289
+0.0704635 0.452366 0.212012 0.01923 1.07046 0.17318 -0.333136 2.07046 0.0943736 3.07046
+0.0523684 0.153897 0.219198 0.0267074 1.05237 0.022149 -0.0271896 2.05237 0.089052 3.05237
+0.067805 0.42196 0.440148 0.0506766 1.0678 0.100943 -0.271283 2.0678 0.131368 3.0678
+0.0659731 0.399664 0.325554 0.0475877 1.06597 0.118444 -0.252076 2.06597 0.100079 3.06597
+0.0680742 0.425137 0.403876 0.0217865 1.06807 0.111599 -0.30335 2.06807 0.149376 3.06807
+0.0924644 0.651647 0.5 0.00242197 1.09246 0.200823 -0.549225 2.09246 0.197578 3.09246
+0.0517445 0.132081 0.326228 0.383781 1.05174 -0.0155165 0.3517 2.05174 -0.235913 3.05174
+0.0543769 0.209211 0.403642 0.0555019 1.05438 0.003695 -0.0537091 2.05438 0.115591 3.05438
+0.056624 0.257371 0.500001 0.0267601 1.05662 0.00368525 -0.130611 2.05662 0.17324 3.05662
+0.0554178 0.232761 0.478113 0.223857 1.05542 -0.00314775 0.091096 2.05542 -0.0304231 3.05542
+0.0510203 0.101008 0.357298 0.22764 1.05102 -0.0388205 0.226632 2.05102 -0.0704506 3.05102
+0.0761745 0.51161 0.352822 0.068763 1.07617 0.1676 -0.342847 2.07617 0.0870836 3.07617
+0.0606567 0.326446 0.351293 0.0429144 1.06066 0.0753998 -0.183532 2.06066 0.112474 3.06066
+0.0720232 0.469289 0.396183 0.0111814 1.07202 0.135599 -0.358108 2.07202 0.157674 3.07202
+0.0504398 0.0663197 0.416116 0.0344741 1.05044 -0.0708691 0.0681544 2.05044 0.140361 3.05044
+0.076528 0.515053 0.5 0.110656 1.07653 0.132526 -0.304397 2.07653 0.089344 3.07653
+0.0540037 0.200093 0.0296283 0.296979 1.054 0.0926394 0.196886 2.054 -0.238091 3.054
+0.0622476 0.349966 0.385604 0.102724 1.06225 0.078582 -0.147242 2.06225 0.0629572 3.06225
+0.0805365 0.552599 0.341585 0.0570174 1.08054 0.190903 -0.395582 2.08054 0.0954581 3.08054
+0.0525927 0.161017 0.390334 1.11299e-53 1.05259 -0.017075 -0.061017 2.05259 0.1671 3.05259
+0.0548397 0.219994 0.469217 0.126287 1.05484 -0.00730725 0.006293 2.05484 0.0644781 3.05484
+0.0651231 0.388884 0.392061 0.139469 1.06512 0.0964268 -0.149415 2.06512 0.0281493 3.06512
+0.0588947 0.29824 0.335616 0.000646105 1.05889 0.065216 -0.197594 2.05889 0.150039 3.05889
+0.0648975 0.385973 0.453199 0.0689041 1.0649 0.0796868 -0.217069 2.0649 0.117056 3.0649
+0.0722383 0.471575 0.244393 2.01588e-47 1.07224 0.174689 -0.371575 2.07224 0.123318 3.07224
+0.0504497 0.0670597 0.04907 0.132064 1.05045 0.0212623 0.165004 2.05045 -0.067343 3.05045
+0.0865332 0.604427 0.452358 0.0271499 1.08653 0.189124 -0.477277 2.08653 0.158557 3.08653
+0.0685276 0.430437 0.405399 0.0475718 1.06853 0.113869 -0.282865 2.06853 0.124048 3.06853
+0.0673152 0.416116 0.420404 0.0752646 1.06732 0.102957 -0.240851 2.06732 0.100857 3.06732
+0.0592263 0.303749 0.169483 0.0201734 1.05923 0.109504 -0.183576 2.05923 0.0806715 3.05923
+0.0561393 0.247777 0.42602 0.11263 1.05614 0.0173835 -0.035147 2.05614 0.065176 3.05614
+0.0641812 0.37658 0.421514 0.0511265 1.06418 0.0829115 -0.225454 2.06418 0.125328 3.06418
+0.0906898 0.637886 0.348703 0.195065 1.09069 0.231767 -0.342821 2.09069 -0.0404541 3.09069
+0.0552924 0.230052 0.232188 5.77102e-53 1.05529 0.056979 -0.130052 2.05529 0.119656 3.05529
+0.0592162 0.303582 0.260305 0.00245237 1.05922 0.0867148 -0.20113 2.05922 0.125639 3.05922
+0.0650017 0.38732 0.452881 0.0796307 1.065 0.0804398 -0.207689 2.065 0.106234 3.065
+0.062033 0.346887 0.419368 0.0290428 1.06203 0.0686015 -0.217844 2.06203 0.146768 3.06203
+0.0556813 0.238355 0.241219 0.00686625 1.05568 0.0588728 -0.131489 2.05568 0.115499 3.05568
+0.0501551 0.0393888 0.499989 0.0433751 1.05016 -0.105303 0.103986 2.05016 0.156622 3.05016
+0.0517963 0.134027 0.396585 0.45701 1.0518 -0.0321328 0.422983 2.0518 -0.288035 3.0518
+0.0649154 0.386204 0.378685 0.0579771 1.06492 0.0984307 -0.228227 2.06492 0.105628 3.06492
+0.0637053 0.370207 0.402976 0.0829862 1.06371 0.0843595 -0.187221 2.06371 0.0879066 3.06371
+0.065447 0.393027 0.400117 0.0240646 1.06545 0.0964843 -0.268962 2.06545 0.145971 3.06545
+0.0722778 0.471994 0.456602 1.17362e-42 1.07228 0.121847 -0.371994 2.07228 0.186981 3.07228
+0.0656094 0.395088 0.395698 0.0285555 1.06561 0.0986195 -0.266532 2.06561 0.140154 3.06561
+0.0647507 0.384067 0.414364 0.0526443 1.06475 0.0884425 -0.231423 2.06475 0.121665 3.06475
+0.0667937 0.409802 0.435073 0.0721567 1.06679 0.0961328 -0.237645 2.06679 0.108365 3.06679
+0.0790609 0.539082 0.355857 0.0148426 1.07906 0.180577 -0.424239 2.07906 0.141914 3.07906
+0.0789246 0.537816 0.464152 0.1625 1.07892 0.15287 -0.275316 2.07892 0.0267456 3.07892
+0.0618373 0.344054 0.463577 0.0595509 1.06184 0.0561328 -0.184503 2.06184 0.129522 3.06184
+0.0660721 0.4009 0.431903 0.0647507 1.06607 0.0924742 -0.236149 2.06607 0.11482 3.06607
+0.055495 0.234415 0.5 4.2639e-51 1.0555 -0.0077925 -0.134415 2.0555 0.2 3.0555
+0.0532416 0.180045 4.07979e-06 0.310409 1.05324 0.0900215 0.230364 2.05324 -0.260408 3.05324
+0.051172 0.108257 0.451134 0.0904216 1.05117 -0.058655 0.0821646 2.05117 0.0949186 3.05117
+0.0683911 0.428849 0.452025 0.101679 1.06839 0.101418 -0.22717 2.06839 0.0839285 3.06839
+0.0742254 0.492194 0.474034 0.0265912 1.07423 0.127588 -0.365603 2.07423 0.165619 3.07423
+0.0638357 0.371964 0.462539 0.0663019 1.06384 0.0703473 -0.205662 2.06384 0.12246 3.06384
+0.0507292 0.0853961 0.200886 1.26834e-55 1.05073 -0.00752345 0.0146039 2.05073 0.110266 3.05073
+0.0678795 0.422842 0.440177 0.0249299 1.06788 0.101377 -0.297912 2.06788 0.157123 3.06788
+0.0659666 0.399582 0.39113 0.0777741 1.06597 0.102009 -0.221808 2.06597 0.0895649 3.06597
+0.0593323 0.305489 0.324352 0.0313853 1.05933 0.0716565 -0.174104 2.05933 0.11592 3.05933
+0.0653988 0.392413 0.5 0.0245468 1.0654 0.0712065 -0.267866 2.0654 0.175453 3.0654
+0.05 -6.26775e-13 0.415527 0.549568 1.05 -0.103882 0.649568 2.05 -0.37491 3.05
+0.054 0.2 0.404032 0.842421 1.054 -0.001008 0.742421 2.054 -0.671211 3.054
+0.0643497 0.378811 0.407376 0.161802 1.06435 0.0875615 -0.117009 2.06435 0.0104108 3.06435
+0.0539818 0.199546 0.499463 0.254689 1.05398 -0.0250927 0.155143 2.05398 -0.0548501 3.05398
+0.065492 0.393598 0.408281 0.0467463 1.06549 0.0947288 -0.246852 2.06549 0.125738 3.06549
+0.0642996 0.378148 0.307913 0.0619032 1.0643 0.112096 -0.216245 2.0643 0.0804707 3.0643
+0.0614545 0.338445 0.416043 0.033022 1.06145 0.0652117 -0.205423 2.06145 0.141791 3.06145
+0.0528596 0.169104 0.5 1.53554e-55 1.05286 -0.040448 -0.069104 2.05286 0.2 3.05286
+0.0651731 0.389527 0.210837 0.0369111 1.06517 0.142054 -0.252616 2.06517 0.07634 3.06517
+0.0932459 0.657616 0.373591 0.00246993 1.09325 0.23541 -0.555146 2.09325 0.159607 3.09325
+0.0619976 0.346376 0.315839 0.0827835 1.062 0.0942283 -0.163593 2.062 0.0619682 3.062
+0.0560386 0.245736 0.500001 0.0382099 1.05604 -0.00213225 -0.107526 2.05604 0.16179 3.05604
+0.0502561 0.0506109 0.13127 5.60514e-51 1.05026 -0.00751205 0.0493891 2.05026 0.089381 3.05026
+0.0666882 0.408512 0.364235 0.0406735 1.06669 0.113197 -0.267838 2.06669 0.118597 3.06669
+0.0722999 0.472227 0.5 0.00418478 1.0723 0.111114 -0.368042 2.0723 0.195815 3.0723
+0.0702157 0.449619 0.237193 0.0744887 1.07022 0.165511 -0.27513 2.07022 0.0466692 3.07022
+0.0607655 0.328108 0.417183 0.0911564 1.06077 0.0597582 -0.136952 2.06077 0.0839985 3.06077
+0.0637842 0.37127 0.480293 0.00030372 1.06378 0.0655617 -0.270966 2.06378 0.193784 3.06378
+0.0662755 0.403429 0.5 0.185383 1.06628 0.0767145 -0.118046 2.06628 0.014617 3.06628
+0.0696049 0.442774 0.308233 0.000873211 1.0696 0.144329 -0.341901 2.0696 0.141597 3.0696
+0.0790191 0.538694 0.0543507 0.00392724 1.07902 0.255759 -0.434767 2.07902 0.062378 3.07902
+0.0591803 0.30299 0.352721 0.0879977 1.05918 0.0633147 -0.114992 2.05918 0.0678186 3.05918
+0.0607915 0.328504 0.432629 0.0557007 1.06079 0.0560948 -0.172803 2.06079 0.124088 3.06079
+0.0633745 0.365711 0.439767 0.109897 1.06337 0.0729137 -0.155814 2.06337 0.0720331 3.06337
+0.0709356 0.457555 0.349486 0.0483874 1.07094 0.141406 -0.309168 2.07094 0.106458 3.07094
+0.0518252 0.135098 0.131235 0.30531 1.05183 0.0347403 0.270212 2.05183 -0.21594 3.05183
+0.0529326 0.171249 0.499888 0.271469 1.05293 -0.0393475 0.20022 2.05293 -0.0715026 3.05293
+0.0639143 0.373019 0.376471 0.0572028 1.06391 0.0923917 -0.215816 2.06391 0.105738 3.06391
+0.0640499 0.374832 0.367381 0.140512 1.06405 0.0955707 -0.13432 2.06405 0.0197023 3.06405
+0.0662223 0.402769 0.39621 0.043343 1.06622 0.102332 -0.259426 2.06622 0.12552 3.06622
+0.0726969 0.476412 0.382524 0.0200383 1.0727 0.142575 -0.356374 2.0727 0.144719 3.0727
+0.0503456 0.0587917 0.499999 0.202002 1.05035 -0.0956039 0.24321 2.05035 -0.0020023 3.05035
+0.0507165 0.0846472 0.304723 3.35499e-56 1.05072 -0.0338572 0.0153528 2.05072 0.141417 3.05072
+0.0516609 0.128877 0.0544062 0.00236557 1.05166 0.0508369 -0.0265114 2.05166 0.0639563 3.05166
+0.062538 0.35409 0.2582 0.00137445 1.06254 0.112495 -0.252716 2.06254 0.126086 3.06254
+0.0597593 0.312398 0.392932 0.0574408 1.05976 0.057966 -0.154957 2.05976 0.110439 3.05976
+0.065412 0.392581 0.403054 0.038658 1.06541 0.095527 -0.253923 2.06541 0.132258 3.06541
+0.0565467 0.255866 0.343426 0.00101485 1.05655 0.0420765 -0.154851 2.05655 0.152013 3.05655
+0.0606688 0.326631 0.480225 0.0484268 1.06067 0.0432592 -0.178204 2.06067 0.145641 3.06067
+0.0667986 0.409861 0.419343 0.031428 1.0668 0.100095 -0.278433 2.0668 0.144375 3.0668
+0.065478 0.39342 0.451152 0.027665 1.06548 0.083922 -0.265755 2.06548 0.157681 3.06548
+0.0594782 0.307867 0.47625 0.022019 1.05948 0.034871 -0.185848 2.05948 0.170856 3.05948
+0.0763704 0.513521 0.466971 0.0386245 1.07637 0.140018 -0.374896 2.07637 0.151467 3.07637
+0.0549042 0.221455 0.297461 0.126293 1.0549 0.0363623 0.004838 2.0549 0.0129453 3.0549
+0.0621037 0.347903 0.3733 6.82106e-48 1.0621 0.0806265 -0.247903 2.0621 0.16199 3.0621
+0.0666933 0.408575 0.426463 0.0552183 1.06669 0.0976718 -0.253357 2.06669 0.122721 3.06669
+0.0512134 0.110155 0.308923 0.589629 1.05121 -0.0221532 0.579474 2.05121 -0.446952 3.05121
+0.0502535 0.0503499 0.372954 0.273173 1.05025 -0.0680636 0.322823 2.05025 -0.111287 3.05025
+0.0644417 0.380023 0.359211 0.0710187 1.06444 0.100209 -0.209004 2.06444 0.0867446 3.06444
+0.0756256 0.506217 0.307674 0.171536 1.07563 0.17619 -0.234681 2.07563 -0.0292338 3.07563
+0.0602582 0.320285 0.484964 0.0118506 1.06026 0.0389015 -0.208434 2.06026 0.183639 3.06026
+0.0627646 0.357276 0.390645 0.0595222 1.06276 0.0809767 -0.197754 2.06276 0.107671 3.06276
+0.0647632 0.38423 0.385877 0.0321825 1.06476 0.0956458 -0.252047 2.06476 0.133581 3.06476
+0.0668642 0.410661 0.397323 0.0469045 1.06686 0.106 -0.263757 2.06686 0.122292 3.06686
+0.0619867 0.346219 0.327979 0.0239391 1.06199 0.0911147 -0.22228 2.06199 0.124455 3.06199
+0.0672613 0.415467 0.376457 0.0274713 1.06726 0.113619 -0.287996 2.06726 0.135466 3.06726
+0.0572038 0.268399 0.398398 0.0592766 1.0572 0.0346 -0.109122 2.0572 0.110243 3.0572
+0.0599626 0.315635 0.449594 0.00129176 1.05996 0.045419 -0.214343 2.05996 0.183586 3.05996
+0.0656968 0.396192 0.464311 0.0231497 1.0657 0.0820183 -0.273042 2.0657 0.166144 3.0657
+0.0575299 0.274407 0.294524 0.000984998 1.05753 0.0635725 -0.173422 2.05753 0.137372 3.05753
+0.0539988 0.199969 0.421902 0.279014 1.054 -0.005491 0.179045 2.054 -0.102443 3.054
+0.0574782 0.273462 0.391646 0.0031727 1.05748 0.0388195 -0.170289 2.05748 0.164321 3.05748
+0.0877763 0.614624 1.97518e-13 0.0851003 1.08778 0.307312 -0.429524 2.08778 -0.0351003 3.08778
+0.0843906 0.586435 0.390134 0.0616267 1.08439 0.195684 -0.424808 2.08439 0.105413 3.08439
+0.0663661 0.40455 0.432816 8.95878e-45 1.06637 0.094071 -0.30455 2.06637 0.179845 3.06637
+0.0549142 0.221679 0.361024 0.204351 1.05491 0.0205835 0.082672 2.05491 -0.0460438 3.05491
+0.0565686 0.256293 0.173111 0.00993551 1.05657 0.0848687 -0.146357 2.05657 0.0919978 3.05657
+0.05 7.95388e-06 0.270439 0.0106868 1.05 -0.0676058 0.110679 2.05 0.120445 3.05
+0.0519719 0.140426 0.333068 0.00177331 1.05197 -0.013054 -0.0386527 2.05197 0.148147 3.05197
+0.0699464 0.446614 0.285632 0.148583 1.06995 0.151899 -0.198031 2.06995 -0.0128934 3.06995
+0.0672085 0.414831 0.402369 0.036818 1.06721 0.106823 -0.278013 2.06721 0.133893 3.06721
+0.0818405 0.564274 0.370856 0.198364 1.08184 0.189423 -0.26591 2.08184 -0.0371072 3.08184
+0.0667731 0.40955 0.5 0.0310004 1.06677 0.079775 -0.27855 2.06677 0.169 3.06677
+0.057929 0.281585 0.438151 0.0560549 1.05793 0.0312547 -0.12553 2.05793 0.12539 3.05793
+0.0769549 0.519181 0.370553 0.0492108 1.07695 0.166952 -0.36997 2.07695 0.111955 3.07695
+0.0698086 0.445068 0.5 0.153244 1.06981 0.097534 -0.191824 2.06981 0.046756 3.06981
+0.0612411 0.335277 0.375349 0.10716 1.06124 0.0738012 -0.128117 2.06124 0.0554447 3.06124
+0.0671427 0.414037 0.448241 0.0473727 1.06714 0.0949582 -0.266664 2.06714 0.1371 3.06714
+0.0655557 0.394408 0.457851 0.0408428 1.06556 0.0827412 -0.253565 2.06556 0.146512 3.06556
+0.0634998 0.367421 0.409052 0.0223988 1.0635 0.0814475 -0.245022 2.0635 0.150317 3.0635
+0.0722688 0.471898 0.448378 0.0143708 1.07227 0.123854 -0.357527 2.07227 0.170143 3.07227
+0.0801833 0.549393 0.5 0.133553 1.08018 0.149697 -0.31584 2.08018 0.066447 3.08018
+0.0617918 0.343392 0.23853 0.150764 1.06179 0.112063 -0.092628 2.06179 -0.029205 3.06179
+0.0680444 0.424788 0.433432 0.0314639 1.06804 0.104036 -0.293324 2.06804 0.148566 3.06804
+0.0527111 0.164655 0.392215 0.0470077 1.05271 -0.0157262 -0.0176473 2.05271 0.120657 3.05271
+0.0547804 0.218642 0.315878 0.0179929 1.05478 0.0303515 -0.100649 2.05478 0.126771 3.05478
+0.067259 0.415439 0.477956 0.0258434 1.06726 0.0882305 -0.289596 2.06726 0.167543 3.06726
+0.0683545 0.428422 0.464072 2.28715e-44 1.06835 0.098193 -0.328422 2.06835 0.189222 3.06835
+0.0677249 0.42101 0.471431 0.0394366 1.06772 0.0926473 -0.281573 2.06772 0.151993 3.06772
+0.0525397 0.159364 0.440133 0.486496 1.05254 -0.0303512 0.427132 2.05254 -0.304456 3.05254
+0.0673309 0.416304 0.5 2.26441e-44 1.06733 0.083152 -0.316304 2.06733 0.2 3.06733
+0.05877 0.296142 0.341428 0.0450337 1.05877 0.062714 -0.151108 2.05877 0.107395 3.05877
+0.0650717 0.388223 0.43731 0.0504728 1.06507 0.084784 -0.23775 2.06507 0.13072 3.06507
+0.05 3.20271e-14 0.5 0.482742 1.05 -0.125 0.582742 2.05 -0.282742 3.05
+0.0656974 0.3962 0.418845 0.0400644 1.0657 0.0933887 -0.256136 2.0657 0.135589 3.0657
+0.0696119 0.442854 0.488694 0.0513068 1.06961 0.0992535 -0.291547 2.06961 0.145301 3.06961
+0.066656 0.408117 0.309366 0.00724904 1.06666 0.126717 -0.300868 2.06666 0.135561 3.06666
+0.0673906 0.41702 0.5 0.122675 1.06739 0.08351 -0.194345 2.06739 0.077325 3.06739
+0.0666143 0.407607 0.43305 0.0398195 1.06661 0.095541 -0.267787 2.06661 0.140095 3.06661
+0.054 0.2 0.116645 0.477932 1.054 0.0708388 0.377932 2.054 -0.392939 3.054
+0.0789579 0.538125 0.240276 1.13071e-45 1.07896 0.208993 -0.438125 2.07896 0.122083 3.07896
+0.05 -0.000174766 0.464309 0.0370374 1.05 -0.116165 0.137212 2.05 0.152255 3.05
+0.0542362 0.205819 0.306853 0.00849926 1.05424 0.0261963 -0.0973197 2.05424 0.133557 3.05424
+0.0601377 0.318398 0.404268 5.4737e-48 1.06014 0.058132 -0.218398 2.06014 0.17128 3.06014
+0.05 0 0.5 0.0117889 1.05 -0.125 0.111789 2.05 0.188211 3.05
+0.0688824 0.434539 0.439606 0.0654424 1.06888 0.107368 -0.269097 2.06888 0.116439 3.06888
+0.05 0 0.5 1 1.05 -0.125 1.1 2.05 -0.8 3.05
+0.0597263 0.31187 0.41798 0.0409915 1.05973 0.05144 -0.170878 2.05973 0.134403 3.05973
+0.0813266 0.559702 0.235061 0.0946073 1.08133 0.221086 -0.365095 2.08133 0.025911 3.08133
+0.0542166 0.205342 0.342021 0.00242921 1.05422 0.0171657 -0.102913 2.05422 0.150177 3.05422
+0.0655161 0.393904 0.439888 0.0702715 1.06552 0.08698 -0.223632 2.06552 0.111695 3.06552
+0.05 0 0 1 1.05 0 1.1 2.05 -0.95 3.05
+0.099 0.7 0 0.25 1.099 0.35 -0.35 2.099 -0.2 3.099
+0.099 0.7 1.6263e-18 0.131079 1.099 0.35 -0.468921 2.099 -0.081079 3.099
+0.0712671 0.461162 0.44399 0.0025896 1.07127 0.119584 -0.358572 2.07127 0.180607 3.07127
+0.0625554 0.354336 0.456687 0.0769022 1.06256 0.0629962 -0.177434 2.06256 0.110104 3.06256
+0.0604962 0.323978 0.323491 0.00891175 1.0605 0.0811163 -0.215066 2.0605 0.138136 3.0605
+0.0594427 0.30729 0.430093 0.000522253 1.05944 0.0461218 -0.206768 2.05944 0.178506 3.05944
+0.099 0.7 0.5 0.25 1.099 0.225 -0.35 2.099 -0.05 3.099
+0.050464 0.0681144 0.15187 0.0881783 1.05046 -0.0039103 0.120064 2.05046 0.0073827 3.05046
+0.0625718 0.354567 0.285655 0.059783 1.06257 0.10587 -0.194784 2.06257 0.0759135 3.06257
+0.0503084 0.0555297 0.440311 0.0242591 1.05031 -0.0823129 0.0687294 2.05031 0.157834 3.05031
+0.0921819 0.649476 0.202842 0.00490973 1.09218 0.274028 -0.544566 2.09218 0.105943 3.09218
+0.0540046 0.200115 0.498366 0.257127 1.054 -0.024534 0.157012 2.054 -0.0576172 3.054
+0.0874971 0.612348 0.355084 0.0312932 1.0875 0.217403 -0.481055 2.0875 0.125232 3.0875
+0.099 0.7 0.5 0.149632 1.099 0.225 -0.450368 2.099 0.050368 3.099
+0.050127 0.0356434 0.372484 0.00620153 1.05013 -0.0752993 0.0705581 2.05013 0.155544 3.05013
+0.0544466 0.210871 0.357497 9.96811e-53 1.05445 0.0160612 -0.110871 2.05445 0.157249 3.05445
+0.0615099 0.339263 0.261399 0.0449035 1.06151 0.104282 -0.194359 2.06151 0.0835162 3.06151
+0.0503738 0.06114 0.389188 0.0556079 1.05037 -0.066727 0.0944679 2.05037 0.111148 3.05037
+0.071969 0.468711 0.368324 0.0427501 1.07197 0.142274 -0.325961 2.07197 0.117747 3.07197
+0.0723079 0.472313 0.260998 0.0187167 1.07231 0.170907 -0.353596 2.07231 0.109583 3.07231
+0.099 0.7 0.5 0.0919306 1.099 0.225 -0.508069 2.099 0.108069 3.099
+0.0731115 0.480744 0.308876 1.24645e-45 1.07311 0.163153 -0.380744 2.07311 0.142663 3.07311
+0.0598152 0.313293 0.127961 0.0728617 1.05982 0.124656 -0.140431 2.05982 0.0155266 3.05982
+0.0608759 0.329786 0.345215 0.101483 1.06088 0.0785893 -0.128303 2.06088 0.0520815 3.06088
+0.0505821 0.0762954 0.40674 0.358424 1.05058 -0.0635373 0.382129 2.05058 -0.186402 3.05058
+0.054 0.2 0.350842 0.581788 1.054 0.0122895 0.481788 2.054 -0.426535 3.054
+0.0676897 0.420591 0.132603 0.0236089 1.06769 0.177145 -0.296982 2.06769 0.066172 3.06769
+0.0538436 0.19605 0.425341 0.128161 1.05384 -0.00831025 0.032111 2.05384 0.0494413 3.05384
+0.0539999 0.199999 -4.64237e-07 0.329559 1.054 0.0999996 0.22956 2.054 -0.279559 3.054
+0.0625062 0.353641 0.429924 0.0062734 1.06251 0.0693395 -0.247368 2.06251 0.172704 3.06251
+0.0618686 0.344509 0.5 0.0570292 1.06187 0.0472545 -0.18748 2.06187 0.142971 3.06187
+0.056599 0.256885 0.5 0.00172461 1.0566 0.0034425 -0.15516 2.0566 0.198275 3.0566
+0.0520083 0.141715 0.5 0.19642 1.05201 -0.0541425 0.154705 2.05201 0.00358 3.05201
+0.0515539 0.124654 0.465921 0.217706 1.05155 -0.0541532 0.193052 2.05155 -0.0279297 3.05155
+0.059 0.3 0.308137 0.25 1.059 0.0729657 0.05 2.059 -0.107559 3.059
+0.0571483 0.267363 0.475325 0.00706193 1.05715 0.0148503 -0.160301 2.05715 0.185536 3.05715
+0.061218 0.334933 0.428974 0.0959516 1.06122 0.060223 -0.138981 2.06122 0.0827406 3.06122
+0.0571321 0.26706 0.414966 0.0446543 1.05713 0.0297885 -0.122406 2.05713 0.129835 3.05713
+0.070942 0.457624 0.337574 0.00289273 1.07094 0.144419 -0.354731 2.07094 0.148379 3.07094
+0.054 0.2 0 1 1.054 0.1 0.9 2.054 -0.95 3.054
+0.0663872 0.404811 0.231014 0.0512887 1.06639 0.144652 -0.253522 2.06639 0.0680155 3.06639
+0.07589 0.508822 0.410608 0.0537115 1.07589 0.151759 -0.35511 2.07589 0.119471 3.07589
+0.0679364 0.423513 0.39898 0.125586 1.06794 0.112011 -0.197927 2.06794 0.044108 3.06794
+0.0786316 0.535085 0.194278 0.113163 1.07863 0.218973 -0.321922 2.07863 -0.0048796 3.07863
+0.0510095 0.100473 0.5 0.860773 1.05101 -0.0747635 0.8603 2.05101 -0.660773 3.05101
+0.0760005 0.509906 0.458307 0.102478 1.076 0.140376 -0.307428 2.076 0.0850141 3.076
+0.0633155 0.364904 0.456815 0.0240317 1.06332 0.0682482 -0.240872 2.06332 0.163013 3.06332
+0.054 0.2 0 0.36 1.054 0.1 0.26 2.054 -0.31 3.054
+0.0574937 0.273746 0.370715 0.0316778 1.05749 0.0441942 -0.142068 2.05749 0.129537 3.05749
+0.0511926 0.109207 0.44713 0.00223015 1.05119 -0.057179 -0.00697685 2.05119 0.181909 3.05119
+0.0674026 0.417164 0.445987 0.0653575 1.0674 0.0970852 -0.251806 2.0674 0.118439 3.0674
+0.0681707 0.426271 0.423393 0.0206918 1.06817 0.107287 -0.305579 2.06817 0.156326 3.06817
+0.0659759 0.399699 0.479609 0.0179773 1.06598 0.0799473 -0.281722 2.06598 0.175905 3.06598
+0.0785084 0.533932 0.206286 0.0409981 1.07851 0.215394 -0.392934 2.07851 0.0708877 3.07851
+0.054 0.2 -6.69077e-09 0.460997 1.054 0.1 0.360997 2.054 -0.410997 3.054
+0.0553025 0.230271 0.275692 0.051502 1.0553 0.0462125 -0.078769 2.0553 0.0812056 3.0553
+0.0527333 0.165326 0.410058 0.220659 1.05273 -0.0198515 0.155333 2.05273 -0.0476416 3.05273
+0.054 0.2 0 0.25 1.054 0.1 0.15 2.054 -0.2 3.054
+0.0662478 0.403086 0.465748 0.0532083 1.06625 0.085106 -0.249878 2.06625 0.136516 3.06625
+0.064051 0.374847 0.469494 0.0399948 1.06405 0.07005 -0.234852 2.06405 0.150853 3.06405
+0.0914327 0.643683 0.165468 0.0820453 1.09143 0.280475 -0.461638 2.09143 0.0175951 3.09143
+0.0575783 0.275287 0.5 1.43266e-50 1.05758 0.0126435 -0.175287 2.05758 0.2 3.05758
+0.0682484 0.427181 0.443961 0.0467272 1.06825 0.1026 -0.280454 2.06825 0.136461 3.06825
+0.0642373 0.377324 0.400831 0.0455221 1.06424 0.0884542 -0.231802 2.06424 0.124727 3.06424
+0.0582294 0.286869 0.35425 1.15436e-50 1.05823 0.054872 -0.186869 2.05823 0.156275 3.05823
+0.0513126 0.11457 0.270072 0.800163 1.05131 -0.010233 0.785593 2.05131 -0.669141 3.05131
+0.058877 0.297942 0.5 0.131435 1.05888 0.023971 -0.066507 2.05888 0.068565 3.05888
+0.063881 0.372572 0.434357 0.0560006 1.06388 0.0776968 -0.216571 2.06388 0.124306 3.06388
+0.0642 0.376829 0.472698 0.0159128 1.0642 0.07024 -0.260916 2.0642 0.175897 3.0642
+0.059 0.3 0 0.25 1.059 0.15 0.05 2.059 -0.2 3.059
+0.070901 0.457176 0.174015 0.0148027 1.0709 0.185084 -0.342373 2.0709 0.0874018 3.0709
+0.0618067 0.343608 0.107301 1.20172e-50 1.06181 0.144979 -0.243608 2.06181 0.0821903 3.06181
+0.0695856 0.442556 0.462088 0.0545991 1.06959 0.105756 -0.287957 2.06959 0.134027 3.06959
+0.0614893 0.338959 0.366946 0.0523817 1.06149 0.077743 -0.186577 2.06149 0.107702 3.06149
+0.0536055 0.18988 0.434286 0.0418494 1.05361 -0.0136315 -0.0480306 2.05361 0.138436 3.05361
+0.0724396 0.473705 0.403607 5.57189e-43 1.07244 0.135951 -0.373705 2.07244 0.171082 3.07244
+0.0501435 0.0378868 0.456756 0.375311 1.05014 -0.0952456 0.437424 2.05014 -0.188284 3.05014
+0.0752482 0.502476 0.5 0.145823 1.07525 0.126238 -0.256653 2.07525 0.054177 3.07525
+0.088397 0.619653 -3.7647e-14 0.0341169 1.0884 0.309827 -0.485536 2.0884 0.0158831 3.0884
+0.0504255 0.0652306 0.0705761 0.0373109 1.05043 0.0149713 0.0720803 2.05043 0.0338619 3.05043
+0.0664386 0.405445 0.415898 0.0760159 1.06644 0.098748 -0.229429 2.06644 0.0987535 3.06644
+0.0601003 0.31781 0.381608 3.6476e-48 1.0601 0.063503 -0.21781 2.0601 0.164482 3.0601
+0.0666397 0.407918 1.97497e-14 0.25 1.06664 0.203959 -0.057918 2.06664 -0.2 3.06664
+0.065767 0.397076 0.378391 0.0849792 1.06577 0.10394 -0.212097 2.06577 0.0785381 3.06577
+0.0631046 0.362003 0.422778 0.0551039 1.0631 0.075307 -0.206899 2.0631 0.121729 3.0631
+0.0734775 0.484536 0.280352 0.0918501 1.07348 0.17218 -0.292686 2.07348 0.0422555 3.07348
+0.0647573 0.384152 0.482646 0.0265439 1.06476 0.0714145 -0.257608 2.06476 0.16825 3.06476
+0.054 0.2 0.0703041 0.36 1.054 0.082424 0.26 2.054 -0.288909 3.054
+0.0662719 0.403384 0.442608 0.0305486 1.06627 0.09104 -0.272835 2.06627 0.152234 3.06627
+0.0689615 0.435448 0.44767 0.00596919 1.06896 0.105806 -0.329479 2.06896 0.178332 3.06896
+0.0829001 0.573586 0.157133 0.072441 1.0829 0.24751 -0.401145 2.0829 0.0246989 3.0829
+0.0559148 0.243205 0.370802 0.00384829 1.05591 0.028902 -0.139357 2.05591 0.157392 3.05591
+0.05 1.51767e-15 0.100726 0.786989 1.05 -0.0251815 0.886989 2.05 -0.706771 3.05
+0.054 0.2 -6.92966e-11 0.579649 1.054 0.1 0.479649 2.054 -0.529649 3.054
+0.0732074 0.481741 0.336763 0.000712878 1.07321 0.15668 -0.381028 2.07321 0.150316 3.07321
+0.0522648 0.150493 0.408384 0.158458 1.05226 -0.0268495 0.107965 2.05226 0.0140572 3.05226
+0.054 0.2 0 0.302456 1.054 0.1 0.202456 2.054 -0.252456 3.054
+0.050399 0.0631674 0.500058 0.00671767 1.0504 -0.0934308 0.0435503 2.0504 0.1933 3.0504
+0.079917 0.546964 1.27394e-18 0.25 1.07992 0.273482 -0.196964 2.07992 -0.2 3.07992
+0.0530618 0.174981 0.349538 0.285524 1.05306 0.000106 0.210543 2.05306 -0.130663 3.05306
+0.0625195 0.353829 0.478405 0.0398976 1.06252 0.0573132 -0.213931 2.06252 0.153624 3.06252
+0.0642265 0.37718 0.433693 0.0675217 1.06423 0.0801668 -0.209658 2.06423 0.112586 3.06423
+0.0602026 0.319416 0.335402 0.00266697 1.0602 0.0758575 -0.216749 2.0602 0.147954 3.0602
+0.0639482 0.373472 0.364505 0.061949 1.06395 0.0956098 -0.211523 2.06395 0.0974025 3.06395
+0.0757777 0.507717 0.171614 0.15485 1.07578 0.210955 -0.252867 2.07578 -0.0533658 3.07578
+0.0622734 0.350335 0.128035 0.0194974 1.06227 0.143159 -0.230838 2.06227 0.0689131 3.06227
+0.0578365 0.279938 0.5 0.034603 1.05784 0.014969 -0.145335 2.05784 0.165397 3.05784
+0.0689935 0.435816 0.414718 0.101045 1.06899 0.114228 -0.234771 2.06899 0.0733704 3.06899
+0.0500816 0.0285613 0.394724 0.450279 1.05008 -0.0844003 0.521718 2.05008 -0.281862 3.05008
+0.0650862 0.38841 0.464104 0.0116729 1.06509 0.078179 -0.276737 2.06509 0.177558 3.06509
+0.0582975 0.288053 0.5 0.00458895 1.0583 0.0190265 -0.183464 2.0583 0.195411 3.0583
+0.0710591 0.458902 0.436252 0.0798828 1.07106 0.120388 -0.279019 2.07106 0.100993 3.07106
+0.0595521 0.309066 0.393749 0.0399085 1.05955 0.0560957 -0.169158 2.05955 0.128216 3.05955
+0.0586177 0.293559 0.5 0.000940925 1.05862 0.0217795 -0.192618 2.05862 0.199059 3.05862
+0.0559482 0.243888 0.5 0.202313 1.05595 -0.003056 0.058425 2.05595 -0.002313 3.05595
+0.0908546 0.639176 0.5 0.0893821 1.09085 0.194588 -0.449794 2.09085 0.110618 3.09085
+0.0661457 0.401817 0.308407 0.019325 1.06615 0.123807 -0.282492 2.06615 0.123197 3.06615
+0.0611469 0.33387 0.4397 0.0408916 1.06115 0.05701 -0.192978 2.06115 0.141018 3.06115
+0.0592706 0.304476 0.384413 0.0154796 1.05927 0.0561348 -0.188996 2.05927 0.149844 3.05927
+0.054 0.2 0.5 1 1.054 -0.025 0.9 2.054 -0.8 3.054
+0.0500472 0.0217158 0.414709 0.0246628 1.05005 -0.0928193 0.102947 2.05005 0.14975 3.05005
+0.0710064 0.458328 0.5 0.0480506 1.07101 0.104164 -0.310277 2.07101 0.151949 3.07101
+0.0537849 0.194548 0.458709 0.0743446 1.05378 -0.0174032 -0.0202034 2.05378 0.113268 3.05378
+0.0752444 0.502438 0.398042 0.0727592 1.07524 0.151709 -0.329679 2.07524 0.0966534 3.07524
+0.0605556 0.324894 0.431283 0.0628536 1.06056 0.0546263 -0.16204 2.06056 0.116531 3.06056
+0.092595 0.652648 0.0451373 0.0026862 1.09259 0.31504 -0.549962 2.0926 0.060855 3.0926
+0.054 0.2 0.5 0.798421 1.054 -0.025 0.698421 2.054 -0.598421 3.054
+0.0843445 0.586042 -1.2651e-12 0.150937 1.08434 0.293021 -0.335105 2.08434 -0.100937 3.08434
+0.054 0.2 0.5 0.635392 1.054 -0.025 0.535392 2.054 -0.435392 3.054
+0.0691868 0.438027 0.396797 0.000408218 1.06919 0.119814 -0.337619 2.06919 0.168631 3.06919
+0.0855554 0.596283 0.174614 0.0422848 1.08556 0.254488 -0.453998 2.08556 0.0600994 3.08556
+0.0509249 0.0961708 3.53675e-11 0.0348487 1.05092 0.0480854 0.0386779 2.05092 0.0151513 3.05092
+0.0677451 0.42125 0.250739 0.00425588 1.06775 0.14794 -0.316994 2.06775 0.120966 3.06775
+0.051153 0.107376 0.447528 0.147759 1.05115 -0.058194 0.140383 2.05115 0.0364994 3.05115
+0.054 0.2 0.5 0.36 1.054 -0.025 0.26 2.054 -0.16 3.054
+0.069444 0.440954 0.34752 0.0693794 1.06944 0.133597 -0.271575 2.06944 0.0848766 3.06944
+0.0519785 0.140661 0.455328 0.02331 1.05198 -0.0435015 -0.017351 2.05198 0.163288 3.05198
+0.0657339 0.39666 0.103608 0.00598148 1.06573 0.172428 -0.290679 2.06573 0.0751009 3.06573
+0.0626373 0.35549 0.426538 0.0426976 1.06264 0.0711105 -0.212792 2.06264 0.135264 3.06264
+0.0657632 0.397029 0.336127 0.0842045 1.06576 0.114483 -0.212825 2.06576 0.0666336 3.06576
+0.054 0.2 0.5 0.25 1.054 -0.025 0.15 2.054 -0.05 3.054
+0.0627647 0.357277 0.419156 0.122678 1.06276 0.0738495 -0.134599 2.06276 0.0530688 3.06276
+0.0595347 0.308782 0.386158 0.0204725 1.05953 0.0578515 -0.188309 2.05953 0.145375 3.05953
+0.0597652 0.312493 0.409997 0.0213397 1.05977 0.0537473 -0.191153 2.05977 0.151659 3.05977
+0.0539999 0.199998 0.434012 0.310652 1.054 -0.008504 0.210654 2.054 -0.130448 3.054
+0.0502606 0.0510491 0.463326 0.0478182 1.05026 -0.0903069 0.0967691 2.05026 0.14118 3.05026
+0.069255 0.438805 0.443399 0.0417537 1.06926 0.108553 -0.297051 2.06926 0.141266 3.06926
+0.061003 0.331708 0.5 0.0441475 1.061 0.040854 -0.18756 2.061 0.155853 3.061
+0.059 0.3 0.5 0.25 1.059 0.025 0.05 2.059 -0.05 3.059
+0.0631972 0.36328 0.436913 0.0423302 1.0632 0.0724117 -0.22095 2.0632 0.138744 3.0632
+0.0529314 0.171214 0.500004 0.222404 1.05293 -0.039394 0.15119 2.05293 -0.0224028 3.05293
+0.0722615 0.471821 0.321049 0.104616 1.07226 0.155648 -0.267205 2.07226 0.0416987 3.07226
+0.05 -1.48301e-07 0.168759 0.00763323 1.05 -0.0421898 0.107633 2.05 0.0929945 3.05
+0.0632409 0.363881 0.338448 0.0229067 1.06324 0.0973285 -0.240974 2.06324 0.128628 3.06324
+0.0578447 0.280084 0.374756 0.00613393 1.05784 0.046353 -0.17395 2.05784 0.156293 3.05784
+0.0635771 0.368472 0.425192 0.0343019 1.06358 0.077938 -0.23417 2.06358 0.143256 3.06358
+0.0725131 0.474479 0.274203 0.0648699 1.07251 0.168689 -0.309609 2.07251 0.067391 3.07251
+0.0670787 0.413263 0.388086 0.0135637 1.06708 0.10961 -0.299699 2.06708 0.152862 3.06708
+0.0607237 0.327471 0.5 0.00764487 1.06072 0.0387355 -0.219826 2.06072 0.192355 3.06072
+0.0649353 0.386462 0.5 0.0464075 1.06494 0.068231 -0.240055 2.06494 0.153593 3.06494
+0.0700197 0.447434 0.5 0.25 1.07002 0.098717 -0.097434 2.07002 -0.05 3.07002
+0.0581647 0.285739 0.349375 0.0340145 1.05816 0.0555258 -0.151725 2.05816 0.120798 3.05816
+0.0527931 0.167126 0.25402 0.0848739 1.05279 0.020058 0.0177479 2.05279 0.0413321 3.05279
+0.0723732 0.473003 0.385379 0.0349598 1.07237 0.140157 -0.338043 2.07237 0.130654 3.07237
+0.059927 0.315072 0.377481 0.0645886 1.05993 0.0631658 -0.150483 2.05993 0.0986557 3.05993
+0.060938 0.330726 0.5 0.0741778 1.06094 0.040363 -0.156548 2.06094 0.125822 3.06094
+0.0639276 0.373198 0.440992 0.0528751 1.06393 0.076351 -0.220323 2.06393 0.129422 3.06393
+0.0640965 0.375453 0.43476 0.0767474 1.0641 0.0790365 -0.198706 2.0641 0.103681 3.0641
+0.0533777 0.183786 0.499832 0.252166 1.05338 -0.033065 0.16838 2.05338 -0.0522164 3.05338
+0.0781821 0.530868 0.5 0.25 1.07818 0.140434 -0.180868 2.07818 -0.05 3.07818
+0.0578433 0.28006 0.324811 0.0960696 1.05784 0.0588272 -0.0839904 2.05784 0.0513737 3.05784
+0.0599559 0.31553 0.392931 0.0740217 1.05996 0.0595322 -0.141508 2.05996 0.0938576 3.05996
+0.0702378 0.449864 0.427809 0.0579556 1.07024 0.11798 -0.291908 2.07024 0.120387 3.07024
+0.0636006 0.36879 0.439707 0.062725 1.0636 0.0744682 -0.206065 2.0636 0.119187 3.0636
+0.0882034 0.618089 0.5 0.25 1.0882 0.184044 -0.268089 2.0882 -0.05 3.0882
+0.0639249 0.37316 0.415277 0.0752525 1.06392 0.0827607 -0.197907 2.06392 0.0993306 3.06392
+0.0682452 0.427144 0.5 0.0577876 1.06825 0.088572 -0.269356 2.06825 0.142212 3.06825
+0.0509423 0.0970719 0.500002 0.307802 1.05094 -0.0764645 0.31073 2.05094 -0.107801 3.05094
+0.0651799 0.389614 0.337487 0.101438 1.06518 0.110435 -0.188176 2.06518 0.0498081 3.06518
+0.0520293 0.142455 0.393397 0.241722 1.05203 -0.0271218 0.199267 2.05203 -0.0737029 3.05203
+0.0771093 0.520666 0.471922 0.0279316 1.07711 0.142352 -0.392734 2.07711 0.163645 3.07711
+0.064696 0.383354 0.357149 0.0795323 1.0647 0.10239 -0.203822 2.0647 0.0776124 3.0647
+0.05 -2.36631e-06 0.453749 0.0848553 1.05 -0.113438 0.184858 2.05 0.101269 3.05
+0.064857 0.385448 0.396393 0.0805224 1.06486 0.0936258 -0.204926 2.06486 0.0883955 3.06486
+0.0638154 0.37169 0.358633 0.000663923 1.06382 0.0961868 -0.271026 2.06382 0.156926 3.06382
+0.0540118 0.200295 0.0711056 4.62734e-52 1.05401 0.0823711 -0.100295 2.05401 0.0713317 3.05401
+0.0663101 0.403858 0.428461 0.0604003 1.06631 0.0948138 -0.243458 2.06631 0.118138 3.06631
+0.054 0.2 0.168821 1 1.054 0.0577948 0.9 2.054 -0.899354 3.054
+0.0509859 0.0992929 0.372046 0.270945 1.05099 -0.043365 0.271652 2.05099 -0.109331 3.05099
+0.0539413 0.198528 0.210805 0.0026293 1.05394 0.0465628 -0.0958987 2.05394 0.110612 3.05394
+0.0691164 0.437223 0.349457 0.000692035 1.06912 0.131247 -0.336531 2.06912 0.154145 3.06912
+0.0507305 0.085472 0.119538 0.147051 1.05073 0.0128515 0.161579 2.05073 -0.0611896 3.05073
+0.0650217 0.387579 0.325872 0.00683917 1.06502 0.112322 -0.28074 2.06502 0.140922 3.06502
+0.052984 0.172742 0.456967 0.0152997 1.05298 -0.0278707 -0.0574423 2.05298 0.17179 3.05298
+0.0584367 0.290461 0.35783 0.0519926 1.05844 0.055773 -0.138468 2.05844 0.105356 3.05844
+0.069654 0.443329 0.367378 0.0723619 1.06965 0.12982 -0.270967 2.06965 0.0878515 3.06965
+0.059 0.3 0.380925 0.25 1.059 0.0547687 0.05 2.059 -0.0857225 3.059
+0.054 0.2 0.264837 0.25 1.054 0.0337908 0.15 2.054 -0.120549 3.054
+0.063836 0.371967 0.485475 0.0633559 1.06384 0.0646147 -0.208611 2.06384 0.132287 3.06384
+0.0504538 0.0673656 0.329737 0.00260712 1.05045 -0.0487515 0.0352415 2.05045 0.146314 3.05045
+0.0657921 0.397392 0.387407 0.0199201 1.06579 0.101844 -0.277472 2.06579 0.146302 3.06579
+0.099 0.7 0.347552 0.165244 1.099 0.263112 -0.434756 2.099 -0.0109784 3.099
+0.067694 0.420642 0.387257 0.0355597 1.06769 0.113507 -0.285082 2.06769 0.130617 3.06769
+0.061612 0.340764 0.354995 0.0155133 1.06161 0.0816333 -0.225251 2.06161 0.140985 3.06161
+0.0660967 0.401207 0.433418 0.25 1.0661 0.092249 -0.051207 2.0661 -0.0699746 3.0661
+0.059 0.3 0.2363 0.25 1.059 0.090925 0.05 2.059 -0.12911 3.059
+0.0616524 0.341355 0.394096 0.0227321 1.06165 0.0721535 -0.218623 2.06165 0.145497 3.06165
+0.0637078 0.370241 0.412172 0.0284406 1.06371 0.0820775 -0.2418 2.06371 0.145211 3.06371
+0.0578424 0.280042 0.388558 0.0185773 1.05784 0.0428815 -0.161465 2.05784 0.14799 3.05784
+0.0629492 0.35985 0.41924 0.0481488 1.06295 0.075115 -0.211701 2.06295 0.127623 3.06295
+0.0703416 0.451017 0.0890378 0.0508857 1.07034 0.203249 -0.300131 2.07034 0.0258256 3.07034
+0.0794352 0.542542 0.404268 0.159492 1.07944 0.170204 -0.28305 2.07944 0.0117884 3.07944
+0.0840563 0.583578 0.130169 0.25 1.08406 0.259247 -0.233578 2.08406 -0.160949 3.08406
+0.05 -8.07969e-07 0.396258 0.105074 1.05 -0.0990649 0.205075 2.05 0.0638034 3.05
+0.0547734 0.218481 0.406484 0.106934 1.05477 0.0076195 -0.011547 2.05477 0.0650112 3.05477
+0.0684536 0.429577 0.279732 0.00647759 1.06845 0.144855 -0.323099 2.06845 0.127442 3.06845
+0.065003 0.387337 0.123874 0.25 1.065 0.1627 -0.037337 2.065 -0.162838 3.065
+0.0677691 0.421534 0.0607768 0.118257 1.06777 0.195573 -0.203277 2.06777 -0.050024 3.06777
+0.0659099 0.398872 0.423338 0.033178 1.06591 0.0936015 -0.265694 2.06591 0.143823 3.06591
+0.0671427 0.414037 0.387308 0.055225 1.06714 0.110191 -0.258812 2.06714 0.110967 3.06714
+0.0722942 0.472168 0.171366 0.25 1.07229 0.193242 -0.122168 2.07229 -0.14859 3.07229
+0.0662338 0.402911 0.410193 0.029349 1.06623 0.0989073 -0.273562 2.06623 0.143709 3.06623
+0.0567052 0.258945 0.410185 0.00163808 1.05671 0.0269262 -0.157307 2.05671 0.171417 3.05671
+0.0643168 0.378375 0.444546 0.0480206 1.06432 0.078051 -0.230354 2.06432 0.135343 3.06432
+0.0513376 0.115653 0.499978 0.0210254 1.05134 -0.067168 0.0053724 2.05134 0.178968 3.05134
+0.0657727 0.397148 0.412187 0.0424332 1.06577 0.0955272 -0.254715 2.06577 0.131223 3.06577
+0.05 4.69091e-05 0.415617 0.0373103 1.05 -0.103881 0.137263 2.05 0.137375 3.05
+0.054 0.2 0.392271 0.36 1.054 0.00193225 0.26 2.054 -0.192319 3.054
+0.0582268 0.286824 0.224551 0.0283845 1.05823 0.0872743 -0.15844 2.05823 0.0889808 3.05823
+0.0652296 0.390251 0.42679 0.0390332 1.06523 0.088428 -0.251218 2.06523 0.139004 3.06523
+0.0501033 0.032135 0.426113 0.0325764 1.0501 -0.0904608 0.100441 2.0501 0.145257 3.0501
+0.08308 0.575152 0.249235 0.054906 1.08308 0.225267 -0.420246 2.08308 0.0698645 3.08308
+0.0618857 0.344756 0.350348 0.0461945 1.06189 0.084791 -0.198562 2.06189 0.10891 3.06189
+0.054 0.2 0.318933 0.36 1.054 0.0202668 0.26 2.054 -0.21432 3.054
+0.0648834 0.38579 0.328307 0.0218375 1.06488 0.110818 -0.263953 2.06488 0.126655 3.06488
+0.0551495 0.226925 0.298037 0.074468 1.05515 0.0389532 -0.052457 2.05515 0.0649431 3.05515
+0.0637598 0.370941 0.453806 0.0326035 1.06376 0.072019 -0.238338 2.06376 0.153538 3.06376
+0.054 0.2 0.153472 0.36 1.054 0.061632 0.26 2.054 -0.263958 3.054
+0.0904149 0.635727 0.244207 0.186623 1.09041 0.256812 -0.349104 2.09041 -0.0633609 3.09041
+0.0719156 0.468141 0.414919 0.0717803 1.07192 0.130341 -0.296361 2.07192 0.102695 3.07192
+0.0511766 0.108469 3.56708e-07 0.371865 1.05118 0.0542344 0.363396 2.05118 -0.321865 3.05118
+0.0589544 0.299239 0.425821 0.00313287 1.05895 0.0431642 -0.196106 2.05895 0.174613 3.05895
+0.0537233 0.192958 0.28986 0.104015 1.05372 0.024014 0.011057 2.05372 0.032943 3.05372
+0.0663666 0.404557 0.457524 0.0679408 1.06637 0.0878975 -0.236616 2.06637 0.119316 3.06637
+0.054 0.2 0.246992 0.558735 1.054 0.038252 0.458735 2.054 -0.434637 3.054
+0.0564521 0.25401 0.447702 0.0614647 1.05645 0.0150795 -0.0925453 2.05645 0.122846 3.05645
+0.081334 0.559768 0.272254 0.027328 1.08133 0.211821 -0.43244 2.08133 0.104348 3.08133
+0.0515785 0.125639 0.37816 0.670908 1.05158 -0.0317205 0.645269 2.05158 -0.50746 3.05158
+0.0582798 0.287746 0.173384 0.149932 1.05828 0.100527 -0.037814 2.05828 -0.0479168 3.05828
+0.0592924 0.304834 0.5 0.0989531 1.05929 0.027417 -0.105881 2.05929 0.101047 3.05929
+0.0611483 0.33389 0.44934 0.0606765 1.06115 0.05461 -0.173214 2.06115 0.124126 3.06115
+0.0630071 0.360654 0.337077 5.86542e-48 1.06301 0.0960577 -0.260654 2.06301 0.151123 3.06301
+0.0627946 0.357696 0.430981 0.0109049 1.06279 0.0711028 -0.246791 2.06279 0.168389 3.06279
+0.05 -0.000351128 0.419563 0.0192248 1.05 -0.105066 0.119576 2.05 0.156644 3.05
+0.0580781 0.28422 0.417909 0.126403 1.05808 0.0376327 -0.057817 2.05808 0.0489697 3.05808
+0.0676679 0.420332 0.382484 0.082732 1.06767 0.114545 -0.2376 2.06767 0.0820132 3.06767
+0.0585012 0.291568 0.392842 0.0316688 1.0585 0.0475735 -0.159899 2.0585 0.136184 3.0585
+0.054 0.2 0.299103 0.771095 1.054 0.0252243 0.671095 2.054 -0.631364 3.054
+0.0627278 0.35676 0.420171 2.47478e-46 1.06273 0.0733373 -0.25676 2.06273 0.176051 3.06273
+0.0567329 0.259479 0.297095 0.0426961 1.05673 0.0554658 -0.116783 2.05673 0.0964324 3.05673
+0.0744827 0.4948 0.471128 0.00101104 1.07448 0.129618 -0.393789 2.07448 0.190327 3.07448
+0.067349 0.416521 0.412399 0.0629117 1.06735 0.105161 -0.253609 2.06735 0.110808 3.06735
+0.0593627 0.305985 0.347455 0.0181669 1.05936 0.0661288 -0.187818 2.05936 0.13607 3.05936
+0.0616499 0.341319 0.389456 0.0921349 1.06165 0.0732955 -0.149184 2.06165 0.0747019 3.06165
+0.0631347 0.362418 0.420328 0.0378541 1.06313 0.076127 -0.224564 2.06313 0.138244 3.06313
+0.0723798 0.473073 0.23133 0.0517761 1.07238 0.178704 -0.321297 2.07238 0.0676229 3.07238
+0.0763663 0.513481 0.461762 0.13551 1.07637 0.1413 -0.277971 2.07637 0.0530186 3.07637
+0.0650527 0.387978 0.470381 0.065946 1.06505 0.0763937 -0.222032 2.06505 0.125168 3.06505
+0.0513732 0.117183 0.390299 0.135021 1.05137 -0.0389833 0.117838 2.05137 0.0320687 3.05137
+0.0503334 0.0577434 0.167662 0.0392517 1.05033 -0.0130438 0.0815083 2.05033 0.0610469 3.05033
+0.0662583 0.403215 0.280986 0.0628564 1.06626 0.131361 -0.240359 2.06626 0.0714394 3.06626
+0.0640799 0.375232 0.429314 0.0415243 1.06408 0.0802875 -0.233708 2.06408 0.13727 3.06408
+0.0524521 0.156592 0.433044 0.00147947 1.05245 -0.029965 -0.0551125 2.05245 0.178434 3.05245
+0.0633845 0.365848 0.43555 0.0519145 1.06338 0.0740365 -0.213933 2.06338 0.12875 3.06338
+0.051554 0.124658 0.410518 0.326696 1.05155 -0.0403005 0.302038 2.05155 -0.153541 3.05155
+0.0832076 0.57626 0.0744844 8.75507e-46 1.08321 0.269509 -0.47626 2.08321 0.0723453 3.08321
+0.05 -5.6861e-13 0.5 0.397037 1.05 -0.125 0.497037 2.05 -0.197037 3.05
+0.0508707 0.0933112 0.372754 0.0388007 1.05087 -0.0465329 0.0454895 2.05087 0.123025 3.05087
+0.0607712 0.328195 0.33917 0.0135159 1.06077 0.079305 -0.214679 2.06077 0.138235 3.06077
+0.0735617 0.485404 0.120497 0.00801509 1.07356 0.212578 -0.377389 2.07356 0.078134 3.07356
+0.0664153 0.405158 0.434355 0.0437604 1.06642 0.0939903 -0.261398 2.06642 0.136546 3.06642
+0.0607733 0.328227 0.341933 0.00564068 1.06077 0.0786302 -0.222586 2.06077 0.146939 3.06077
+0.0657716 0.397135 0.311909 0.0379206 1.06577 0.12059 -0.259214 2.06577 0.105652 3.06577
+0.0658485 0.398102 0.326338 0.207524 1.06585 0.117467 -0.090578 2.06585 -0.0596226 3.06585
+0.0647844 0.384505 0.429769 0.0563763 1.06478 0.0848102 -0.228129 2.06478 0.122554 3.06478
+0.0623999 0.352135 0.465768 0.0678531 1.0624 0.0596255 -0.184282 2.0624 0.121877 3.0624
+0.0680169 0.424463 0.293264 0.0441434 1.06802 0.138915 -0.28032 2.06802 0.0938358 3.06802
+0.070731 0.455314 0.361801 0.0202224 1.07073 0.137207 -0.335092 2.07073 0.138318 3.07073
+0.0623125 0.350892 0.425242 0.04915 1.06231 0.0691355 -0.201742 2.06231 0.128423 3.06231
+0.0513233 0.115036 0.444889 0.178919 1.05132 -0.0537042 0.163883 2.05132 0.0045477 3.05132
+0.0547896 0.218851 0.060087 0.00825883 1.05479 0.0944037 -0.110592 2.05479 0.0597673 3.05479
+0.0507899 0.0888787 0.445604 0.0175658 1.05079 -0.0669616 0.0286871 2.05079 0.166115 3.05079
+0.0656308 0.395358 0.3948 0.00837753 1.06563 0.098979 -0.28698 2.06563 0.160062 3.06563
+0.0645969 0.382059 0.400995 0.0698077 1.0646 0.0907807 -0.212251 2.0646 0.100491 3.0646
+0.05 0 0 0.0726927 1.05 0 0.172693 2.05 -0.0226927 3.05
+0.0602169 0.319639 0.469242 0.0294099 1.06022 0.042509 -0.190229 2.06022 0.161363 3.06022
+0.05 0 0 0.0121686 1.05 0 0.112169 2.05 0.0378314 3.05
+0.099 0.7 0 0.0413364 1.099 0.35 -0.558664 2.099 0.0086636 3.099
+0.0691794 0.437942 0.440507 0.0872113 1.06918 0.108844 -0.250731 2.06918 0.0949408 3.06918
+0.0798049 0.545939 0.467866 0.100212 1.0798 0.156003 -0.345727 2.0798 0.0901478 3.0798
+0.0828331 0.573002 0.336247 0.109661 1.08283 0.202439 -0.363341 2.08283 0.0412131 3.08283
+0.0569251 0.263156 0.412063 0.00034996 1.05693 0.0285622 -0.162806 2.05693 0.173269 3.05693
+0.0623684 0.351688 0.219714 0.0921505 1.06237 0.120916 -0.159537 2.06237 0.0237637 3.06237
+0.0624546 0.352911 0.364765 0.0373715 1.06245 0.0852642 -0.215539 2.06245 0.122058 3.06245
+0.0778445 0.527679 0.338702 0.0370381 1.07784 0.179164 -0.390641 2.07784 0.114573 3.07784
+0.0853505 0.594563 0.372144 0.0418268 1.08535 0.204245 -0.452736 2.08535 0.119816 3.08535
+0.0770675 0.520265 0.347757 0.113283 1.07707 0.173193 -0.306982 2.07707 0.0410441 3.07707
+0.0505521 0.0743039 0.500089 0.0204134 1.05055 -0.0878703 0.0461095 2.05055 0.179613 3.05055
+0.0623959 0.352078 0.233953 0.0692802 1.0624 0.117551 -0.182798 2.0624 0.0509057 3.0624
+0.05 0 0 0 1.05 0 0.1 2.05 0.05 3.05
+0.0626979 0.356341 0.454871 0.150749 1.0627 0.0644528 -0.105592 2.0627 0.0357123 3.0627
+0.0874103 0.611639 0.5 0.0459861 1.08741 0.18082 -0.465653 2.08741 0.154014 3.08741
+0.0766051 0.515801 0.427376 0.0837909 1.07661 0.151056 -0.33201 2.07661 0.0944219 3.07661
+0.0533244 0.182328 0.384896 0.209555 1.05332 -0.00506 0.127227 2.05332 -0.0440862 3.05332
+0.0632988 0.364675 5.23128e-18 5.88623e-51 1.0633 0.182338 -0.264675 2.0633 0.05 3.0633
+0.0825137 0.570208 0.216067 0.156264 1.08251 0.231087 -0.313944 2.08251 -0.0414439 3.08251
+0.0678495 0.422487 0.416616 0.0469298 1.06785 0.10709 -0.275557 2.06785 0.128055 3.06785
+0.0621245 0.348203 0.416109 0.0224805 1.06212 0.0700742 -0.225722 2.06212 0.152352 3.06212
+0.0616212 0.340899 0.335715 0.000794696 1.06162 0.0865208 -0.240104 2.06162 0.14992 3.06162
+0.05 6.07153e-18 0.1 0 1.05 -0.025 0.1 2.05 0.08 3.05
+0.051 0.1 0 0 1.051 0.05 0 2.051 0.05 3.051
+0.0906635 0.637679 0.125646 0.0201573 1.09066 0.287428 -0.517522 2.09066 0.0675365 3.09066
+0.054 0.2 0.139313 0.697975 1.054 0.0651718 0.597975 2.054 -0.606181 3.054
+0.06591 0.398873 0.377785 0.0635509 1.06591 0.10499 -0.235322 2.06591 0.0997846 3.06591
+0.0619031 0.345009 0.27276 0.0227581 1.0619 0.104315 -0.222251 2.0619 0.10907 3.0619
+0.0641652 0.376367 0.244178 0.0389106 1.06417 0.127139 -0.237456 2.06417 0.0843428 3.06417
+0.0613892 0.337479 0.464556 0.0520388 1.06139 0.0526005 -0.18544 2.06139 0.137328 3.06139
+0.0599922 0.316105 0.410822 0.000472365 1.05999 0.055347 -0.215633 2.05999 0.172774 3.05999
+0.0631743 0.362964 0.380942 0.118589 1.06317 0.0862465 -0.144375 2.06317 0.0456936 3.06317
+0.05 3.63192e-05 0.356932 0.0436166 1.05 -0.0892148 0.14358 2.05 0.113463 3.05
+0.0842858 0.585541 0.147728 0.186035 1.08429 0.255838 -0.299506 2.08429 -0.0917166 3.08429
+0.054653 0.215708 0.376514 0.0979281 1.05465 0.0137255 -0.0177799 2.05465 0.0650261 3.05465
+0.0502506 0.0500621 0.500001 0.100207 1.05025 -0.0999692 0.150145 2.05025 0.0997933 3.05025
+0.0689449 0.435258 0.436629 0.192529 1.06894 0.108472 -0.142729 2.06894 -0.0115403 3.06894
+0.0632376 0.363836 0.4124 0.00355266 1.06324 0.078818 -0.260283 2.06324 0.170167 3.06324
+0.0606762 0.326744 0.350233 4.74734e-48 1.06068 0.0758137 -0.226744 2.06068 0.15507 3.06068
+0.0639911 0.374047 0.423849 0.0702814 1.06399 0.0810613 -0.203766 2.06399 0.106873 3.06399
+0.0748045 0.498042 0.337792 0.0195346 1.0748 0.164573 -0.378507 2.0748 0.131803 3.0748
+0.0679695 0.423904 0.377625 0.0400527 1.06797 0.117546 -0.283851 2.06797 0.123235 3.06797
+0.0640286 0.374547 0.343489 0.0475638 1.06403 0.101401 -0.226983 2.06403 0.105483 3.06403
+0.0714573 0.46322 0.395805 0.0957157 1.07146 0.132659 -0.267504 2.07146 0.0730258 3.07146
+0.0578251 0.279735 0.411796 0.050993 1.05783 0.0369185 -0.128742 2.05783 0.122546 3.05783
+0.05 0 0 0.0806636 1.05 0 0.180664 2.05 -0.0306636 3.05
+0.05 1.6263e-16 -3.07168e-10 0.300587 1.05 7.67921e-11 0.400587 2.05 -0.250587 3.05
+0.0679948 0.424203 0.398647 0.0640128 1.06799 0.11244 -0.26019 2.06799 0.105581 3.06799
+0.0651267 0.38893 0.456925 0.0486745 1.06513 0.0802337 -0.240255 2.06513 0.138403 3.06513
+0.0569983 0.264542 0.397337 0.180673 1.057 0.0329368 0.016131 2.057 -0.0114719 3.057
+0.0571243 0.266914 0.462995 0.0134335 1.05712 0.0177082 -0.15348 2.05712 0.175465 3.05712
+0.0599363 0.315218 0.390437 0.0479497 1.05994 0.0599998 -0.167268 2.05994 0.119181 3.05994
+0.055287 0.229934 0.221071 0.0988531 1.05529 0.0596993 -0.0310809 2.05529 0.0174682 3.05529
+0.0632932 0.364598 0.432592 0.0391814 1.06329 0.074151 -0.225417 2.06329 0.140596 3.06329
+0.0664327 0.405372 0.400031 7.04736e-45 1.06643 0.102678 -0.305372 2.06643 0.170009 3.06643
+0.0646477 0.382723 0.389857 0.0559103 1.06465 0.0938972 -0.226813 2.06465 0.111047 3.06465
+0.066988 0.412165 0.455544 0.0254846 1.06699 0.0921965 -0.28668 2.06699 0.161179 3.06699
+0.05 0 0 0.909983 1.05 0 1.00998 2.05 -0.859983 3.05
+0.0737384 0.487221 0.309914 0.124934 1.07374 0.166132 -0.262287 2.07374 0.0180402 3.07374
+0.0673761 0.416847 0.457177 0.053363 1.06738 0.0941293 -0.263484 2.06738 0.13379 3.06738
+0.05 -1.34311e-15 0.5 0.615931 1.05 -0.125 0.715931 2.05 -0.415931 3.05
+0.05 -1.23996e-11 0.289765 0.330213 1.05 -0.0724413 0.430213 2.05 -0.193283 3.05
+0.05 0 0 0.0159475 1.05 0 0.115948 2.05 0.0340525 3.05
+0.0801258 0.548869 0.5 0.182164 1.08013 0.149435 -0.266705 2.08013 0.017836 3.08013
+0.0659735 0.399669 0.3888 0.0320943 1.06597 0.102635 -0.267575 2.06597 0.134546 3.06597
+0.0697464 0.444369 0.475861 0.125574 1.06975 0.103219 -0.218795 2.06975 0.0671843 3.06975
+0.0649963 0.387251 0.393187 0.0612719 1.065 0.0953288 -0.225979 2.065 0.106684 3.065
+0.0526126 0.161635 0.414619 0.283371 1.05261 -0.0228373 0.221736 2.05261 -0.108985 3.05261
+0.0637172 0.370368 0.453223 0.0431414 1.06372 0.0718782 -0.227227 2.06372 0.142825 3.06372
+0.050483 0.0695009 0.0547877 0.206735 1.05048 0.0210535 0.237234 2.05048 -0.140299 3.05048
+0.0834392 0.578266 0.126113 0.00551856 1.08344 0.257605 -0.472747 2.08344 0.0823153 3.08344
+0.060212 0.319562 0.287003 0.104253 1.06021 0.0880303 -0.115309 2.06021 0.0318479 3.06021
+0.0583816 0.28951 0.245849 0.0183215 1.05838 0.0832927 -0.171188 2.05838 0.105433 3.05838
+0.0672618 0.415473 0.450679 0.00971184 1.06726 0.0950667 -0.305761 2.06726 0.175492 3.06726
+0.0585504 0.292411 0.26303 0.00980074 1.05855 0.080448 -0.18261 2.05855 0.119108 3.05855
+0.0546199 0.214939 0.339746 0.0276023 1.05462 0.022533 -0.0873367 2.05462 0.124322 3.05462
+0.065842 0.39802 0.454577 0.0071751 1.06584 0.0853657 -0.290845 2.06584 0.179198 3.06584
+0.0519102 0.138211 0.1767 0.00264327 1.05191 0.0249305 -0.0355677 2.05191 0.100367 3.05191
+0.0500719 0.0268147 0.472721 0.00116004 1.05007 -0.104773 0.0743453 2.05007 0.190656 3.05007
+0.0538594 0.196453 0.498842 0.264693 1.05386 -0.026484 0.16824 2.05386 -0.0650404 3.05386
+0.0598431 0.313737 0.372325 0.11229 1.05984 0.0637872 -0.101447 2.05984 0.0494075 3.05984
+0.05 0.000310711 0.499742 0.00711074 1.05 -0.12478 0.1068 2.05 0.192812 3.05
+0.0664029 0.405005 0.192981 0.0238059 1.0664 0.154257 -0.281199 2.0664 0.0840884 3.0664
+0.0610146 0.331883 0.452696 0.0794263 1.06101 0.0527675 -0.152457 2.06101 0.106382 3.06101
+0.0667203 0.408904 0.404014 0.0239182 1.06672 0.103448 -0.284986 2.06672 0.147286 3.06672
+0.0641632 0.376341 0.5 0.0701764 1.06416 0.0631705 -0.206165 2.06416 0.129824 3.06416
+0.0660614 0.400766 0.435281 0.0477106 1.06606 0.0915628 -0.253055 2.06606 0.132874 3.06606
+0.05 -3.32093e-07 0.261764 9.67444e-64 1.05 -0.0654412 0.1 2.05 0.128529 3.05
+0.052512 0.158491 0.0693956 0.158816 1.05251 0.0618966 0.100325 2.05251 -0.0879973 3.05251
+0.0712051 0.46049 0.5 1.55861e-43 1.07121 0.105245 -0.36049 2.07121 0.2 3.07121
+0.0501671 0.0408795 0.363897 0.153507 1.05017 -0.0705345 0.212628 2.05017 0.0056621 3.05017
+0.0575266 0.274346 0.44759 0.0681366 1.05753 0.0252755 -0.106209 2.05753 0.11614 3.05753
+0.0661391 0.401735 0.276141 0.0019361 1.06614 0.131832 -0.299799 2.06614 0.130906 3.06614
+0.0662788 0.40347 0.39461 0.00244026 1.06628 0.103082 -0.30103 2.06628 0.165943 3.06628
+0.0685034 0.430156 0.355574 0.00275545 1.0685 0.126184 -0.327401 2.0685 0.153917 3.0685
+0.0748131 0.498127 0.413898 0.0382575 1.07481 0.145589 -0.359869 2.07481 0.135912 3.07481
+0.0920029 0.648096 0.306773 0.136701 1.092 0.247355 -0.411395 2.092 0.0053309 3.092
+0.0639789 0.373884 0.5 0.0162127 1.06398 0.061942 -0.257671 2.06398 0.183787 3.06398
+0.0640643 0.375024 0.377107 0.0191908 1.06406 0.0932353 -0.255833 2.06406 0.143941 3.06406
+0.0622147 0.349495 0.411351 0.0497745 1.06221 0.0719097 -0.19972 2.06221 0.123631 3.06221
+0.0668116 0.410019 0.419918 0.139225 1.06681 0.10003 -0.170794 2.06681 0.0367504 3.06681
+0.0530471 0.174559 0.308946 0.0159507 1.05305 0.010043 -0.0586083 2.05305 0.126733 3.05305
+0.0583385 0.288765 0.379094 0.0604401 1.05834 0.049609 -0.128325 2.05834 0.103288 3.05834
+0.0652267 0.390214 0.366067 0.0571186 1.06523 0.10359 -0.233095 2.06523 0.102702 3.06523
+0.0782302 0.531321 0.404958 0.00107817 1.07823 0.164421 -0.430243 2.07823 0.170409 3.07823
+0.060696 0.327047 0.378518 0.0571283 1.0607 0.068894 -0.169919 2.0607 0.106427 3.0607
+0.0669077 0.411189 0.284262 0.023734 1.06691 0.134529 -0.287455 2.06691 0.111545 3.06691
+0.05 3.70797e-17 -2.1296e-12 0.659548 1.05 5.32419e-13 0.759548 2.05 -0.609548 3.05
+0.0727125 0.476576 0.443468 0.00659504 1.07271 0.127421 -0.369981 2.07271 0.176445 3.07271
+0.0511569 0.107561 0.259296 0.230547 1.05116 -0.0110435 0.222986 2.05116 -0.102758 3.05116
+0.05 5.20417e-17 0.0665796 1 1.05 -0.0166449 1.1 2.05 -0.930026 3.05
+0.0660332 0.400415 0.487966 0.0442508 1.06603 0.078216 -0.256164 2.06603 0.152139 3.06603
+0.0629166 0.359397 0.368805 0.0464311 1.06292 0.0874973 -0.212966 2.06292 0.11421 3.06292
+0.0660001 0.400001 0.439937 0.0999983 1.066 0.0900162 -0.200003 2.066 0.0819828 3.066
+0.0539986 0.199965 0.44193 0.271406 1.054 -0.0105 0.171441 2.054 -0.088827 3.054
+0.0641665 0.376384 0.368312 0.0515639 1.06417 0.096114 -0.22482 2.06417 0.10893 3.06417
+0.0634531 0.366784 0.416579 0.0693593 1.06345 0.0792473 -0.197425 2.06345 0.105614 3.06345
+0.0587705 0.296151 0.45007 0.0422574 1.05877 0.035558 -0.153894 2.05877 0.142764 3.05877
+0.0502439 0.0493904 0.438835 0.459184 1.05024 -0.0850135 0.509794 2.05024 -0.277534 3.05024
+0.0664301 0.40534 0.44558 0.0433468 1.06643 0.091275 -0.261993 2.06643 0.140327 3.06643
+0.0619365 0.345492 -6.2474e-10 0.0532917 1.06194 0.172746 -0.1922 2.06194 -0.0032917 3.06194
+0.0880921 0.617188 0.0653445 0.187817 1.08809 0.292258 -0.329371 2.08809 -0.118214 3.08809
+0.070556 0.453387 0.251964 0.117177 1.07056 0.163702 -0.23621 2.07056 0.0084122 3.07056
+0.0579273 0.281554 0.407643 0.100162 1.05793 0.0388663 -0.081392 2.05793 0.0721309 3.05793
+0.0525172 0.158658 0.415867 0.397983 1.05252 -0.0246377 0.339325 2.05252 -0.223223 3.05252
+0.0845128 0.587476 0.331862 0.003142 1.08451 0.210773 -0.484334 2.08451 0.146417 3.08451
+0.053712 0.192666 0.453757 0.0259587 1.05371 -0.0171063 -0.0667073 2.05371 0.160168 3.05371
+0.0913024 0.642669 0.122915 0.00288264 1.0913 0.290606 -0.539786 2.0913 0.0839919 3.0913
+0.0642259 0.377172 0.458601 0.000729167 1.06423 0.0739358 -0.276443 2.06423 0.186851 3.06423
+0.0614501 0.33838 0.464179 0.000303333 1.06145 0.0531453 -0.238077 2.06145 0.18895 3.06145
+0.0507952 0.089173 0.500023 0.0121567 1.0508 -0.0804192 0.0229837 2.0508 0.18785 3.0508
+0.0539999 0.199997 5.11147e-07 0.270298 1.054 0.0999984 0.170301 2.054 -0.220298 3.054
+0.0757036 0.506987 0.255266 0.0306606 1.0757 0.189677 -0.376326 2.0757 0.0959192 3.0757
+0.059 0.3 0.0867798 0.25 1.059 0.128305 0.05 2.059 -0.173966 3.059
+0.0614792 0.338809 0.262045 0.0152862 1.06148 0.103893 -0.223523 2.06148 0.113327 3.06148
+0.0511124 0.105471 0.499981 0.00294534 1.05111 -0.0722598 -0.00252566 2.05111 0.197049 3.05111
+0.0520188 0.142084 0.372898 0.530244 1.05202 -0.0221825 0.48816 2.05202 -0.368375 3.05202
+0.0669075 0.411187 0.414883 0.000439926 1.06691 0.101873 -0.310747 2.06691 0.174025 3.06691
+0.0660968 0.401208 0.255564 0.00828203 1.0661 0.136713 -0.292926 2.0661 0.118387 3.0661
+0.0616225 0.340918 0.367126 0.0843182 1.06162 0.0786775 -0.1566 2.06162 0.0758196 3.06162
+0.0670153 0.412496 0.312973 0.117452 1.06702 0.128005 -0.195044 2.06702 0.0264399 3.06702
+0.0619961 0.346353 0.420405 0.0777128 1.062 0.0680753 -0.16864 2.062 0.0984087 3.062
+0.05 -1.84314e-17 0.4 0 1.05 -0.1 0.1 2.05 0.17 3.05
+0.0572432 0.269131 0.446688 0.00402994 1.05724 0.0228935 -0.165101 2.05724 0.179976 3.05724
+0.0633004 0.364698 0.426791 0.0590224 1.0633 0.0756513 -0.205676 2.0633 0.119015 3.0633
+0.0690744 0.436743 0.474551 0.0827512 1.06907 0.0997337 -0.253992 2.06907 0.109614 3.06907
+0.0512006 0.109571 0.215883 0.0763985 1.0512 0.00081475 0.0668275 2.0512 0.0383664 3.0512
+
+End
@@ -0,0 +1,144 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_adja.c
+ * \brief Compare the replicated adjacency with the one hashed by Mmg.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_adja file.mesh nx ny nz renum [axes]
+ *
+ * The mesh is replicated twice by \a MIRRORMESH_mirrorlib (translated instead
+ * of mirrored along the optional \a axes, e.g. xz): with \a
+ * MIRRORMESH_IPARAM_adja set, the adjacency is replicated from the base one,
+ * otherwise it is built by \a MMG3D_hashTetra on the replicated mesh. The
+ * two adjacency arrays must be equal.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmg/mmg3d/libmmg3d.h"
+#include "mirrormesh/libmirrormesh.h"
+
+/**
+ * \param a mesh whose adjacency is replicated
+ * \param b mesh whose adjacency is hashed
+ *
+ * \return 1 if the adjacency arrays are equal, 0 otherwise.
+ *
+ */
+static int ADJA_compare(MMG5_pMesh a,MMG5_pMesh b) {
+  int k,i,iadr,nbdy,ndiff;
+
+  if ( a->ne != b->ne ) {
+    fprintf(stderr,"  ## Error: %d / %d tetra.\n",a->ne,b->ne);
+    return 0;
+  }
+  if ( !a->adja || !b->adja ) {
+    fprintf(stderr,"  ## Error: missing adjacency.\n");
+    return 0;
+  }
+
+  nbdy = ndiff = 0;
+  for ( k=1; k<=a->ne; ++k ) {
+    iadr = 4*(k-1)+1;
+    for ( i=0; i<4; ++i ) {
+      if ( !b->adja[iadr+i] ) ++nbdy;
+      if ( a->adja[iadr+i] == b->adja[iadr+i] ) continue;
+      if ( !ndiff ) {
+        fprintf(stderr,"  ## Error: face %d of tetra %d: adjacent %d, %d"
+                " expected.\n",i,k,a->adja[iadr+i],b->adja[iadr+i]);
+      }
+      ++ndiff;
+    }
+  }
+  if ( ndiff ) {
+    fprintf(stderr,"  ## Error: %d faces differ.\n",ndiff);
+    return 0;
+  }
+  fprintf(stdout,"  %d tetra, %d boundary faces: same adjacency.\n",
+          a->ne,nbdy);
+
+  return 1;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mesh[2];
+  MIRRORMESH_Info info;
+  const char      *axes;
+  int             i,j,ier;
+
+  if ( argc != 6 && argc != 7 ) {
+    fprintf(stderr,"Usage: %s file.mesh nx ny nz renum [axes]\n",argv[0]);
+    return EXIT_FAILURE;
+  }
+  axes = argc > 6 ? argv[6] : "";
+
+  ier     = 1;
+  mesh[0] = mesh[1] = NULL;
+  for ( i=0; i<2; ++i ) {
+    MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh[i],MMG5_ARG_end);
+    if ( !MMG3D_Set_iparameter(mesh[i],NULL,MMG3D_IPARAM_verbose,-1) )
+      return EXIT_FAILURE;
+
+    MIRRORMESH_Init_parameters(&info);
+    if ( !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nx,atoi(argv[2])) ||
+         !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_ny,atoi(argv[3])) ||
+         !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nz,atoi(argv[4])) ||
+         !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_renum,atoi(argv[5])) ||
+         !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_adja,!i) )
+      return EXIT_FAILURE;
+    for ( j=0; axes[j]; ++j ) {
+      if ( axes[j] < 'x' || axes[j] > 'z' ||
+           !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_modex+axes[j]-'x',
+                                      MIRRORMESH_TRANSLATE) )
+        return EXIT_FAILURE;
+    }
+
+    if ( MMG3D_loadMesh(mesh[i],argv[1]) != 1 ) {
+      fprintf(stderr,"  ## Error: unable to load %s.\n",argv[1]);
+      ier = 0;
+      break;
+    }
+    if ( MIRRORMESH_mirrorlib(mesh[i],&info) != MMG5_SUCCESS ) {
+      fprintf(stderr,"  ## Error: unable to replicate %s.\n",argv[1]);
+      ier = 0;
+      break;
+    }
+  }
+
+  if ( ier ) {
+    ier = MMG3D_hashTetra(mesh[1],0) && ADJA_compare(mesh[0],mesh[1]);
+  }
+
+  for ( i=0; i<2; ++i ) {
+    if ( mesh[i] ) {
+      MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh[i],MMG5_ARG_end);
+    }
+  }
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,265 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_arrays.c
+ * \brief Compare the replication of arrays with the one of a Mmg mesh.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_arrays file.mesh nx ny nz renum
+ *
+ * The mesh is given as arrays (entity by entity, 32-bit indices) to \a
+ * MIRRORMESH_Init_latticeArrays and the replicated mesh is got back by \a
+ * MIRRORMESH_Get_latticeArrays (component by component, 64-bit indices) and
+ * by the random access functions. It must be the mesh replicated by \a
+ * MIRRORMESH_mirrorlib.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "mmg/mmg3d/libmmg3d.h"
+#include "mirrormesh/libmirrormesh.h"
+
+/** Position of the component \a i of the entity \a k (from 0) in an array of
+ * \a n entities stored component by component */
+#define ARRAYS_SOA(n,k,i) ((int64_t)(i)*(n)+(k))
+
+/** Report a difference of the entity \a k of type \a name */
+static int ARRAYS_diff(const char *name,int64_t k) {
+  fprintf(stderr,"  ## Error: %s %" PRId64 " differs between the two"
+          " replications.\n",name,k);
+  return 0;
+}
+
+/** Replicated mesh got back from the lattice */
+typedef struct {
+  MIRRORMESH_int np,ne,nt,na;
+  double         *vertices;
+  int64_t        *tetra,*tria,*edges;
+  int            *vrefs,*erefs,*trefs,*arefs;
+} ARRAYS_Mesh;
+
+/**
+ * \param mesh mesh loaded by Mmg
+ * \param info mirrormesh parameters
+ * \param out computed replicated mesh
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Give the mesh to the lattice as arrays and get the replicated mesh back.
+ *
+ */
+static int ARRAYS_replicate(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                            ARRAYS_Mesh *out) {
+  MIRRORMESH_pLattice lattice;
+  double              *vertices;
+  int32_t             *tetra,*tria,*edges;
+  int                 *vrefs,*erefs,*trefs,*arefs;
+  MIRRORMESH_int      k,v[4];
+  int                 i,ref,ier;
+
+  vertices = malloc(3*(size_t)mesh->np*sizeof(double));
+  vrefs    = malloc((size_t)mesh->np*sizeof(int));
+  tetra    = malloc((4*(size_t)mesh->ne+1)*sizeof(int32_t));
+  erefs    = malloc(((size_t)mesh->ne+1)*sizeof(int));
+  tria     = malloc((3*(size_t)mesh->nt+1)*sizeof(int32_t));
+  trefs    = malloc(((size_t)mesh->nt+1)*sizeof(int));
+  edges    = malloc((2*(size_t)mesh->na+1)*sizeof(int32_t));
+  arefs    = malloc(((size_t)mesh->na+1)*sizeof(int));
+  if ( !vertices || !vrefs || !tetra || !erefs || !tria || !trefs || !edges ||
+       !arefs ) {
+    ier = 0;
+    goto fail;
+  }
+
+  for ( k=0; k<mesh->np; ++k ) {
+    memcpy(&vertices[3*k],mesh->point[k+1].c,3*sizeof(double));
+    vrefs[k] = mesh->point[k+1].ref;
+  }
+  for ( k=0; k<mesh->ne; ++k ) {
+    for ( i=0; i<4; ++i ) tetra[4*k+i] = mesh->tetra[k+1].v[i];
+    erefs[k] = mesh->tetra[k+1].ref;
+  }
+  for ( k=0; k<mesh->nt; ++k ) {
+    for ( i=0; i<3; ++i ) tria[3*k+i] = mesh->tria[k+1].v[i];
+    trefs[k] = mesh->tria[k+1].ref;
+  }
+  for ( k=0; k<mesh->na; ++k ) {
+    edges[2*k]   = mesh->edge[k+1].a;
+    edges[2*k+1] = mesh->edge[k+1].b;
+    arefs[k]     = mesh->edge[k+1].ref;
+  }
+
+  ier = MIRRORMESH_Init_latticeArrays(info,MIRRORMESH_AOS,MIRRORMESH_INDEX32,
+                                      mesh->np,vertices,vrefs,
+                                      mesh->ne,tetra,erefs,mesh->nt,tria,trefs,
+                                      mesh->na,edges,arefs,&lattice);
+  if ( !ier ) goto fail;
+
+  MIRRORMESH_Get_latticeSize(lattice,&out->np,&out->ne,&out->nt,&out->na);
+  out->vertices = malloc(3*(size_t)out->np*sizeof(double));
+  out->vrefs    = malloc((size_t)out->np*sizeof(int));
+  out->tetra    = malloc((4*(size_t)out->ne+1)*sizeof(int64_t));
+  out->erefs    = malloc(((size_t)out->ne+1)*sizeof(int));
+  out->tria     = malloc((3*(size_t)out->nt+1)*sizeof(int64_t));
+  out->trefs    = malloc(((size_t)out->nt+1)*sizeof(int));
+  out->edges    = malloc((2*(size_t)out->na+1)*sizeof(int64_t));
+  out->arefs    = malloc(((size_t)out->na+1)*sizeof(int));
+  ier = out->vertices && out->vrefs && out->tetra && out->erefs && out->tria &&
+    out->trefs && out->edges && out->arefs &&
+    MIRRORMESH_Get_latticeArrays(lattice,MIRRORMESH_SOA,MIRRORMESH_INDEX64,
+                                 out->vertices,out->vrefs,out->tetra,
+                                 out->erefs,out->tria,out->trefs,
+                                 out->edges,out->arefs);
+
+  /* Random access to the tetra: same as the arrays */
+  for ( k=1; ier && k<=out->ne; ++k ) {
+    ier = MIRRORMESH_Get_latticeTetrahedron(lattice,k,&v[0],&v[1],&v[2],&v[3],
+                                            &ref);
+    for ( i=0; ier && i<4; ++i ) {
+      if ( v[i] != out->tetra[ARRAYS_SOA(out->ne,k-1,i)] ) ier = 0;
+    }
+    if ( ier && ref != out->erefs[k-1] ) ier = 0;
+    if ( !ier ) ARRAYS_diff("random access tetrahedron",k);
+  }
+
+  MIRRORMESH_Free_lattice(&lattice);
+
+fail:
+  free(vertices); free(vrefs);
+  free(tetra);    free(erefs);
+  free(tria);     free(trefs);
+  free(edges);    free(arefs);
+
+  return ier;
+}
+
+/**
+ * \param a replicated mesh got from the lattice
+ * \param b mesh replicated by \a MIRRORMESH_mirrorlib
+ *
+ * \return 1 if the meshes are equal, 0 otherwise.
+ *
+ */
+static int ARRAYS_compare(ARRAYS_Mesh *a,MMG5_pMesh b) {
+  MIRRORMESH_int k;
+  int            i;
+
+  if ( a->np != b->np || a->ne != b->ne || a->nt != b->nt || a->na != b->na ) {
+    fprintf(stderr,"  ## Error: sizes differ: %" PRId64 " %" PRId64 " %"
+            PRId64 " %" PRId64 " / %d %d %d %d.\n",a->np,a->ne,a->nt,a->na,
+            b->np,b->ne,b->nt,b->na);
+    return 0;
+  }
+
+  for ( k=1; k<=a->np; ++k ) {
+    MMG5_pPoint ppt = &b->point[k];
+    for ( i=0; i<3; ++i ) {
+      if ( a->vertices[ARRAYS_SOA(a->np,k-1,i)] != ppt->c[i] )
+        return ARRAYS_diff("vertex",k);
+    }
+    if ( a->vrefs[k-1] != ppt->ref ) return ARRAYS_diff("vertex",k);
+  }
+  for ( k=1; k<=a->ne; ++k ) {
+    MMG5_pTetra pt = &b->tetra[k];
+    for ( i=0; i<4; ++i ) {
+      if ( a->tetra[ARRAYS_SOA(a->ne,k-1,i)] != pt->v[i] )
+        return ARRAYS_diff("tetrahedron",k);
+    }
+    if ( a->erefs[k-1] != pt->ref ) return ARRAYS_diff("tetrahedron",k);
+  }
+  for ( k=1; k<=a->nt; ++k ) {
+    MMG5_pTria ptt = &b->tria[k];
+    for ( i=0; i<3; ++i ) {
+      if ( a->tria[ARRAYS_SOA(a->nt,k-1,i)] != ptt->v[i] )
+        return ARRAYS_diff("triangle",k);
+    }
+    if ( a->trefs[k-1] != ptt->ref ) return ARRAYS_diff("triangle",k);
+  }
+  for ( k=1; k<=a->na; ++k ) {
+    MMG5_pEdge pa = &b->edge[k];
+    if ( a->edges[ARRAYS_SOA(a->na,k-1,0)] != pa->a ||
+         a->edges[ARRAYS_SOA(a->na,k-1,1)] != pa->b ||
+         a->arefs[k-1] != pa->ref ) return ARRAYS_diff("edge",k);
+  }
+  fprintf(stdout,"  %" PRId64 " vertices, %" PRId64 " tetra: same mesh.\n",
+          a->np,a->ne);
+
+  return 1;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mesh;
+  MIRRORMESH_Info info;
+  ARRAYS_Mesh     out;
+  int             ier;
+
+  if ( argc != 6 ) {
+    fprintf(stderr,"Usage: %s file.mesh nx ny nz renum\n",argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  MIRRORMESH_Init_parameters(&info);
+  if ( !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nx,atoi(argv[2])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_ny,atoi(argv[3])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nz,atoi(argv[4])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_renum,atoi(argv[5])) )
+    return EXIT_FAILURE;
+
+  mesh = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+  if ( !MMG3D_Set_iparameter(mesh,NULL,MMG3D_IPARAM_verbose,-1) )
+    return EXIT_FAILURE;
+
+  memset(&out,0,sizeof(ARRAYS_Mesh));
+  ier = MMG3D_loadMesh(mesh,argv[1]) == 1;
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: unable to load %s.\n",argv[1]);
+  }
+  else {
+    /* Arrays first: the replication of the Mmg mesh is done in place */
+    ier = ARRAYS_replicate(mesh,&info,&out);
+    if ( !ier ) {
+      fprintf(stderr,"  ## Error: unable to replicate the arrays.\n");
+    }
+    else if ( MIRRORMESH_mirrorlib(mesh,&info) != MMG5_SUCCESS ) {
+      fprintf(stderr,"  ## Error: unable to replicate %s.\n",argv[1]);
+      ier = 0;
+    }
+    else {
+      ier = ARRAYS_compare(&out,mesh);
+    }
+  }
+
+  free(out.vertices); free(out.vrefs);
+  free(out.tetra);    free(out.erefs);
+  free(out.tria);     free(out.trefs);
+  free(out.edges);    free(out.arefs);
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
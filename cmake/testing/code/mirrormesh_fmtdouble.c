@@ -0,0 +1,105 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_fmtdouble.c
+ * \brief Round trip of the reals formatted by the Medit writers.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_fmtdouble [n]
+ *
+ * The limit cases of the double precision and \a n (1000000 by default)
+ * random reals, drawn uniformly among the bit patterns of the finite
+ * doubles, are formatted by \a MIRRORMESH_fmtDouble: the string must fit in
+ * \ref MIRRORMESH_DBLLEN characters and be read back as the same value (same
+ * bits, so the sign of zero is kept).
+ *
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mirrormesh.h"
+
+/**
+ * \param val real to format
+ *
+ * \return 1 if the formatted real is read back as \a val, 0 otherwise.
+ *
+ */
+static int FMT_check(double val) {
+  char   buf[MIRRORMESH_DBLLEN+1];
+  double back;
+  int    len;
+
+  len = MIRRORMESH_fmtDouble(buf,val);
+  if ( len <= 0 || len >= MIRRORMESH_DBLLEN ) {
+    fprintf(stderr,"  ## Error: %.17g formatted on %d characters.\n",val,len);
+    return 0;
+  }
+  buf[len] = '\0';
+
+  back = strtod(buf,NULL);
+  if ( memcmp(&back,&val,sizeof(double)) ) {
+    fprintf(stderr,"  ## Error: %.17g formatted as %s, read back as %.17g.\n",
+            val,buf,back);
+    return 0;
+  }
+  return 1;
+}
+
+int main(int argc,char *argv[]) {
+  static const double lim[] = {
+    5e-324, -5e-324, 2.2250738585072014e-308, 2.2250738585072009e-308,
+    1.7976931348623157e308, -1.7976931348623157e308, 0., -0., 1e15, 1e16,
+    1e-5, 1e-4, 123456789012345., 0.1, 1./3., 9007199254740993.
+  };
+  uint64_t state,bits;
+  double   val;
+  long     n,k;
+  int      nerr;
+
+  n = argc > 1 ? atol(argv[1]) : 1000000;
+
+  nerr = 0;
+  for ( k=0; k<(long)(sizeof(lim)/sizeof(lim[0])); ++k ) {
+    nerr += !FMT_check(lim[k]);
+  }
+
+  /* xorshift64* generator, with a fixed seed so a failure can be replayed */
+  state = 0x9E3779B97F4A7C15ULL;
+  for ( k=0; k<n && nerr<10; ++k ) {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    bits = state * 0x2545F4914F6CDD1DULL;
+    memcpy(&val,&bits,sizeof(double));
+    if ( !isfinite(val) ) continue;
+    nerr += !FMT_check(val);
+  }
+
+  return nerr ? EXIT_FAILURE : EXIT_SUCCESS;
+}
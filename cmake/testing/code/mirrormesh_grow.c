@@ -0,0 +1,204 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_grow.c
+ * \brief Check a replicated mesh extended from a previous one.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_grow base.mesh previous.mesh grown.mesh nx0 ny0 nz0
+ *        nx ny nz out.mesh
+ *
+ * \a grown.mesh extends \a previous.mesh, a replication of \a base.mesh with
+ * \a nx0, \a ny0 and \a nz0 mirrors, to \a nx, \a ny and \a nz mirrors (\a
+ * -grow option):
+ *  - the vertices and the tetrahedra of \a previous.mesh must be the first
+ *    ones of \a grown.mesh, unchanged;
+ *  - \a grown.mesh must be the mesh written by \a MIRRORMESH_saveLattice in
+ *    \a out.mesh for the same replication declared as extending the previous
+ *    one by \a MIRRORMESH_Add_stage, the base mesh being read with its
+ *    tangents by \a MIRRORMESH_loadMesh as by the application.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmg/mmg3d/libmmg3d.h"
+#include "mirrormesh/libmirrormesh.h"
+
+/**
+ * \param f file
+ * \param kw keyword of the section
+ *
+ * \return the number of entities of the section, -1 if not found.
+ *
+ * Find the section \a kw of a Medit ASCII file: the file is positioned at the
+ * first line of entities.
+ *
+ */
+static long GROW_section(FILE *f,const char *kw) {
+  char line[256];
+  long n;
+
+  rewind(f);
+  while ( fgets(line,sizeof(line),f) ) {
+    line[strcspn(line,"\r\n")] = '\0';
+    if ( strcmp(line,kw) ) continue;
+    if ( fscanf(f,"%ld",&n) != 1 || !fgets(line,sizeof(line),f) ) return -1;
+    return n;
+  }
+  return -1;
+}
+
+/**
+ * \param prevname previous replicated mesh
+ * \param grownname extended replicated mesh
+ * \param kw keyword of the section
+ *
+ * \return 1 if the entities of the section \a kw of the previous mesh are the
+ * first ones of the extended mesh, 0 otherwise.
+ *
+ */
+static int GROW_prefix(const char *prevname,const char *grownname,
+                       const char *kw) {
+  FILE *f[2];
+  char line[2][256];
+  long n[2],l;
+  int  ier;
+
+  f[0] = fopen(prevname,"r");
+  f[1] = fopen(grownname,"r");
+  ier  = f[0] && f[1];
+  if ( ier ) {
+    n[0] = GROW_section(f[0],kw);
+    n[1] = GROW_section(f[1],kw);
+    ier  = n[0] > 0 && n[1] > n[0];
+    if ( !ier ) {
+      fprintf(stderr,"  ## Error: %s: %ld entities in %s, %ld in %s.\n",kw,
+              n[0],prevname,n[1],grownname);
+    }
+  }
+  for ( l=0; ier && l<n[0]; ++l ) {
+    ier = fgets(line[0],sizeof(line[0]),f[0]) &&
+      fgets(line[1],sizeof(line[1]),f[1]) && !strcmp(line[0],line[1]);
+    if ( !ier ) {
+      fprintf(stderr,"  ## Error: %s: entity %ld of %s changed in %s.\n",kw,
+              l+1,prevname,grownname);
+    }
+  }
+  if ( f[0] ) fclose(f[0]);
+  if ( f[1] ) fclose(f[1]);
+
+  if ( ier ) {
+    fprintf(stdout,"  %s: the %ld entities of %s are the first %ld ones of"
+            " %s.\n",kw,n[0],prevname,n[1],grownname);
+  }
+  return ier;
+}
+
+/**
+ * \param name0 first file
+ * \param name1 second file
+ *
+ * \return 1 if the files are equal, 0 otherwise.
+ *
+ */
+static int GROW_compare(const char *name0,const char *name1) {
+  FILE *f0,*f1;
+  long l;
+  int  c0,c1;
+
+  f0 = fopen(name0,"rb");
+  f1 = fopen(name1,"rb");
+  c0 = c1 = 0;
+  l  = 0;
+  if ( f0 && f1 ) {
+    do {
+      c0 = getc(f0);
+      c1 = getc(f1);
+      ++l;
+    } while ( c0 == c1 && c0 != EOF );
+  }
+  if ( f0 ) fclose(f0);
+  if ( f1 ) fclose(f1);
+
+  if ( !f0 || !f1 || c0 != c1 ) {
+    fprintf(stderr,"  ## Error: %s and %s differ (byte %ld).\n",name0,name1,l);
+    return 0;
+  }
+  return 1;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh          mesh;
+  MIRRORMESH_pLattice lattice;
+  MIRRORMESH_Info     info;
+  int                 nmir0[3],nmir[3],i,ier;
+
+  if ( argc != 11 ) {
+    fprintf(stderr,"Usage: %s base.mesh previous.mesh grown.mesh nx0 ny0 nz0"
+            " nx ny nz out.mesh\n",argv[0]);
+    return EXIT_FAILURE;
+  }
+  for ( i=0; i<3; ++i ) {
+    nmir0[i] = atoi(argv[4+i]);
+    nmir[i]  = atoi(argv[7+i]);
+  }
+
+  /* Previous entities kept in place */
+  ier = GROW_prefix(argv[2],argv[3],"Vertices") &&
+    GROW_prefix(argv[2],argv[3],"Tetrahedra");
+
+  /* Same replication written at once */
+  mesh    = NULL;
+  lattice = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+  MIRRORMESH_Init_parameters(&info);
+  if ( !MMG3D_Set_iparameter(mesh,NULL,MMG3D_IPARAM_verbose,-1) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nx,nmir[0]) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_ny,nmir[1]) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nz,nmir[2]) ||
+       !MIRRORMESH_Add_stage(&info,nmir0[0],nmir0[1],nmir0[2]) ) {
+    ier = 0;
+  }
+  else if ( MIRRORMESH_loadMesh(mesh,&info,argv[1]) != 1 ) {
+    fprintf(stderr,"  ## Error: unable to load %s.\n",argv[1]);
+    ier = 0;
+  }
+  else if ( !MIRRORMESH_Init_latticeSols(mesh,NULL,NULL,&info,&lattice) ||
+            !MIRRORMESH_saveLattice(lattice,argv[10]) ) {
+    fprintf(stderr,"  ## Error: unable to write %s.\n",argv[10]);
+    ier = 0;
+  }
+  else {
+    ier = GROW_compare(argv[3],argv[10]) && ier;
+  }
+
+  if ( lattice ) MIRRORMESH_Free_lattice(&lattice);
+  MIRRORMESH_Free_tangents(mesh,&info);
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
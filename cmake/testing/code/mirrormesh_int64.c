@@ -0,0 +1,374 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_int64.c
+ * \brief Check the 64-bit variants of the output formats against the 32-bit
+ * ones.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_int64 file.mesh nx ny nz out
+ *
+ * The replicated mesh is written by \a MIRRORMESH_saveLattice at the Medit
+ * (out.mesh) and Gmsh (out.msh) formats, then again (out-64.mesh and
+ * out-64.msh) with \a MIRRORMESH_IPARAM_int32max lowered so that the
+ * variants with 64-bit indices are written: the version 4 of the Medit
+ * format and the version 4.1 of the Gmsh format. The Medit files must only
+ * differ by their version, the Gmsh files must describe the same nodes and
+ * the same elements, with the same numbers and references.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmg/mmg3d/libmmg3d.h"
+#include "mirrormesh/libmirrormesh.h"
+
+/** Element of a Gmsh file */
+typedef struct {
+  int  type,ref;
+  long v[4];
+} INT64_Elt;
+
+/** Nodes and elements of a Gmsh file, indexed by their tags */
+typedef struct {
+  double    *coor;
+  INT64_Elt *elt;
+  long      np,nelt;
+} INT64_Msh;
+
+/* Number of nodes of the Gmsh elements written (points, edges, triangles and
+ * tetra) */
+static int INT64_nv(int type) {
+  switch ( type ) {
+  case 15: return 1;
+  case 1:  return 2;
+  case 2:  return 3;
+  case 4:  return 4;
+  }
+  return -1;
+}
+
+/**
+ * \param f file
+ * \param kw section keyword
+ *
+ * \return 1 if the section \a kw is found, the file being positioned after
+ * its keyword, 0 otherwise.
+ *
+ */
+static int INT64_section(FILE *f,const char *kw) {
+  char word[64];
+
+  while ( fscanf(f,"%63s",word) == 1 ) {
+    if ( !strcmp(word,kw) ) return 1;
+  }
+  return 0;
+}
+
+/**
+ * \param msh mesh to fill
+ * \param n number of elements
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ */
+static int INT64_allocElt(INT64_Msh *msh,long n) {
+  msh->nelt = n;
+  msh->elt  = (INT64_Elt*)calloc(n+1,sizeof(INT64_Elt));
+  return msh->elt != NULL;
+}
+
+/**
+ * \param filename name of the Gmsh file
+ * \param msh mesh to fill
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the nodes and the elements of a Gmsh ASCII file written by mirrormesh,
+ * at the version 2.2 or 4.1.
+ *
+ */
+static int INT64_loadMsh(const char *filename,INT64_Msh *msh) {
+  FILE   *f;
+  double version;
+  long   n,nblk,b,nb,k,id,*tag = NULL;
+  int    ref[4][64],nref[4],dim,etag,type,nv,i,j,ntag,ier;
+
+  memset(msh,0,sizeof(INT64_Msh));
+  if ( !(f = fopen(filename,"r")) ) {
+    fprintf(stderr,"  ## Error: unable to open %s.\n",filename);
+    return 0;
+  }
+
+  ier = INT64_section(f,"$MeshFormat") && fscanf(f,"%lf",&version) == 1;
+
+  if ( ier && version > 4. ) {
+    /* Physical tag of each entity */
+    ier = INT64_section(f,"$Entities") &&
+      fscanf(f,"%d %d %d %d",&nref[0],&nref[1],&nref[2],&nref[3]) == 4;
+    for ( dim=0; ier && dim<4; ++dim ) {
+      ier = nref[dim] <= 64;
+      for ( i=0; ier && i<nref[dim]; ++i ) {
+        double c;
+        ier = fscanf(f,"%d",&etag) == 1 && etag == i+1;
+        for ( j=0; ier && j<(dim ? 6 : 3); ++j ) {
+          ier = fscanf(f,"%lf",&c) == 1;
+        }
+        ier = ier && fscanf(f,"%d %d",&ntag,&ref[dim][i]) == 2 && ntag == 1;
+        ier = ier && ( !dim || fscanf(f,"%d",&ntag) == 1 );
+      }
+    }
+
+    /* Nodes: tags then coordinates of each block */
+    ier = ier && INT64_section(f,"$Nodes") &&
+      fscanf(f,"%ld %ld %*d %*d",&nblk,&msh->np) == 2 &&
+      (msh->coor = (double*)calloc(3*(msh->np+1),sizeof(double))) &&
+      (tag = (long*)malloc((msh->np+1)*sizeof(long)));
+    for ( b=0; ier && b<nblk; ++b ) {
+      ier = fscanf(f,"%*d %*d %*d %ld",&nb) == 1 && nb <= msh->np;
+      for ( k=0; ier && k<nb; ++k ) {
+        ier = fscanf(f,"%ld",&tag[k]) == 1 && tag[k] >= 1 && tag[k] <= msh->np;
+      }
+      for ( k=0; ier && k<nb; ++k ) {
+        ier = fscanf(f,"%lf %lf %lf",&msh->coor[3*tag[k]],
+                     &msh->coor[3*tag[k]+1],&msh->coor[3*tag[k]+2]) == 3;
+      }
+    }
+    free(tag);
+
+    /* Elements: blocks of a type and an entity */
+    ier = ier && INT64_section(f,"$Elements") &&
+      fscanf(f,"%ld %ld %*d %*d",&nblk,&n) == 2 && INT64_allocElt(msh,n);
+    for ( b=0; ier && b<nblk; ++b ) {
+      ier = fscanf(f,"%d %d %d %ld",&dim,&etag,&type,&nb) == 4 &&
+        dim >= 0 && dim < 4 && etag >= 1 && etag <= nref[dim] &&
+        (nv = INT64_nv(type)) > 0;
+      for ( k=0; ier && k<nb; ++k ) {
+        ier = fscanf(f,"%ld",&id) == 1 && id >= 1 && id <= msh->nelt;
+        if ( !ier ) break;
+        msh->elt[id].type = type;
+        msh->elt[id].ref  = ref[dim][etag-1];
+        for ( i=0; ier && i<nv; ++i ) {
+          ier = fscanf(f,"%ld",&msh->elt[id].v[i]) == 1;
+        }
+      }
+    }
+  }
+  else if ( ier ) {
+    /* Nodes */
+    ier = INT64_section(f,"$Nodes") && fscanf(f,"%ld",&msh->np) == 1 &&
+      (msh->coor = (double*)calloc(3*(msh->np+1),sizeof(double)));
+    for ( k=0; ier && k<msh->np; ++k ) {
+      ier = fscanf(f,"%ld",&id) == 1 && id >= 1 && id <= msh->np &&
+        fscanf(f,"%lf %lf %lf",&msh->coor[3*id],&msh->coor[3*id+1],
+               &msh->coor[3*id+2]) == 3;
+    }
+
+    /* Elements: number, type, tags (physical one first) and nodes */
+    ier = ier && INT64_section(f,"$Elements") && fscanf(f,"%ld",&n) == 1 &&
+      INT64_allocElt(msh,n);
+    for ( k=0; ier && k<msh->nelt; ++k ) {
+      ier = fscanf(f,"%ld %d %d",&id,&type,&ntag) == 3 && id >= 1 &&
+        id <= msh->nelt && ntag >= 1 && (nv = INT64_nv(type)) > 0 &&
+        fscanf(f,"%d",&msh->elt[id].ref) == 1;
+      for ( i=1; ier && i<ntag; ++i ) {
+        ier = fscanf(f,"%*d") == 0;
+      }
+      if ( !ier ) break;
+      msh->elt[id].type = type;
+      for ( i=0; ier && i<nv; ++i ) {
+        ier = fscanf(f,"%ld",&msh->elt[id].v[i]) == 1;
+      }
+    }
+  }
+  fclose(f);
+
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: unable to read %s.\n",filename);
+  }
+  return ier;
+}
+
+/**
+ * \param name32 file at the 32-bit variant of the format
+ * \param name64 file at the 64-bit variant of the format
+ *
+ * \return 1 if both Gmsh files describe the same mesh, 0 otherwise.
+ *
+ */
+static int INT64_compareMsh(const char *name32,const char *name64) {
+  INT64_Msh msh[2];
+  long      k;
+  int       ier;
+
+  ier = INT64_loadMsh(name32,&msh[0]);
+  ier = INT64_loadMsh(name64,&msh[1]) && ier;
+
+  if ( ier && (msh[0].np != msh[1].np || msh[0].nelt != msh[1].nelt) ) {
+    fprintf(stderr,"  ## Error: %ld nodes and %ld elements in %s, %ld and"
+            " %ld in %s.\n",msh[0].np,msh[0].nelt,name32,msh[1].np,
+            msh[1].nelt,name64);
+    ier = 0;
+  }
+  if ( ier && memcmp(msh[0].coor,msh[1].coor,
+                     3*(msh[0].np+1)*sizeof(double)) ) {
+    fprintf(stderr,"  ## Error: nodes of %s and %s differ.\n",name32,name64);
+    ier = 0;
+  }
+  for ( k=1; ier && k<=msh[0].nelt; ++k ) {
+    if ( !msh[0].elt[k].type ||
+         memcmp(&msh[0].elt[k],&msh[1].elt[k],sizeof(INT64_Elt)) ) {
+      fprintf(stderr,"  ## Error: element %ld of %s and %s differ.\n",k,
+              name32,name64);
+      ier = 0;
+    }
+  }
+  if ( ier ) {
+    fprintf(stdout,"  %s and %s: %ld nodes, %ld elements.\n",name32,name64,
+            msh[0].np,msh[0].nelt);
+  }
+
+  for ( k=0; k<2; ++k ) {
+    free(msh[k].coor);
+    free(msh[k].elt);
+  }
+  return ier;
+}
+
+/**
+ * \param name32 file at the version 2
+ * \param name64 file at the version 4
+ *
+ * \return 1 if both Medit files only differ by their version, 0 otherwise.
+ *
+ */
+static int INT64_compareMedit(const char *name32,const char *name64) {
+  FILE *f[2];
+  char line[2][256];
+  long l;
+  int  ier,eof[2];
+
+  f[0] = fopen(name32,"r");
+  f[1] = fopen(name64,"r");
+  ier  = f[0] && f[1] &&
+    fgets(line[0],sizeof(line[0]),f[0]) && fgets(line[1],sizeof(line[1]),f[1])
+    && !strcmp(line[0],"MeshVersionFormatted 2\n")
+    && !strcmp(line[1],"MeshVersionFormatted 4\n");
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: %s and %s are not at the versions 2 and 4 of"
+            " the Medit format.\n",name32,name64);
+  }
+
+  for ( l=2; ier; ++l ) {
+    eof[0] = !fgets(line[0],sizeof(line[0]),f[0]);
+    eof[1] = !fgets(line[1],sizeof(line[1]),f[1]);
+    if ( eof[0] || eof[1] ) {
+      ier = eof[0] && eof[1];
+      break;
+    }
+    ier = !strcmp(line[0],line[1]);
+  }
+  if ( f[0] ) fclose(f[0]);
+  if ( f[1] ) fclose(f[1]);
+
+  if ( ier ) {
+    fprintf(stdout,"  %s and %s: same mesh.\n",name32,name64);
+  }
+  else if ( l > 2 ) {
+    fprintf(stderr,"  ## Error: %s and %s differ (line %ld).\n",name32,
+            name64,l-1);
+  }
+  return ier;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh          mesh;
+  MIRRORMESH_pLattice lattice;
+  MIRRORMESH_Info     info;
+  char                *name[2][2];
+  int                 i,j,ier;
+
+  if ( argc != 6 ) {
+    fprintf(stderr,"Usage: %s file.mesh nx ny nz out\n",argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  MIRRORMESH_Init_parameters(&info);
+  if ( !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nx,atoi(argv[2])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_ny,atoi(argv[3])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nz,atoi(argv[4])) )
+    return EXIT_FAILURE;
+
+  /* name[i][j]: Medit (j=0) or Gmsh (j=1) file, 32-bit (i=0) or 64-bit (i=1)
+   * variant */
+  ier = 1;
+  for ( i=0; i<2; ++i ) {
+    for ( j=0; j<2; ++j ) {
+      name[i][j] = (char*)malloc(strlen(argv[5])+10);
+      if ( !name[i][j] ) return EXIT_FAILURE;
+      sprintf(name[i][j],"%s%s.%s",argv[5],i ? "-64" : "",j ? "msh" : "mesh");
+    }
+  }
+
+  mesh = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+  if ( !MMG3D_Set_iparameter(mesh,NULL,MMG3D_IPARAM_verbose,-1) ||
+       MMG3D_loadMesh(mesh,argv[1]) != 1 ) {
+    fprintf(stderr,"  ## Error: unable to load %s.\n",argv[1]);
+    ier = 0;
+  }
+
+  /* The 64-bit variants are written beyond one entity */
+  for ( i=0; ier && i<2; ++i ) {
+    lattice = NULL;
+    if ( !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_int32max,i) ||
+         !MIRRORMESH_Init_latticeSols(mesh,NULL,NULL,&info,&lattice) ) {
+      ier = 0;
+      break;
+    }
+    for ( j=0; ier && j<2; ++j ) {
+      if ( !MIRRORMESH_saveLattice(lattice,name[i][j]) ) {
+        fprintf(stderr,"  ## Error: unable to write %s.\n",name[i][j]);
+        ier = 0;
+      }
+    }
+    MIRRORMESH_Free_lattice(&lattice);
+  }
+
+  if ( ier ) {
+    ier = INT64_compareMedit(name[0][0],name[1][0]);
+    ier = INT64_compareMsh(name[0][1],name[1][1]) && ier;
+  }
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+  for ( i=0; i<2; ++i ) {
+    for ( j=0; j<2; ++j ) {
+      free(name[i][j]);
+    }
+  }
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,224 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_load.c
+ * \brief Compare the parallel Medit reader with the Mmg one.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_load file.mesh nthreads
+ *
+ * The mesh is loaded by \a MIRRORMESH_loadMesh with \a nthreads threads and
+ * by \a MMG3D_loadMesh: the two meshes must have the same entities,
+ * references, tags and normals. The tangents, that Mmg doesn't keep, must be
+ * the ones of the file read with the standard input functions.
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmg/mmg3d/libmmg3d.h"
+#include "mirrormesh/libmirrormesh.h"
+
+/** Report a difference of the entity \a k of type \a name */
+static int LOAD_diff(const char *name,int k) {
+  fprintf(stderr,"  ## Error: %s %d differs between the two readers.\n",
+          name,k);
+  return 0;
+}
+
+/**
+ * \param a mesh loaded by mirrormesh
+ * \param b mesh loaded by Mmg
+ *
+ * \return 1 if the meshes are equal, 0 otherwise.
+ *
+ */
+static int LOAD_compare(MMG5_pMesh a,MMG5_pMesh b) {
+  int k,i;
+
+  if ( a->np != b->np || a->ne != b->ne || a->nt != b->nt || a->na != b->na ) {
+    fprintf(stderr,"  ## Error: sizes differ: %d %d %d %d / %d %d %d %d.\n",
+            a->np,a->ne,a->nt,a->na,b->np,b->ne,b->nt,b->na);
+    return 0;
+  }
+
+  for ( k=1; k<=a->np; ++k ) {
+    MMG5_pPoint pa = &a->point[k], pb = &b->point[k];
+    if ( memcmp(pa->c,pb->c,3*sizeof(double)) ||
+         memcmp(pa->n,pb->n,3*sizeof(double)) ||
+         pa->ref != pb->ref || pa->tag != pb->tag ) return LOAD_diff("vertex",k);
+  }
+  for ( k=1; k<=a->ne; ++k ) {
+    MMG5_pTetra pa = &a->tetra[k], pb = &b->tetra[k];
+    if ( memcmp(pa->v,pb->v,4*sizeof(pa->v[0])) || pa->ref != pb->ref ||
+         pa->tag != pb->tag ) return LOAD_diff("tetra",k);
+  }
+  for ( k=1; k<=a->nt; ++k ) {
+    MMG5_pTria pa = &a->tria[k], pb = &b->tria[k];
+    if ( memcmp(pa->v,pb->v,3*sizeof(pa->v[0])) || pa->ref != pb->ref )
+      return LOAD_diff("triangle",k);
+    for ( i=0; i<3; ++i ) {
+      if ( pa->tag[i] != pb->tag[i] ) return LOAD_diff("triangle",k);
+    }
+  }
+  for ( k=1; k<=a->na; ++k ) {
+    MMG5_pEdge pa = &a->edge[k], pb = &b->edge[k];
+    if ( pa->a != pb->a || pa->b != pb->b || pa->ref != pb->ref ||
+         pa->tag != pb->tag ) return LOAD_diff("edge",k);
+  }
+
+  return 1;
+}
+
+/**
+ * \param f opened Medit file
+ * \param key keyword of the section
+ *
+ * \return the number of entities of the section, 0 if there is none.
+ *
+ * Move \a f after the number of entities of the section \a key.
+ *
+ */
+static int LOAD_section(FILE *f,const char *key) {
+  char tok[128];
+  int  n;
+
+  rewind(f);
+  while ( fscanf(f,"%127s",tok) == 1 ) {
+    if ( !strcmp(tok,key) ) {
+      return fscanf(f,"%d",&n) == 1 ? n : 0;
+    }
+  }
+  return 0;
+}
+
+/**
+ * \param mesh mesh loaded by mirrormesh
+ * \param info parameters holding the tangents read by mirrormesh
+ * \param filename Medit file
+ *
+ * \return 1 if the tangents are the ones of the file, 0 otherwise.
+ *
+ * Read the tangents of the file, normalize them as mirrormesh does and
+ * compare them with the ones read in \a info->tangent.
+ *
+ */
+static int LOAD_tangents(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                         const char *filename) {
+  FILE   *f;
+  double *vec,*u,dd;
+  int    n,nv,k,i,ip,in,ier;
+
+  if ( !(f = fopen(filename,"r")) ) return 0;
+
+  n  = LOAD_section(f,"Tangents");
+  nv = n ? LOAD_section(f,"TangentAtVertices") : 0;
+  if ( !nv ) {
+    fclose(f);
+    if ( info->tangent ) {
+      fprintf(stderr,"  ## Error: tangents read from a file without any.\n");
+      return 0;
+    }
+    return 1;
+  }
+  if ( !info->tangent || info->tangent->np != mesh->np ) {
+    fprintf(stderr,"  ## Error: tangents of the file not read.\n");
+    fclose(f);
+    return 0;
+  }
+
+  vec = (double*)malloc(3*((size_t)n+1)*sizeof(double));
+  if ( !vec ) {
+    fclose(f);
+    return 0;
+  }
+  LOAD_section(f,"Tangents");
+  for ( k=1; k<=n; ++k ) {
+    u = &vec[3*k];
+    if ( fscanf(f,"%lf %lf %lf",&u[0],&u[1],&u[2]) != 3 ) break;
+    dd = u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
+    if ( dd > 1.0e-200 ) {
+      dd = 1.0 / sqrt(dd);
+      for ( i=0; i<3; ++i ) u[i] *= dd;
+    }
+  }
+
+  ier = ( k > n );
+  LOAD_section(f,"TangentAtVertices");
+  for ( k=1; ier && k<=nv; ++k ) {
+    if ( fscanf(f,"%d %d",&ip,&in) != 2 ) {
+      ier = 0;
+      break;
+    }
+    if ( ip < 1 || ip > mesh->np || in < 1 || in > n ) continue;
+    if ( memcmp(&info->tangent->m[3*(size_t)ip],&vec[3*in],3*sizeof(double)) ) {
+      ier = LOAD_diff("tangent",ip);
+    }
+  }
+
+  free(vec);
+  fclose(f);
+  return ier;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mesh[2];
+  MIRRORMESH_Info info;
+  int             i,ier;
+
+  if ( argc != 3 ) {
+    fprintf(stderr,"Usage: %s file.mesh nthreads\n",argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  MIRRORMESH_Init_parameters(&info);
+  if ( !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nthreads,atoi(argv[2])) )
+    return EXIT_FAILURE;
+
+  for ( i=0; i<2; ++i ) {
+    mesh[i] = NULL;
+    MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh[i],MMG5_ARG_end);
+    if ( !MMG3D_Set_iparameter(mesh[i],NULL,MMG3D_IPARAM_verbose,-1) )
+      return EXIT_FAILURE;
+  }
+
+  ier = MIRRORMESH_loadMesh(mesh[0],&info,argv[1]) == 1 &&
+    MMG3D_loadMesh(mesh[1],argv[1]) == 1;
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: unable to load %s.\n",argv[1]);
+  }
+  else {
+    ier = LOAD_compare(mesh[0],mesh[1]) && LOAD_tangents(mesh[0],&info,argv[1]);
+  }
+  MIRRORMESH_Free_tangents(mesh[0],&info);
+
+  for ( i=0; i<2; ++i ) {
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh[i],MMG5_ARG_end);
+  }
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
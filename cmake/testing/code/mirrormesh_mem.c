@@ -0,0 +1,114 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_mem.c
+ * \brief Check the memory predicted for a replication against the one used.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_mem file.mesh nx ny nz adja
+ *
+ * The memory used by the mesh is predicted by \a MIRRORMESH_preflight, as
+ * for the \a -dry-run option, then the mesh is replicated by \a
+ * MIRRORMESH_mirrorlib (with its adjacency if \a adja is set) with exactly
+ * the predicted peak allowed: no allocation may exceed it. The memory
+ * allocated once the arrays are at their final size (end of the preflight
+ * phase) must be the predicted one.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mirrormesh.h"
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh           mesh;
+  MIRRORMESH_pLattice  lattice;
+  MIRRORMESH_Preflight pf;
+  MIRRORMESH_Info      info;
+  size_t               memCur;
+  int                  ier;
+
+  if ( argc != 6 ) {
+    fprintf(stderr,"Usage: %s file.mesh nx ny nz adja\n",argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  MIRRORMESH_Init_parameters(&info);
+  if ( !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nx,atoi(argv[2])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_ny,atoi(argv[3])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nz,atoi(argv[4])) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_adja,atoi(argv[5])) )
+    return EXIT_FAILURE;
+
+  mesh = NULL;
+  MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+  if ( !MMG3D_Set_iparameter(mesh,NULL,MMG3D_IPARAM_verbose,-1) ||
+       MMG3D_loadMesh(mesh,argv[1]) != 1 ) {
+    fprintf(stderr,"  ## Error: unable to load %s.\n",argv[1]);
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+    return EXIT_FAILURE;
+  }
+
+  /* Prediction of the dry run */
+  ier     = 1;
+  memCur  = mesh->memCur;
+  lattice = NULL;
+  if ( !MIRRORMESH_Init_latticeSols(mesh,NULL,NULL,&info,&lattice) ) {
+    fprintf(stderr,"  ## Error: unable to build the lattice.\n");
+    ier = 0;
+  }
+  else {
+    MIRRORMESH_preflight(lattice,&pf,info.adja);
+    MIRRORMESH_Free_lattice(&lattice);
+    if ( mesh->memCur != memCur ) {
+      fprintf(stderr,"  ## Error: %zu bytes left by the lattice.\n",
+              mesh->memCur-memCur);
+      ier = 0;
+    }
+  }
+
+  /* Replication with the predicted peak allowed */
+  if ( ier ) {
+    mesh->memMax = pf.mem + pf.work;
+    if ( MIRRORMESH_mirrorlib(mesh,&info) != MMG5_SUCCESS ) {
+      fprintf(stderr,"  ## Error: replication failed in the %zu bytes"
+              " predicted.\n",mesh->memMax);
+      ier = 0;
+    }
+    else if ( info.stats.phase[MIRRORMESH_PHASE_preflight].mem != pf.mem ) {
+      fprintf(stderr,"  ## Error: %zu bytes allocated, %zu bytes predicted.\n",
+              info.stats.phase[MIRRORMESH_PHASE_preflight].mem,pf.mem);
+      ier = 0;
+    }
+    else {
+      fprintf(stdout,"  %d tetra: %zu bytes allocated, %zu bytes at the"
+              " peak.\n",mesh->ne,pf.mem,mesh->memMax);
+    }
+  }
+
+  MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
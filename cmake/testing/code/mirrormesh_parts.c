@@ -0,0 +1,454 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_parts.c
+ * \brief Check the partitions of a replicated mesh against the whole mesh.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_parts file.mesh part.0.mesh [part.1.mesh ...]
+ *
+ * The partitions written by the \a -nparts option are read back with their
+ * communicators:
+ *  - each entry of the vertex (resp. face) communicator of a partition with
+ *    another one has a matching entry, of same global index, in the
+ *    communicator of the other partition with the first one, and both
+ *    entries are the same vertex (resp. triangle) in both partitions;
+ *  - the vertices, the tetra and the triangles of the partitions, the
+ *    triangles of the face communicators excluded, are the ones of the whole
+ *    replicated mesh \a file.mesh.
+ *
+ * The entities are compared from their coordinates, written by the same
+ * writer in all the files.
+ *
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Largest entity compared: a tetra (4 vertices and a reference) */
+#define PART_KEYLEN 13
+
+/** Entity identified by the coordinates of its vertices and its reference */
+typedef struct {
+  double c[PART_KEYLEN];
+} PART_Key;
+
+/** Communicator item: partition sharing the entity, local and global index */
+typedef struct {
+  int  color;
+  long loc,glob;
+} PART_Item;
+
+/** Mesh or partition read back */
+typedef struct {
+  double    *point; /* coordinates of the vertices (3 per vertex, from 1) */
+  int       *pref; /* references of the vertices */
+  int       *tetra; /* vertices and reference of the tetra (5 per tetra) */
+  int       *tria; /* vertices and reference of the triangles (4 per tria) */
+  int       np,ne,nt;
+  PART_Item *item[2]; /* items of the vertex and face communicators */
+  long      nitem[2];
+} PART_Mesh;
+
+static int PART_cmpKey(const void *a,const void *b) {
+  const double *ca = ((const PART_Key*)a)->c, *cb = ((const PART_Key*)b)->c;
+  int i;
+  for ( i=0; i<PART_KEYLEN; ++i ) {
+    if ( ca[i] < cb[i] ) return -1;
+    if ( ca[i] > cb[i] ) return 1;
+  }
+  return 0;
+}
+
+static int PART_cmpPoint(const void *a,const void *b) {
+  const double *ca = (const double*)a, *cb = (const double*)b;
+  int i;
+  for ( i=0; i<3; ++i ) {
+    if ( ca[i] < cb[i] ) return -1;
+    if ( ca[i] > cb[i] ) return 1;
+  }
+  return 0;
+}
+
+static int PART_cmpItem(const void *a,const void *b) {
+  const PART_Item *ia = (const PART_Item*)a, *ib = (const PART_Item*)b;
+  if ( ia->color != ib->color ) return ia->color < ib->color ? -1 : 1;
+  if ( ia->glob != ib->glob ) return ia->glob < ib->glob ? -1 : 1;
+  return 0;
+}
+
+/**
+ * \param f file positioned after the keyword of a communicator section
+ * \param ncomm number of communicators
+ * \param color partition of each communicator
+ * \param pm mesh to fill
+ * \param t type of the communicator (0: vertices, 1: faces)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the items of the communicators of a type.
+ *
+ */
+static int PART_readItems(FILE *f,int ncomm,const int *color,PART_Mesh *pm,
+                          int t) {
+  long l;
+  int  icomm;
+
+  pm->item[t] = (PART_Item*)malloc((pm->nitem[t]+1)*sizeof(PART_Item));
+  if ( !pm->item[t] ) return 0;
+  for ( l=0; l<pm->nitem[t]; ++l ) {
+    if ( fscanf(f,"%ld %ld %d",&pm->item[t][l].loc,&pm->item[t][l].glob,
+                &icomm) != 3 || icomm < 0 || icomm >= ncomm ) return 0;
+    pm->item[t][l].color = color[icomm];
+  }
+  qsort(pm->item[t],pm->nitem[t],sizeof(PART_Item),PART_cmpItem);
+  return 1;
+}
+
+/**
+ * \param filename name of the Medit file
+ * \param pm mesh to fill
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the vertices, the tetra, the triangles and the communicators of a
+ * Medit ASCII file, other sections being skipped.
+ *
+ */
+static int PART_load(const char *filename,PART_Mesh *pm) {
+  FILE *f;
+  char word[64];
+  int  *color[2],ncomm[2],i,k,t,ier;
+
+  memset(pm,0,sizeof(PART_Mesh));
+  color[0] = color[1] = NULL;
+  ncomm[0] = ncomm[1] = 0;
+
+  if ( !(f = fopen(filename,"r")) ) {
+    fprintf(stderr,"  ## Error: unable to open %s.\n",filename);
+    return 0;
+  }
+
+  ier = 1;
+  while ( ier && fscanf(f,"%63s",word) == 1 ) {
+    if ( !isalpha((unsigned char)word[0]) ) continue;
+
+    if ( !strcmp(word,"Vertices") ) {
+      ier = fscanf(f,"%d",&pm->np) == 1
+        && (pm->point = (double*)malloc(3*(pm->np+1)*sizeof(double)))
+        && (pm->pref = (int*)malloc((pm->np+1)*sizeof(int)));
+      for ( k=1; ier && k<=pm->np; ++k ) {
+        ier = fscanf(f,"%lf %lf %lf %d",&pm->point[3*k],&pm->point[3*k+1],
+                     &pm->point[3*k+2],&pm->pref[k]) == 4;
+      }
+    }
+    else if ( !strcmp(word,"Tetrahedra") || !strcmp(word,"Triangles") ) {
+      int n = word[1] == 'e' ? 5 : 4;
+      int *nent = n == 5 ? &pm->ne : &pm->nt;
+      int **ent = n == 5 ? &pm->tetra : &pm->tria;
+
+      ier = fscanf(f,"%d",nent) == 1
+        && (*ent = (int*)malloc(n*(*nent+1)*sizeof(int)));
+      for ( k=n; ier && k<n*(*nent+1); ++k ) {
+        ier = fscanf(f,"%d",&(*ent)[k]) == 1;
+      }
+    }
+    else if ( !strcmp(word,"ParallelVertexCommunicators") ||
+              !strcmp(word,"ParallelTriangleCommunicators") ) {
+      t   = word[8] == 'T';
+      ier = fscanf(f,"%d",&ncomm[t]) == 1 && ncomm[t] > 0
+        && (color[t] = (int*)malloc(ncomm[t]*sizeof(int)));
+      for ( i=0; ier && i<ncomm[t]; ++i ) {
+        long n;
+        ier = fscanf(f,"%d %ld",&color[t][i],&n) == 2;
+        pm->nitem[t] += n;
+      }
+    }
+    else if ( !strcmp(word,"ParallelCommunicatorVertices") ||
+              !strcmp(word,"ParallelCommunicatorTriangles") ) {
+      t   = word[20] == 'T';
+      ier = color[t] && PART_readItems(f,ncomm[t],color[t],pm,t);
+    }
+  }
+  fclose(f);
+  free(color[0]);
+  free(color[1]);
+
+  if ( !ier || !pm->np || !pm->ne ) {
+    fprintf(stderr,"  ## Error: unable to read %s.\n",filename);
+    return 0;
+  }
+  return 1;
+}
+
+static void PART_free(PART_Mesh *pm) {
+  free(pm->point);
+  free(pm->pref);
+  free(pm->tetra);
+  free(pm->tria);
+  free(pm->item[0]);
+  free(pm->item[1]);
+}
+
+/**
+ * \param pm mesh
+ * \param v vertices of the entity
+ * \param n number of vertices
+ * \param ref reference of the entity
+ * \param key key to fill
+ *
+ * Key of an entity: coordinates of its vertices, in their order, and its
+ * reference.
+ *
+ */
+static void PART_key(PART_Mesh *pm,const int *v,int n,int ref,PART_Key *key) {
+  int i;
+
+  memset(key,0,sizeof(PART_Key));
+  for ( i=0; i<n; ++i ) {
+    memcpy(&key->c[3*i],&pm->point[3*v[i]],3*sizeof(double));
+  }
+  key->c[3*n] = ref;
+}
+
+/**
+ * \param pm partitions
+ * \param nparts number of partitions
+ * \param t type of the communicators (0: vertices, 1: faces)
+ *
+ * \return 1 if the communicators pair up, 0 otherwise.
+ *
+ */
+static int PART_checkComm(PART_Mesh *pm,int nparts,int t) {
+  PART_Key  ka,kb;
+  PART_Item *it,*jt,key;
+  long      l,nchk;
+  int       p,q;
+
+  nchk = 0;
+  for ( p=0; p<nparts; ++p ) {
+    for ( l=0; l<pm[p].nitem[t]; ++l ) {
+      it = &pm[p].item[t][l];
+      q  = it->color;
+      if ( q < 0 || q >= nparts || q == p ) {
+        fprintf(stderr,"  ## Error: partition %d: communicator with the"
+                " partition %d.\n",p,q);
+        return 0;
+      }
+      key.color = p;
+      key.glob  = it->glob;
+      jt = (PART_Item*)bsearch(&key,pm[q].item[t],pm[q].nitem[t],
+                               sizeof(PART_Item),PART_cmpItem);
+      if ( !jt ) {
+        fprintf(stderr,"  ## Error: %s %ld of the partition %d: no matching"
+                " entry in the partition %d.\n",t ? "face" : "vertex",
+                it->glob,p,q);
+        return 0;
+      }
+      if ( it->loc < 1 || it->loc > (t ? pm[p].nt : pm[p].np) ||
+           jt->loc < 1 || jt->loc > (t ? pm[q].nt : pm[q].np) ) {
+        fprintf(stderr,"  ## Error: %s %ld: local index out of range.\n",
+                t ? "face" : "vertex",it->glob);
+        return 0;
+      }
+
+      if ( t ) {
+        /* Same triangle, whatever the order of its vertices */
+        PART_key(&pm[p],&pm[p].tria[4*it->loc],3,0,&ka);
+        PART_key(&pm[q],&pm[q].tria[4*jt->loc],3,0,&kb);
+        qsort(ka.c,3,3*sizeof(double),PART_cmpPoint);
+        qsort(kb.c,3,3*sizeof(double),PART_cmpPoint);
+      }
+      else {
+        int ip = (int)it->loc, iq = (int)jt->loc;
+        PART_key(&pm[p],&ip,1,0,&ka);
+        PART_key(&pm[q],&iq,1,0,&kb);
+      }
+      if ( PART_cmpKey(&ka,&kb) ) {
+        fprintf(stderr,"  ## Error: %s %ld: entity %ld of the partition %d"
+                " differs from the entity %ld of the partition %d.\n",
+                t ? "face" : "vertex",it->glob,it->loc,p,jt->loc,q);
+        return 0;
+      }
+      ++nchk;
+    }
+  }
+  if ( nparts > 1 && !nchk ) {
+    fprintf(stderr,"  ## Error: no %s communicator.\n",t ? "face" : "vertex");
+    return 0;
+  }
+  fprintf(stdout,"  %ld %s communicator entries paired.\n",nchk,
+          t ? "face" : "vertex");
+
+  return 1;
+}
+
+/**
+ * \param pm mesh
+ * \param key keys to fill (NULL to count them only)
+ * \param t type of the entities (0: vertices, 1: triangles, 2: tetra)
+ *
+ * \return the number of keys.
+ *
+ * Keys of the entities of a mesh, the triangles of the face communicators
+ * excluded.
+ *
+ */
+static long PART_keys(PART_Mesh *pm,PART_Key *key,int t) {
+  long l,n;
+  int  k,nitf;
+
+  n = 0;
+  switch ( t ) {
+  case 0:
+    for ( k=1; k<=pm->np; ++k ) {
+      if ( key ) PART_key(pm,&k,1,0,&key[n]);
+      ++n;
+    }
+    break;
+  case 1:
+    /* The triangles of the face communicators are the last ones */
+    nitf = 0;
+    for ( l=0; l<pm->nitem[1]; ++l ) {
+      if ( pm->item[1][l].loc > pm->nt-pm->nitem[1] ) ++nitf;
+    }
+    if ( nitf != pm->nitem[1] ) return -1;
+    for ( k=1; k<=pm->nt-nitf; ++k ) {
+      if ( key ) PART_key(pm,&pm->tria[4*k],3,pm->tria[4*k+3],&key[n]);
+      ++n;
+    }
+    break;
+  default:
+    for ( k=1; k<=pm->ne; ++k ) {
+      if ( key ) PART_key(pm,&pm->tetra[5*k],4,pm->tetra[5*k+4],&key[n]);
+      ++n;
+    }
+  }
+  return n;
+}
+
+/**
+ * \param mesh whole replicated mesh
+ * \param pm partitions
+ * \param nparts number of partitions
+ * \param t type of the entities (0: vertices, 1: triangles, 2: tetra)
+ *
+ * \return 1 if the entities of the partitions are the ones of the whole
+ * mesh, 0 otherwise.
+ *
+ * The vertices shared by several partitions are counted once.
+ *
+ */
+static int PART_checkUnion(PART_Mesh *mesh,PART_Mesh *pm,int nparts,int t) {
+  static const char *name[3] = {"vertices","triangles","tetra"};
+  PART_Key *ka,*kb;
+  long     na,nb,n,l;
+  int      p,ier;
+
+  na = PART_keys(mesh,NULL,t);
+  nb = 0;
+  for ( p=0; p<nparts; ++p ) {
+    if ( (n = PART_keys(&pm[p],NULL,t)) < 0 ) {
+      fprintf(stderr,"  ## Error: partition %d: triangles of the face"
+              " communicators not at the end.\n",p);
+      return 0;
+    }
+    nb += n;
+  }
+
+  ka = (PART_Key*)malloc((na+1)*sizeof(PART_Key));
+  kb = (PART_Key*)malloc((nb+1)*sizeof(PART_Key));
+  if ( !ka || !kb ) {
+    free(ka);
+    free(kb);
+    return 0;
+  }
+  PART_keys(mesh,ka,t);
+  for ( p=0, n=0; p<nparts; ++p ) {
+    n += PART_keys(&pm[p],kb+n,t);
+  }
+  qsort(ka,na,sizeof(PART_Key),PART_cmpKey);
+  qsort(kb,nb,sizeof(PART_Key),PART_cmpKey);
+
+  /* Shared vertices */
+  if ( !t ) {
+    for ( l=0, n=0; l<nb; ++l ) {
+      if ( !n || PART_cmpKey(&kb[n-1],&kb[l]) ) kb[n++] = kb[l];
+    }
+    nb = n;
+  }
+
+  ier = na == nb;
+  for ( l=0; ier && l<na; ++l ) {
+    ier = !PART_cmpKey(&ka[l],&kb[l]);
+  }
+  if ( ier ) {
+    fprintf(stdout,"  %ld %s: same as the whole mesh.\n",na,name[t]);
+  }
+  else {
+    fprintf(stderr,"  ## Error: %ld %s in the whole mesh, %ld in the"
+            " partitions or different ones.\n",na,name[t],nb);
+  }
+  free(ka);
+  free(kb);
+
+  return ier;
+}
+
+int main(int argc,char *argv[]) {
+  PART_Mesh mesh,*pm;
+  int       nparts,p,t,ier;
+
+  if ( argc < 3 ) {
+    fprintf(stderr,"Usage: %s file.mesh part.0.mesh [part.1.mesh ...]\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+  nparts = argc-2;
+
+  pm = (PART_Mesh*)calloc(nparts,sizeof(PART_Mesh));
+  if ( !pm ) return EXIT_FAILURE;
+
+  ier = PART_load(argv[1],&mesh);
+  for ( p=0; p<nparts; ++p ) {
+    ier = PART_load(argv[2+p],&pm[p]) && ier;
+  }
+
+  for ( t=0; ier && t<2; ++t ) {
+    ier = PART_checkComm(pm,nparts,t);
+  }
+  for ( t=0; ier && t<3; ++t ) {
+    ier = PART_checkUnion(&mesh,pm,nparts,t);
+  }
+
+  PART_free(&mesh);
+  for ( p=0; p<nparts; ++p ) {
+    PART_free(&pm[p]);
+  }
+  free(pm);
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
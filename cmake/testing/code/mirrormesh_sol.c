@@ -0,0 +1,261 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mirrormesh_sol.c
+ * \brief Check the reflection of the fields replicated with the mesh.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Usage: mirrormesh_sol file.mesh file.sol nx ny nz
+ *
+ * The mesh and its fields are replicated by \a MIRRORMESH_mirrorlibSols.
+ * Each replicated vertex that doesn't lie on a symmetry plane is mapped back
+ * on its base vertex from its coordinates only: along each axis, its copy
+ * and whether it is a reflected one follow from its position in the lattice
+ * of bounding boxes. Its values must be the ones of the base vertex, the
+ * components of the vectors being multiplied by the signs \f$s_i\f$ of the
+ * copy and the ones of the symmetric tensors by \f$s_i s_j\f$.
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mmg/mmg3d/libmmg3d.h"
+#include "mirrormesh/libmirrormesh.h"
+
+/** Base point sorted by its first coordinate */
+typedef struct {
+  double x;
+  int    k;
+} SOL_Point;
+
+static int SOL_cmpPoint(const void *a,const void *b) {
+  double xa = ((const SOL_Point*)a)->x, xb = ((const SOL_Point*)b)->x;
+  return xa < xb ? -1 : ( xa > xb ? 1 : 0 );
+}
+
+/**
+ * \param base base mesh
+ * \param sorted points of the base mesh sorted by their first coordinate
+ * \param c coordinates to look for
+ * \param tol tolerance on the coordinates
+ *
+ * \return the base point at \a c, 0 if none.
+ *
+ */
+static int SOL_find(MMG5_pMesh base,SOL_Point *sorted,const double c[3],
+                    double tol) {
+  int lo,hi,mid,i,k;
+
+  /* First point with x >= c[0]-tol */
+  lo = 0;
+  hi = base->np;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2;
+    if ( sorted[mid].x < c[0]-tol ) lo = mid+1;
+    else hi = mid;
+  }
+  for ( ; lo<base->np && sorted[lo].x <= c[0]+tol; ++lo ) {
+    k = sorted[lo].k;
+    for ( i=1; i<3; ++i ) {
+      if ( fabs(base->point[k].c[i]-c[i]) > tol ) break;
+    }
+    if ( i == 3 ) return k;
+  }
+  return 0;
+}
+
+/**
+ * \param base base mesh and fields
+ * \param bsol fields of the base mesh
+ * \param mesh replicated mesh
+ * \param sol replicated fields
+ * \param nmir number of mirrors along each axis
+ *
+ * \return 1 if the replicated values are the reflected base ones, 0
+ * otherwise.
+ *
+ */
+static int SOL_check(MMG5_pMesh base,MMG5_pSol bsol,MMG5_pMesh mesh,
+                     MMG5_pSol sol,int nmir[3]) {
+  SOL_Point *sorted;
+  double    min[3],max[3],delta[3],s[3],cb[3],tol,t;
+  int       k,kb,i,l,idx,nchk,ier;
+
+  /* Bounding box of the base mesh */
+  for ( i=0; i<3; ++i ) {
+    min[i] = max[i] = base->point[1].c[i];
+  }
+  for ( k=2; k<=base->np; ++k ) {
+    for ( i=0; i<3; ++i ) {
+      min[i] = fmin(min[i],base->point[k].c[i]);
+      max[i] = fmax(max[i],base->point[k].c[i]);
+    }
+  }
+  tol = 0.;
+  for ( i=0; i<3; ++i ) {
+    delta[i] = max[i] - min[i];
+    tol      = fmax(tol,1e-9*delta[i]);
+  }
+
+  sorted = (SOL_Point*)malloc(base->np*sizeof(SOL_Point));
+  if ( !sorted ) return 0;
+  for ( k=1; k<=base->np; ++k ) {
+    sorted[k-1].x = base->point[k].c[0];
+    sorted[k-1].k = k;
+  }
+  qsort(sorted,base->np,sizeof(SOL_Point),SOL_cmpPoint);
+
+  ier  = 1;
+  nchk = 0;
+  for ( k=1; k<=mesh->np && ier; ++k ) {
+    const double *c = mesh->point[k].c;
+
+    /* Copy along each axis, vertices of the symmetry planes skipped (they
+     * keep the values of the vertex they are welded to) */
+    for ( i=0; i<3; ++i ) {
+      t   = (c[i]-min[i])/delta[i];
+      idx = (int)floor(t+0.5);
+      if ( idx >= 1 && idx <= nmir[i] && fabs(t-idx)*delta[i] <= tol ) break;
+      idx = (int)floor(t);
+      idx = idx < 0 ? 0 : ( idx > nmir[i] ? nmir[i] : idx );
+      if ( idx%2 ) {
+        s[i]  = -1.;
+        cb[i] = 2.*max[i] + (idx-1)*delta[i] - c[i];
+      }
+      else {
+        s[i]  = 1.;
+        cb[i] = c[i] - idx*delta[i];
+      }
+    }
+    if ( i < 3 ) continue;
+
+    if ( !(kb = SOL_find(base,sorted,cb,tol)) ) {
+      fprintf(stderr,"  ## Error: no base vertex for the vertex %d.\n",k);
+      ier = 0;
+      break;
+    }
+    ++nchk;
+
+    for ( l=0; l<mesh->nsols; ++l ) {
+      const double *m  = &sol[l].m[(size_t)k*sol[l].size];
+      const double *mb = &bsol[l].m[(size_t)kb*bsol[l].size];
+      double       ref[6];
+
+      switch ( sol[l].type ) {
+      case MMG5_Vector:
+        for ( i=0; i<3; ++i ) ref[i] = s[i]*mb[i];
+        break;
+      case MMG5_Tensor:
+        ref[0] = mb[0];
+        ref[1] = s[0]*s[1]*mb[1];
+        ref[2] = s[0]*s[2]*mb[2];
+        ref[3] = mb[3];
+        ref[4] = s[1]*s[2]*mb[4];
+        ref[5] = mb[5];
+        break;
+      default:
+        ref[0] = mb[0];
+      }
+      if ( memcmp(m,ref,sol[l].size*sizeof(double)) ) {
+        fprintf(stderr,"  ## Error: field %d: value at the vertex %d is not"
+                " the reflected value of the base vertex %d.\n",l,k,kb);
+        ier = 0;
+        break;
+      }
+    }
+  }
+  free(sorted);
+
+  if ( ier && !nchk ) {
+    fprintf(stderr,"  ## Error: no vertex checked.\n");
+    ier = 0;
+  }
+  return ier;
+}
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mesh[2];
+  MMG5_pSol       sol[2];
+  MIRRORMESH_Info info;
+  int             nmir[3],i,l,ier;
+
+  if ( argc != 6 ) {
+    fprintf(stderr,"Usage: %s file.mesh file.sol nx ny nz\n",argv[0]);
+    return EXIT_FAILURE;
+  }
+  for ( i=0; i<3; ++i ) {
+    nmir[i] = atoi(argv[3+i]);
+  }
+
+  MIRRORMESH_Init_parameters(&info);
+  if ( !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nx,nmir[0]) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_ny,nmir[1]) ||
+       !MIRRORMESH_Set_iparameter(&info,MIRRORMESH_IPARAM_nz,nmir[2]) )
+    return EXIT_FAILURE;
+
+  /* Base mesh (0) and replicated one (1) */
+  ier = 1;
+  for ( i=0; i<2; ++i ) {
+    mesh[i] = NULL;
+    sol[i]  = NULL;
+    MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh[i],MMG5_ARG_end);
+    if ( !MMG3D_Set_iparameter(mesh[i],NULL,MMG3D_IPARAM_verbose,-1) ||
+         MMG3D_loadMesh(mesh[i],argv[1]) != 1 ||
+         MMG3D_loadAllSols(mesh[i],&sol[i],argv[2]) != 1 ) {
+      fprintf(stderr,"  ## Error: unable to load %s and %s.\n",argv[1],argv[2]);
+      ier = 0;
+    }
+  }
+
+  if ( ier ) {
+    for ( l=0; l<mesh[0]->nsols; ++l ) {
+      if ( sol[0][l].type != MMG5_Scalar ) break;
+    }
+    if ( l == mesh[0]->nsols ) {
+      fprintf(stderr,"  ## Error: no vector or tensor field in %s.\n",argv[2]);
+      ier = 0;
+    }
+  }
+
+  if ( ier ) {
+    ier = MIRRORMESH_mirrorlibSols(mesh[1],NULL,sol[1],&info) == MMG5_SUCCESS;
+    if ( !ier ) {
+      fprintf(stderr,"  ## Error: replication failed.\n");
+    }
+  }
+
+  if ( ier ) {
+    ier = SOL_check(mesh[0],sol[0],mesh[1],sol[1],nmir);
+  }
+
+  for ( i=0; i<2; ++i ) {
+    if ( sol[i] ) MMG3D_Free_allSols(mesh[i],&sol[i]);
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh[i],MMG5_ARG_end);
+  }
+
+  return ier ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,70 @@
+## =============================================================================
+##  This file is part of the mmg software package for the tetrahedral
+##  mesh modification.
+##**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+##
+##  mmg is free software: you can redistribute it and/or modify it
+##  under the terms of the GNU Lesser General Public License as published
+##  by the Free Software Foundation, either version 3 of the License, or
+##  (at your option) any later version.
+##
+##  mmg is distributed in the hope that it will be useful, but WITHOUT
+##  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+##  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+##  License for more details.
+##
+##  You should have received a copy of the GNU Lesser General Public
+##  License and of the GNU General Public License along with mmg (in
+##  files COPYING.LESSER and COPYING). If not, see
+##  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+##  use this copy of the mmg distribution only if you accept them.
+## =============================================================================
+
+###############################################################################
+#####
+#####         Sizes predicted by -dry-run against the ones of a real run
+#####
+#####  cmake -DEXE=<mirrormesh> -DMESH=<input> -DOUT=<output> -DARGS=<options>
+#####        -P mirrormesh_dryrun.cmake
+#####
+###############################################################################
+
+SEPARATE_ARGUMENTS ( ARGS )
+
+EXECUTE_PROCESS ( COMMAND ${EXE} -v 1 -dry-run ${ARGS} ${MESH} -out ${OUT}
+  RESULT_VARIABLE RES OUTPUT_VARIABLE DRYRUN )
+IF ( RES )
+  MESSAGE ( FATAL_ERROR "dry run failed:\n${DRYRUN}" )
+ENDIF ( )
+
+EXECUTE_PROCESS ( COMMAND ${EXE} -v 1 ${ARGS} ${MESH} -out ${OUT}
+  -stats ${OUT}.stats.json
+  RESULT_VARIABLE RES OUTPUT_VARIABLE RUN )
+IF ( RES )
+  MESSAGE ( FATAL_ERROR "replication failed:\n${RUN}" )
+ENDIF ( )
+FILE ( READ ${OUT}.stats.json STATS )
+
+# Sizes of the replicated mesh (end of the element mirroring)
+STRING ( REGEX MATCH "\"name\": \"cells\"[^}]*" CELLS "${STATS}" )
+FOREACH ( ent "VERTICES;np" "TETRAHEDRA;ne" "TRIANGLES;nt" "EDGES;na" )
+  LIST ( GET ent 0 label )
+  LIST ( GET ent 1 key )
+  STRING ( REGEX MATCH "NUMBER OF ${label} *([0-9]+)" tmp "${DRYRUN}" )
+  SET ( predicted "${CMAKE_MATCH_1}" )
+  STRING ( REGEX MATCH "\"${key}\": ([0-9]+)" tmp "${CELLS}" )
+  IF ( NOT predicted OR NOT "${predicted}" STREQUAL "${CMAKE_MATCH_1}" )
+    MESSAGE ( FATAL_ERROR "number of ${label}: ${predicted} predicted,"
+      " ${CMAKE_MATCH_1} built" )
+  ENDIF ( )
+ENDFOREACH ( )
+
+# Memory: arrays allocated at their final size (end of the preflight phase)
+STRING ( REGEX MATCH "ACCOUNTED MESH MEMORY *[0-9]+ MB \\(([0-9]+) bytes" tmp "${DRYRUN}" )
+SET ( predicted "${CMAKE_MATCH_1}" )
+STRING ( REGEX MATCH "\"name\": \"preflight\"[^}]*\"mem_bytes\": ([0-9]+)"
+  tmp "${STATS}" )
+IF ( NOT predicted OR NOT "${predicted}" STREQUAL "${CMAKE_MATCH_1}" )
+  MESSAGE ( FATAL_ERROR "memory: ${predicted} bytes predicted,"
+    " ${CMAKE_MATCH_1} bytes used" )
+ENDIF ( )
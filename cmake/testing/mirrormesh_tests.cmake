@@ -37,4 +37,303 @@ IF( BUILD_TESTING )
     ${MIRRORMESH_CI_TESTS}/0.mesh
     -out ${CMAKE_BINARY_DIR}/mirrormesh_0.o.mesh)
 
+  # Same output whatever the number of threads
+  FOREACH ( nt 1 4 )
+    ADD_TEST(NAME mirrormesh_Threads${nt}
+      COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -nt ${nt} -nx 2
+      ${MIRRORMESH_CI_TESTS}/0.mesh
+      -out ${CMAKE_BINARY_DIR}/mirrormesh_0-nt${nt}.o.mesh)
+  ENDFOREACH ( )
+  ADD_TEST(NAME mirrormesh_ThreadsDiff
+    COMMAND ${CMAKE_COMMAND} -E compare_files
+    ${CMAKE_BINARY_DIR}/mirrormesh_0-nt1.o.mesh
+    ${CMAKE_BINARY_DIR}/mirrormesh_0-nt4.o.mesh)
+  SET_TESTS_PROPERTIES(mirrormesh_ThreadsDiff PROPERTIES
+    DEPENDS "mirrormesh_Threads1;mirrormesh_Threads4")
+
+  # Generate-on-write output
+  ADD_TEST(NAME mirrormesh_Stream
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -stream
+    ${MIRRORMESH_CI_TESTS}/0.mesh
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_0-stream.o.mesh)
+
+  # The streamed mesh is the one built in memory
+  ADD_TEST(NAME mirrormesh_StreamDiff
+    COMMAND ${CMAKE_COMMAND} -E compare_files
+    ${CMAKE_BINARY_DIR}/mirrormesh_0.o.mesh
+    ${CMAKE_BINARY_DIR}/mirrormesh_0-stream.o.mesh)
+  SET_TESTS_PROPERTIES(mirrormesh_StreamDiff PROPERTIES
+    DEPENDS "mirrormesh_Simple;mirrormesh_Stream")
+
+  # Locality-aware numbering: the streamed mesh renumbers a copy of the base
+  # mesh, the mesh built in memory renumbers it in place
+  ADD_TEST(NAME mirrormesh_Renum
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -rn 1 -nx 2
+    ${MIRRORMESH_CI_TESTS}/0.mesh
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_0-rn.o.mesh)
+  ADD_TEST(NAME mirrormesh_RenumStream
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -rn 1 -nx 2 -stream
+    ${MIRRORMESH_CI_TESTS}/0.mesh
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_0-rn-stream.o.mesh)
+  ADD_TEST(NAME mirrormesh_RenumDiff
+    COMMAND ${CMAKE_COMMAND} -E compare_files
+    ${CMAKE_BINARY_DIR}/mirrormesh_0-rn.o.mesh
+    ${CMAKE_BINARY_DIR}/mirrormesh_0-rn-stream.o.mesh)
+  SET_TESTS_PROPERTIES(mirrormesh_RenumDiff PROPERTIES
+    DEPENDS "mirrormesh_Renum;mirrormesh_RenumStream")
+
+  # Extension of the streamed mesh: only the new copies are generated
+  ADD_TEST(NAME mirrormesh_Grow
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -nx 2 -ny 2 -nz 2
+    -grow ${CMAKE_BINARY_DIR}/mirrormesh_0-stream.o.mesh
+    ${MIRRORMESH_CI_TESTS}/0.mesh
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_0-grow.o.mesh)
+  SET_TESTS_PROPERTIES(mirrormesh_Grow PROPERTIES
+    DEPENDS mirrormesh_Stream)
+
+  # Several replications sharing their base mesh, run concurrently
+  FILE ( WRITE ${CMAKE_BINARY_DIR}/mirrormesh_batch.txt
+    "# input nx ny nz output\n"
+    "${MIRRORMESH_CI_TESTS}/0.mesh 1 1 1 ${CMAKE_BINARY_DIR}/mirrormesh_0-batch1.o.mesh\n"
+    "${MIRRORMESH_CI_TESTS}/0.mesh 2 1 0 ${CMAKE_BINARY_DIR}/mirrormesh_0-batch2.o.mesh\n"
+    "${MIRRORMESH_CI_TESTS}/0.mesh 0 0 3 ${CMAKE_BINARY_DIR}/mirrormesh_0-batch3.o.msh\n" )
+  ADD_TEST(NAME mirrormesh_Batch
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -jobs 2
+    -batch ${CMAKE_BINARY_DIR}/mirrormesh_batch.txt)
+
+  # Each output of the batch is the one of its job run alone
+  FOREACH ( job "1;1;1;1;mesh" "2;2;1;0;mesh" "3;0;0;3;msh" )
+    LIST ( GET job 0 i )
+    LIST ( GET job 1 nx )
+    LIST ( GET job 2 ny )
+    LIST ( GET job 3 nz )
+    LIST ( GET job 4 ext )
+    ADD_TEST(NAME mirrormesh_BatchJob${i}
+      COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -stream
+      -nx ${nx} -ny ${ny} -nz ${nz} ${MIRRORMESH_CI_TESTS}/0.mesh
+      -out ${CMAKE_BINARY_DIR}/mirrormesh_0-batchjob${i}.o.${ext})
+    ADD_TEST(NAME mirrormesh_BatchDiff${i}
+      COMMAND ${CMAKE_COMMAND} -E compare_files
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-batch${i}.o.${ext}
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-batchjob${i}.o.${ext})
+    SET_TESTS_PROPERTIES(mirrormesh_BatchDiff${i} PROPERTIES
+      DEPENDS "mirrormesh_Batch;mirrormesh_BatchJob${i}")
+  ENDFOREACH ( )
+
+  # Partitioned output with communicators
+  ADD_TEST(NAME mirrormesh_Parts
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -nparts 3
+    ${MIRRORMESH_CI_TESTS}/0.mesh
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_0-parts.o.mesh)
+
+  # Periodic tiling of a box whose opposite boundaries match within the
+  # tolerance only
+  ADD_TEST(NAME mirrormesh_Periodic
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -periodic xyz -nx 1 -ny 2 -nz 1
+    ${MIRRORMESH_CI_TESTS}/periodic.mesh
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_periodic.o.mesh)
+  ADD_TEST(NAME mirrormesh_PeriodicStream
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -periodic xyz -nx 1 -ny 2 -nz 1
+    -stream ${MIRRORMESH_CI_TESTS}/periodic.mesh
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_periodic-stream.o.mesh)
+  ADD_TEST(NAME mirrormesh_PeriodicDiff
+    COMMAND ${CMAKE_COMMAND} -E compare_files
+    ${CMAKE_BINARY_DIR}/mirrormesh_periodic.o.mesh
+    ${CMAKE_BINARY_DIR}/mirrormesh_periodic-stream.o.mesh)
+  SET_TESTS_PROPERTIES(mirrormesh_PeriodicDiff PROPERTIES
+    DEPENDS "mirrormesh_Periodic;mirrormesh_PeriodicStream")
+
+  # Normals and tangents of the input mesh written with the replicated mesh
+  ADD_TEST(NAME mirrormesh_Normals
+    COMMAND ${CMAKE_COMMAND}
+    "-DFILES=${CMAKE_BINARY_DIR}/mirrormesh_0.o.mesh ${CMAKE_BINARY_DIR}/mirrormesh_0-stream.o.mesh ${CMAKE_BINARY_DIR}/mirrormesh_0-parts.o.0.mesh ${CMAKE_BINARY_DIR}/mirrormesh_0-parts.o.2.mesh"
+    "-DSECTIONS=Normals NormalAtVertices Tangents TangentAtVertices"
+    -P ${MIRRORMESH_CI_TESTS}/mirrormesh_sections.cmake)
+  SET_TESTS_PROPERTIES(mirrormesh_Normals PROPERTIES
+    DEPENDS "mirrormesh_Simple;mirrormesh_Stream;mirrormesh_Parts")
+
+  # Scalar, vector and tensor fields replicated with the mesh
+  ADD_TEST(NAME mirrormesh_Sol
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5
+    ${MIRRORMESH_CI_TESTS}/0.mesh -sol ${MIRRORMESH_CI_TESTS}/0.sol
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_0-sol.o.mesh)
+
+  # Per-phase measures
+  ADD_TEST(NAME mirrormesh_Stats
+    COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5
+    ${MIRRORMESH_CI_TESTS}/0.mesh -stats ${CMAKE_BINARY_DIR}/mirrormesh_0.stats.json
+    -out ${CMAKE_BINARY_DIR}/mirrormesh_0-stats.o.mesh)
+
+  # Sizes and memory predicted by -dry-run are the ones of the replication
+  ADD_TEST(NAME mirrormesh_DryRun
+    COMMAND ${CMAKE_COMMAND} -DEXE=$<TARGET_FILE:${PROJECT_NAME}>
+    -DMESH=${MIRRORMESH_CI_TESTS}/0.mesh
+    -DOUT=${CMAKE_BINARY_DIR}/mirrormesh_0-dryrun.o.mesh
+    -P ${MIRRORMESH_CI_TESTS}/mirrormesh_dryrun.cmake)
+  ADD_TEST(NAME mirrormesh_DryRunSol
+    COMMAND ${CMAKE_COMMAND} -DEXE=$<TARGET_FILE:${PROJECT_NAME}>
+    -DMESH=${MIRRORMESH_CI_TESTS}/0.mesh
+    "-DARGS=-nx 2 -ny 0 -nz 3 -sol ${MIRRORMESH_CI_TESTS}/0.sol"
+    -DOUT=${CMAKE_BINARY_DIR}/mirrormesh_0-dryrunsol.o.mesh
+    -P ${MIRRORMESH_CI_TESTS}/mirrormesh_dryrun.cmake)
+
+  # Input without normals and tangents, read by the parallel reader (the Mmg
+  # reader is used when the file name has no extension)
+  FILE ( READ ${MIRRORMESH_CI_TESTS}/0.mesh MIRRORMESH_MESH )
+  STRING ( REGEX REPLACE
+    "(Normals|NormalAtVertices|Tangents|TangentAtVertices)\n[-+.0-9eE \t\r\n]*"
+    "" MIRRORMESH_MESH "${MIRRORMESH_MESH}" )
+  FILE ( WRITE ${CMAKE_BINARY_DIR}/mirrormesh_1.mesh "${MIRRORMESH_MESH}" )
+
+  FOREACH ( nt 1 4 )
+    ADD_TEST(NAME mirrormesh_ReaderPar${nt}
+      COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -nt ${nt}
+      ${CMAKE_BINARY_DIR}/mirrormesh_1.mesh
+      -out ${CMAKE_BINARY_DIR}/mirrormesh_1-par-nt${nt}.o.mesh)
+    ADD_TEST(NAME mirrormesh_ReaderMmg${nt}
+      COMMAND $<TARGET_FILE:${PROJECT_NAME}> -v 5 -nt ${nt}
+      ${CMAKE_BINARY_DIR}/mirrormesh_1
+      -out ${CMAKE_BINARY_DIR}/mirrormesh_1-mmg-nt${nt}.o.mesh)
+    ADD_TEST(NAME mirrormesh_ReaderDiff${nt}
+      COMMAND ${CMAKE_COMMAND} -E compare_files
+      ${CMAKE_BINARY_DIR}/mirrormesh_1-par-nt${nt}.o.mesh
+      ${CMAKE_BINARY_DIR}/mirrormesh_1-mmg-nt${nt}.o.mesh)
+    SET_TESTS_PROPERTIES(mirrormesh_ReaderDiff${nt} PROPERTIES
+      DEPENDS "mirrormesh_ReaderPar${nt};mirrormesh_ReaderMmg${nt}")
+  ENDFOREACH ( )
+
+  # Tests of the library entry points
+  IF ( LIBMIRRORMESH_INTERNAL )
+    IF ( LIBMIRRORMESH_STATIC )
+      SET ( MIRRORMESH_TEST_LIB lib${PROJECT_NAME}_a )
+    ELSE ( )
+      SET ( MIRRORMESH_TEST_LIB lib${PROJECT_NAME}_so )
+    ENDIF ( )
+
+    # Round trip of the reals written by the Medit writers
+    ADD_LIBRARY_TEST ( mirrormesh_fmtdouble
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_fmtdouble.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_FmtDouble
+      COMMAND $<TARGET_FILE:mirrormesh_fmtdouble> 1000000)
+
+    # Partitions read back: paired communicators and same entities as the
+    # whole mesh
+    ADD_LIBRARY_TEST ( mirrormesh_parts
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_parts.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_PartsCheck
+      COMMAND $<TARGET_FILE:mirrormesh_parts>
+      ${CMAKE_BINARY_DIR}/mirrormesh_0.o.mesh
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-parts.o.0.mesh
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-parts.o.1.mesh
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-parts.o.2.mesh)
+    SET_TESTS_PROPERTIES(mirrormesh_PartsCheck PROPERTIES
+      DEPENDS "mirrormesh_Simple;mirrormesh_Parts")
+
+    # Extended mesh: previous entities kept in place, same mesh as the
+    # replication written at once
+    ADD_LIBRARY_TEST ( mirrormesh_grow
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_grow.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_GrowCheck
+      COMMAND $<TARGET_FILE:mirrormesh_grow>
+      ${MIRRORMESH_CI_TESTS}/0.mesh
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-stream.o.mesh
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-grow.o.mesh 1 1 1 2 2 2
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-grow-direct.o.mesh)
+    SET_TESTS_PROPERTIES(mirrormesh_GrowCheck PROPERTIES
+      DEPENDS mirrormesh_Grow)
+
+    # Medit version 4 and Gmsh 4.1 against the version 2 and the Gmsh 2.2,
+    # the 64-bit formats being forced by a lowered threshold
+    ADD_LIBRARY_TEST ( mirrormesh_int64
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_int64.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_Int64
+      COMMAND $<TARGET_FILE:mirrormesh_int64>
+      ${MIRRORMESH_CI_TESTS}/0.mesh 1 1 1
+      ${CMAKE_BINARY_DIR}/mirrormesh_0-int64.o)
+
+    # Parallel reader against the Mmg one
+    ADD_LIBRARY_TEST ( mirrormesh_load
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_load.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    FOREACH ( nt 1 4 )
+      ADD_TEST(NAME mirrormesh_Load${nt}
+        COMMAND $<TARGET_FILE:mirrormesh_load>
+        ${CMAKE_BINARY_DIR}/mirrormesh_1.mesh ${nt})
+      # With the normals and tangents
+      ADD_TEST(NAME mirrormesh_LoadGeom${nt}
+        COMMAND $<TARGET_FILE:mirrormesh_load>
+        ${MIRRORMESH_CI_TESTS}/0.mesh ${nt})
+    ENDFOREACH ( )
+
+    # Replicated adjacency against the one hashed by Mmg
+    ADD_LIBRARY_TEST ( mirrormesh_adja
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_adja.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_Adja
+      COMMAND $<TARGET_FILE:mirrormesh_adja>
+      ${MIRRORMESH_CI_TESTS}/0.mesh 1 1 1 0)
+    ADD_TEST(NAME mirrormesh_AdjaRenum
+      COMMAND $<TARGET_FILE:mirrormesh_adja>
+      ${MIRRORMESH_CI_TESTS}/0.mesh 2 0 1 1)
+    ADD_TEST(NAME mirrormesh_AdjaPeriodic
+      COMMAND $<TARGET_FILE:mirrormesh_adja>
+      ${MIRRORMESH_CI_TESTS}/periodic.mesh 1 2 1 0 xyz)
+
+    # Replication in the memory predicted by the dry run
+    ADD_LIBRARY_TEST ( mirrormesh_mem
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_mem.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_Mem
+      COMMAND $<TARGET_FILE:mirrormesh_mem>
+      ${MIRRORMESH_CI_TESTS}/0.mesh 1 1 1 0)
+    ADD_TEST(NAME mirrormesh_MemAdja
+      COMMAND $<TARGET_FILE:mirrormesh_mem>
+      ${MIRRORMESH_CI_TESTS}/0.mesh 1 1 1 1)
+    ADD_TEST(NAME mirrormesh_MemAdjaPeriodic
+      COMMAND $<TARGET_FILE:mirrormesh_mem>
+      ${MIRRORMESH_CI_TESTS}/periodic.mesh 1 2 1 1)
+
+    # Reflection of the vector and tensor fields in each copy
+    ADD_LIBRARY_TEST ( mirrormesh_sol
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_sol.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_SolReflect
+      COMMAND $<TARGET_FILE:mirrormesh_sol>
+      ${MIRRORMESH_CI_TESTS}/0.mesh ${MIRRORMESH_CI_TESTS}/0.sol 1 1 1)
+    ADD_TEST(NAME mirrormesh_SolReflect203
+      COMMAND $<TARGET_FILE:mirrormesh_sol>
+      ${MIRRORMESH_CI_TESTS}/0.mesh ${MIRRORMESH_CI_TESTS}/0.sol 2 0 3)
+
+    # Replication of arrays against the one of the Mmg mesh
+    ADD_LIBRARY_TEST ( mirrormesh_arrays
+      ${MIRRORMESH_CI_TESTS}/code/mirrormesh_arrays.c
+      copy_mirrormesh_headers ${MIRRORMESH_TEST_LIB} )
+    ADD_TEST(NAME mirrormesh_Arrays
+      COMMAND $<TARGET_FILE:mirrormesh_arrays>
+      ${MIRRORMESH_CI_TESTS}/0.mesh 2 0 1 0)
+    ADD_TEST(NAME mirrormesh_ArraysRenum
+      COMMAND $<TARGET_FILE:mirrormesh_arrays>
+      ${MIRRORMESH_CI_TESTS}/0.mesh 1 1 1 1)
+  ENDIF ( )
+
+  # Reduced benchmark (ctest -L bench), compared with the baseline stored by
+  # its first run
+  IF ( TARGET mirrormesh_bench )
+    SET ( MIRRORMESH_BENCH_BASELINE
+      ${CMAKE_BINARY_DIR}/mirrormesh_bench_baseline.csv CACHE FILEPATH
+      "Baseline of the reduced benchmark (written by its first run)" )
+
+    ADD_TEST(NAME mirrormesh_Bench
+      COMMAND $<TARGET_FILE:mirrormesh_bench> -ne 20000
+      -nmir 1,1,1 -nmir 2,2,2 -nt 1,0 -reps 3
+      -out ${CMAKE_BINARY_DIR}/mirrormesh_bench.csv
+      -baseline ${MIRRORMESH_BENCH_BASELINE} -tol 0.3)
+    SET_TESTS_PROPERTIES(mirrormesh_Bench PROPERTIES
+      LABELS bench RUN_SERIAL TRUE)
+  ENDIF ( )
+
 ENDIF()
@@ -0,0 +1,516 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file API_functions.c
+ * \brief C API functions definitions for MIRRORMESH library.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * \note This file contains some internal functions for the API, see
+ * the \ref libmirrormesh.h header file for the documentation of all
+ * the usefull user's API functions.
+ *
+ * C API for MIRRORMESH library.
+ *
+ */
+#include "mirrormesh.h"
+
+int MIRRORMESH_Init_parameters(MIRRORMESH_pInfo info) {
+
+  assert ( info );
+
+  /* Number of mirrors along each direction */
+  info->nmir[0] = info->nmir[1] = info->nmir[2] = 1;
+
+  /* Mirroring along each direction */
+  info->mode[0] = info->mode[1] = info->mode[2] = MIRRORMESH_MIRROR;
+
+  /* Let the runtime choose the number of threads */
+  info->nthreads = 0;
+
+  /* Welding tolerance, relative to the bounding box size */
+  info->weldTol = 1.e-8;
+
+  /* Build the replicated mesh before saving it */
+  info->stream = 0;
+
+  /* Write the replicated mesh in a single file */
+  info->nparts = 0;
+
+  /* Input numbering kept */
+  info->renum = 0;
+
+  /* No adjacency of the replicated mesh */
+  info->adja = 0;
+
+  /* Build the replicated mesh (not only its sizes) */
+  info->dryrun = 0;
+
+  /* Single replication, jobs of a batch run by as many threads */
+  info->njobs     = 0;
+  info->batchname = NULL;
+
+  /* Default size of the tiles of base elements */
+  info->tile = 0;
+
+  /* 64-bit output formats beyond 2^31-1 entities */
+  info->int32max = 0;
+
+  /* New replication, not the extension of a previous one */
+  info->nstage   = 0;
+  info->growname = NULL;
+
+  /* No tangents read with the mesh */
+  info->tangent = NULL;
+
+  /* No measures yet */
+  info->statsname = NULL;
+  memset(&info->stats,0,sizeof(MIRRORMESH_Stats));
+
+  return 1;
+}
+
+int MIRRORMESH_Set_iparameter(MIRRORMESH_pInfo info,int iparam,int val) {
+
+  switch ( iparam ) {
+  case MIRRORMESH_IPARAM_nx :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of mirrors must be positive.\n",
+              __func__);
+      return 0;
+    }
+    info->nmir[0] = val;
+    break;
+  case MIRRORMESH_IPARAM_ny :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of mirrors must be positive.\n",
+              __func__);
+      return 0;
+    }
+    info->nmir[1] = val;
+    break;
+  case MIRRORMESH_IPARAM_nz :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of mirrors must be positive.\n",
+              __func__);
+      return 0;
+    }
+    info->nmir[2] = val;
+    break;
+  case MIRRORMESH_IPARAM_nthreads :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of threads must be positive.\n",
+              __func__);
+      return 0;
+    }
+#ifndef _OPENMP
+    if ( val > 1 ) {
+      fprintf(stderr,"\n  ## Warning: %s: mirrormesh compiled without OpenMP."
+              " Number of threads ignored.\n",__func__);
+    }
+#endif
+    info->nthreads = val;
+    break;
+  case MIRRORMESH_IPARAM_renum :
+    info->renum = val;
+    break;
+  case MIRRORMESH_IPARAM_adja :
+    info->adja = val;
+    break;
+  case MIRRORMESH_IPARAM_modex : case MIRRORMESH_IPARAM_modey :
+  case MIRRORMESH_IPARAM_modez :
+    if ( val != MIRRORMESH_MIRROR && val != MIRRORMESH_TRANSLATE ) {
+      fprintf(stderr,"\n  ## Error: %s: unknown replication mode %d.\n",
+              __func__,val);
+      return 0;
+    }
+    info->mode[iparam-MIRRORMESH_IPARAM_modex] = val;
+    break;
+  case MIRRORMESH_IPARAM_njobs :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: number of jobs must be positive.\n",
+              __func__);
+      return 0;
+    }
+    info->njobs = val;
+    break;
+  case MIRRORMESH_IPARAM_tile :
+    if ( val < -1 ) {
+      fprintf(stderr,"\n  ## Error: %s: tile size must be positive (or -1).\n",
+              __func__);
+      return 0;
+    }
+    info->tile = val;
+    break;
+  case MIRRORMESH_IPARAM_int32max :
+    if ( val < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: largest 32-bit index must be"
+              " positive.\n",__func__);
+      return 0;
+    }
+    info->int32max = val;
+    break;
+  default :
+    fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
+    return 0;
+  }
+
+  return 1;
+}
+
+int MIRRORMESH_Set_dparameter(MIRRORMESH_pInfo info,int dparam,double val) {
+
+  switch ( dparam ) {
+  case MIRRORMESH_DPARAM_weldTol :
+    if ( val < 0. ) {
+      fprintf(stderr,"\n  ## Error: %s: welding tolerance must be positive.\n",
+              __func__);
+      return 0;
+    }
+    info->weldTol = val;
+    break;
+  default :
+    fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
+    return 0;
+  }
+
+  return 1;
+}
+
+int MIRRORMESH_Add_stage(MIRRORMESH_pInfo info,int nx,int ny,int nz) {
+  int *prev;
+
+  if ( nx < 0 || ny < 0 || nz < 0 ) {
+    fprintf(stderr,"\n  ## Error: %s: number of mirrors must be positive.\n",
+            __func__);
+    return 0;
+  }
+  if ( info->nstage == MIRRORMESH_NSTAGE ) {
+    fprintf(stderr,"\n  ## Error: %s: more than %d previous replications.\n",
+            __func__,MIRRORMESH_NSTAGE);
+    return 0;
+  }
+  if ( info->nstage ) {
+    prev = info->stage[info->nstage-1];
+    if ( nx < prev[0] || ny < prev[1] || nz < prev[2] ) {
+      fprintf(stderr,"\n  ## Error: %s: replication %d x %d x %d smaller than"
+              " the previous one.\n",__func__,nx,ny,nz);
+      return 0;
+    }
+  }
+  info->stage[info->nstage][0] = nx;
+  info->stage[info->nstage][1] = ny;
+  info->stage[info->nstage][2] = nz;
+  ++info->nstage;
+
+  return 1;
+}
+
+int MIRRORMESH_Get_stats(MIRRORMESH_pInfo info,MIRRORMESH_pStats stats) {
+
+  if ( !info || !stats ) {
+    fprintf(stderr,"\n  ## Error: %s: missing structure.\n",__func__);
+    return 0;
+  }
+  memcpy(stats,&info->stats,sizeof(MIRRORMESH_Stats));
+
+  return 1;
+}
+
+int MIRRORMESH_Init_lattice(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                            MIRRORMESH_pLattice *lattice) {
+
+  return MIRRORMESH_Init_latticeSols(mesh,NULL,NULL,info,lattice);
+}
+
+int MIRRORMESH_Init_latticeSols(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,
+                                MIRRORMESH_pInfo info,
+                                MIRRORMESH_pLattice *lattice) {
+  MIRRORMESH_Info binfo;
+  MMG5_pMesh      bmesh;
+  MMG5_pSol       bsol;
+
+  assert ( mesh && info && lattice );
+
+  MMG5_SAFE_CALLOC(*lattice,1,MIRRORMESH_Lattice,return 0);
+
+  /* The renumbering applies to a copy owned by the lattice: the mesh and the
+   * fields of the caller are left unchanged */
+  bmesh = mesh;
+  bsol  = NULL;
+  binfo = *info;
+  if ( info->renum ) {
+    if ( !MIRRORMESH_copy_base(mesh,met,sol,info->tangent,&bmesh,&bsol) ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to copy the base mesh.\n",
+              __func__);
+      MMG5_SAFE_FREE(*lattice);
+      return 0;
+    }
+    met = bsol ? &bsol[0] : NULL;
+    sol = bsol && bmesh->nsols ? &bsol[1] : NULL;
+    binfo.tangent = bsol && bsol[bmesh->nsols+1].m ?
+      &bsol[bmesh->nsols+1] : NULL;
+  }
+
+  if ( !MIRRORMESH_build_lattice(bmesh,met,sol,&binfo,*lattice) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to build the replicated mesh.\n",
+            __func__);
+    if ( bsol ) {
+      MIRRORMESH_free_solCopy(bmesh,&bsol);
+    }
+    if ( bmesh != mesh ) {
+      MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&bmesh,MMG5_ARG_end);
+    }
+    MMG5_SAFE_FREE(*lattice);
+    return 0;
+  }
+  if ( bmesh != mesh ) {
+    (*lattice)->ownmesh = 1;
+    (*lattice)->solcopy = bsol;
+  }
+
+  return 1;
+}
+
+int MIRRORMESH_Free_lattice(MIRRORMESH_pLattice *lattice) {
+  MMG5_pMesh mesh;
+
+  if ( !*lattice ) return 1;
+
+  /* Base mesh built by MIRRORMESH_Init_latticeArrays */
+  mesh = (*lattice)->ownmesh ? (*lattice)->mesh : NULL;
+
+  MIRRORMESH_free_lattice(*lattice);
+  MMG5_SAFE_FREE(*lattice);
+
+  if ( mesh ) {
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+  }
+
+  return 1;
+}
+
+int MIRRORMESH_Free_tangents(MMG5_pMesh mesh,MIRRORMESH_pInfo info) {
+
+  if ( !info->tangent ) return 1;
+
+  if ( info->tangent->m ) {
+    MMG5_DEL_MEM(mesh,info->tangent->m);
+  }
+  MMG5_SAFE_FREE(info->tangent);
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeSize(MIRRORMESH_pLattice lattice,MIRRORMESH_int *np,
+                               MIRRORMESH_int *ne,MIRRORMESH_int *nt,
+                               MIRRORMESH_int *na) {
+  int ncopy = lattice->ncopy;
+
+  if ( np ) *np = lattice->point.offset[ncopy];
+  if ( ne ) *ne = lattice->tetra.offset[ncopy];
+  if ( nt ) *nt = lattice->tria.offset[ncopy];
+  if ( na ) *na = lattice->edge.offset[ncopy];
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeVertex(MIRRORMESH_pLattice lattice,MIRRORMESH_int k,
+                                 double *c0,double *c1,double *c2,int *ref) {
+  double c[3];
+  int    ip,icopy;
+
+  ip = MIRRORMESH_lattice_locate(lattice,&lattice->point,k,&icopy);
+  if ( !ip ) {
+    fprintf(stderr,"\n  ## Error: %s: vertex %" MIRRORMESH_PRId
+            " out of range.\n",__func__,k);
+    return 0;
+  }
+
+  MIRRORMESH_lattice_coor(lattice,&lattice->copies[icopy],ip,c);
+  *c0 = c[0];
+  *c1 = c[1];
+  *c2 = c[2];
+  if ( ref ) *ref = lattice->mesh->point[ip].ref;
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeSol(MIRRORMESH_pLattice lattice,int isol,
+                              MIRRORMESH_int k,double *s) {
+  int ip,icopy;
+
+  if ( isol < 0 || isol >= lattice->nsol ) {
+    fprintf(stderr,"\n  ## Error: %s: field %d out of range.\n",__func__,isol);
+    return 0;
+  }
+
+  ip = MIRRORMESH_lattice_locate(lattice,&lattice->point,k,&icopy);
+  if ( !ip ) {
+    fprintf(stderr,"\n  ## Error: %s: vertex %" MIRRORMESH_PRId
+            " out of range.\n",__func__,k);
+    return 0;
+  }
+
+  MIRRORMESH_lattice_sol(&lattice->copies[icopy],lattice->sol[isol],ip,s);
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeVertices(MIRRORMESH_pLattice lattice,
+                                   MIRRORMESH_int kstart,MIRRORMESH_int kend,
+                                   double *vertices,int *refs) {
+  MMG5_pMesh     mesh = lattice->mesh;
+  MIRRORMESH_int k,j;
+  int            ip,icopy,pos;
+
+  ip = MIRRORMESH_lattice_locate(lattice,&lattice->point,kstart,&icopy);
+  if ( !ip || kend < kstart || kend > lattice->point.offset[lattice->ncopy] ) {
+    fprintf(stderr,"\n  ## Error: %s: vertices %" MIRRORMESH_PRId "-%"
+            MIRRORMESH_PRId " out of range.\n",__func__,kstart,kend);
+    return 0;
+  }
+
+  /* Walk over the points of the copies, skipping the duplicated ones */
+  pos = lattice->copies[icopy].pos;
+  for ( k=kstart,j=0; k<=kend; ++k,++j ) {
+    MIRRORMESH_lattice_coor(lattice,&lattice->copies[icopy],ip,&vertices[3*j]);
+    if ( refs ) refs[j] = mesh->point[ip].ref;
+
+    do {
+      if ( ++ip > mesh->npi ) {
+        ip = 1;
+        if ( ++pos == lattice->ncopy ) break;
+        icopy = lattice->order[pos];
+      }
+    }
+    while ( k < kend &&
+            MIRRORMESH_lattice_skip(lattice,&lattice->point,icopy,1,&ip) );
+  }
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeTetrahedron(MIRRORMESH_pLattice lattice,
+                                      MIRRORMESH_int k,MIRRORMESH_int *v0,
+                                      MIRRORMESH_int *v1,MIRRORMESH_int *v2,
+                                      MIRRORMESH_int *v3,int *ref) {
+  MIRRORMESH_int v[4];
+  int            ie,icopy;
+
+  ie = MIRRORMESH_lattice_locate(lattice,&lattice->tetra,k,&icopy);
+  if ( !ie ) {
+    fprintf(stderr,"\n  ## Error: %s: tetrahedron %" MIRRORMESH_PRId
+            " out of range.\n",__func__,k);
+    return 0;
+  }
+
+  MIRRORMESH_lattice_tetra(lattice,icopy,ie,v);
+  *v0 = v[0];
+  *v1 = v[1];
+  *v2 = v[2];
+  *v3 = v[3];
+  if ( ref ) *ref = lattice->mesh->tetra[ie].ref;
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeTetrahedra(MIRRORMESH_pLattice lattice,
+                                     MIRRORMESH_int kstart,MIRRORMESH_int kend,
+                                     MIRRORMESH_int *tetra,int *refs) {
+  MMG5_pMesh     mesh = lattice->mesh;
+  MIRRORMESH_int k,j;
+  int            ie,icopy,pos;
+
+  ie = MIRRORMESH_lattice_locate(lattice,&lattice->tetra,kstart,&icopy);
+  if ( !ie || kend < kstart || kend > lattice->tetra.offset[lattice->ncopy] ) {
+    fprintf(stderr,"\n  ## Error: %s: tetrahedra %" MIRRORMESH_PRId "-%"
+            MIRRORMESH_PRId " out of range.\n",__func__,kstart,kend);
+    return 0;
+  }
+
+  /* Walk over the tetra of the copies, skipping the duplicated ones */
+  pos = lattice->copies[icopy].pos;
+  for ( k=kstart,j=0; k<=kend; ++k,++j ) {
+    MIRRORMESH_lattice_tetra(lattice,icopy,ie,&tetra[4*j]);
+    if ( refs ) refs[j] = mesh->tetra[ie].ref;
+
+    do {
+      if ( ++ie > mesh->nei ) {
+        ie = 1;
+        if ( ++pos == lattice->ncopy ) break;
+        icopy = lattice->order[pos];
+      }
+    }
+    while ( k < kend &&
+            MIRRORMESH_lattice_skip(lattice,&lattice->tetra,icopy,4,
+                                    mesh->tetra[ie].v) );
+  }
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeTriangle(MIRRORMESH_pLattice lattice,
+                                   MIRRORMESH_int k,MIRRORMESH_int *v0,
+                                   MIRRORMESH_int *v1,MIRRORMESH_int *v2,
+                                   int *ref) {
+  MIRRORMESH_int v[3];
+  int            it,icopy;
+
+  it = MIRRORMESH_lattice_locate(lattice,&lattice->tria,k,&icopy);
+  if ( !it ) {
+    fprintf(stderr,"\n  ## Error: %s: triangle %" MIRRORMESH_PRId
+            " out of range.\n",__func__,k);
+    return 0;
+  }
+
+  MIRRORMESH_lattice_tria(lattice,icopy,it,v);
+  *v0 = v[0];
+  *v1 = v[1];
+  *v2 = v[2];
+  if ( ref ) *ref = lattice->mesh->tria[it].ref;
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeEdge(MIRRORMESH_pLattice lattice,MIRRORMESH_int k,
+                               MIRRORMESH_int *e0,MIRRORMESH_int *e1,int *ref) {
+  MIRRORMESH_int v[2];
+  int            ia,icopy;
+
+  ia = MIRRORMESH_lattice_locate(lattice,&lattice->edge,k,&icopy);
+  if ( !ia ) {
+    fprintf(stderr,"\n  ## Error: %s: edge %" MIRRORMESH_PRId
+            " out of range.\n",__func__,k);
+    return 0;
+  }
+
+  MIRRORMESH_lattice_edge(lattice,icopy,ia,v);
+  *e0 = v[0];
+  *e1 = v[1];
+  if ( ref ) *ref = lattice->mesh->edge[ia].ref;
+
+  return 1;
+}
@@ -0,0 +1,484 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+
+/**
+ * \file arrays.c
+ * \brief Exchange of the base and replicated meshes through caller arrays.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The base mesh is given as coordinate and connectivity arrays owned by the
+ * caller (\ref MIRRORMESH_Init_latticeArrays) and the replicated mesh is
+ * written in arrays owned by the caller (\ref MIRRORMESH_Get_latticeArrays)
+ * or given chunk by chunk to a sink (\ref MIRRORMESH_Get_latticeChunks),
+ * without building a Mmg mesh on the caller side. Arrays are stored entity by
+ * entity or component by component (\ref MIRRORMESH_Layout) with 32- or
+ * 64-bit indices (\ref MIRRORMESH_IndexSize), vertices being numbered from 1.
+ *
+ */
+#include "mirrormesh.h"
+
+/* Position of the component i of the entity k (from 0) in an array of n
+ * entities of dim components */
+#define MIRRORMESH_ARRPOS(layout,n,dim,k,i)                             \
+  ( (layout) == MIRRORMESH_SOA ? (MIRRORMESH_int)(i)*(n)+(k) :         \
+    (MIRRORMESH_int)(dim)*(k)+(i) )
+
+/* Size of an entity in the chunk buffers (4 64-bit indices at most) */
+#define MIRRORMESH_ARRLEN (4*sizeof(int64_t))
+
+/** Entity types, in the output order */
+static const int MIRRORMESH_arrType[4] = {
+  MMG5_Vertex,MMG5_Tetrahedron,MMG5_Triangle,MMG5_Edg
+};
+
+static inline
+MIRRORMESH_int MIRRORMESH_getIndex(const void *a,int isize,MIRRORMESH_int pos) {
+  if ( isize == MIRRORMESH_INDEX64 ) return ((const int64_t*)a)[pos];
+  return ((const int32_t*)a)[pos];
+}
+
+static inline
+void MIRRORMESH_setIndex(void *a,int isize,MIRRORMESH_int pos,
+                         MIRRORMESH_int v) {
+  if ( isize == MIRRORMESH_INDEX64 ) ((int64_t*)a)[pos] = v;
+  else ((int32_t*)a)[pos] = (int32_t)v;
+}
+
+/* Number of components of an entity: coordinates or vertices */
+static inline
+int MIRRORMESH_arrDim(int type) {
+  switch ( type ) {
+  case MMG5_Tetrahedron:
+    return 4;
+  case MMG5_Edg:
+    return 2;
+  default:
+    return 3;
+  }
+}
+
+static inline
+MIRRORMESH_pNumbering MIRRORMESH_arrNum(MIRRORMESH_pLattice lat,int type) {
+  switch ( type ) {
+  case MMG5_Vertex:
+    return &lat->point;
+  case MMG5_Tetrahedron:
+    return &lat->tetra;
+  case MMG5_Triangle:
+    return &lat->tria;
+  default:
+    return &lat->edge;
+  }
+}
+
+/**
+ * \param layout layout of the arrays (\ref MIRRORMESH_Layout)
+ * \param isize size of the indices (\ref MIRRORMESH_IndexSize)
+ *
+ * \return 1 if the format is valid, 0 otherwise.
+ *
+ */
+static int MIRRORMESH_arrFormat(int layout,int isize) {
+  if ( (layout != MIRRORMESH_AOS && layout != MIRRORMESH_SOA) ||
+       (isize != MIRRORMESH_INDEX32 && isize != MIRRORMESH_INDEX64) ) {
+    fprintf(stderr,"\n  ## Error: unknown layout (%d) or index size (%d).\n",
+            layout,isize);
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the base mesh
+ * \param type type of the elements
+ * \param n number of elements
+ * \param layout layout of the arrays
+ * \param isize size of the indices
+ * \param cells vertices of the elements
+ * \param refs references of the elements (may be NULL)
+ * \param nthreads number of threads
+ *
+ * \return the number of invalid vertex indices.
+ *
+ * Copy the elements of a type from the caller arrays into the base mesh.
+ *
+ */
+static int MIRRORMESH_getCells(MMG5_pMesh mesh,int type,int n,int layout,
+                               int isize,const void *cells,const int *refs,
+                               int nthreads) {
+  int dim = MIRRORMESH_arrDim(type);
+  int k,nbad;
+
+  nbad = 0;
+#pragma omp parallel for num_threads(nthreads) schedule(static) \
+  reduction(+:nbad)
+  for ( k=0; k<n; ++k ) {
+    MIRRORMESH_int g;
+    int            i,v[4],ref;
+
+    for ( i=0; i<dim; ++i ) {
+      g = MIRRORMESH_getIndex(cells,isize,
+                              MIRRORMESH_ARRPOS(layout,n,dim,k,i));
+      if ( g < 1 || g > mesh->np ) {
+        ++nbad;
+        g = 1;
+      }
+      v[i] = (int)g;
+    }
+    ref = refs ? refs[k] : 0;
+
+    switch ( type ) {
+    case MMG5_Tetrahedron:
+      memcpy(mesh->tetra[k+1].v,v,4*sizeof(int));
+      mesh->tetra[k+1].ref = ref;
+      break;
+    case MMG5_Triangle:
+      memcpy(mesh->tria[k+1].v,v,3*sizeof(int));
+      mesh->tria[k+1].ref = ref;
+      break;
+    default:
+      mesh->edge[k+1].a   = v[0];
+      mesh->edge[k+1].b   = v[1];
+      mesh->edge[k+1].ref = ref;
+    }
+  }
+
+  return nbad;
+}
+
+int MIRRORMESH_Init_latticeArrays(MIRRORMESH_pInfo info,int layout,int isize,
+                                  int np,const double *vertices,
+                                  const int *vrefs,int ne,const void *tetra,
+                                  const int *erefs,int nt,const void *tria,
+                                  const int *trefs,int na,const void *edges,
+                                  const int *arefs,
+                                  MIRRORMESH_pLattice *lattice) {
+  MMG5_pMesh mesh;
+  int        nthreads,nbad,nreo,k;
+
+  assert ( info && lattice );
+
+  if ( !MIRRORMESH_arrFormat(layout,isize) ) return 0;
+
+  if ( np < 1 || ne < 0 || nt < 0 || na < 0 || !vertices ||
+       (ne && !tetra) || (nt && !tria) || (na && !edges) ) {
+    fprintf(stderr,"\n  ## Error: %s: missing arrays.\n",__func__);
+    return 0;
+  }
+
+  /* Base mesh owned by the lattice: the engine works on Mmg structures */
+  mesh = NULL;
+  if ( !MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end) ) {
+    return 0;
+  }
+  if ( !MMG3D_Set_meshSize(mesh,np,ne,0,nt,0,na) ) {
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+    return 0;
+  }
+
+  nthreads = MIRRORMESH_NTHREADS(info);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( k=0; k<np; ++k ) {
+    MMG5_pPoint ppt = &mesh->point[k+1];
+    int         i;
+
+    for ( i=0; i<3; ++i ) {
+      ppt->c[i] = vertices[MIRRORMESH_ARRPOS(layout,np,3,k,i)];
+    }
+    ppt->ref = vrefs ? vrefs[k] : 0;
+    ppt->tag = MG_NUL;
+    ppt->tmp = 0;
+  }
+
+  nbad  = MIRRORMESH_getCells(mesh,MMG5_Tetrahedron,ne,layout,isize,tetra,
+                              erefs,nthreads);
+  nbad += MIRRORMESH_getCells(mesh,MMG5_Triangle,nt,layout,isize,tria,
+                              trefs,nthreads);
+  nbad += MIRRORMESH_getCells(mesh,MMG5_Edg,na,layout,isize,edges,
+                              arefs,nthreads);
+  if ( nbad ) {
+    fprintf(stderr,"\n  ## Error: %s: %d vertex indices out of range.\n",
+            __func__,nbad);
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+    return 0;
+  }
+
+  /* Used points, tetra orientation (Mmg convention) */
+  nreo = MIRRORMESH_init_base(mesh,nthreads);
+  if ( nreo ) {
+    fprintf(stdout,"\n  ## Warning: %s: %d tetra reoriented\n",__func__,nreo);
+  }
+
+  /* The base mesh belongs to the lattice: it is renumbered in place */
+  MMG5_SAFE_CALLOC(*lattice,1,MIRRORMESH_Lattice,
+                   MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,
+                                  MMG5_ARG_end);return 0);
+  if ( !MIRRORMESH_build_lattice(mesh,NULL,NULL,info,*lattice) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to build the replicated mesh.\n",
+            __func__);
+    MMG5_SAFE_FREE(*lattice);
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&mesh,MMG5_ARG_end);
+    return 0;
+  }
+  (*lattice)->ownmesh = 1;
+
+  return 1;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param type type of entity
+ * \param k index of the item: image of the base entity (k-1)%nbase+1 in the
+ * copy at position (k-1)/nbase in the numbering order
+ *
+ * \return the index of the item in the replicated mesh, 0 if it is a skipped
+ * entity.
+ *
+ */
+static inline
+MIRRORMESH_int MIRRORMESH_arrIndex(MIRRORMESH_pLattice lat,int type,
+                                   MIRRORMESH_int k) {
+  MIRRORMESH_pNumbering num = MIRRORMESH_arrNum(lat,type);
+  MMG5_pMesh            mesh = lat->mesh;
+  int                   cp   = lat->order[(k-1)/num->nbase];
+  int                   kb   = (int)((k-1)%num->nbase+1);
+  int                   v[2];
+
+  switch ( type ) {
+  case MMG5_Vertex:
+    if ( lat->itf.face[kb] & lat->copies[cp].dupmask ) return 0;
+    return MIRRORMESH_lattice_point(lat,cp,kb);
+  case MMG5_Tetrahedron:
+    if ( MIRRORMESH_lattice_skip(lat,num,cp,4,mesh->tetra[kb].v) ) return 0;
+    break;
+  case MMG5_Triangle:
+    if ( MIRRORMESH_lattice_skip(lat,num,cp,3,mesh->tria[kb].v) ) return 0;
+    break;
+  default:
+    v[0] = mesh->edge[kb].a;
+    v[1] = mesh->edge[kb].b;
+    if ( MIRRORMESH_lattice_skip(lat,num,cp,2,v) ) return 0;
+  }
+  return MIRRORMESH_lattice_index(lat,num,cp,kb);
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param type type of entity
+ * \param layout layout of the arrays
+ * \param isize size of the indices
+ * \param k index of the item (not skipped, see \ref MIRRORMESH_arrIndex)
+ * \param pos position of the entity in the arrays (from 0)
+ * \param n number of entities of the arrays
+ * \param data coordinates or vertices of the entities (may be NULL)
+ * \param refs references of the entities (may be NULL)
+ *
+ * Store the entity of the item \a k in the arrays.
+ *
+ */
+static inline
+void MIRRORMESH_arrPut(MIRRORMESH_pLattice lat,int type,int layout,int isize,
+                       MIRRORMESH_int k,MIRRORMESH_int pos,MIRRORMESH_int n,
+                       void *data,int *refs) {
+  MIRRORMESH_pNumbering num  = MIRRORMESH_arrNum(lat,type);
+  MMG5_pMesh            mesh = lat->mesh;
+  MIRRORMESH_int        v[4];
+  double                c[3];
+  int                   cp   = lat->order[(k-1)/num->nbase];
+  int                   kb   = (int)((k-1)%num->nbase+1);
+  int                   i,dim,ref;
+
+  dim = MIRRORMESH_arrDim(type);
+  switch ( type ) {
+  case MMG5_Vertex:
+    if ( data ) {
+      MIRRORMESH_lattice_coor(lat,&lat->copies[cp],kb,c);
+      for ( i=0; i<3; ++i ) {
+        ((double*)data)[MIRRORMESH_ARRPOS(layout,n,3,pos,i)] = c[i];
+      }
+    }
+    ref = mesh->point[kb].ref;
+    break;
+  case MMG5_Tetrahedron:
+    if ( data ) MIRRORMESH_lattice_tetra(lat,cp,kb,v);
+    ref = mesh->tetra[kb].ref;
+    break;
+  case MMG5_Triangle:
+    if ( data ) MIRRORMESH_lattice_tria(lat,cp,kb,v);
+    ref = mesh->tria[kb].ref;
+    break;
+  default:
+    if ( data ) MIRRORMESH_lattice_edge(lat,cp,kb,v);
+    ref = mesh->edge[kb].ref;
+  }
+
+  if ( data && type != MMG5_Vertex ) {
+    for ( i=0; i<dim; ++i ) {
+      MIRRORMESH_setIndex(data,isize,MIRRORMESH_ARRPOS(layout,n,dim,pos,i),
+                          v[i]);
+    }
+  }
+  if ( refs ) refs[pos] = ref;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param isize size of the indices
+ *
+ * \return 1 if the vertex indices fit in \a isize, 0 otherwise.
+ *
+ */
+static int MIRRORMESH_arrFit(MIRRORMESH_pLattice lat,int isize) {
+  MIRRORMESH_int np = lat->point.offset[lat->ncopy];
+
+  if ( isize == MIRRORMESH_INDEX32 && np > MIRRORMESH_INT32MAX ) {
+    fprintf(stderr,"\n  ## Error: %" MIRRORMESH_PRId " vertices: indices do"
+            " not fit in 32 bits (use MIRRORMESH_INDEX64).\n",np);
+    return 0;
+  }
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeArrays(MIRRORMESH_pLattice lattice,int layout,
+                                 int isize,double *vertices,int *vrefs,
+                                 void *tetra,int *erefs,void *tria,int *trefs,
+                                 void *edges,int *arefs) {
+  void           *data[4];
+  int            *refs[4];
+  MIRRORMESH_int k,n,nitem;
+  int            l,type;
+
+  if ( !MIRRORMESH_arrFormat(layout,isize) ) return 0;
+  if ( (tetra || tria || edges) && !MIRRORMESH_arrFit(lattice,isize) ) {
+    return 0;
+  }
+
+  data[0] = vertices; refs[0] = vrefs;
+  data[1] = tetra;    refs[1] = erefs;
+  data[2] = tria;     refs[2] = trefs;
+  data[3] = edges;    refs[3] = arefs;
+
+  /* Each entity is written at its index: no ordering between the threads */
+  for ( l=0; l<4; ++l ) {
+    MIRRORMESH_pNumbering num;
+
+    type  = MIRRORMESH_arrType[l];
+    num   = MIRRORMESH_arrNum(lattice,type);
+    n     = num->offset[lattice->ncopy];
+    nitem = (MIRRORMESH_int)lattice->ncopy*num->nbase;
+    if ( !n || (!data[l] && !refs[l]) ) continue;
+
+#pragma omp parallel for num_threads(lattice->nthreads) schedule(static)
+    for ( k=1; k<=nitem; ++k ) {
+      MIRRORMESH_int idx = MIRRORMESH_arrIndex(lattice,type,k);
+
+      if ( !idx ) continue;
+      MIRRORMESH_arrPut(lattice,type,layout,isize,k,idx-1,n,data[l],refs[l]);
+    }
+  }
+
+  return 1;
+}
+
+int MIRRORMESH_Get_latticeChunks(MIRRORMESH_pLattice lattice,int layout,
+                                 int isize,MIRRORMESH_Sink sink,void *user) {
+  MMG5_pMesh     mesh = lattice->mesh;
+  MIRRORMESH_int *idx,*kstart,*len,nitem,nchunk,c0;
+  char           *buf;
+  size_t         bufsiz,siz;
+  int            *refs,nbuf,l,j,type;
+
+  if ( !MIRRORMESH_arrFormat(layout,isize) ) return 0;
+  if ( !MIRRORMESH_arrFit(lattice,isize) ) return 0;
+
+  nbuf   = MG_MAX(lattice->nthreads,1);
+  bufsiz = MIRRORMESH_CHUNK*MIRRORMESH_ARRLEN;
+  siz    = nbuf*(bufsiz + MIRRORMESH_CHUNK*(sizeof(int)+sizeof(MIRRORMESH_int))
+                 + 2*sizeof(MIRRORMESH_int));
+
+  MMG5_ADD_MEM(mesh,siz,"output buffers",return 0);
+  MMG5_SAFE_MALLOC(buf,nbuf*bufsiz,char,return 0);
+  MMG5_SAFE_MALLOC(refs,nbuf*MIRRORMESH_CHUNK,int,
+                   MMG5_DEL_MEM(mesh,buf);return 0);
+  MMG5_SAFE_MALLOC(idx,nbuf*MIRRORMESH_CHUNK+2*nbuf,MIRRORMESH_int,
+                   MMG5_DEL_MEM(mesh,buf);MMG5_DEL_MEM(mesh,refs);return 0);
+  kstart = &idx[nbuf*MIRRORMESH_CHUNK];
+  len    = &kstart[nbuf];
+
+  for ( l=0; l<4; ++l ) {
+    type   = MIRRORMESH_arrType[l];
+    nitem  = (MIRRORMESH_int)lattice->ncopy
+      * MIRRORMESH_arrNum(lattice,type)->nbase;
+    nchunk = (nitem + MIRRORMESH_CHUNK - 1) / MIRRORMESH_CHUNK;
+
+    /* Waves of chunks filled in parallel, then given to the sink in order */
+    for ( c0=0; c0<nchunk; c0+=nbuf ) {
+      int nc = (int)MG_MIN(nbuf,nchunk-c0);
+
+#pragma omp parallel for num_threads(lattice->nthreads) schedule(static)
+      for ( j=0; j<nc; ++j ) {
+        MIRRORMESH_int *ind = &idx[j*MIRRORMESH_CHUNK];
+        MIRRORMESH_int k0   = (c0+j)*MIRRORMESH_CHUNK;
+        int            i,n,cnt;
+
+        /* The images of a chunk of items are consecutive entities */
+        n   = (int)MG_MIN(MIRRORMESH_CHUNK,nitem-k0);
+        cnt = 0;
+        for ( i=0; i<n; ++i ) {
+          ind[i] = MIRRORMESH_arrIndex(lattice,type,k0+i+1);
+          if ( ind[i] && !cnt++ ) kstart[j] = ind[i];
+        }
+        len[j] = cnt;
+
+        for ( i=0; i<n; ++i ) {
+          if ( !ind[i] ) continue;
+          MIRRORMESH_arrPut(lattice,type,layout,isize,k0+i+1,ind[i]-kstart[j],
+                            cnt,&buf[j*bufsiz],&refs[j*MIRRORMESH_CHUNK]);
+        }
+      }
+
+      for ( j=0; j<nc; ++j ) {
+        if ( !len[j] ) continue;
+        if ( !sink(user,type,kstart[j],len[j],&buf[j*bufsiz],
+                   &refs[j*MIRRORMESH_CHUNK]) ) {
+          fprintf(stderr,"\n  ## Error: %s: output stopped by the sink.\n",
+                  __func__);
+          MMG5_DEL_MEM(mesh,idx);
+          MMG5_DEL_MEM(mesh,refs);
+          MMG5_DEL_MEM(mesh,buf);
+          return 0;
+        }
+      }
+    }
+  }
+
+  MMG5_DEL_MEM(mesh,idx);
+  MMG5_DEL_MEM(mesh,refs);
+  MMG5_DEL_MEM(mesh,buf);
+
+  return 1;
+}
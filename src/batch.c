@@ -0,0 +1,420 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file batch.c
+ * \brief Replications listed in a file, sharing their base meshes.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * Each job of a batch replicates an input mesh and writes it on the fly
+ * (\ref MIRRORMESH_saveLattice). Each distinct input mesh is loaded once and
+ * the part of the lattice that only depends on it (renumbering, interface
+ * points and entities, see \ref MIRRORMESH_build_base) is built once for all
+ * its jobs. The jobs are then run concurrently, each one only setting its
+ * copies (\ref MIRRORMESH_set_copies) and keeping its output buffers for the
+ * next job run by the same thread.
+ *
+ */
+#include "mirrormesh.h"
+
+/** Maximal length of a line of a batch file */
+#define MIRRORMESH_BATCHLEN 4096
+
+/**
+ * \struct MIRRORMESH_Job
+ * \brief Replication of a batch.
+ */
+typedef struct {
+  int  base; /*!< index of the input mesh among the distinct ones */
+  int  nmir[3]; /*!< number of mirrors in each direction */
+  int  line; /*!< line of the job in the batch file */
+  char *out; /*!< output mesh file */
+} MIRRORMESH_Job;
+typedef MIRRORMESH_Job * MIRRORMESH_pJob;
+
+/**
+ * \struct MIRRORMESH_Batch
+ * \brief Jobs of a batch and their distinct input meshes.
+ */
+typedef struct {
+  MIRRORMESH_Job     *job; /*!< jobs, in the order of the file */
+  int                njob; /*!< number of jobs */
+  char               **name; /*!< names of the distinct input meshes */
+  MMG5_pMesh         *mesh; /*!< distinct input meshes */
+  MMG5_pSol          *tangent; /*!< tangents read with the input meshes */
+  MIRRORMESH_Lattice *base; /*!< lattice bases of the input meshes */
+  int                nbase; /*!< number of distinct input meshes */
+} MIRRORMESH_Batch;
+typedef MIRRORMESH_Batch * MIRRORMESH_pBatch;
+
+/**
+ * \param str string to copy
+ *
+ * \return a copy of \a str, NULL if fail.
+ *
+ */
+static char *MIRRORMESH_strdup(const char *str) {
+  char *cpy;
+
+  MMG5_SAFE_MALLOC(cpy,strlen(str)+1,char,return NULL);
+  strcpy(cpy,str);
+
+  return cpy;
+}
+
+/**
+ * \param batch pointer toward the batch
+ *
+ * Free the jobs, the input meshes and their lattice bases.
+ *
+ */
+static void MIRRORMESH_free_batch(MIRRORMESH_pBatch batch) {
+  int j;
+
+  for ( j=0; j<batch->njob; ++j ) {
+    MMG5_SAFE_FREE(batch->job[j].out);
+  }
+  for ( j=0; j<batch->nbase; ++j ) {
+    if ( batch->base && batch->base[j].mesh ) {
+      MIRRORMESH_free_lattice(&batch->base[j]);
+    }
+    if ( batch->tangent && batch->tangent[j] ) {
+      if ( batch->tangent[j]->m ) {
+        MMG5_DEL_MEM(batch->mesh[j],batch->tangent[j]->m);
+      }
+      MMG5_SAFE_FREE(batch->tangent[j]);
+    }
+    if ( batch->mesh && batch->mesh[j] ) {
+      MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&batch->mesh[j],
+                     MMG5_ARG_end);
+    }
+    MMG5_SAFE_FREE(batch->name[j]);
+  }
+  MMG5_SAFE_FREE(batch->job);
+  MMG5_SAFE_FREE(batch->name);
+  MMG5_SAFE_FREE(batch->mesh);
+  MMG5_SAFE_FREE(batch->tangent);
+  MMG5_SAFE_FREE(batch->base);
+  memset(batch,0,sizeof(MIRRORMESH_Batch));
+}
+
+/**
+ * \param filename name of the batch file
+ * \param batch pointer toward the batch to fill
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the jobs of a batch file: one job "input nx ny nz output" per line,
+ * the end of a line from a '#' being ignored. Jobs sharing the name of their
+ * input mesh share its base.
+ *
+ */
+static
+int MIRRORMESH_readBatch(const char *filename,MIRRORMESH_pBatch batch) {
+  MIRRORMESH_pJob job;
+  FILE            *in;
+  char            line[MIRRORMESH_BATCHLEN],*tok[6],*ptr;
+  int             ntok,nl,b,i;
+
+  memset(batch,0,sizeof(MIRRORMESH_Batch));
+
+  in = fopen(filename,"r");
+  if ( !in ) {
+    fprintf(stderr,"  ** %s  NOT FOUND.\n",filename);
+    return 0;
+  }
+
+  /* At most one job and one input mesh per line */
+  nl = 0;
+  while ( fgets(line,MIRRORMESH_BATCHLEN,in) ) {
+    if ( strchr(line,'\n') || feof(in) ) ++nl;
+  }
+  rewind(in);
+  MMG5_SAFE_CALLOC(batch->job,nl+1,MIRRORMESH_Job,fclose(in);return 0);
+  MMG5_SAFE_CALLOC(batch->name,nl+1,char*,
+                   fclose(in);MIRRORMESH_free_batch(batch);return 0);
+
+  nl = 0;
+  while ( fgets(line,MIRRORMESH_BATCHLEN,in) ) {
+    ++nl;
+    if ( !strchr(line,'\n') && !feof(in) ) {
+      fprintf(stderr,"\n  ## Error: %s: line %d of %s too long.\n",__func__,
+              nl,filename);
+      fclose(in);
+      MIRRORMESH_free_batch(batch);
+      return 0;
+    }
+    if ( (ptr = strchr(line,'#')) ) *ptr = '\0';
+
+    ntok = 0;
+    for ( ptr=strtok(line," \t\r\n"); ptr && ntok<6;
+          ptr=strtok(NULL," \t\r\n") ) {
+      tok[ntok++] = ptr;
+    }
+    if ( !ntok ) continue;
+
+    if ( ntok != 5 ) {
+      fprintf(stderr,"\n  ## Error: %s: line %d of %s: expected"
+              " \"input nx ny nz output\".\n",__func__,nl,filename);
+      fclose(in);
+      MIRRORMESH_free_batch(batch);
+      return 0;
+    }
+
+    job = &batch->job[batch->njob];
+    job->line = nl;
+
+    for ( i=0; i<3; ++i ) {
+      job->nmir[i] = (int)strtol(tok[i+1],&ptr,10);
+      if ( *ptr || job->nmir[i] < 0 ) {
+        fprintf(stderr,"\n  ## Error: %s: line %d of %s: invalid number of"
+                " mirrors %s.\n",__func__,nl,filename,tok[i+1]);
+        fclose(in);
+        MIRRORMESH_free_batch(batch);
+        return 0;
+      }
+    }
+
+    job->out = MIRRORMESH_strdup(tok[4]);
+    if ( !job->out ) {
+      fclose(in);
+      MIRRORMESH_free_batch(batch);
+      return 0;
+    }
+    ++batch->njob;
+
+    /* Distinct input meshes */
+    for ( b=0; b<batch->nbase; ++b ) {
+      if ( !strcmp(batch->name[b],tok[0]) ) break;
+    }
+    if ( b == batch->nbase ) {
+      batch->name[b] = MIRRORMESH_strdup(tok[0]);
+      if ( !batch->name[b] ) {
+        fclose(in);
+        MIRRORMESH_free_batch(batch);
+        return 0;
+      }
+      ++batch->nbase;
+    }
+    job->base = b;
+  }
+  fclose(in);
+
+  if ( !batch->njob ) {
+    fprintf(stderr,"\n  ## Error: %s: no job in %s.\n",__func__,filename);
+    MIRRORMESH_free_batch(batch);
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh holding the options of the run
+ * \param info pointer toward the mirrormesh parameters
+ * \param batch pointer toward the batch
+ * \param b index of the input mesh
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Load an input mesh of the batch and build its lattice base.
+ *
+ */
+static
+int MIRRORMESH_loadBase(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                        MIRRORMESH_pBatch batch,int b) {
+  MIRRORMESH_Info binfo;
+  MMG5_pMesh      bmesh = NULL;
+  char            *ptr;
+  int             ier;
+
+  if ( !MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&bmesh,MMG5_ARG_end) ) {
+    return 0;
+  }
+  batch->mesh[b] = bmesh;
+
+  /* Options of the run */
+  if ( !MMG3D_Set_iparameter(bmesh,NULL,MMG3D_IPARAM_verbose,
+                             mesh->info.imprim) ) {
+    return 0;
+  }
+  if ( mesh->info.mem > 0 &&
+       !MMG3D_Set_iparameter(bmesh,NULL,MMG3D_IPARAM_mem,mesh->info.mem) ) {
+    return 0;
+  }
+
+  /* Tangents of the mesh, kept by the batch */
+  binfo         = *info;
+  binfo.tangent = NULL;
+
+  ptr = MMG5_Get_filenameExt(batch->name[b]);
+  switch ( MMG5_Get_format(ptr,MMG5_FMT_MeditASCII) ) {
+  case ( MMG5_FMT_MeditASCII ):
+    if ( ptr ) {
+      ier = MIRRORMESH_loadMesh(bmesh,&binfo,batch->name[b]);
+      batch->tangent[b] = binfo.tangent;
+      break;
+    }
+    /* no break */
+  case ( MMG5_FMT_MeditBinary ):
+    ier = MMG3D_loadMesh(bmesh,batch->name[b]);
+    break;
+  default:
+    fprintf(stderr,"  ** I/O AT FORMAT %s NOT IMPLEMENTED IN BATCH MODE.\n",
+            MMG5_Get_formatName(MMG5_Get_format(ptr,MMG5_FMT_MeditASCII)));
+    return 0;
+  }
+  if ( ier < 1 ) return 0;
+
+  return MIRRORMESH_build_base(bmesh,NULL,NULL,&binfo,&batch->base[b]);
+}
+
+int MIRRORMESH_runBatch(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                        const char *filename) {
+  MIRRORMESH_Batch batch;
+  size_t           memMax,memUsed,memJob;
+  int              nthreads,njobs,sub,nfail,b;
+
+  if ( info->nstage ) {
+    fprintf(stderr,"\n  ## Error: %s: the extension of a previous"
+            " replication is not available in batch mode.\n",__func__);
+    return 0;
+  }
+
+  if ( !MIRRORMESH_readBatch(filename,&batch) ) return 0;
+
+  /* Input meshes: loaded once for all their jobs */
+  MMG5_SAFE_CALLOC(batch.mesh,batch.nbase,MMG5_pMesh,
+                   MIRRORMESH_free_batch(&batch);return 0);
+  MMG5_SAFE_CALLOC(batch.tangent,batch.nbase,MMG5_pSol,
+                   MIRRORMESH_free_batch(&batch);return 0);
+  MMG5_SAFE_CALLOC(batch.base,batch.nbase,MIRRORMESH_Lattice,
+                   MIRRORMESH_free_batch(&batch);return 0);
+  for ( b=0; b<batch.nbase; ++b ) {
+    if ( mesh->info.imprim > 0 ) {
+      fprintf(stdout,"\n  -- BASE %s\n",batch.name[b]);
+    }
+    if ( !MIRRORMESH_loadBase(mesh,info,&batch,b) ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to prepare the input mesh"
+              " %s.\n",__func__,batch.name[b]);
+      MIRRORMESH_free_batch(&batch);
+      return 0;
+    }
+  }
+
+  /* Concurrent jobs, sharing the threads */
+  nthreads = MIRRORMESH_NTHREADS(info);
+  njobs    = info->njobs ? info->njobs : nthreads;
+  njobs    = MG_MAX(1,MG_MIN(njobs,batch.njob));
+  sub      = MG_MAX(1,nthreads/njobs);
+#ifdef _OPENMP
+  if ( sub > 1 && omp_get_max_active_levels() < 2 ) {
+    omp_set_max_active_levels(2);
+  }
+#endif
+
+  /* Memory: the input meshes are shared by the jobs, the remaining budget is
+   * split between the concurrent jobs */
+  memMax  = batch.mesh[0]->memMax;
+  memUsed = 0;
+  for ( b=0; b<batch.nbase; ++b ) {
+    memUsed += batch.mesh[b]->memCur;
+  }
+  memJob = 0;
+  if ( memMax ) {
+    if ( memUsed >= memMax ) {
+      fprintf(stderr,"\n  ## Error: %s: the input meshes need %zu MB, more"
+              " than the %zu MB allowed.\n",__func__,
+              (memUsed+MMG5_MILLION-1)/MMG5_MILLION,memMax/MMG5_MILLION);
+      MIRRORMESH_free_batch(&batch);
+      return 0;
+    }
+    memJob = (memMax-memUsed)/njobs;
+  }
+
+  if ( mesh->info.imprim > 0 ) {
+    fprintf(stdout,"\n  -- BATCH %s: %d JOBS ON %d INPUT MESHES,"
+            " %d AT ONCE\n",filename,batch.njob,batch.nbase,njobs);
+  }
+  if ( memMax && abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     MEMORY PER JOB  %8zu MB\n",memJob/MMG5_MILLION);
+  }
+
+  nfail = 0;
+#pragma omp parallel num_threads(njobs) reduction(+:nfail)
+  {
+    /* Memory count and output buffers of the thread, kept from one job to
+     * the next one */
+    MIRRORMESH_Buffer  buf;
+    MIRRORMESH_Lattice lat;
+    MMG5_Mesh          shell;
+    MIRRORMESH_pJob    job;
+    size_t             memCur = 0;
+    int                k;
+
+    memset(&buf,0,sizeof(MIRRORMESH_Buffer));
+    memset(&shell,0,sizeof(MMG5_Mesh));
+
+#pragma omp for schedule(dynamic,1)
+    for ( k=0; k<batch.njob; ++k ) {
+      job = &batch.job[k];
+
+      /* The lattice shares the arrays of its base (whose memory count may be
+       * updated by the other threads, see MIRRORMESH_set_copies) */
+#pragma omp critical (MIRRORMESH_numbering)
+      shell        = *batch.mesh[job->base];
+      shell.memMax = memJob;
+      shell.memCur = memCur;
+      lat          = batch.base[job->base];
+      lat.mesh     = &shell;
+      lat.nthreads = sub;
+      lat.buf      = &buf;
+
+      if ( !MIRRORMESH_set_copies(&batch.base[job->base],job->nmir,&lat) ||
+           !MIRRORMESH_saveLattice(&lat,job->out) ) {
+        fprintf(stderr,"\n  ## Error: %s: job of line %d (%s) failed.\n",
+                __func__,job->line,job->out);
+        ++nfail;
+      }
+      else if ( mesh->info.imprim > 0 ) {
+        fprintf(stdout,"     %s: %d x %d x %d COPIES OF %s\n",job->out,
+                job->nmir[0]+1,job->nmir[1]+1,job->nmir[2]+1,
+                batch.name[job->base]);
+      }
+      MIRRORMESH_free_copies(&lat);
+      memCur = shell.memCur;
+    }
+
+    MIRRORMESH_free_buffer(&shell,&buf);
+  }
+
+  MIRRORMESH_free_batch(&batch);
+
+  if ( nfail ) {
+    fprintf(stderr,"\n  ## Error: %s: %d job(s) failed.\n",__func__,nfail);
+    return 0;
+  }
+  return 1;
+}
@@ -0,0 +1,355 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file dtoa.c
+ * \brief Fast formatting of reals.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * Shortest round-trip formatting of doubles with the Grisu2 algorithm
+ * (F. Loitsch, "Printing floating-point numbers quickly and accurately with
+ * integers", PLDI 2010): the digits are generated with 64-bit integer
+ * arithmetic only and always read back to the same double. The output
+ * follows the "%g" conventions (exponent notation for very small or large
+ * values).
+ *
+ */
+#include "mirrormesh.h"
+
+/**
+ * \struct MIRRORMESH_DiyFp
+ * \brief Floating point number f * 2^e with a 64-bit significand.
+ */
+typedef struct {
+  uint64_t f;
+  int      e;
+} MIRRORMESH_DiyFp;
+
+#define MIRRORMESH_DP_SIGNIFICAND 0x000FFFFFFFFFFFFFULL
+#define MIRRORMESH_DP_HIDDENBIT   0x0010000000000000ULL
+#define MIRRORMESH_DP_EXPONENT    0x7FF0000000000000ULL
+#define MIRRORMESH_DP_BIAS        1075
+
+/** Normalized significands of 10^k for k = -348, -340, ..., 340 */
+static const uint64_t MIRRORMESH_cachedF[87] = {
+  0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+  0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+  0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+  0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+  0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+  0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+  0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+  0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+  0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+  0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+  0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+  0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+  0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+  0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+  0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+  0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+  0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+  0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+  0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+  0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+  0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+  0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+  0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+  0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+  0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+  0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+  0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+  0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+  0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+};
+
+/** Binary exponents of the cached powers of ten */
+static const int16_t MIRRORMESH_cachedE[87] = {
+  -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007,
+   -980,  -954,  -927,  -901,  -874,  -847,  -821,  -794,  -768,
+   -741,  -715,  -688,  -661,  -635,  -608,  -582,  -555,  -529,
+   -502,  -475,  -449,  -422,  -396,  -369,  -343,  -316,  -289,
+   -263,  -236,  -210,  -183,  -157,  -130,  -103,   -77,   -50,
+    -24,     3,    30,    56,    83,   109,   136,   162,   189,
+    216,   242,   269,   295,   322,   348,   375,   402,   428,
+    455,   481,   508,   534,   561,   588,   614,   641,   667,
+    694,   720,   747,   774,   800,   827,   853,   880,   907,
+    933,   960,   986,  1013,  1039,  1066
+};
+
+static const uint32_t MIRRORMESH_pow10[10] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/* Powers of ten for the digits generated after the integer part */
+static const uint64_t MIRRORMESH_pow10l[20] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+  100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+  1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+  1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+  1000000000000000000ULL, 10000000000000000000ULL
+};
+
+static inline
+MIRRORMESH_DiyFp MIRRORMESH_diyfp(uint64_t f,int e) {
+  MIRRORMESH_DiyFp r;
+  r.f = f;
+  r.e = e;
+  return r;
+}
+
+/* Product of two DiyFp, rounded on 64 bits */
+static inline
+MIRRORMESH_DiyFp MIRRORMESH_diyfpMult(MIRRORMESH_DiyFp x,MIRRORMESH_DiyFp y) {
+  const uint64_t m32 = 0xFFFFFFFFULL;
+  uint64_t       a,b,c,d,ac,bc,ad,bd,tmp;
+
+  a   = x.f >> 32;
+  b   = x.f & m32;
+  c   = y.f >> 32;
+  d   = y.f & m32;
+  ac  = a*c;
+  bc  = b*c;
+  ad  = a*d;
+  bd  = b*d;
+  tmp = (bd >> 32) + (ad & m32) + (bc & m32);
+  tmp += 1ULL << 31;
+
+  return MIRRORMESH_diyfp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32),x.e+y.e+64);
+}
+
+/* Normalized representation of v and of the boundaries of its rounding
+ * interval (w_m and w_p share the exponent of w_p) */
+static inline
+void MIRRORMESH_diyfpBoundaries(double v,MIRRORMESH_DiyFp *w,
+                                MIRRORMESH_DiyFp *w_m,MIRRORMESH_DiyFp *w_p) {
+  MIRRORMESH_DiyFp x,pl,mi;
+  uint64_t         u;
+  int              be;
+
+  memcpy(&u,&v,sizeof(uint64_t));
+  be = (int)((u & MIRRORMESH_DP_EXPONENT) >> 52);
+  if ( be ) {
+    x = MIRRORMESH_diyfp((u & MIRRORMESH_DP_SIGNIFICAND) + MIRRORMESH_DP_HIDDENBIT,
+                         be - MIRRORMESH_DP_BIAS);
+  }
+  else {
+    x = MIRRORMESH_diyfp(u & MIRRORMESH_DP_SIGNIFICAND,1 - MIRRORMESH_DP_BIAS);
+  }
+
+  /* Upper boundary */
+  pl = MIRRORMESH_diyfp((x.f << 1) + 1,x.e - 1);
+  while ( !(pl.f & (MIRRORMESH_DP_HIDDENBIT << 1)) ) {
+    pl.f <<= 1;
+    pl.e--;
+  }
+  pl.f <<= 10;
+  pl.e  -= 10;
+
+  /* Lower boundary (closer to v if v is a power of 2) */
+  if ( x.f == MIRRORMESH_DP_HIDDENBIT ) {
+    mi = MIRRORMESH_diyfp((x.f << 2) - 1,x.e - 2);
+  }
+  else {
+    mi = MIRRORMESH_diyfp((x.f << 1) - 1,x.e - 1);
+  }
+  mi.f <<= mi.e - pl.e;
+  mi.e   = pl.e;
+
+  /* Normalized value */
+  while ( !(x.f & (1ULL << 63)) ) {
+    x.f <<= 1;
+    x.e--;
+  }
+
+  *w   = x;
+  *w_m = mi;
+  *w_p = pl;
+}
+
+/* Weed the last digit to get the closest representation to w in the
+ * interval */
+static inline
+void MIRRORMESH_grisuRound(char *buf,int len,uint64_t delta,uint64_t rest,
+                           uint64_t ten_kappa,uint64_t wp_w) {
+  while ( rest < wp_w && delta - rest >= ten_kappa &&
+          (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w) ) {
+    buf[len-1]--;
+    rest += ten_kappa;
+  }
+}
+
+/**
+ * \param v positive finite real
+ * \param buf buffer to fill with the significant digits
+ * \param K computed decimal exponent
+ *
+ * \return the number of digits: \a v is the real closest to buf * 10^K.
+ *
+ */
+static
+int MIRRORMESH_grisu2(double v,char *buf,int *K) {
+  MIRRORMESH_DiyFp w,w_m,w_p,c_mk,W,Wp,Wm,one;
+  uint64_t         delta,p2,tmp,wp_w;
+  uint32_t         p1,d;
+  double           dk;
+  int              k,idx,kappa,len;
+
+  MIRRORMESH_diyfpBoundaries(v,&w,&w_m,&w_p);
+
+  /* Cached power of ten such that the product exponent is in [-60,-32] */
+  dk = (-61 - w_p.e) * 0.30102999566398114 + 347;
+  k  = (int)dk;
+  if ( dk - k > 0.0 ) ++k;
+  idx  = (k >> 3) + 1;
+  *K   = -(-348 + (idx << 3));
+  c_mk = MIRRORMESH_diyfp(MIRRORMESH_cachedF[idx],MIRRORMESH_cachedE[idx]);
+
+  W  = MIRRORMESH_diyfpMult(w,c_mk);
+  Wp = MIRRORMESH_diyfpMult(w_p,c_mk);
+  Wm = MIRRORMESH_diyfpMult(w_m,c_mk);
+  Wm.f++;
+  Wp.f--;
+  delta = Wp.f - Wm.f;
+
+  /* Digit generation */
+  one  = MIRRORMESH_diyfp(1ULL << -Wp.e,Wp.e);
+  wp_w = Wp.f - W.f;
+  p1   = (uint32_t)(Wp.f >> -one.e);
+  p2   = Wp.f & (one.f - 1);
+
+  kappa = 10;
+  while ( kappa > 1 && p1 < MIRRORMESH_pow10[kappa-1] ) --kappa;
+
+  len = 0;
+  while ( kappa > 0 ) {
+    d   = p1 / MIRRORMESH_pow10[kappa-1];
+    p1 %= MIRRORMESH_pow10[kappa-1];
+    if ( d || len ) buf[len++] = '0' + (char)d;
+    --kappa;
+    tmp = ((uint64_t)p1 << -one.e) + p2;
+    if ( tmp <= delta ) {
+      *K += kappa;
+      MIRRORMESH_grisuRound(buf,len,delta,tmp,
+                            (uint64_t)MIRRORMESH_pow10[kappa] << -one.e,wp_w);
+      return len;
+    }
+  }
+
+  for ( ;; ) {
+    p2    *= 10;
+    delta *= 10;
+    d      = (uint32_t)(p2 >> -one.e);
+    if ( d || len ) buf[len++] = '0' + (char)d;
+    p2 &= one.f - 1;
+    --kappa;
+    if ( p2 < delta ) {
+      *K += kappa;
+      MIRRORMESH_grisuRound(buf,len,delta,p2,one.f,
+                            -kappa < 20 ? wp_w*MIRRORMESH_pow10l[-kappa] : 0);
+      return len;
+    }
+  }
+}
+
+/**
+ * \param buf buffer to fill (at least \ref MIRRORMESH_DBLLEN characters)
+ * \param val real to format
+ *
+ * \return the number of written characters.
+ *
+ * Format a real with (almost always) the smallest number of significant
+ * digits that allows to read back the exact same value. Reals that are
+ * exactly written with 15 digits by the "%.15lg" format used by Mmg are
+ * written the same way.
+ *
+ */
+int MIRRORMESH_fmtDouble(char *buf,double val) {
+  char digits[20];
+  int  len,K,kk,exp,i,n;
+
+  if ( !isfinite(val) ) {
+    return snprintf(buf,MIRRORMESH_DBLLEN,"%.17g",val);
+  }
+
+  n = 0;
+  if ( signbit(val) ) {
+    buf[n++] = '-';
+    val = -val;
+  }
+  if ( val == 0. ) {
+    buf[n++] = '0';
+    return n;
+  }
+
+  len = MIRRORMESH_grisu2(val,digits,&K);
+
+  /* Position of the decimal point relatively to the first digit */
+  kk  = len + K;
+  exp = kk - 1;
+
+  if ( exp < -4 || exp >= 15 ) {
+    /* d[.ddd]e[+-]xx */
+    buf[n++] = digits[0];
+    if ( len > 1 ) {
+      buf[n++] = '.';
+      for ( i=1; i<len; ++i ) buf[n++] = digits[i];
+    }
+    buf[n++] = 'e';
+    if ( exp < 0 ) {
+      buf[n++] = '-';
+      exp = -exp;
+    }
+    else {
+      buf[n++] = '+';
+    }
+    if ( exp >= 100 ) {
+      buf[n++] = '0' + exp/100;
+      exp %= 100;
+    }
+    buf[n++] = '0' + exp/10;
+    buf[n++] = '0' + exp%10;
+  }
+  else if ( kk >= len ) {
+    /* Integer: dddd000 */
+    for ( i=0; i<len; ++i ) buf[n++] = digits[i];
+    for ( ; i<kk; ++i ) buf[n++] = '0';
+  }
+  else if ( kk > 0 ) {
+    /* ddd.ddd */
+    for ( i=0; i<kk; ++i ) buf[n++] = digits[i];
+    buf[n++] = '.';
+    for ( ; i<len; ++i ) buf[n++] = digits[i];
+  }
+  else {
+    /* 0.000ddd */
+    buf[n++] = '0';
+    buf[n++] = '.';
+    for ( i=kk; i<0; ++i ) buf[n++] = '0';
+    for ( i=0; i<len; ++i ) buf[n++] = digits[i];
+  }
+
+  return n;
+}
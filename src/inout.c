@@ -0,0 +1,1797 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file inout.c
+ * \brief Parallel ASCII input/output of meshes.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * Output: each section of the output file is split into chunks of
+ * consecutive entities. Chunks are formatted in parallel in separated
+ * buffers, then the buffers are written in the order of the chunks: the file
+ * doesn't depend on the number of threads.
+ *
+ * Input: the Medit file is mapped in memory, the section keywords are
+ * located in parallel, then each numeric section is split into line-aligned
+ * chunks that are parsed in parallel directly into the mesh arrays.
+ *
+ */
+#include "mirrormesh.h"
+
+#include <ctype.h>
+#include <limits.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * \param buf buffer to fill
+ * \param val integer to format
+ *
+ * \return the number of written characters.
+ *
+ * Format an integer in base 10 (same output as the "%d" format).
+ *
+ */
+int MIRRORMESH_fmtInt(char *buf,MIRRORMESH_int val) {
+  char     tmp[20];
+  uint64_t u;
+  int      n,len;
+
+  len = 0;
+  u   = (uint64_t)val;
+  if ( val < 0 ) {
+    buf[len++] = '-';
+    u = 0u - u;
+  }
+
+  n = 0;
+  do {
+    tmp[n++] = '0' + u%10;
+    u /= 10;
+  }
+  while ( u );
+
+  while ( n ) {
+    buf[len++] = tmp[--n];
+  }
+  return len;
+}
+
+/**
+ * \param nmax largest index written in the file
+ * \param imax largest index written with 32-bit integers (\ref
+ * MIRRORMESH_INT32)
+ *
+ * \return the version of a Medit file: 2 (32-bit integers, double precision
+ * reals) or, if \a nmax exceeds \a imax, 4 (64-bit integers).
+ *
+ */
+int MIRRORMESH_meditVersion(MIRRORMESH_int nmax,MIRRORMESH_int imax) {
+  return nmax > imax ? 4 : 2;
+}
+
+/**
+ * \param mesh pointer toward the mesh (for memory accounting)
+ * \param b pointer toward the buffers
+ * \param ncnt number of prefix counts (0: unchanged)
+ * \param nlen number of chunks formatted at once (0: unchanged)
+ * \param nout size of the formatted lines of these chunks (0: unchanged)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Grow the buffers of \a b to the requested sizes. The \a ncnt first prefix
+ * counts are reset, the other buffers are left uninitialized.
+ *
+ */
+static
+int MIRRORMESH_grow_buffer(MMG5_pMesh mesh,MIRRORMESH_pBuffer b,
+                           MIRRORMESH_int ncnt,int nlen,size_t nout) {
+
+  if ( ncnt > b->ncnt ) {
+    if ( b->cnt ) {
+      MMG5_DEL_MEM(mesh,b->cnt);
+    }
+    b->ncnt = 0;
+    MMG5_ADD_MEM(mesh,ncnt*sizeof(MIRRORMESH_int),"chunk sizes",return 0);
+    MMG5_SAFE_MALLOC(b->cnt,ncnt,MIRRORMESH_int,return 0);
+    b->ncnt = ncnt;
+  }
+  if ( ncnt ) {
+    memset(b->cnt,0,ncnt*sizeof(MIRRORMESH_int));
+  }
+
+  if ( nlen > b->nlen ) {
+    if ( b->len ) {
+      MMG5_DEL_MEM(mesh,b->len);
+    }
+    b->nlen = 0;
+    MMG5_ADD_MEM(mesh,nlen*sizeof(size_t),"chunk lengths",return 0);
+    MMG5_SAFE_MALLOC(b->len,nlen,size_t,return 0);
+    b->nlen = nlen;
+  }
+
+  if ( nout > b->nout ) {
+    if ( b->out ) {
+      MMG5_DEL_MEM(mesh,b->out);
+    }
+    b->nout = 0;
+    MMG5_ADD_MEM(mesh,nout,"output buffers",return 0);
+    MMG5_SAFE_MALLOC(b->out,nout,char,return 0);
+    b->nout = nout;
+  }
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh (for memory accounting)
+ * \param b pointer toward the buffers
+ *
+ * Release the buffers of \a b.
+ *
+ */
+void MIRRORMESH_free_buffer(MMG5_pMesh mesh,MIRRORMESH_pBuffer b) {
+  if ( b->cnt ) {
+    MMG5_DEL_MEM(mesh,b->cnt);
+  }
+  if ( b->len ) {
+    MMG5_DEL_MEM(mesh,b->len);
+  }
+  if ( b->out ) {
+    MMG5_DEL_MEM(mesh,b->out);
+  }
+  memset(b,0,sizeof(MIRRORMESH_Buffer));
+}
+
+/**
+ * \param mesh pointer toward the mesh (for memory accounting)
+ * \param inm pointer toward the output file (NULL to only count)
+ * \param keyword keyword of the section (NULL if the section has no header)
+ * \param sec description of the section
+ * \param nthreads number of threads
+ *
+ * \return the number of written entities, -1 if fail.
+ *
+ * Write a section of an ASCII mesh file. If \a keyword is provided and at
+ * least one entity is selected, the section starts with the keyword and the
+ * number of written entities (Medit style). If \a inm is NULL, the selected
+ * entities are only counted.
+ *
+ * A first parallel pass counts the entities of each chunk so each written
+ * entity knows its index among the non-skipped items; the chunks are then
+ * formatted by waves of \a nthreads chunks. The work buffers are the ones of
+ * \a sec->buf if provided (kept for the next sections), otherwise they are
+ * allocated for the section.
+ *
+ */
+MIRRORMESH_int MIRRORMESH_writeSection(MMG5_pMesh mesh,FILE *inm,
+                                       const char *keyword,
+                                       MIRRORMESH_pSection sec,int nthreads) {
+  MIRRORMESH_Buffer  local;
+  MIRRORMESH_pBuffer b;
+  MIRRORMESH_int     *cnt,nsel,nchunk,c,c0;
+  char               *buf;
+  size_t             *len,bufsiz;
+  int                nbuf,j;
+
+  if ( sec->n <= sec->first ) return 0;
+
+  nchunk = (sec->n - sec->first + MIRRORMESH_CHUNK - 1) / MIRRORMESH_CHUNK;
+  nbuf   = (int)MG_MIN(nchunk,MG_MAX(nthreads,1));
+  bufsiz = (size_t)MIRRORMESH_CHUNK * sec->lmax;
+
+  memset(&local,0,sizeof(MIRRORMESH_Buffer));
+  b = sec->buf ? sec->buf : &local;
+
+  if ( !MIRRORMESH_grow_buffer(mesh,b,nchunk+1,0,0) ) {
+    MIRRORMESH_free_buffer(mesh,&local);
+    return -1;
+  }
+  cnt = b->cnt;
+
+  /* Number of non-skipped and of selected items of each chunk */
+  nsel = 0;
+#pragma omp parallel for num_threads(nthreads) schedule(static) \
+  reduction(+:nsel)
+  for ( c=0; c<nchunk; ++c ) {
+    MIRRORMESH_int k,kend = MG_MIN(sec->n,sec->first+(c+1)*MIRRORMESH_CHUNK);
+
+    for ( k=sec->first+c*MIRRORMESH_CHUNK+1; k<=kend; ++k ) {
+      if ( sec->skip && sec->skip(sec->data,k) ) continue;
+      ++cnt[c+1];
+      if ( !sec->select || sec->select(sec->data,k) ) ++nsel;
+    }
+  }
+  for ( c=0; c<nchunk; ++c ) {
+    cnt[c+1] += cnt[c];
+  }
+
+  if ( !nsel || !inm ) {
+    MIRRORMESH_free_buffer(mesh,&local);
+    return nsel;
+  }
+
+  if ( keyword ) {
+    fprintf(inm,"\n\n%s\n%" MIRRORMESH_PRId "\n",keyword,nsel);
+  }
+
+  if ( !MIRRORMESH_grow_buffer(mesh,b,0,nbuf,nbuf*bufsiz) ) {
+    MIRRORMESH_free_buffer(mesh,&local);
+    return -1;
+  }
+  buf = b->out;
+  len = b->len;
+
+  for ( c0=0; c0<nchunk; c0+=nbuf ) {
+    int nc = (int)MG_MIN(nbuf,nchunk-c0);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for ( j=0; j<nc; ++j ) {
+      char           *ptr = &buf[j*bufsiz];
+      MIRRORMESH_int c    = c0+j;
+      MIRRORMESH_int idx  = cnt[c] + sec->offset;
+      MIRRORMESH_int k,kend = MG_MIN(sec->n,sec->first+(c+1)*MIRRORMESH_CHUNK);
+
+      len[j] = 0;
+      for ( k=sec->first+c*MIRRORMESH_CHUNK+1; k<=kend; ++k ) {
+        if ( sec->skip && sec->skip(sec->data,k) ) continue;
+        ++idx;
+        if ( sec->select && !sec->select(sec->data,k) ) continue;
+        len[j] += sec->format(sec->data,k,idx,ptr+len[j]);
+      }
+      assert ( len[j] <= bufsiz );
+    }
+
+    for ( j=0; j<nc; ++j ) {
+      if ( fwrite(&buf[j*bufsiz],1,len[j],inm) != len[j] ) {
+        fprintf(stderr,"\n  ## Error: %s: unable to write the %s section.\n",
+                __func__,keyword ? keyword : "data");
+        MIRRORMESH_free_buffer(mesh,&local);
+        return -1;
+      }
+    }
+  }
+
+  MIRRORMESH_free_buffer(mesh,&local);
+
+  return nsel;
+}
+
+/* Callbacks to write the sections of a materialised mesh */
+static int MIRRORMESH_skipPoint(void *data,MIRRORMESH_int k) {
+  return !MG_VOK(&((MMG5_pMesh)data)->point[k]);
+}
+static int MIRRORMESH_skipTetra(void *data,MIRRORMESH_int k) {
+  return !MG_EOK(&((MMG5_pMesh)data)->tetra[k]);
+}
+static int MIRRORMESH_skipTria(void *data,MIRRORMESH_int k) {
+  return !MG_EOK(&((MMG5_pMesh)data)->tria[k]);
+}
+static int MIRRORMESH_skipEdge(void *data,MIRRORMESH_int k) {
+  return ((MMG5_pMesh)data)->edge[k].a <= 0;
+}
+static int MIRRORMESH_isCorner(void *data,MIRRORMESH_int k) {
+  return ((MMG5_pMesh)data)->point[k].tag & MG_CRN;
+}
+static int MIRRORMESH_isReqPoint(void *data,MIRRORMESH_int k) {
+  return ((MMG5_pMesh)data)->point[k].tag & MG_REQ;
+}
+static int MIRRORMESH_isReqTetra(void *data,MIRRORMESH_int k) {
+  return ((MMG5_pMesh)data)->tetra[k].tag & MG_REQ;
+}
+static int MIRRORMESH_isReqTria(void *data,MIRRORMESH_int k) {
+  MMG5_pTria pt = &((MMG5_pMesh)data)->tria[k];
+  return (pt->tag[0] & MG_REQ) && (pt->tag[1] & MG_REQ) && (pt->tag[2] & MG_REQ);
+}
+static int MIRRORMESH_isRidge(void *data,MIRRORMESH_int k) {
+  return ((MMG5_pMesh)data)->edge[k].tag & MG_GEO;
+}
+static int MIRRORMESH_isReqEdge(void *data,MIRRORMESH_int k) {
+  return ((MMG5_pMesh)data)->edge[k].tag & MG_REQ;
+}
+
+static int MIRRORMESH_fmtPoint(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                               char *buf) {
+  MMG5_pPoint ppt = &((MMG5_pMesh)data)->point[k];
+
+  /* Index of the point in the output mesh (a mesh built in memory fits in
+   * the integer type of Mmg) */
+  ppt->tmp = (int)idx;
+
+  return MIRRORMESH_fmtVertex(buf,ppt->c,abs(ppt->ref));
+}
+static int MIRRORMESH_fmtTetra(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                               char *buf) {
+  MMG5_pMesh     mesh = (MMG5_pMesh)data;
+  MMG5_pTetra    pt   = &mesh->tetra[k];
+  MIRRORMESH_int v[4];
+  int            i;
+
+  for ( i=0; i<4; ++i ) {
+    v[i] = mesh->point[pt->v[i]].tmp;
+  }
+  return MIRRORMESH_fmtCell(buf,4,v,pt->ref);
+}
+static int MIRRORMESH_fmtTria(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                              char *buf) {
+  MMG5_pMesh     mesh = (MMG5_pMesh)data;
+  MMG5_pTria     pt   = &mesh->tria[k];
+  MIRRORMESH_int v[3];
+  int            i;
+
+  for ( i=0; i<3; ++i ) {
+    v[i] = mesh->point[pt->v[i]].tmp;
+  }
+  return MIRRORMESH_fmtCell(buf,3,v,pt->ref);
+}
+static int MIRRORMESH_fmtEdge(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                              char *buf) {
+  MMG5_pMesh     mesh = (MMG5_pMesh)data;
+  MMG5_pEdge     pa   = &mesh->edge[k];
+  MIRRORMESH_int v[2];
+
+  v[0] = mesh->point[pa->a].tmp;
+  v[1] = mesh->point[pa->b].tmp;
+  return MIRRORMESH_fmtCell(buf,2,v,pa->ref);
+}
+static int MIRRORMESH_fmtIndex(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                               char *buf) {
+  return MIRRORMESH_fmtCell(buf,0,NULL,idx);
+}
+
+/** Normals and tangents of a materialised mesh: the points without vector are
+ * skipped, so the index of an item is the index of its vector */
+typedef struct {
+  MMG5_pMesh mesh;
+  MMG5_pSol  tangent; /*!< tangents read with the mesh (NULL if none) */
+} MIRRORMESH_Vectors;
+
+static int MIRRORMESH_skipNormal(void *data,MIRRORMESH_int k) {
+  MMG5_pMesh mesh = ((MIRRORMESH_Vectors*)data)->mesh;
+  return !MG_VOK(&mesh->point[k]) || !MIRRORMESH_normal(mesh,(int)k);
+}
+static int MIRRORMESH_skipTangent(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_Vectors *vec = (MIRRORMESH_Vectors*)data;
+  return !MG_VOK(&vec->mesh->point[k]) ||
+    !MIRRORMESH_tangent(vec->mesh,vec->tangent,(int)k);
+}
+static int MIRRORMESH_fmtNormal(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                char *buf) {
+  MMG5_pMesh mesh = ((MIRRORMESH_Vectors*)data)->mesh;
+  return MIRRORMESH_fmtVector(buf,MIRRORMESH_normal(mesh,(int)k));
+}
+static int MIRRORMESH_fmtTangent(void *data,MIRRORMESH_int k,
+                                 MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_Vectors *vec = (MIRRORMESH_Vectors*)data;
+  return MIRRORMESH_fmtVector(buf,MIRRORMESH_tangent(vec->mesh,vec->tangent,
+                                                     (int)k));
+}
+static int MIRRORMESH_fmtAtVertex(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_int ip = ((MIRRORMESH_Vectors*)data)->mesh->point[k].tmp;
+  return MIRRORMESH_fmtCell(buf,1,&ip,idx);
+}
+
+/**
+ * \param buf buffer to fill
+ * \param c coordinates of the vertex
+ * \param ref reference of the vertex
+ *
+ * \return the number of written characters.
+ *
+ * Format a line of the Medit \a Vertices section.
+ *
+ */
+int MIRRORMESH_fmtVertex(char *buf,double c[3],int ref) {
+  int i,len;
+
+  len = 0;
+  for ( i=0; i<3; ++i ) {
+    len += MIRRORMESH_fmtDouble(buf+len,c[i]);
+    buf[len++] = ' ';
+  }
+  len += MIRRORMESH_fmtInt(buf+len,ref);
+  buf[len++] = '\n';
+
+  return len;
+}
+
+/**
+ * \param buf buffer to fill
+ * \param nv number of vertices of the cell
+ * \param v vertices of the cell
+ * \param ref reference of the cell
+ *
+ * \return the number of written characters.
+ *
+ * Format a line of a Medit element section (vertices followed by the
+ * reference), or of an index section if \a nv is 0.
+ *
+ */
+int MIRRORMESH_fmtCell(char *buf,int nv,MIRRORMESH_int *v,MIRRORMESH_int ref) {
+  int i,len;
+
+  len = 0;
+  for ( i=0; i<nv; ++i ) {
+    len += MIRRORMESH_fmtInt(buf+len,v[i]);
+    buf[len++] = ' ';
+  }
+  len += MIRRORMESH_fmtInt(buf+len,ref);
+  buf[len++] = '\n';
+
+  return len;
+}
+
+/**
+ * \param buf buffer to fill
+ * \param sol field
+ * \param m value of the field at a vertex
+ *
+ * \return the number of written characters.
+ *
+ * Format the value of a field at a vertex, each real being followed by a
+ * space. Symmetric tensors are written in the order of the Medit files
+ * (\f$m_{11},m_{12},m_{22},m_{13},m_{23},m_{33}\f$).
+ *
+ */
+int MIRRORMESH_fmtSol(char *buf,MMG5_pSol sol,double *m) {
+  static const int medit[6] = {0,1,3,2,4,5};
+  int              i,len;
+
+  len = 0;
+  for ( i=0; i<sol->size; ++i ) {
+    len += MIRRORMESH_fmtDouble(buf+len,sol->size == 6 ? m[medit[i]] : m[i]);
+    buf[len++] = ' ';
+  }
+  return len;
+}
+
+/**
+ * \param buf buffer to fill
+ * \param u vector
+ *
+ * \return the number of written characters.
+ *
+ * Format a line of the Medit \a Normals or \a Tangents section.
+ *
+ */
+int MIRRORMESH_fmtVector(char *buf,const double *u) {
+  int i,len;
+
+  len = 0;
+  for ( i=0; i<3; ++i ) {
+    len += MIRRORMESH_fmtDouble(buf+len,u[i]);
+    buf[len++] = ' ';
+  }
+  buf[len-1] = '\n';
+
+  return len;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param k index of a point
+ *
+ * \return the normal at the point, NULL if none.
+ *
+ * For a mesh analysed by Mmg, the normal of the regular boundary points
+ * (stored in their xpoint) as written by \a MMG3D_saveMesh. Otherwise, the
+ * normal read with the mesh (stored in the point, zero if none).
+ *
+ */
+const double *MIRRORMESH_normal(MMG5_pMesh mesh,int k) {
+  MMG5_pPoint ppt = &mesh->point[k];
+
+  if ( mesh->xpoint ) {
+    if ( !ppt->xp || MG_SIN(ppt->tag) || !(ppt->tag & MG_BDY) ||
+         ((ppt->tag & MG_GEO) && !(ppt->tag & MG_NOM)) ) return NULL;
+    return mesh->xpoint[ppt->xp].n1;
+  }
+  if ( !ppt->n[0] && !ppt->n[1] && !ppt->n[2] ) return NULL;
+
+  return ppt->n;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param tangent tangents read with the mesh (may be NULL)
+ * \param k index of a point
+ *
+ * \return the tangent at the point, NULL if none.
+ *
+ * For a mesh analysed by Mmg, the tangent of the points of the ridges and
+ * reference edges (stored in the point) as written by \a MMG3D_saveMesh.
+ * Otherwise, the tangent read with the mesh (zero if none).
+ *
+ */
+const double *MIRRORMESH_tangent(MMG5_pMesh mesh,MMG5_pSol tangent,int k) {
+  MMG5_pPoint ppt = &mesh->point[k];
+  double      *u;
+
+  if ( mesh->xpoint ) {
+    if ( MG_SIN(ppt->tag) || !(MG_EDG(ppt->tag) || (ppt->tag & MG_NOM)) )
+      return NULL;
+    return ppt->n;
+  }
+  if ( !tangent ) return NULL;
+
+  u = &tangent->m[3*(size_t)k];
+  if ( !u[0] && !u[1] && !u[2] ) return NULL;
+
+  return u;
+}
+
+/**
+ * \param mesh pointer toward the mesh (for memory accounting)
+ * \param inm pointer toward the output file
+ * \param np number of written vertices
+ * \param imax largest index written with 32-bit integers
+ * \param sol fields to write
+ * \param nsol number of fields
+ * \param sec description of the section of the values (one line per vertex)
+ * \param nthreads number of threads
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write a Medit ASCII solution file with the \a nsol fields defined at the
+ * \a np vertices.
+ *
+ */
+int MIRRORMESH_writeSols(MMG5_pMesh mesh,FILE *inm,MIRRORMESH_int np,
+                         MIRRORMESH_int imax,MMG5_pSol *sol,int nsol,
+                         MIRRORMESH_pSection sec,int nthreads) {
+  int l;
+
+  fprintf(inm,"MeshVersionFormatted %d\n",MIRRORMESH_meditVersion(np,imax));
+  fprintf(inm,"\n\nDimension 3\n");
+
+  fprintf(inm,"\n\nSolAtVertices\n%" MIRRORMESH_PRId "\n%d",np,nsol);
+  sec->lmax = 1;
+  for ( l=0; l<nsol; ++l ) {
+    fprintf(inm," %d",sol[l]->type);
+    sec->lmax += sol[l]->size*(MIRRORMESH_DBLLEN+1);
+  }
+  fprintf(inm,"\n");
+
+  if ( MIRRORMESH_writeSection(mesh,inm,NULL,sec,nthreads) != np ) {
+    return 0;
+  }
+
+  fprintf(inm,"\n\nEnd\n");
+
+  return 1;
+}
+
+int MIRRORMESH_saveMesh(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                        const char *filename) {
+  MIRRORMESH_Section sec;
+  MIRRORMESH_Vectors vec;
+  MIRRORMESH_int     np,ne,nt,na,nc,nr;
+  FILE               *inm;
+  int                nthreads;
+
+  nthreads = MIRRORMESH_NTHREADS(info);
+
+  inm = fopen(filename,"w");
+  if ( !inm ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    return 0;
+  }
+  if ( mesh->info.imprim >= 0 )
+    fprintf(stdout,"  %%%% %s OPENED\n",filename);
+
+  fprintf(inm,"MeshVersionFormatted %d\n",
+          MIRRORMESH_meditVersion(MG_MAX(MG_MAX(mesh->np,mesh->ne),
+                                         MG_MAX(mesh->nt,mesh->na)),
+                                  MIRRORMESH_INT32(info)));
+  fprintf(inm,"\n\nDimension 3\n");
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.data = mesh;
+
+  /* Vertices (the index of each point in the output mesh is stored in tmp) */
+  sec.n      = mesh->np;
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipPoint;
+  sec.format = MIRRORMESH_fmtPoint;
+  if ( (np = MIRRORMESH_writeSection(mesh,inm,"Vertices",&sec,nthreads)) < 0 )
+    goto fail;
+
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtIndex;
+  sec.select = MIRRORMESH_isCorner;
+  if ( (nc = MIRRORMESH_writeSection(mesh,inm,"Corners",&sec,nthreads)) < 0 )
+    goto fail;
+  sec.select = MIRRORMESH_isReqPoint;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredVertices",&sec,nthreads) < 0 )
+    goto fail;
+
+  /* Tetrahedra */
+  sec.n      = mesh->ne;
+  sec.skip   = MIRRORMESH_skipTetra;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtTetra;
+  if ( (ne = MIRRORMESH_writeSection(mesh,inm,"Tetrahedra",&sec,nthreads)) < 0 )
+    goto fail;
+  sec.select = MIRRORMESH_isReqTetra;
+  sec.format = MIRRORMESH_fmtIndex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredTetrahedra",&sec,nthreads) < 0 )
+    goto fail;
+
+  /* Triangles */
+  sec.n      = mesh->nt;
+  sec.skip   = MIRRORMESH_skipTria;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtTria;
+  if ( (nt = MIRRORMESH_writeSection(mesh,inm,"Triangles",&sec,nthreads)) < 0 )
+    goto fail;
+  sec.select = MIRRORMESH_isReqTria;
+  sec.format = MIRRORMESH_fmtIndex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredTriangles",&sec,nthreads) < 0 )
+    goto fail;
+
+  /* Edges */
+  sec.n      = mesh->na;
+  sec.skip   = MIRRORMESH_skipEdge;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtEdge;
+  if ( (na = MIRRORMESH_writeSection(mesh,inm,"Edges",&sec,nthreads)) < 0 )
+    goto fail;
+  sec.select = MIRRORMESH_isRidge;
+  sec.format = MIRRORMESH_fmtIndex;
+  if ( (nr = MIRRORMESH_writeSection(mesh,inm,"Ridges",&sec,nthreads)) < 0 )
+    goto fail;
+  sec.select = MIRRORMESH_isReqEdge;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredEdges",&sec,nthreads) < 0 )
+    goto fail;
+
+  /* Normals and tangents, then their vertices */
+  vec.mesh    = mesh;
+  vec.tangent = info->tangent && info->tangent->np == mesh->np ?
+    info->tangent : NULL;
+  sec.data   = &vec;
+  sec.n      = mesh->np;
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipNormal;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtNormal;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Normals",&sec,nthreads) < 0 )
+    goto fail;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtAtVertex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"NormalAtVertices",&sec,nthreads) < 0 )
+    goto fail;
+
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipTangent;
+  sec.format = MIRRORMESH_fmtTangent;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Tangents",&sec,nthreads) < 0 )
+    goto fail;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtAtVertex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"TangentAtVertices",&sec,nthreads) < 0 )
+    goto fail;
+
+  fprintf(inm,"\n\nEnd\n");
+
+  if ( fclose(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,filename);
+    return 0;
+  }
+
+  if ( abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MIRRORMESH_PRId "   CORNERS %8"
+            MIRRORMESH_PRId "\n",np,nc);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8" MIRRORMESH_PRId "\n",ne);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MIRRORMESH_PRId "\n",nt);
+    fprintf(stdout,"     NUMBER OF EDGES      %8" MIRRORMESH_PRId "   RIDGES  %8"
+            MIRRORMESH_PRId "\n",na,nr);
+  }
+
+  return 1;
+
+fail:
+  fclose(inm);
+  return 0;
+}
+
+/** Fields of a materialised mesh */
+typedef struct {
+  MMG5_pMesh mesh;
+  MMG5_pSol  *sol;
+  int        nsol;
+} MIRRORMESH_Fields;
+
+static int MIRRORMESH_skipSolPoint(void *data,MIRRORMESH_int k) {
+  return !MG_VOK(&((MIRRORMESH_Fields*)data)->mesh->point[k]);
+}
+static int MIRRORMESH_fmtSolPoint(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_Fields *fld = (MIRRORMESH_Fields*)data;
+  int               l,len;
+
+  len = 0;
+  for ( l=0; l<fld->nsol; ++l ) {
+    MMG5_pSol psl = fld->sol[l];
+    len += MIRRORMESH_fmtSol(buf+len,psl,&psl->m[(size_t)k*psl->size]);
+  }
+  buf[len-1] = '\n';
+
+  return len;
+}
+
+int MIRRORMESH_saveAllSols(MMG5_pMesh mesh,MMG5_pSol sol,MIRRORMESH_pInfo info,
+                           const char *filename) {
+  MIRRORMESH_Fields  fld;
+  MIRRORMESH_Section sec;
+  FILE               *inm;
+  int                nthreads,np,k,l,ier;
+
+  nthreads = MIRRORMESH_NTHREADS(info);
+
+  if ( !sol || mesh->nsols < 1 ) {
+    fprintf(stderr,"\n  ## Error: %s: no field to save.\n",__func__);
+    return 0;
+  }
+  for ( l=0; l<mesh->nsols; ++l ) {
+    if ( !sol[l].m || sol[l].np < mesh->np ) {
+      fprintf(stderr,"\n  ## Error: %s: field %d doesn't match the mesh.\n",
+              __func__,l+1);
+      return 0;
+    }
+  }
+
+  fld.mesh = mesh;
+  fld.nsol = mesh->nsols;
+  MMG5_SAFE_MALLOC(fld.sol,fld.nsol,MMG5_pSol,return 0);
+  for ( l=0; l<fld.nsol; ++l ) {
+    fld.sol[l] = &sol[l];
+  }
+
+  np = 0;
+#pragma omp parallel for num_threads(nthreads) schedule(static) \
+  reduction(+:np)
+  for ( k=1; k<=mesh->np; ++k ) {
+    if ( MG_VOK(&mesh->point[k]) ) ++np;
+  }
+
+  inm = fopen(filename,"w");
+  if ( !inm ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    MMG5_SAFE_FREE(fld.sol);
+    return 0;
+  }
+  if ( mesh->info.imprim >= 0 )
+    fprintf(stdout,"  %%%% %s OPENED\n",filename);
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.data   = &fld;
+  sec.n      = mesh->np;
+  sec.skip   = MIRRORMESH_skipSolPoint;
+  sec.format = MIRRORMESH_fmtSolPoint;
+  ier = MIRRORMESH_writeSols(mesh,inm,np,MIRRORMESH_INT32(info),fld.sol,
+                             fld.nsol,&sec,nthreads);
+  MMG5_SAFE_FREE(fld.sol);
+
+  if ( fclose(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,filename);
+    return 0;
+  }
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write %s.\n",__func__,filename);
+    return 0;
+  }
+
+  if ( abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     NUMBER OF SOLUTIONS  %8d   VERTICES %8d\n",
+            fld.nsol,np);
+  }
+
+  return 1;
+}
+
+/** Keywords and number of values per entity of the handled sections */
+static const char *MIRRORMESH_secName[MIRRORMESH_NSEC] = {
+  "Vertices","Tetrahedra","Triangles","Edges","Corners","RequiredVertices",
+  "Ridges","RequiredEdges","RequiredTriangles","RequiredTetrahedra",
+  "Normals","NormalAtVertices","Tangents","TangentAtVertices"
+};
+static const int MIRRORMESH_secNtok[MIRRORMESH_NSEC] = {4,5,4,3,1,1,1,1,1,1,
+                                                        3,2,3,2};
+
+static inline int MIRRORMESH_isBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/* Skip blanks and comments (from '#' to the end of the line) */
+static inline
+const char *MIRRORMESH_skipBlank(const char *p,const char *end) {
+  while ( p < end ) {
+    if ( MIRRORMESH_isBlank(*p) ) {
+      ++p;
+    }
+    else if ( *p == '#' ) {
+      while ( p < end && *p != '\n' ) ++p;
+    }
+    else {
+      break;
+    }
+  }
+  return p;
+}
+
+static inline
+int MIRRORMESH_readInt(const char **pp,const char *end,int *val) {
+  const char *p = MIRRORMESH_skipBlank(*pp,end);
+  long       v;
+  int        sign;
+
+  sign = 1;
+  if ( p < end && (*p == '-' || *p == '+') ) {
+    if ( *p == '-' ) sign = -1;
+    ++p;
+  }
+  if ( p == end || !isdigit((unsigned char)*p) ) return 0;
+
+  v = 0;
+  while ( p < end && isdigit((unsigned char)*p) ) {
+    v = 10*v + (*p++ - '0');
+    if ( v > INT_MAX ) return 0;
+  }
+  if ( p < end && !MIRRORMESH_isBlank(*p) ) return 0;
+
+  *val = (int)(sign*v);
+  *pp  = p;
+  return 1;
+}
+
+static inline
+int MIRRORMESH_readDouble(const char **pp,const char *end,double *val) {
+  const char *p = MIRRORMESH_skipBlank(*pp,end);
+  char       tok[MIRRORMESH_DBLLEN*2],*q;
+  int        len;
+
+  /* The mapped file is not null-terminated: copy the token */
+  len = 0;
+  while ( p < end && !MIRRORMESH_isBlank(*p) ) {
+    if ( len == MIRRORMESH_DBLLEN*2-1 ) return 0;
+    tok[len++] = *p++;
+  }
+  if ( !len ) return 0;
+  tok[len] = '\0';
+
+  *val = strtod(tok,&q);
+  if ( q != tok+len ) return 0;
+
+  *pp = p;
+  return 1;
+}
+
+/* Number of tokens in [p,end) */
+static
+int MIRRORMESH_countTokens(const char *p,const char *end) {
+  int n = 0;
+
+  for ( ;; ) {
+    p = MIRRORMESH_skipBlank(p,end);
+    if ( p == end ) break;
+    ++n;
+    while ( p < end && !MIRRORMESH_isBlank(*p) ) ++p;
+  }
+  return n;
+}
+
+/* Start of the line following p (or end) */
+static inline
+const char *MIRRORMESH_nextLine(const char *p,const char *end) {
+  const char *q = memchr(p,'\n',end-p);
+  return q ? q+1 : end;
+}
+
+/* Signed volume (times 6) of a tetra */
+static inline
+double MIRRORMESH_orvol(MMG5_pPoint point,int *v) {
+  double *a,*b,*c,*d,abx,aby,abz,acx,acy,acz,adx,ady,adz;
+
+  a = point[v[0]].c;
+  b = point[v[1]].c;
+  c = point[v[2]].c;
+  d = point[v[3]].c;
+
+  abx = b[0]-a[0]; aby = b[1]-a[1]; abz = b[2]-a[2];
+  acx = c[0]-a[0]; acy = c[1]-a[1]; acz = c[2]-a[2];
+  adx = d[0]-a[0]; ady = d[1]-a[1]; adz = d[2]-a[2];
+
+  return abx*(acy*adz-acz*ady) + aby*(acz*adx-acx*adz) + abz*(acx*ady-acy*adx);
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param sec section to parse
+ * \param p pointer toward the data of the entity (updated)
+ * \param end end of the chunk
+ * \param k index of the entity
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Parse one entity of a section in the mesh arrays. For elements, the
+ * vertices are marked as used, only one thread accessing each point at a
+ * time (see \ref MIRRORMESH_loadMesh).
+ *
+ */
+static inline
+int MIRRORMESH_parseEntity(MMG5_pMesh mesh,int sec,const char **p,
+                           const char *end,int k) {
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  MMG5_pTria  ptt;
+  MMG5_pEdge  pa;
+  int         i,v[4];
+
+  switch ( sec ) {
+  case MIRRORMESH_SEC_Vertices:
+    ppt = &mesh->point[k];
+    for ( i=0; i<3; ++i ) {
+      if ( !MIRRORMESH_readDouble(p,end,&ppt->c[i]) ) return 0;
+    }
+    if ( !MIRRORMESH_readInt(p,end,&ppt->ref) ) return 0;
+    ppt->tag = MG_NUL;
+    ppt->tmp = 0;
+    return 1;
+
+  case MIRRORMESH_SEC_Tetrahedra:
+    pt = &mesh->tetra[k];
+    for ( i=0; i<4; ++i ) {
+      if ( !MIRRORMESH_readInt(p,end,&v[i]) ) return 0;
+      if ( v[i] < 1 || v[i] > mesh->np ) return 0;
+    }
+    if ( !MIRRORMESH_readInt(p,end,&pt->ref) ) return 0;
+    memcpy(pt->v,v,4*sizeof(int));
+    return 1;
+
+  case MIRRORMESH_SEC_Triangles:
+    ptt = &mesh->tria[k];
+    for ( i=0; i<3; ++i ) {
+      if ( !MIRRORMESH_readInt(p,end,&v[i]) ) return 0;
+      if ( v[i] < 1 || v[i] > mesh->np ) return 0;
+    }
+    if ( !MIRRORMESH_readInt(p,end,&ptt->ref) ) return 0;
+    memcpy(ptt->v,v,3*sizeof(int));
+    return 1;
+
+  case MIRRORMESH_SEC_Edges:
+    pa = &mesh->edge[k];
+    for ( i=0; i<2; ++i ) {
+      if ( !MIRRORMESH_readInt(p,end,&v[i]) ) return 0;
+      if ( v[i] < 1 || v[i] > mesh->np ) return 0;
+    }
+    if ( !MIRRORMESH_readInt(p,end,&pa->ref) ) return 0;
+    pa->a    = v[0];
+    pa->b    = v[1];
+    pa->tag |= MG_REF;
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param file sections of the mapped file
+ * \param sec section to parse
+ * \param nthreads number of threads
+ *
+ * \return 1 if success, 0 if the section layout is not supported (each
+ * entity must start on a new line), -1 if the section is invalid.
+ *
+ * Parse a numeric section in parallel: the data is split into line-aligned
+ * chunks, a first pass counts the values of each chunk to get the index of
+ * its first entity, then the chunks are parsed independently.
+ *
+ */
+static
+int MIRRORMESH_parseSection(MMG5_pMesh mesh,MIRRORMESH_MeditFile *file,
+                            int sec,int nthreads) {
+  const char *beg = file->beg[sec];
+  const char *end = file->end[sec];
+  const char **cbeg;
+  int        *ntok,nchunk,ntot,c,ier;
+  const int  nt = MIRRORMESH_secNtok[sec];
+
+  if ( !file->n[sec] ) return 1;
+
+  nchunk = (int)((end-beg)/MIRRORMESH_RDCHUNK) + 1;
+
+  MMG5_ADD_MEM(mesh,(nchunk+1)*(sizeof(char*)+sizeof(int)),"chunks",return -1);
+  MMG5_SAFE_CALLOC(cbeg,nchunk+1,const char*,return -1);
+  MMG5_SAFE_CALLOC(ntok,nchunk+1,int,MMG5_DEL_MEM(mesh,cbeg);return -1);
+
+  /* Line-aligned chunks */
+  cbeg[0]      = beg;
+  cbeg[nchunk] = end;
+  for ( c=1; c<nchunk; ++c ) {
+    cbeg[c] = MIRRORMESH_nextLine(beg + (end-beg)/nchunk*c,end);
+    if ( cbeg[c] < cbeg[c-1] ) cbeg[c] = cbeg[c-1];
+  }
+
+  /* Number of values of each chunk */
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( c=0; c<nchunk; ++c ) {
+    ntok[c+1] = MIRRORMESH_countTokens(cbeg[c],cbeg[c+1]);
+  }
+
+  ier = 1;
+  for ( c=0; c<nchunk; ++c ) {
+    /* Chunks must start at the beginning of an entity */
+    if ( ntok[c]%nt ) ier = 0;
+    ntok[c+1] += ntok[c];
+  }
+  ntot = ntok[nchunk];
+  if ( ntot != nt*file->n[sec] ) {
+    fprintf(stderr,"\n  ## Error: %s: %d values found in the %s section,"
+            " %d expected.\n",__func__,ntot,MIRRORMESH_secName[sec],
+            nt*file->n[sec]);
+    ier = -1;
+  }
+
+  if ( ier == 1 ) {
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+  reduction(min:ier)
+    for ( c=0; c<nchunk; ++c ) {
+      const char *p = cbeg[c];
+      int        k;
+
+      for ( k=ntok[c]/nt+1; k<=ntok[c+1]/nt; ++k ) {
+        if ( !MIRRORMESH_parseEntity(mesh,sec,&p,cbeg[c+1],k) ) {
+          ier = -1;
+          break;
+        }
+      }
+    }
+    if ( ier < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: invalid entity in the %s section.\n",
+              __func__,MIRRORMESH_secName[sec]);
+    }
+  }
+
+  MMG5_DEL_MEM(mesh,ntok);
+  MMG5_DEL_MEM(mesh,cbeg);
+
+  return ier;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param file sections of the mapped file
+ * \param sec section to parse
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Parse a section listing entity indices and tag the listed entities as
+ * Mmg does. Invalid indices are ignored.
+ *
+ */
+static
+int MIRRORMESH_parseTags(MMG5_pMesh mesh,MIRRORMESH_MeditFile *file,int sec) {
+  const char *p = file->beg[sec];
+  int        k,i,idx,nmax,nign;
+
+  switch ( sec ) {
+  case MIRRORMESH_SEC_Corners: case MIRRORMESH_SEC_RequiredVertices:
+    nmax = mesh->np;
+    break;
+  case MIRRORMESH_SEC_Ridges: case MIRRORMESH_SEC_RequiredEdges:
+    nmax = mesh->na;
+    break;
+  case MIRRORMESH_SEC_RequiredTriangles:
+    nmax = mesh->nt;
+    break;
+  default:
+    nmax = mesh->ne;
+  }
+
+  nign = 0;
+  for ( k=0; k<file->n[sec]; ++k ) {
+    if ( !MIRRORMESH_readInt(&p,file->end[sec],&idx) ) {
+      fprintf(stderr,"\n  ## Error: %s: invalid entity in the %s section.\n",
+              __func__,MIRRORMESH_secName[sec]);
+      return 0;
+    }
+    if ( idx < 1 || idx > nmax ) {
+      ++nign;
+      continue;
+    }
+
+    switch ( sec ) {
+    case MIRRORMESH_SEC_Corners:
+      mesh->point[idx].tag |= MG_CRN;
+      break;
+    case MIRRORMESH_SEC_RequiredVertices:
+      mesh->point[idx].tag |= MG_REQ;
+      mesh->point[idx].tag &= ~MG_NUL;
+      break;
+    case MIRRORMESH_SEC_Ridges:
+      mesh->edge[idx].tag |= MG_GEO;
+      break;
+    case MIRRORMESH_SEC_RequiredEdges:
+      mesh->edge[idx].tag |= MG_REQ;
+      break;
+    case MIRRORMESH_SEC_RequiredTriangles:
+      for ( i=0; i<3; ++i ) {
+        mesh->tria[idx].tag[i] |= MG_REQ;
+      }
+      break;
+    case MIRRORMESH_SEC_RequiredTetrahedra:
+      mesh->tetra[idx].tag |= MG_REQ;
+      break;
+    }
+  }
+
+  if ( nign ) {
+    fprintf(stderr,"\n  ## Warning: %s: %d invalid indices ignored in the %s"
+            " section.\n",__func__,nign,MIRRORMESH_secName[sec]);
+  }
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param file sections of the mapped file
+ * \param sec section of the vectors (\a Normals or \a Tangents), followed by
+ * the section of their vertices
+ * \param m values at the vertices to fill (3 per vertex), NULL to fill the
+ * normals of the points
+ *
+ * \return the number of vertices with a vector, -1 if fail.
+ *
+ * Parse the normals or the tangents of the file and store them, normalized as
+ * Mmg does, at their vertices. Invalid indices are ignored.
+ *
+ */
+static
+int MIRRORMESH_parseVectors(MMG5_pMesh mesh,MIRRORMESH_MeditFile *file,int sec,
+                            double *m) {
+  const char *p;
+  double     *vec,*u,dd;
+  int        k,i,ip,in,nv,nign;
+
+  if ( !file->n[sec] || !file->n[sec+1] ) return 0;
+
+  MMG5_ADD_MEM(mesh,3*((size_t)file->n[sec]+1)*sizeof(double),"vectors",
+               return -1);
+  MMG5_SAFE_MALLOC(vec,3*((size_t)file->n[sec]+1),double,return -1);
+
+  p = file->beg[sec];
+  for ( k=1; k<=file->n[sec]; ++k ) {
+    u = &vec[3*k];
+    for ( i=0; i<3; ++i ) {
+      if ( !MIRRORMESH_readDouble(&p,file->end[sec],&u[i]) ) break;
+    }
+    if ( i < 3 ) {
+      fprintf(stderr,"\n  ## Error: %s: invalid entity in the %s section.\n",
+              __func__,MIRRORMESH_secName[sec]);
+      MMG5_DEL_MEM(mesh,vec);
+      return -1;
+    }
+    dd = u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
+    if ( dd > MMG5_EPSD2 ) {
+      dd = 1.0 / sqrt(dd);
+      for ( i=0; i<3; ++i ) u[i] *= dd;
+    }
+  }
+
+  p    = file->beg[sec+1];
+  nv   = 0;
+  nign = 0;
+  for ( k=0; k<file->n[sec+1]; ++k ) {
+    if ( !MIRRORMESH_readInt(&p,file->end[sec+1],&ip) ||
+         !MIRRORMESH_readInt(&p,file->end[sec+1],&in) ) {
+      fprintf(stderr,"\n  ## Error: %s: invalid entity in the %s section.\n",
+              __func__,MIRRORMESH_secName[sec+1]);
+      MMG5_DEL_MEM(mesh,vec);
+      return -1;
+    }
+    if ( ip < 1 || ip > mesh->np || in < 1 || in > file->n[sec] ) {
+      ++nign;
+      continue;
+    }
+    u = m ? &m[3*(size_t)ip] : mesh->point[ip].n;
+    memcpy(u,&vec[3*in],3*sizeof(double));
+    ++nv;
+  }
+  MMG5_DEL_MEM(mesh,vec);
+
+  if ( nign ) {
+    fprintf(stderr,"\n  ## Warning: %s: %d invalid indices ignored in the %s"
+            " section.\n",__func__,nign,MIRRORMESH_secName[sec+1]);
+  }
+
+  return nv;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param info pointer toward the mirrormesh parameters (for the tangents)
+ * \param file sections of the mapped file
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Parse the normals of the file in the points, as \a MMG3D_loadMesh does, and
+ * its tangents in the vector field \a info->tangent.
+ *
+ */
+static
+int MIRRORMESH_parseGeom(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                         MIRRORMESH_MeditFile *file) {
+  MMG5_pSol tgt;
+
+  if ( MIRRORMESH_parseVectors(mesh,file,MIRRORMESH_SEC_Normals,NULL) < 0 )
+    return 0;
+
+  if ( !file->n[MIRRORMESH_SEC_Tangents] ||
+       !file->n[MIRRORMESH_SEC_TangentAtVertices] ) return 1;
+
+  MMG5_SAFE_CALLOC(tgt,1,MMG5_Sol,return 0);
+  tgt->dim      = 3;
+  tgt->ver      = 2;
+  tgt->size     = 3;
+  tgt->type     = MMG5_Vector;
+  tgt->entities = MMG5_Vertex;
+  tgt->np       = tgt->npmax = mesh->np;
+  MMG5_ADD_MEM(mesh,3*((size_t)mesh->np+1)*sizeof(double),"tangents",
+               MMG5_SAFE_FREE(tgt);return 0);
+  MMG5_SAFE_CALLOC(tgt->m,3*((size_t)mesh->np+1),double,
+                   MMG5_SAFE_FREE(tgt);return 0);
+
+  if ( MIRRORMESH_parseVectors(mesh,file,MIRRORMESH_SEC_Tangents,tgt->m) < 0 ) {
+    MMG5_DEL_MEM(mesh,tgt->m);
+    MMG5_SAFE_FREE(tgt);
+    return 0;
+  }
+  info->tangent = tgt;
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the base mesh
+ * \param nthreads number of threads
+ *
+ * \return the number of reoriented tetra.
+ *
+ * Mark the vertices of the elements as used (the other ones keep the \a MG_NUL
+ * tag) and orient the tetra following the Mmg convention (positive volume).
+ *
+ */
+int MIRRORMESH_init_base(MMG5_pMesh mesh,int nthreads) {
+  int k,nreo;
+
+  nreo = 0;
+#pragma omp parallel for num_threads(nthreads) schedule(static) \
+  reduction(+:nreo)
+  for ( k=1; k<=mesh->ne; ++k ) {
+    MMG5_pTetra pt = &mesh->tetra[k];
+    int         i,tmp;
+
+    for ( i=0; i<4; ++i ) {
+#pragma omp atomic write
+      mesh->point[pt->v[i]].tag = 0;
+    }
+    if ( MIRRORMESH_orvol(mesh->point,pt->v) < 0. ) {
+      tmp      = pt->v[2];
+      pt->v[2] = pt->v[3];
+      pt->v[3] = tmp;
+      ++nreo;
+    }
+  }
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( k=1; k<=mesh->nt; ++k ) {
+    int i;
+    for ( i=0; i<3; ++i ) {
+#pragma omp atomic write
+      mesh->point[mesh->tria[k].v[i]].tag = 0;
+    }
+  }
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( k=1; k<=mesh->na; ++k ) {
+#pragma omp atomic write
+    mesh->point[mesh->edge[k].a].tag = 0;
+#pragma omp atomic write
+    mesh->point[mesh->edge[k].b].tag = 0;
+  }
+
+  return nreo;
+}
+
+#ifndef _WIN32
+/**
+ * \param data mapped file
+ * \param size size of the file
+ * \param file sections to fill
+ * \param nthreads number of threads
+ *
+ * \return 1 if success, 0 if the file contains sections that are not handled
+ * by the parallel reader, -1 if the file is invalid.
+ *
+ * Locate the keywords of the file: a keyword is a token starting with a
+ * letter at the beginning of a line (numeric lines start with a digit, a
+ * sign or a dot). Lines are scanned in parallel over byte ranges.
+ *
+ */
+static
+int MIRRORMESH_findSections(const char *data,size_t size,
+                            MIRRORMESH_MeditFile *file,int nthreads) {
+  const char *end = data + size;
+  const char **kw;
+  const char *p;
+  int        *nkw,nrange,nkwtot,r,i,sec,ver,dim,len;
+
+  nrange = 4*MG_MAX(nthreads,1);
+  MMG5_SAFE_CALLOC(nkw,nrange+1,int,return -1);
+
+  /* Count then store the keyword lines of each range */
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( r=0; r<nrange; ++r ) {
+    const char *q    = data + size/nrange*r;
+    const char *qend = (r == nrange-1) ? end : data + size/nrange*(r+1);
+
+    if ( r ) q = MIRRORMESH_nextLine(q-1,end);
+    while ( q < qend ) {
+      const char *t = q;
+      while ( t < end && (*t == ' ' || *t == '\t') ) ++t;
+      if ( t < end && isalpha((unsigned char)*t) ) ++nkw[r+1];
+      q = MIRRORMESH_nextLine(q,end);
+    }
+  }
+  for ( r=0; r<nrange; ++r ) {
+    nkw[r+1] += nkw[r];
+  }
+  nkwtot = nkw[nrange];
+
+  MMG5_SAFE_MALLOC(kw,nkwtot+1,const char*,MMG5_SAFE_FREE(nkw);return -1);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( r=0; r<nrange; ++r ) {
+    const char *q    = data + size/nrange*r;
+    const char *qend = (r == nrange-1) ? end : data + size/nrange*(r+1);
+    int        j     = nkw[r];
+
+    if ( r ) q = MIRRORMESH_nextLine(q-1,end);
+    while ( q < qend ) {
+      const char *t = q;
+      while ( t < end && (*t == ' ' || *t == '\t') ) ++t;
+      if ( t < end && isalpha((unsigned char)*t) ) kw[j++] = t;
+      q = MIRRORMESH_nextLine(q,end);
+    }
+  }
+  kw[nkwtot] = end;
+  MMG5_SAFE_FREE(nkw);
+
+  /* Identify the keywords */
+  memset(file,0,sizeof(MIRRORMESH_MeditFile));
+  ver = dim = 0;
+  for ( i=0; i<nkwtot; ++i ) {
+    p   = kw[i];
+    len = 0;
+    while ( p+len < end && isalnum((unsigned char)p[len]) ) ++len;
+
+#define MIRRORMESH_ISKW(name) \
+    ( len == (int)strlen(name) && !strncmp(kw[i],name,len) )
+
+    if ( MIRRORMESH_ISKW("End") ) break;
+
+    p += len;
+    if ( MIRRORMESH_ISKW("MeshVersionFormatted") ) {
+      if ( !MIRRORMESH_readInt(&p,kw[i+1],&ver) ) break;
+      continue;
+    }
+    if ( MIRRORMESH_ISKW("Dimension") ) {
+      if ( !MIRRORMESH_readInt(&p,kw[i+1],&dim) ) break;
+      continue;
+    }
+
+    for ( sec=0; sec<MIRRORMESH_NSEC; ++sec ) {
+      if ( MIRRORMESH_ISKW(MIRRORMESH_secName[sec]) ) break;
+    }
+#undef MIRRORMESH_ISKW
+
+    if ( sec == MIRRORMESH_NSEC || file->beg[sec] ) {
+      /* Unknown or repeated section */
+      MMG5_SAFE_FREE(kw);
+      return 0;
+    }
+    if ( !MIRRORMESH_readInt(&p,kw[i+1],&file->n[sec]) || file->n[sec] < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: invalid size of the %s section.\n",
+              __func__,MIRRORMESH_secName[sec]);
+      MMG5_SAFE_FREE(kw);
+      return -1;
+    }
+    file->beg[sec] = p;
+    file->end[sec] = kw[i+1];
+  }
+  MMG5_SAFE_FREE(kw);
+
+  if ( !ver || dim != 3 || !file->n[MIRRORMESH_SEC_Vertices] ) {
+    /* Let Mmg handle (or reject) this file */
+    return 0;
+  }
+
+  return 1;
+}
+#endif
+
+int MIRRORMESH_loadMesh(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                        const char *filename) {
+#ifndef _WIN32
+  MIRRORMESH_MeditFile file;
+  struct stat          st;
+  char                 *data;
+  int                  fd,ier,nthreads,k,nreo;
+
+  nthreads = MIRRORMESH_NTHREADS(info);
+
+  fd = open(filename,O_RDONLY);
+  if ( fd < 0 ) {
+    fprintf(stderr,"  ** %s  NOT FOUND.\n",filename);
+    return 0;
+  }
+  if ( fstat(fd,&st) || !st.st_size ) {
+    close(fd);
+    return MMG3D_loadMesh(mesh,filename);
+  }
+  data = mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+  close(fd);
+  if ( data == MAP_FAILED ) {
+    return MMG3D_loadMesh(mesh,filename);
+  }
+  if ( mesh->info.imprim >= 0 )
+    fprintf(stdout,"  %%%% %s OPENED\n",filename);
+
+  ier = MIRRORMESH_findSections(data,st.st_size,&file,nthreads);
+  if ( ier <= 0 ) {
+    munmap(data,st.st_size);
+    if ( !ier ) {
+      /* Binary data or sections not handled here */
+      if ( abs(mesh->info.imprim) > 4 )
+        fprintf(stdout,"     Parallel reader not available: using Mmg.\n");
+      return MMG3D_loadMesh(mesh,filename);
+    }
+    return -1;
+  }
+
+  if ( !MMG3D_Set_meshSize(mesh,file.n[MIRRORMESH_SEC_Vertices],
+                           file.n[MIRRORMESH_SEC_Tetrahedra],0,
+                           file.n[MIRRORMESH_SEC_Triangles],0,
+                           file.n[MIRRORMESH_SEC_Edges]) ) {
+    munmap(data,st.st_size);
+    return -1;
+  }
+
+  /* Vertices first: elements need the number of points and the coordinates */
+  for ( k=MIRRORMESH_SEC_Vertices; k<=MIRRORMESH_SEC_Edges; ++k ) {
+    ier = MIRRORMESH_parseSection(mesh,&file,k,nthreads);
+    if ( !ier ) {
+      /* Unusual layout (entity split over chunk boundaries) */
+      munmap(data,st.st_size);
+      if ( abs(mesh->info.imprim) > 4 )
+        fprintf(stdout,"     Parallel reader not available: using Mmg.\n");
+      return MMG3D_loadMesh(mesh,filename);
+    }
+    if ( ier < 0 ) {
+      munmap(data,st.st_size);
+      return -1;
+    }
+  }
+
+  /* Used points, tetra orientation (Mmg convention) */
+  nreo = MIRRORMESH_init_base(mesh,nthreads);
+  if ( nreo ) {
+    fprintf(stdout,"\n  ## Warning: %s: %d tetra reoriented\n",__func__,nreo);
+  }
+
+  /* Tags */
+  for ( k=MIRRORMESH_SEC_Corners; k<=MIRRORMESH_SEC_RequiredTetrahedra; ++k ) {
+    if ( !MIRRORMESH_parseTags(mesh,&file,k) ) {
+      munmap(data,st.st_size);
+      return -1;
+    }
+  }
+
+  /* Normals and tangents */
+  if ( !MIRRORMESH_parseGeom(mesh,info,&file) ) {
+    munmap(data,st.st_size);
+    return -1;
+  }
+  munmap(data,st.st_size);
+
+  if ( abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     NUMBER OF VERTICES   %8d   CORNERS %8d\n",mesh->np,
+            file.n[MIRRORMESH_SEC_Corners]);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8d\n",mesh->ne);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",mesh->nt);
+    fprintf(stdout,"     NUMBER OF EDGES      %8d   RIDGES  %8d\n",mesh->na,
+            file.n[MIRRORMESH_SEC_Ridges]);
+    if ( file.n[MIRRORMESH_SEC_NormalAtVertices] ||
+         file.n[MIRRORMESH_SEC_TangentAtVertices] ) {
+      fprintf(stdout,"     NUMBER OF NORMALS    %8d   TANGENTS %7d\n",
+              file.n[MIRRORMESH_SEC_NormalAtVertices],
+              file.n[MIRRORMESH_SEC_TangentAtVertices]);
+    }
+  }
+
+  return 1;
+#else
+  return MMG3D_loadMesh(mesh,filename);
+#endif
+}
+
+/**
+ * \param filename name of a Medit ASCII file
+ * \param file computed sections of the file
+ * \param nthreads number of threads
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Map a Medit ASCII file in memory and locate its numeric sections. The file
+ * is released by \ref MIRRORMESH_unmapMedit.
+ *
+ */
+int MIRRORMESH_mapMedit(const char *filename,MIRRORMESH_pMeditFile file,
+                        int nthreads) {
+#ifndef _WIN32
+  struct stat st;
+  char        *data;
+  int         fd,ier;
+
+  memset(file,0,sizeof(MIRRORMESH_MeditFile));
+
+  fd = open(filename,O_RDONLY);
+  if ( fd < 0 ) {
+    fprintf(stderr,"  ** %s  NOT FOUND.\n",filename);
+    return 0;
+  }
+  if ( fstat(fd,&st) || !st.st_size ) {
+    fprintf(stderr,"\n  ## Error: %s: empty file %s.\n",__func__,filename);
+    close(fd);
+    return 0;
+  }
+  data = mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+  close(fd);
+  if ( data == MAP_FAILED ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to map %s.\n",__func__,filename);
+    return 0;
+  }
+
+  ier = MIRRORMESH_findSections(data,st.st_size,file,nthreads);
+  file->data = data;
+  file->size = st.st_size;
+  if ( ier < 1 ) {
+    fprintf(stderr,"\n  ## Error: %s: %s is not a replicated mesh at Medit"
+            " ASCII format.\n",__func__,filename);
+    MIRRORMESH_unmapMedit(file);
+    return 0;
+  }
+
+  return 1;
+#else
+  fprintf(stderr,"\n  ## Error: %s: file mapping not available on this"
+          " platform.\n",__func__);
+  return 0;
+#endif
+}
+
+/**
+ * \param file sections of a mapped file
+ *
+ * Release a file mapped by \ref MIRRORMESH_mapMedit.
+ *
+ */
+void MIRRORMESH_unmapMedit(MIRRORMESH_pMeditFile file) {
+#ifndef _WIN32
+  if ( file->data ) {
+    munmap(file->data,file->size);
+  }
+#endif
+  memset(file,0,sizeof(MIRRORMESH_MeditFile));
+}
+
+/**
+ * \param meshname name of a replicated mesh file (or of its description)
+ *
+ * \return the name of the description of the replicated mesh (the extension
+ * of \a meshname replaced by .mirror), to free, NULL if fail.
+ *
+ */
+static
+char *MIRRORMESH_growthName(const char *meshname) {
+  char *name,*ptr;
+
+  MMG5_SAFE_CALLOC(name,strlen(meshname)+8,char,return NULL);
+  strcpy(name,meshname);
+
+  ptr = strrchr(name,'.');
+  if ( ptr && !strchr(ptr,'/') ) {
+    if ( !strcmp(ptr,".mirror") ) return name;
+    *ptr = '\0';
+  }
+  strcat(name,".mirror");
+
+  return name;
+}
+
+/**
+ * \param meshname name of a replicated mesh file (or of its description)
+ * \param grow computed description of the replicated mesh
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the description of a replicated mesh written by \ref
+ * MIRRORMESH_saveGrowth.
+ *
+ */
+int MIRRORMESH_readGrowth(const char *meshname,MIRRORMESH_pGrowth grow) {
+  FILE *in;
+  char *name,kw[64];
+  int  ver,seen,s,ier;
+
+  name = MIRRORMESH_growthName(meshname);
+  if ( !name ) return 0;
+
+  in = fopen(name,"r");
+  if ( !in ) {
+    fprintf(stderr,"  ** %s  NOT FOUND.\n",name);
+    MMG5_SAFE_FREE(name);
+    return 0;
+  }
+
+  memset(grow,0,sizeof(MIRRORMESH_Growth));
+  ier  = ( fscanf(in,"%63s %d",kw,&ver) == 2 &&
+           !strcmp(kw,"MirrorMeshGrowth") && ver == 1 );
+  seen = 0;
+  while ( ier && fscanf(in,"%63s",kw) == 1 && strcmp(kw,"End") ) {
+    if ( !strcmp(kw,"BaseSizes") ) {
+      ier = fscanf(in,"%d %d %d %d",&grow->nbase[0],&grow->nbase[1],
+                   &grow->nbase[2],&grow->nbase[3]) == 4;
+      seen |= 1;
+    }
+    else if ( !strcmp(kw,"Mirrors") ) {
+      ier = fscanf(in,"%d %d %d",&grow->nmir[0],&grow->nmir[1],
+                   &grow->nmir[2]) == 3;
+      seen |= 2;
+    }
+    else if ( !strcmp(kw,"Modes") ) {
+      ier = fscanf(in,"%d %d %d",&grow->mode[0],&grow->mode[1],
+                   &grow->mode[2]) == 3;
+    }
+    else if ( !strcmp(kw,"Renum") ) {
+      ier = fscanf(in,"%d",&grow->renum) == 1;
+    }
+    else if ( !strcmp(kw,"WeldTol") ) {
+      ier = fscanf(in,"%lf",&grow->weldTol) == 1;
+    }
+    else if ( !strcmp(kw,"Stages") ) {
+      ier = fscanf(in,"%d",&grow->nstage) == 1 && grow->nstage >= 0 &&
+        grow->nstage < MIRRORMESH_NSTAGE;
+      for ( s=0; ier && s<grow->nstage; ++s ) {
+        ier = fscanf(in,"%d %d %d",&grow->stage[s][0],&grow->stage[s][1],
+                     &grow->stage[s][2]) == 3;
+      }
+    }
+    else if ( !strcmp(kw,"Sizes") ) {
+      ier = fscanf(in,"%" SCNd64 " %" SCNd64 " %" SCNd64 " %" SCNd64,
+                   &grow->size[0],&grow->size[1],&grow->size[2],
+                   &grow->size[3]) == 4;
+      seen |= 4;
+    }
+    else {
+      ier = 0;
+    }
+  }
+  fclose(in);
+
+  if ( !ier || seen != 7 ) {
+    fprintf(stderr,"\n  ## Error: %s: invalid description of a replicated"
+            " mesh in %s.\n",__func__,name);
+    MMG5_SAFE_FREE(name);
+    return 0;
+  }
+  MMG5_SAFE_FREE(name);
+
+  return 1;
+}
+
+int MIRRORMESH_loadGrowth(MIRRORMESH_pInfo info,const char *meshname) {
+  MIRRORMESH_Growth grow;
+  int               s;
+
+  if ( !MIRRORMESH_readGrowth(meshname,&grow) ) return 0;
+
+  /* The numbering of the previous replication only depends on them */
+  memcpy(info->mode,grow.mode,3*sizeof(int));
+  info->renum   = grow.renum;
+  info->weldTol = grow.weldTol;
+
+  info->nstage = 0;
+  for ( s=0; s<grow.nstage; ++s ) {
+    if ( !MIRRORMESH_Add_stage(info,grow.stage[s][0],grow.stage[s][1],
+                               grow.stage[s][2]) ) return 0;
+  }
+  return MIRRORMESH_Add_stage(info,grow.nmir[0],grow.nmir[1],grow.nmir[2]);
+}
+
+int MIRRORMESH_saveGrowth(MIRRORMESH_pLattice lattice,const char *meshname) {
+  MMG5_pMesh     mesh = lattice->mesh;
+  MIRRORMESH_int np,ne,nt,na;
+  FILE           *out;
+  char           *name;
+  int            s;
+
+  name = MIRRORMESH_growthName(meshname);
+  if ( !name ) return 0;
+
+  out = fopen(name,"w");
+  if ( !out ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",name);
+    MMG5_SAFE_FREE(name);
+    return 0;
+  }
+
+  MIRRORMESH_Get_latticeSize(lattice,&np,&ne,&nt,&na);
+
+  fprintf(out,"MirrorMeshGrowth 1\n");
+  fprintf(out,"\nBaseSizes\n%d %d %d %d\n",mesh->npi,mesh->nei,mesh->nti,
+          mesh->nai);
+  fprintf(out,"\nMirrors\n%d %d %d\n",lattice->nmir[0],lattice->nmir[1],
+          lattice->nmir[2]);
+  fprintf(out,"\nModes\n%d %d %d\n",lattice->mode[0],lattice->mode[1],
+          lattice->mode[2]);
+  fprintf(out,"\nRenum\n%d\n",lattice->renum);
+  fprintf(out,"\nWeldTol\n%.17g\n",lattice->weldTol);
+  fprintf(out,"\nStages\n%d\n",lattice->nstage);
+  for ( s=0; s<lattice->nstage; ++s ) {
+    fprintf(out,"%d %d %d\n",lattice->stage[s][0],lattice->stage[s][1],
+            lattice->stage[s][2]);
+  }
+  fprintf(out,"\nSizes\n%" MIRRORMESH_PRId " %" MIRRORMESH_PRId " %"
+          MIRRORMESH_PRId " %" MIRRORMESH_PRId "\n",np,ne,nt,na);
+  fprintf(out,"\nEnd\n");
+
+  if ( fclose(out) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,name);
+    MMG5_SAFE_FREE(name);
+    return 0;
+  }
+  MMG5_SAFE_FREE(name);
+
+  return 1;
+}
@@ -0,0 +1,1100 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file lattice.c
+ * \brief Closed-form description of the replicated mesh.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The replicated mesh is described by the base mesh, the transformation of
+ * each copy of the lattice and the numbering of the entities that are not
+ * duplicated in each copy.
+ *
+ * Whether a base entity is duplicated in a copy only depends on the planes
+ * that the copy shares with the previous copies (\a dupmask): along each
+ * axis, the copy is either the first one, an odd one (sharing the upper
+ * boundary of the base mesh with the previous copy) or an even one (sharing
+ * the lower boundary); along a translation axis, every copy but the first one
+ * shares its lower boundary with the previous copy. Only interface entities (points lying on a boundary
+ * plane, elements whose vertices all lie on a same boundary plane) may be
+ * duplicated, thus the numbering stores, for each mask of planes, a prefix
+ * count of the duplicated entities over the interface entities only.
+ *
+ * Boundary triangles and edges lying on a plane shared with a neighbouring
+ * copy (\a itfmask) are inside the replicated mesh: they are removed from
+ * every copy, the base one included, with the same prefix counts.
+ *
+ */
+#include "mirrormesh.h"
+
+/**
+ * \param mesh mesh structure
+ * \param dim working dimension
+ * \param nmir number of mirrors in each direction
+ * \param mode replication mode in each direction (\ref MIRRORMESH_Mode)
+ * \param icopy index of the copy in the lattice of copies
+ * \param copy pointer toward the computed transformation
+ *
+ * Compute the transformation that maps the base mesh on the copy \a icopy of
+ * the lattice. Copies are numbered along the x-axis first, then along the y
+ * and z axes.
+ *
+ * Along a mirroring direction, the copy of index \f$i\f$ is obtained from
+ * the base mesh by \f$i\f$ successive mirrorings, the upper boundary of the
+ * previous copy being used as symmetry plane. For a base coordinate \f$x\f$,
+ * a bounding box \f$[m,M]\f$ and \f$\delta = M-m\f$, it gives:
+ *   - \f$x_i = x + i\delta\f$ if \f$i\f$ is even;
+ *   - \f$x_i = 2M + (i-1)\delta - x\f$ if \f$i\f$ is odd.
+ *
+ * Along a translation direction, \f$x_i = x + i\delta\f$ for every copy:
+ * the lower boundary of a copy is glued to the upper boundary of the
+ * previous one.
+ *
+ * The planes of the base bounding box that the copy shares with the previous
+ * copies (\a dupmask) and with the previous or the next ones (\a itfmask)
+ * are stored with the bits of \ref MIRRORMESH_Interface.
+ *
+ */
+void MIRRORMESH_set_copy(MMG5_pMesh mesh,int dim,int *nmir,int *mode,
+                         int icopy,MIRRORMESH_pCopy copy) {
+  double delta;
+  int    i,per,nref;
+
+  nref = 0;
+  copy->dupmask  = 0;
+  copy->itfmask  = 0;
+  copy->periodic = 0;
+  for ( i=0; i<dim; ++i ) {
+    copy->idx[i] = icopy % (nmir[i]+1);
+    icopy       /= (nmir[i]+1);
+
+    per   = ( mode[i] == MIRRORMESH_TRANSLATE );
+    delta = mesh->info.max[i] - mesh->info.min[i];
+    if ( !per && copy->idx[i]%2 ) {
+      copy->sign[i]  = -1.;
+      copy->shift[i] = 2.*mesh->info.max[i] + (copy->idx[i]-1)*delta;
+      ++nref;
+    }
+    else {
+      copy->sign[i]  = 1.;
+      copy->shift[i] = copy->idx[i]*delta;
+    }
+
+    if ( per ) {
+      copy->periodic |= (1 << i);
+    }
+    if ( copy->idx[i] ) {
+      copy->dupmask |= (1 << MIRRORMESH_LOWER(per,i,copy->idx[i]));
+    }
+    if ( copy->idx[i] < nmir[i] ) {
+      copy->itfmask |= (1 << MIRRORMESH_UPPER(per,i,copy->idx[i]));
+    }
+  }
+  copy->itfmask |= copy->dupmask;
+  copy->reorient = nref%2;
+}
+
+/**
+ * \param num pointer toward the numbering
+ * \param mask mask of the planes of the copy
+ * \param k index of an entity of the base mesh
+ *
+ * \return the number of skipped entities of index lower or equal to \a k
+ * in the copies of mask \a mask.
+ *
+ */
+static inline
+int MIRRORMESH_ndup(MIRRORMESH_pNumbering num,int mask,int k) {
+  int lo,hi,mid;
+
+  /* Number of interface entities of index lower or equal to k */
+  lo = 0;
+  hi = num->nitf;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2;
+    if ( num->itf[mid] <= k ) lo = mid+1;
+    else hi = mid;
+  }
+  return num->ndup[mask][lo];
+}
+
+/**
+ * \param num pointer toward the numbering
+ * \param copy pointer toward the copy
+ *
+ * \return the mask of the planes used to skip the entities of \a num in
+ * \a copy.
+ *
+ */
+static inline
+int MIRRORMESH_mask(MIRRORMESH_pNumbering num,MIRRORMESH_pCopy copy) {
+  return num->plane ? copy->itfmask : copy->dupmask;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param mask mask of planes
+ * \param nv number of vertices of the entity
+ * \param v vertices of the base entity
+ *
+ * \return 1 if the entity is skipped in the copies of mask \a mask.
+ *
+ * An entity is skipped if all its vertices lie on a same plane of the mask.
+ * Checking that each vertex lies on one of the planes is not enough: near an
+ * edge of the bounding box, a tetra may have its vertices on two different
+ * planes shared with previous copies without being a duplicate.
+ *
+ */
+static inline
+int MIRRORMESH_isdup(MIRRORMESH_pLattice lat,int mask,int nv,int *v) {
+  int i,common;
+
+  common = mask;
+  for ( i=0; i<nv; ++i ) {
+    common &= lat->itf.face[v[i]];
+  }
+  return common != 0;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param num pointer toward the numbering to fill
+ * \param plane 1 if the entities lying on interior planes are skipped
+ * \param nbase number of base entities
+ * \param nv number of vertices per entity
+ * \param vert vertices of each base entity (\a nv per entity, entity \a k at
+ * position \a nv * \a k)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Find the interface entities of the base mesh and the planes shared by
+ * their vertices. For points, \a nv is 1 and \a vert stores the identity.
+ * The prefix counts and the offsets of the copies are computed by \ref
+ * MIRRORMESH_number_copies.
+ *
+ */
+static
+int MIRRORMESH_build_numbering(MIRRORMESH_pLattice lat,
+                               MIRRORMESH_pNumbering num,int plane,int nbase,
+                               int nv,int *vert) {
+  MMG5_pMesh mesh = lat->mesh;
+  int        k,r,i;
+  int8_t     common;
+
+  memset(num,0,sizeof(MIRRORMESH_Numbering));
+  num->nbase = nbase;
+  num->plane = plane;
+
+  /* Interface entities: all their vertices lie on a same boundary plane */
+  for ( k=1; k<=nbase; ++k ) {
+    if ( MIRRORMESH_isdup(lat,0x3f,nv,&vert[nv*k]) ) ++num->nitf;
+  }
+
+  if ( num->nitf ) {
+    MMG5_ADD_MEM(mesh,num->nitf*(sizeof(int)+sizeof(int8_t)),
+                 "interface entities",return 0);
+    MMG5_SAFE_MALLOC(num->itf,num->nitf,int,return 0);
+    MMG5_SAFE_MALLOC(num->face,num->nitf,int8_t,return 0);
+    r = 0;
+    for ( k=1; k<=nbase; ++k ) {
+      common = 0x3f;
+      for ( i=0; i<nv; ++i ) {
+        common &= lat->itf.face[vert[nv*k+i]];
+      }
+      if ( !common ) continue;
+      num->itf[r]    = k;
+      num->face[r++] = common;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * \param base pointer toward the lattice owning the numbering arrays of the
+ * base mesh
+ * \param bnum numbering of the entity type in \a base
+ * \param lat pointer toward the lattice (copies ordered)
+ * \param num numbering of the entity type in \a lat
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Number the entities over the copies of \a lat: prefix counts of the
+ * skipped interface entities for the masks of planes of its copies (computed
+ * once and stored in \a base, that may be \a lat) and index of the first
+ * entity of each copy.
+ *
+ */
+static
+int MIRRORMESH_number_copies(MIRRORMESH_pLattice base,
+                             MIRRORMESH_pNumbering bnum,
+                             MIRRORMESH_pLattice lat,
+                             MIRRORMESH_pNumbering num) {
+  int r,mask,icopy;
+
+  /* Prefix count of the skipped interface entities for each mask */
+  for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+    mask = MIRRORMESH_mask(num,&lat->copies[icopy]);
+    if ( num->ndup[mask] ) continue;
+
+    if ( !bnum->ndup[mask] ) {
+      MMG5_ADD_MEM(base->mesh,(bnum->nitf+1)*sizeof(int),
+                   "duplicated entities",return 0);
+      MMG5_SAFE_CALLOC(bnum->ndup[mask],bnum->nitf+1,int,return 0);
+
+      for ( r=0; r<bnum->nitf; ++r ) {
+        bnum->ndup[mask][r+1] = bnum->ndup[mask][r] +
+          ((bnum->face[r] & mask) != 0);
+      }
+    }
+    num->ndup[mask] = bnum->ndup[mask];
+  }
+
+  /* Index of the first entity of each copy, in the numbering order */
+  MMG5_ADD_MEM(lat->mesh,(lat->ncopy+1)*sizeof(MIRRORMESH_int),"copy offsets",
+               return 0);
+  MMG5_SAFE_MALLOC(num->offset,lat->ncopy+1,MIRRORMESH_int,return 0);
+  num->offset[0] = 0;
+  for ( r=0; r<lat->ncopy; ++r ) {
+    mask = MIRRORMESH_mask(num,&lat->copies[lat->order[r]]);
+    num->offset[r+1] = num->offset[r] + num->nbase - num->ndup[mask][num->nitf];
+  }
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param num pointer toward the numbering
+ *
+ * Free the numbering arrays.
+ *
+ */
+static
+void MIRRORMESH_free_numbering(MMG5_pMesh mesh,MIRRORMESH_pNumbering num) {
+  int mask;
+
+  if ( num->itf ) {
+    MMG5_DEL_MEM(mesh,num->itf);
+  }
+  if ( num->face ) {
+    MMG5_DEL_MEM(mesh,num->face);
+  }
+  for ( mask=0; mask<MIRRORMESH_NMASK; ++mask ) {
+    if ( num->ndup[mask] ) {
+      MMG5_DEL_MEM(mesh,num->ndup[mask]);
+    }
+  }
+  if ( num->offset ) {
+    MMG5_DEL_MEM(mesh,num->offset);
+  }
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param met pointer toward the metric (may be NULL or empty)
+ * \param sol array of \a mesh->nsols solution fields (may be NULL)
+ * \param tangent tangents at the vertices (may be NULL)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Gather the fields to replicate with the mesh. Only scalar, vector and
+ * symmetric tensor fields defined at the vertices of the base mesh are
+ * handled. The tangents follow the \a lat->nsol fields: they are replicated
+ * like them but only written with the mesh.
+ *
+ */
+static
+int MIRRORMESH_set_fields(MIRRORMESH_pLattice lat,MMG5_pSol met,
+                          MMG5_pSol sol,MMG5_pSol tangent) {
+  MMG5_pMesh mesh = lat->mesh;
+  MMG5_pSol  psl;
+  int        nsols,l;
+
+  nsols = sol ? mesh->nsols : 0;
+
+  MMG5_ADD_MEM(mesh,(nsols+2)*sizeof(MMG5_pSol),"fields",return 0);
+  MMG5_SAFE_CALLOC(lat->sol,nsols+2,MMG5_pSol,return 0);
+
+  for ( l=-1; l<nsols; ++l ) {
+    psl = ( l < 0 ) ? met : &sol[l];
+
+    if ( !psl || !psl->m || !psl->np ) continue;
+
+    if ( psl->entities != MMG5_Noentity && psl->entities != MMG5_Vertex ) {
+      fprintf(stderr,"\n  ## Error: %s: only fields defined at the vertices"
+              " can be replicated.\n",__func__);
+      return 0;
+    }
+    if ( psl->np != mesh->npi ) {
+      fprintf(stderr,"\n  ## Error: %s: field with %d values for a mesh of %d"
+              " vertices.\n",__func__,psl->np,mesh->npi);
+      return 0;
+    }
+    if ( !(psl->type == MMG5_Scalar && psl->size == 1) &&
+         !(psl->type == MMG5_Vector && psl->size == 3) &&
+         !(psl->type == MMG5_Tensor && psl->size == 6) ) {
+      fprintf(stderr,"\n  ## Error: %s: unexpected type of field (%d values"
+              " per vertex).\n",__func__,psl->size);
+      return 0;
+    }
+    lat->sol[lat->nsol++] = psl;
+  }
+  lat->nfld = lat->nsol;
+
+  if ( tangent && tangent->m ) {
+    if ( tangent->np != mesh->npi ) {
+      fprintf(stderr,"\n  ## Warning: %s: tangents at %d vertices for a mesh"
+              " of %d vertices: ignored.\n",__func__,tangent->np,mesh->npi);
+    }
+    else {
+      lat->sol[lat->nfld++] = tangent;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * \param nstage number of previous replications
+ * \param stage numbers of mirrors of the previous replications
+ * \param nmir number of mirrors in each direction
+ * \param ncopy number of copies of the lattice (to fill)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Count the copies of a lattice of \a nmir mirrors and check that the
+ * previous replications are nested in it.
+ *
+ */
+static
+int MIRRORMESH_count_copies(int nstage,int stage[][3],const int nmir[3],
+                            int *ncopy) {
+  int i,k;
+
+  *ncopy = 1;
+  for ( i=0; i<3; ++i ) {
+    for ( k=0; k<nstage; ++k ) {
+      if ( stage[k][i] > nmir[i] || (k && stage[k][i] < stage[k-1][i]) ) {
+        fprintf(stderr,"\n  ## Error: %s: the previous replications must be"
+                " nested in the new one.\n",__func__);
+        return 0;
+      }
+    }
+    if ( nmir[i] >= INT_MAX / *ncopy ) {
+      fprintf(stderr,"\n  ## Error: %s: too many copies.\n",__func__);
+      return 0;
+    }
+    *ncopy *= (nmir[i]+1);
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the base mesh
+ * \param met pointer toward the metric (may be NULL)
+ * \param sol array of \a mesh->nsols solution fields (may be NULL)
+ * \param info pointer toward the mirrormesh parameters
+ * \param lat pointer toward the lattice to fill
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Build the part of the lattice that only depends on the base mesh and on the
+ * replication parameters: bounding box, fields, interface points and
+ * interface entities. The copies are set by \ref MIRRORMESH_set_copies, that
+ * may be called for several numbers of mirrors on a same base.
+ *
+ * If \a info->renum is set, the base mesh is renumbered (see \ref
+ * MIRRORMESH_renum_base) and the values of the fields are permuted with the
+ * vertices.
+ *
+ */
+int MIRRORMESH_build_base(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,
+                          MIRRORMESH_pInfo info,MIRRORMESH_pLattice lat) {
+  int *vert,i,k;
+
+  memset(lat,0,sizeof(MIRRORMESH_Lattice));
+  lat->mesh     = mesh;
+  lat->dim      = 3;
+  lat->nthreads = MIRRORMESH_NTHREADS(info);
+  lat->int32max = MIRRORMESH_INT32(info);
+
+  lat->renum   = info->renum;
+  lat->weldTol = info->weldTol;
+  lat->nstage  = info->nstage;
+  memcpy(lat->mode,info->mode,3*sizeof(int));
+  memcpy(lat->stage,info->stage,info->nstage*sizeof(lat->stage[0]));
+
+  /* Bounding box computation */
+  if ( !MMG5_boundingBox(mesh) ) {
+    return 0;
+  }
+
+  /* Fields replicated with the mesh */
+  if ( !MIRRORMESH_set_fields(lat,met,sol,info->tangent) ) {
+    MIRRORMESH_free_lattice(lat);
+    return 0;
+  }
+
+  /* Locality of the numbering of the base mesh */
+  if ( info->renum &&
+       !MIRRORMESH_renum_base(mesh,lat->sol,lat->nfld,lat->nthreads) ) {
+    fprintf(stderr,"\n  ## Warning: %s: unable to renumber the base mesh.\n",
+            __func__);
+  }
+
+  /* Points lying on the symmetry planes */
+  if ( !MIRRORMESH_build_interfaces(mesh,lat->dim,info->mode,info->weldTol,
+                                    &lat->itf) ) {
+    MIRRORMESH_free_lattice(lat);
+    return 0;
+  }
+
+  /* Points: identity connectivity */
+  MMG5_ADD_MEM(mesh,(mesh->npi+1)*sizeof(int),"point ranks",
+               MIRRORMESH_free_lattice(lat);return 0);
+  MMG5_SAFE_MALLOC(lat->rank,mesh->npi+1,int,
+                   MIRRORMESH_free_lattice(lat);return 0);
+  for ( k=0; k<=mesh->npi; ++k ) {
+    lat->rank[k] = k;
+  }
+  if ( !MIRRORMESH_build_numbering(lat,&lat->point,0,mesh->npi,1,lat->rank) ) {
+    MIRRORMESH_free_lattice(lat);
+    return 0;
+  }
+
+  /* rank[k]: number of interface points of index lower than k */
+  i = 0;
+  for ( k=1; k<=mesh->npi; ++k ) {
+    lat->rank[k] = i;
+    if ( lat->itf.face[k] ) ++i;
+  }
+
+  /* Elements: gather the vertices in a contiguous array */
+  k = MG_MAX(MG_MAX(4*(mesh->nei+1),3*(mesh->nti+1)),2*(mesh->nai+1));
+  MMG5_ADD_MEM(mesh,k*sizeof(int),"element vertices",
+               MIRRORMESH_free_lattice(lat);return 0);
+  MMG5_SAFE_CALLOC(vert,k,int,MIRRORMESH_free_lattice(lat);return 0);
+
+  for ( k=1; k<=mesh->nei; ++k ) {
+    memcpy(&vert[4*k],mesh->tetra[k].v,4*sizeof(int));
+  }
+  if ( !MIRRORMESH_build_numbering(lat,&lat->tetra,0,mesh->nei,4,vert) ) {
+    MMG5_DEL_MEM(mesh,vert);
+    MIRRORMESH_free_lattice(lat);
+    return 0;
+  }
+
+  for ( k=1; k<=mesh->nti; ++k ) {
+    memcpy(&vert[3*k],mesh->tria[k].v,3*sizeof(int));
+  }
+  if ( !MIRRORMESH_build_numbering(lat,&lat->tria,1,mesh->nti,3,vert) ) {
+    MMG5_DEL_MEM(mesh,vert);
+    MIRRORMESH_free_lattice(lat);
+    return 0;
+  }
+
+  for ( k=1; k<=mesh->nai; ++k ) {
+    vert[2*k]   = mesh->edge[k].a;
+    vert[2*k+1] = mesh->edge[k].b;
+  }
+  if ( !MIRRORMESH_build_numbering(lat,&lat->edge,1,mesh->nai,2,vert) ) {
+    MMG5_DEL_MEM(mesh,vert);
+    MIRRORMESH_free_lattice(lat);
+    return 0;
+  }
+  MMG5_DEL_MEM(mesh,vert);
+
+  return 1;
+}
+
+/**
+ * \param base pointer toward the lattice built by \ref MIRRORMESH_build_base
+ * \param nmir number of mirrors in each direction
+ * \param lat pointer toward the lattice to fill: \a base itself or a copy of
+ * the \a base structure (sharing its arrays)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Set the transformation of the copies of a lattice of \a nmir mirrors, their
+ * numbering order and the numbering of their entities. The prefix counts of
+ * the interface entities are computed once for each mask of planes and kept
+ * in \a base; their computation is protected, so several threads may set the
+ * copies of distinct lattices built on a same base, each lattice pointing
+ * toward its own mesh structure for the memory count.
+ *
+ */
+int MIRRORMESH_set_copies(MIRRORMESH_pLattice base,const int nmir[3],
+                          MIRRORMESH_pLattice lat) {
+  MMG5_pMesh mesh = lat->mesh;
+  int        icopy,ier;
+
+  if ( !MIRRORMESH_count_copies(lat->nstage,lat->stage,nmir,&lat->ncopy) ) {
+    return 0;
+  }
+  memcpy(lat->nmir,nmir,3*sizeof(int));
+
+  /* Transformation of each copy */
+  MMG5_ADD_MEM(mesh,lat->ncopy*sizeof(MIRRORMESH_Copy),"copies",
+               MIRRORMESH_free_copies(lat);return 0);
+  MMG5_SAFE_CALLOC(lat->copies,lat->ncopy,MIRRORMESH_Copy,
+                   MIRRORMESH_free_copies(lat);return 0);
+  for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+    MIRRORMESH_set_copy(mesh,lat->dim,lat->nmir,lat->mode,icopy,
+                        &lat->copies[icopy]);
+  }
+
+  /* Numbering order of the copies */
+  MMG5_ADD_MEM(mesh,lat->ncopy*sizeof(int),"copy order",
+               MIRRORMESH_free_copies(lat);return 0);
+  MMG5_SAFE_MALLOC(lat->order,lat->ncopy,int,
+                   MIRRORMESH_free_copies(lat);return 0);
+  if ( lat->renum || lat->nstage ) {
+    MIRRORMESH_order_copies(lat);
+  }
+  else {
+    for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+      lat->order[icopy]       = icopy;
+      lat->copies[icopy].pos = icopy;
+    }
+  }
+
+  /* Numbering of the entities over the copies */
+#pragma omp critical (MIRRORMESH_numbering)
+  {
+    ier = MIRRORMESH_number_copies(base,&base->point,lat,&lat->point) &&
+      MIRRORMESH_number_copies(base,&base->tetra,lat,&lat->tetra) &&
+      MIRRORMESH_number_copies(base,&base->tria,lat,&lat->tria) &&
+      MIRRORMESH_number_copies(base,&base->edge,lat,&lat->edge);
+  }
+  if ( !ier ) {
+    MIRRORMESH_free_copies(lat);
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the base mesh
+ * \param met pointer toward the metric (may be NULL)
+ * \param sol array of \a mesh->nsols solution fields (may be NULL)
+ * \param info pointer toward the mirrormesh parameters
+ * \param lat pointer toward the lattice to fill
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Build the closed-form description of the replicated mesh: bounding box of
+ * the base mesh, transformation of the copies, interface points and
+ * numbering of the points, tetra, triangles and edges of each copy.
+ *
+ * If \a info->renum is set, the base mesh is renumbered and the copies are
+ * ordered along a space-filling curve (see \ref MIRRORMESH_renum_base and
+ * \ref MIRRORMESH_order_copies). The values of the fields are permuted with
+ * the vertices. If \a info holds previous replications (see \ref
+ * MIRRORMESH_Add_stage), their copies are numbered first, so that their
+ * points and tetra keep their indices.
+ *
+ */
+int MIRRORMESH_build_lattice(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,
+                             MIRRORMESH_pInfo info,MIRRORMESH_pLattice lat) {
+  int ncopy;
+
+  /* Check the sizes before modifying the base mesh */
+  if ( !MIRRORMESH_count_copies(info->nstage,info->stage,info->nmir,&ncopy) ) {
+    return 0;
+  }
+
+  if ( !MIRRORMESH_build_base(mesh,met,sol,info,lat) ) {
+    return 0;
+  }
+  if ( !MIRRORMESH_set_copies(lat,info->nmir,lat) ) {
+    MIRRORMESH_free_lattice(lat);
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ *
+ * Free the arrays set by \ref MIRRORMESH_set_copies. The prefix counts of the
+ * interface entities belong to the base and are kept.
+ *
+ */
+void MIRRORMESH_free_copies(MIRRORMESH_pLattice lat) {
+  MMG5_pMesh mesh = lat->mesh;
+
+  if ( lat->copies ) {
+    MMG5_DEL_MEM(mesh,lat->copies);
+  }
+  if ( lat->order ) {
+    MMG5_DEL_MEM(mesh,lat->order);
+  }
+  if ( lat->point.offset ) {
+    MMG5_DEL_MEM(mesh,lat->point.offset);
+  }
+  if ( lat->tetra.offset ) {
+    MMG5_DEL_MEM(mesh,lat->tetra.offset);
+  }
+  if ( lat->tria.offset ) {
+    MMG5_DEL_MEM(mesh,lat->tria.offset);
+  }
+  if ( lat->edge.offset ) {
+    MMG5_DEL_MEM(mesh,lat->edge.offset);
+  }
+  lat->ncopy = 0;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ *
+ * Free the lattice arrays (the base mesh is not freed).
+ *
+ */
+void MIRRORMESH_free_lattice(MIRRORMESH_pLattice lat) {
+  MMG5_pMesh mesh = lat->mesh;
+
+  MIRRORMESH_free_copies(lat);
+  MIRRORMESH_free_interfaces(mesh,&lat->itf);
+  MIRRORMESH_free_numbering(mesh,&lat->point);
+  MIRRORMESH_free_numbering(mesh,&lat->tetra);
+  MIRRORMESH_free_numbering(mesh,&lat->tria);
+  MIRRORMESH_free_numbering(mesh,&lat->edge);
+
+  if ( lat->rank ) {
+    MMG5_DEL_MEM(mesh,lat->rank);
+  }
+  if ( lat->sol ) {
+    MMG5_DEL_MEM(mesh,lat->sol);
+  }
+  lat->nsol = lat->nfld = 0;
+
+  if ( lat->solcopy ) {
+    MIRRORMESH_free_solCopy(mesh,&lat->solcopy);
+  }
+}
+
+/**
+ * \param mesh pointer toward the copy of the base mesh
+ * \param solcopy pointer toward the copies of the fields
+ *
+ * Free the copies of the metric, of the \a mesh->nsols fields and of the
+ * tangents built by \ref MIRRORMESH_copy_base.
+ *
+ */
+void MIRRORMESH_free_solCopy(MMG5_pMesh mesh,MMG5_pSol *solcopy) {
+  int l;
+
+  for ( l=0; l<=mesh->nsols+1; ++l ) {
+    if ( (*solcopy)[l].m ) {
+      MMG5_DEL_MEM(mesh,(*solcopy)[l].m);
+    }
+  }
+  MMG5_DEL_MEM(mesh,*solcopy);
+}
+
+/**
+ * \param mesh pointer toward the base mesh
+ * \param met pointer toward the metric (may be NULL)
+ * \param sol array of \a mesh->nsols solution fields (may be NULL)
+ * \param tangent tangents at the vertices (may be NULL)
+ * \param copy pointer toward the copy of the base mesh (to allocate)
+ * \param solcopy pointer toward the copies of the metric, of the fields and of
+ * the tangents, in this order (to allocate, NULL if there is no field)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Copy the base mesh (entities and boundary data of a mesh analysed by Mmg)
+ * and its fields, so that a lattice can renumber them without modifying the
+ * ones of the caller. The memory of the copies is counted on \a copy, that
+ * has the verbosity and the memory option of \a mesh.
+ *
+ */
+int MIRRORMESH_copy_base(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,
+                         MMG5_pSol tangent,MMG5_pMesh *copy,
+                         MMG5_pSol *solcopy) {
+  MMG5_pMesh cmesh = NULL;
+  MMG5_pSol  csol,psl;
+  size_t     size;
+  int        nsols,l;
+
+  *solcopy = NULL;
+  *copy    = NULL;
+
+  if ( !MMG3D_Init_mesh(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,MMG5_ARG_end) ) {
+    return 0;
+  }
+  if ( !MMG3D_Set_iparameter(cmesh,NULL,MMG3D_IPARAM_verbose,
+                             mesh->info.imprim) ||
+       (mesh->info.mem > 0 &&
+        !MMG3D_Set_iparameter(cmesh,NULL,MMG3D_IPARAM_mem,mesh->info.mem)) ||
+       !MMG3D_Set_meshSize(cmesh,mesh->npi,mesh->nei,0,mesh->nti,0,
+                           mesh->nai) ) {
+    MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,MMG5_ARG_end);
+    return 0;
+  }
+
+  /* Entities */
+  memcpy(&cmesh->point[1],&mesh->point[1],mesh->npi*sizeof(MMG5_Point));
+  if ( mesh->nei ) {
+    memcpy(&cmesh->tetra[1],&mesh->tetra[1],mesh->nei*sizeof(MMG5_Tetra));
+  }
+  if ( mesh->nti ) {
+    memcpy(&cmesh->tria[1],&mesh->tria[1],mesh->nti*sizeof(MMG5_Tria));
+  }
+  if ( mesh->nai ) {
+    memcpy(&cmesh->edge[1],&mesh->edge[1],mesh->nai*sizeof(MMG5_Edge));
+  }
+  cmesh->npi = cmesh->np = mesh->npi;
+  cmesh->nei = cmesh->ne = mesh->nei;
+  cmesh->nti = cmesh->nt = mesh->nti;
+  cmesh->nai = cmesh->na = mesh->nai;
+
+  /* Boundary data of a mesh analysed by Mmg */
+  if ( mesh->xpoint ) {
+    MMG5_ADD_MEM(cmesh,(mesh->xp+1)*sizeof(MMG5_xPoint),"boundary points",
+                 MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                MMG5_ARG_end);return 0);
+    MMG5_SAFE_MALLOC(cmesh->xpoint,mesh->xp+1,MMG5_xPoint,
+                     MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                    MMG5_ARG_end);return 0);
+    memcpy(cmesh->xpoint,mesh->xpoint,(mesh->xp+1)*sizeof(MMG5_xPoint));
+    cmesh->xp = cmesh->xpmax = mesh->xp;
+  }
+  if ( mesh->xtetra ) {
+    MMG5_ADD_MEM(cmesh,(mesh->xt+1)*sizeof(MMG5_xTetra),"boundary tetra",
+                 MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                MMG5_ARG_end);return 0);
+    MMG5_SAFE_MALLOC(cmesh->xtetra,mesh->xt+1,MMG5_xTetra,
+                     MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                    MMG5_ARG_end);return 0);
+    memcpy(cmesh->xtetra,mesh->xtetra,(mesh->xt+1)*sizeof(MMG5_xTetra));
+    cmesh->xt = cmesh->xtmax = mesh->xt;
+  }
+
+  /* Fields: the metric, the solution fields, then the tangents */
+  nsols = sol ? mesh->nsols : 0;
+  cmesh->nsols = nsols;
+  if ( met || nsols || tangent ) {
+    MMG5_ADD_MEM(cmesh,(nsols+2)*sizeof(MMG5_Sol),"fields",
+                 MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                MMG5_ARG_end);return 0);
+    MMG5_SAFE_CALLOC(csol,nsols+2,MMG5_Sol,
+                     MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                    MMG5_ARG_end);return 0);
+
+    for ( l=-1; l<=nsols; ++l ) {
+      psl = ( l < 0 ) ? met : ( l < nsols ? &sol[l] : tangent );
+      if ( !psl ) continue;
+
+      memcpy(&csol[l+1],psl,sizeof(MMG5_Sol));
+      csol[l+1].m       = NULL;
+      csol[l+1].namein  = NULL;
+      csol[l+1].nameout = NULL;
+      if ( !psl->m ) continue;
+
+      size = (size_t)(psl->np+1)*psl->size;
+      MMG5_ADD_MEM(cmesh,size*sizeof(double),"field values",
+                   MIRRORMESH_free_solCopy(cmesh,&csol);
+                   MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                  MMG5_ARG_end);return 0);
+      MMG5_SAFE_MALLOC(csol[l+1].m,size,double,
+                       MIRRORMESH_free_solCopy(cmesh,&csol);
+                       MMG3D_Free_all(MMG5_ARG_start,MMG5_ARG_ppMesh,&cmesh,
+                                      MMG5_ARG_end);return 0);
+      memcpy(csol[l+1].m,psl->m,size*sizeof(double));
+      csol[l+1].npmax = psl->np;
+    }
+    *solcopy = csol;
+  }
+
+  *copy = cmesh;
+
+  return 1;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param icopy index of the copy
+ * \param k index of the point in the base mesh
+ *
+ * \return the index of the image of the base point \a k in the copy \a icopy
+ * in the replicated mesh (if the image is a duplicated point, the index of the
+ * point that is kept).
+ *
+ */
+MIRRORMESH_int MIRRORMESH_lattice_point(MIRRORMESH_pLattice lat,int icopy,
+                                        int k) {
+  MIRRORMESH_pCopy copy = &lat->copies[icopy];
+  int8_t           face = lat->itf.face[k];
+
+  if ( face & copy->dupmask ) {
+    icopy = MIRRORMESH_owner(lat->dim,lat->nmir,&lat->itf,copy,&k);
+    copy  = &lat->copies[icopy];
+  }
+  return lat->point.offset[copy->pos] + k - lat->point.ndup[copy->dupmask][lat->rank[k]];
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param num numbering of the entity type
+ * \param g index of the entity in the replicated mesh
+ * \param icopy pointer toward the index of the copy of the entity
+ *
+ * \return the index of the base entity whose image in \a icopy is the entity
+ * \a g of the replicated mesh, 0 if \a g is out of range.
+ *
+ */
+int MIRRORMESH_lattice_locate(MIRRORMESH_pLattice lat,
+                              MIRRORMESH_pNumbering num,MIRRORMESH_int g,
+                              int *icopy) {
+  int lo,hi,mid,mask,l;
+
+  if ( g < 1 || g > num->offset[lat->ncopy] ) return 0;
+
+  /* Copy: last copy whose offset is lower than g */
+  lo = 0;
+  hi = lat->ncopy-1;
+  while ( lo < hi ) {
+    mid = (lo+hi+1)/2;
+    if ( num->offset[mid] < g ) lo = mid;
+    else hi = mid-1;
+  }
+  *icopy = lat->order[lo];
+  mask   = MIRRORMESH_mask(num,&lat->copies[*icopy]);
+  l      = (int)(g - num->offset[lo]);
+
+  /* Base entity: smallest k such that k - ndup(k) == l */
+  lo = l;
+  hi = num->nbase;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2;
+    if ( mid - MIRRORMESH_ndup(num,mask,mid) >= l ) hi = mid;
+    else lo = mid+1;
+  }
+  return lo;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param num numbering of the entity type
+ * \param icopy index of the copy
+ * \param k index of the base entity
+ *
+ * \return the index of the image of the base entity \a k in the copy \a
+ * icopy in the replicated mesh. The image must not be a skipped entity.
+ *
+ */
+MIRRORMESH_int MIRRORMESH_lattice_index(MIRRORMESH_pLattice lat,
+                                        MIRRORMESH_pNumbering num,int icopy,
+                                        int k) {
+  MIRRORMESH_pCopy copy = &lat->copies[icopy];
+
+  return num->offset[copy->pos] + k
+    - MIRRORMESH_ndup(num,MIRRORMESH_mask(num,copy),k);
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param num numbering of the entity type
+ * \param icopy index of the copy
+ * \param k index of the first base entity of the walk
+ * \param w pointer toward the walk to initialize
+ *
+ * Start a walk through the base entities of the copy \a icopy from the
+ * entity \a k (see \ref MIRRORMESH_walk_next): \ref MIRRORMESH_lattice_skip
+ * and \ref MIRRORMESH_lattice_index for consecutive entities, with a single
+ * search.
+ *
+ */
+void MIRRORMESH_walk_init(MIRRORMESH_pLattice lat,MIRRORMESH_pNumbering num,
+                          int icopy,int k,MIRRORMESH_pWalk w) {
+  MIRRORMESH_pCopy copy = &lat->copies[icopy];
+  int              lo,hi,mid;
+
+  /* First interface entity of index greater or equal to k */
+  lo = 0;
+  hi = num->nitf;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2;
+    if ( num->itf[mid] < k ) lo = mid+1;
+    else hi = mid;
+  }
+
+  w->num    = num;
+  w->mask   = MIRRORMESH_mask(num,copy);
+  w->r      = lo;
+  w->offset = num->offset[copy->pos];
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param copy transformation of the copy
+ * \param k index of the point in the base mesh
+ * \param c computed coordinates of the image of \a k
+ *
+ */
+void MIRRORMESH_lattice_coor(MIRRORMESH_pLattice lat,MIRRORMESH_pCopy copy,
+                             int k,double c[3]) {
+  MMG5_pPoint ppt = &lat->mesh->point[k];
+  int         i;
+
+  for ( i=0; i<lat->dim; ++i ) {
+    c[i] = copy->sign[i]*ppt->c[i] + copy->shift[i];
+  }
+}
+
+/**
+ * \param copy transformation of the copy
+ * \param sol field defined at the vertices of the base mesh
+ * \param k index of the point in the base mesh
+ * \param m computed value of the field at the image of \a k
+ *
+ * Vectors are reflected as the coordinates (without translation) and
+ * symmetric tensors \f$M\f$ (stored as \f$m_{11},m_{12},m_{13},m_{22},m_{23},
+ * m_{33}\f$) are mapped on \f$S M S\f$, \f$S\f$ being the diagonal matrix of
+ * the signs of the copy: only the extra-diagonal terms may change sign.
+ *
+ */
+void MIRRORMESH_lattice_sol(MIRRORMESH_pCopy copy,MMG5_pSol sol,int k,
+                            double *m) {
+  const double *s  = copy->sign;
+  const double *mb = &sol->m[(size_t)k*sol->size];
+
+  switch ( sol->type ) {
+  case MMG5_Vector:
+    m[0] = s[0]*mb[0];
+    m[1] = s[1]*mb[1];
+    m[2] = s[2]*mb[2];
+    break;
+  case MMG5_Tensor:
+    m[0] = mb[0];
+    m[1] = s[0]*s[1]*mb[1];
+    m[2] = s[0]*s[2]*mb[2];
+    m[3] = mb[3];
+    m[4] = s[1]*s[2]*mb[4];
+    m[5] = mb[5];
+    break;
+  default:
+    m[0] = mb[0];
+  }
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param num numbering of the entity type
+ * \param icopy index of the copy
+ * \param nv number of vertices of the entity
+ * \param v vertices of the base entity
+ *
+ * \return 1 if the image of the base entity in \a icopy is not part of the
+ * replicated mesh: duplicate of an entity of a previous copy (all its vertices
+ * are duplicated points) or, for triangles and edges, entity lying on a plane
+ * shared with a neighbouring copy.
+ *
+ */
+int MIRRORMESH_lattice_skip(MIRRORMESH_pLattice lat,MIRRORMESH_pNumbering num,
+                            int icopy,int nv,int *v) {
+  int mask = MIRRORMESH_mask(num,&lat->copies[icopy]);
+
+  if ( !mask ) return 0;
+
+  return MIRRORMESH_isdup(lat,mask,nv,v);
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param icopy index of the copy
+ * \param k index of the tetra in the base mesh
+ * \param v computed vertices of the image of \a k in the replicated mesh
+ *
+ * The tetra is reoriented if the copy has an odd number of reflections.
+ *
+ */
+void MIRRORMESH_lattice_tetra(MIRRORMESH_pLattice lat,int icopy,int k,
+                              MIRRORMESH_int v[4]) {
+  MMG5_pTetra    pt = &lat->mesh->tetra[k];
+  MIRRORMESH_int tmp;
+  int            i;
+
+  for ( i=0; i<4; ++i ) {
+    v[i] = MIRRORMESH_lattice_point(lat,icopy,pt->v[i]);
+  }
+  if ( lat->copies[icopy].reorient ) {
+    tmp  = v[3];
+    v[3] = v[2];
+    v[2] = tmp;
+  }
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param icopy index of the copy
+ * \param k index of the triangle in the base mesh
+ * \param v computed vertices of the image of \a k in the replicated mesh
+ *
+ * The triangle is reoriented if the copy has an odd number of reflections.
+ *
+ */
+void MIRRORMESH_lattice_tria(MIRRORMESH_pLattice lat,int icopy,int k,
+                             MIRRORMESH_int v[3]) {
+  MMG5_pTria     pt = &lat->mesh->tria[k];
+  MIRRORMESH_int tmp;
+  int            i;
+
+  for ( i=0; i<3; ++i ) {
+    v[i] = MIRRORMESH_lattice_point(lat,icopy,pt->v[i]);
+  }
+  if ( lat->copies[icopy].reorient ) {
+    tmp  = v[2];
+    v[2] = v[1];
+    v[1] = tmp;
+  }
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param icopy index of the copy
+ * \param k index of the edge in the base mesh
+ * \param v computed extremities of the image of \a k in the replicated mesh
+ *
+ * The edge is reoriented if the copy has an odd number of reflections.
+ *
+ */
+void MIRRORMESH_lattice_edge(MIRRORMESH_pLattice lat,int icopy,int k,
+                             MIRRORMESH_int v[2]) {
+  MMG5_pEdge pa = &lat->mesh->edge[k];
+
+  if ( lat->copies[icopy].reorient ) {
+    v[0] = MIRRORMESH_lattice_point(lat,icopy,pa->b);
+    v[1] = MIRRORMESH_lattice_point(lat,icopy,pa->a);
+  }
+  else {
+    v[0] = MIRRORMESH_lattice_point(lat,icopy,pa->a);
+    v[1] = MIRRORMESH_lattice_point(lat,icopy,pa->b);
+  }
+}
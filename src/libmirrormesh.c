@@ -35,604 +35,1349 @@
 #include "mirrormesh.h"
 
 /**
- * \param mesh mesh structure
- * \param dim working dimension
- * \param npinit number of points to mirror
- * \param nmir number of mirrors
- * \param axis direction for mirroring
- * \param epsilon tolerance to consider 2 points as duplicated
- *
- * \return npend the new number of points.
+ * \param n number of entities
  *
- * Apply mirroring along \a axis direction to an array of points.
- *
- * Mirroring is applied \a nmir times along the \a axis direction.
- * The upper boundary of the mesh bounding box is used as symmetry plane.
+ * \return the average number of digits of the integers 1 to \a n.
  *
  */
 static
-int MIRRORMESH_mirror_points_1d(MMG5_pMesh mesh,int dim, int npinit,int nmir,
-                                int axis,double eps) {
-  MMG5_pPoint pptn, ppt;
-  double f[3],delta[3],dist[3],sqnorm;
-  int imir,k,mir_mask[3],i;
-
-  for ( i=0; i<dim; ++i) {
-    delta[i] = mesh->info.max[i] - mesh->info.min[i];
-    mir_mask[i] = 0;
-  }
-  mir_mask[axis] = 1;
-
-  for (imir=1; imir<=nmir; ++imir) {
-    for (k=1; k<=npinit; ++k) {
-      /* Copy point */
-      pptn = &mesh->point[k+imir*npinit];
-      ppt  = &mesh->point[k+(imir-1)*npinit];
-      memcpy(pptn,ppt,sizeof(MMG5_Point));
-
-      /* Initialization of the array to store 'true' indices of duplicated points */
-      pptn->tmp = mesh->point[k].tmp+imir*(npinit);
-      pptn->tag &= ~MG_NUL;
-    }
-
-    /* compute the reflexion of the points coordinates: formula for
-       a mirroring of point P along the wall of coor W is is: Pn =
-       W + W-P = 2W - P. We want to write it under the form Pn =
-       mir_mask[axis]*f + P, s.a. if mir_mask[axis]==0, then
-       coordinates along `axis` are preserved and if
-       mir_mask[axis]==1, Pn = f + P. Thus,  Pn = 2(W-P) + P.
-       It gives f = 2*(bb_max+(imir-1)*bb_delta+bb_xmax-P). */
-    for (k=1; k<=npinit; ++k) {
-      for ( i=0; i<dim; ++i) {
-        f[i] = 2.*((imir-1)*delta[i]+mesh->info.max[i]-mesh->point[k+(imir-1)*(npinit)].c[i]);
-      }
+double MIRRORMESH_avgDigits(MIRRORMESH_int n) {
+  MIRRORMESH_int lo;
+  double         sum;
+  int            d;
 
-      sqnorm = 0.;
+  if ( n < 1 ) return 1.;
 
-      pptn = &mesh->point[k+imir*npinit];
-      ppt  = &mesh->point[k+(imir-1)*npinit];
-
-      for ( i=0; i<dim; ++i) {
-
-        /* Update coordinates */
-        pptn->c[i] = mir_mask[i] * f[i] + ppt->c[i];
+  sum = 0.;
+  for ( d=1,lo=1; lo<=n; ++d,lo*=10 ) {
+    sum += (double)d * (MG_MIN(n,10*lo-1) - lo + 1);
+  }
+  return sum/n;
+}
 
-        /* Check the distance between the point and its image to mark
-         * duplicated point */
-        dist[i] = pptn->c[i] - ppt->c[i];
-        sqnorm += dist[i];
-      }
+/**
+ * \param lat pointer toward the lattice of the base mesh
+ * \param nthreads number of threads
+ *
+ * \return the estimated size (in bytes) of the replicated mesh at Medit ASCII
+ * format.
+ *
+ * Vertex lines are measured on the base mesh, element lines are deduced from
+ * the average number of digits of the vertex indices. Corners, ridges,
+ * required entities, normals and tangents are counted once per copy.
+ *
+ */
+static
+size_t MIRRORMESH_estimateMedit(MIRRORMESH_pLattice lat,int nthreads) {
+  MMG5_pMesh     mesh = lat->mesh;
+  MMG5_pSol      tangent = lat->nfld > lat->nsol ? lat->sol[lat->nsol] : NULL;
+  MIRRORMESH_int np,ne,nt,na;
+  double         fsize,lv,lref,dig;
+  const double   *u;
+  char           buf[MIRRORMESH_VERTLEN];
+  int            k,ntag;
+
+  MIRRORMESH_Get_latticeSize(lat,&np,&ne,&nt,&na);
+  dig = MIRRORMESH_avgDigits(np);
+
+  /* Header, section keywords and sizes */
+  fsize = 128. + 14*(20+MIRRORMESH_INTLEN);
+
+  /* Vertices */
+  lv = 0.;
+#pragma omp parallel for num_threads(nthreads) schedule(static) \
+  private(buf) reduction(+:lv)
+  for ( k=1; k<=mesh->npi; ++k ) {
+    lv += MIRRORMESH_fmtVertex(buf,mesh->point[k].c,mesh->point[k].ref);
+  }
+  fsize += lv / MG_MAX(mesh->npi,1) * np;
 
-      if ( sqnorm < eps ) {
-        /* if points are too close, store the index to use */
-        pptn->tmp =  k+(imir-1)*npinit;
-        pptn->tag |= MG_NUL;
-      }
+  ntag = 0;
+  for ( k=1; k<=mesh->npi; ++k ) {
+    if ( mesh->point[k].tag & MG_CRN ) ++ntag;
+    if ( mesh->point[k].tag & MG_REQ ) ++ntag;
+  }
+  fsize += (double)ntag * lat->ncopy * (dig+1.);
+
+  /* Elements: vertex indices followed by the reference */
+  lref = 0.;
+  ntag = 0;
+  for ( k=1; k<=mesh->nei; ++k ) {
+    lref += MIRRORMESH_fmtInt(buf,mesh->tetra[k].ref);
+    if ( mesh->tetra[k].tag & MG_REQ ) ++ntag;
+  }
+  fsize += ne * (4.*(dig+1.) + lref/MG_MAX(mesh->nei,1) + 1.);
+  fsize += (double)ntag * lat->ncopy * (MIRRORMESH_avgDigits(ne)+1.);
+
+  lref = 0.;
+  ntag = 0;
+  for ( k=1; k<=mesh->nti; ++k ) {
+    lref += MIRRORMESH_fmtInt(buf,mesh->tria[k].ref);
+    if ( mesh->tria[k].tag[0] & MG_REQ ) ++ntag;
+  }
+  fsize += nt * (3.*(dig+1.) + lref/MG_MAX(mesh->nti,1) + 1.);
+  fsize += (double)ntag * lat->ncopy * (MIRRORMESH_avgDigits(nt)+1.);
+
+  lref = 0.;
+  ntag = 0;
+  for ( k=1; k<=mesh->nai; ++k ) {
+    lref += MIRRORMESH_fmtInt(buf,mesh->edge[k].ref);
+    if ( mesh->edge[k].tag & MG_GEO ) ++ntag;
+    if ( mesh->edge[k].tag & MG_REQ ) ++ntag;
+  }
+  fsize += na * (2.*(dig+1.) + lref/MG_MAX(mesh->nai,1) + 1.);
+  fsize += (double)ntag * lat->ncopy * (MIRRORMESH_avgDigits(na)+1.);
+
+  /* Normals and tangents: the vector, then its vertex and its index */
+  lv = 0.;
+  for ( k=1; k<=mesh->npi; ++k ) {
+    if ( (u = MIRRORMESH_normal(mesh,k)) ) {
+      lv += MIRRORMESH_fmtVector(buf,u) + 2.*(dig+1.);
+    }
+    if ( (u = MIRRORMESH_tangent(mesh,tangent,k)) ) {
+      lv += MIRRORMESH_fmtVector(buf,u) + 2.*(dig+1.);
     }
   }
-  return (nmir+1) * npinit;
+  fsize += lv * lat->ncopy;
 
+  return (size_t)fsize;
 }
 
 /**
- * \param mesh mesh structure
- * \param dim working dimension
- * \param nmir number of mirrors in each direction
- * \param eps tolerance to consider 2 points as duplicated
+ * \param lat pointer toward the lattice of the base mesh
+ * \param pf pointer toward the computed sizes
+ * \param adja 1 if the adjacency of the tetra is replicated too
  *
- * \return 1 if success
+ * \return 1.
  *
- * Apply mirroring to an array of points.
+ * Compute the exact number of entities of the replicated mesh (welded points
+ * and elements lying on the interfaces between copies excluded), the memory
+ * used by the mesh and its fields once their arrays are reallocated at their
+ * final size (with the adjacency of the base mesh if \a adja is set) and an
+ * estimation of the size of the output file.
  *
- * The upper boundary of the mesh bounding box is used as symmetry plane.
+ * The peak of the replication adds the largest of its work arrays: the
+ * coordinate streams of the points, the copies of the base triangles and
+ * edges or, if \a adja is set, the replicated adjacency, built while the
+ * base one is still allocated.
  *
  */
-static
-int MIRRORMESH_mirror_points(MMG5_pMesh mesh,int dim,
-                             int nmir[3],double eps) {
-  int i,nmirtot;
+int MIRRORMESH_preflight(MIRRORMESH_pLattice lat,MIRRORMESH_pPreflight pf,
+                         int adja) {
+  MMG5_pMesh mesh = lat->mesh;
+  double     mem,work;
+  int        l;
+
+  MIRRORMESH_Get_latticeSize(lat,&pf->np,&pf->ne,&pf->nt,&pf->na);
+
+  /* Each array grows (or shrinks) from its current size to its final size */
+  mem  = (double)mesh->memCur;
+  mem += ((double)pf->np - mesh->npmax)*sizeof(MMG5_Point);
+  mem += ((double)pf->ne - mesh->nemax)*sizeof(MMG5_Tetra);
+  mem += ((double)pf->nt - mesh->nt)*sizeof(MMG5_Tria);
+  mem += ((double)pf->na - mesh->na)*sizeof(MMG5_Edge);
+  for ( l=0; l<lat->nfld; ++l ) {
+    mem += ((double)pf->np - lat->sol[l]->npmax)*lat->sol[l]->size
+      *sizeof(double);
+  }
+  if ( mesh->xpoint ) {
+    mem += ((double)lat->ncopy*mesh->xp - mesh->xpmax)*sizeof(MMG5_xPoint);
+  }
+  if ( mesh->xtetra ) {
+    mem += ((double)lat->ncopy*mesh->xt - mesh->xtmax)*sizeof(MMG5_xTetra);
+  }
 
-  /* Get initial number of points */
-  int npinit = mesh->npi;
+  /* Work arrays of the replication (see \ref MIRRORMESH_mirror_points, \ref
+   * MIRRORMESH_mirror_cells and \ref MIRRORMESH_mirror_adja) */
+  work = (double)lat->dim*mesh->np*sizeof(double);
+  if ( lat->copies[0].itfmask ) {
+    work = MG_MAX(work,((double)mesh->nt+1)*sizeof(MMG5_Tria)
+                  + ((double)mesh->na+1)*sizeof(MMG5_Edge));
+  }
+  if ( adja ) {
+    /* Adjacency of the base mesh, hashed before the replication if needed */
+    if ( !mesh->adja ) {
+      mem += (4.*mesh->nemax+5)*sizeof(int);
+    }
+    work = MG_MAX(work,(4.*pf->ne+5)*sizeof(int));
+  }
+  pf->mem  = (size_t)mem;
+  pf->work = (size_t)work;
+
+  pf->fsize = MIRRORMESH_estimateMedit(lat,lat->nthreads);
 
-  /* Compute total number of mirrors */
-  nmirtot = 1;
-  for (i=0; i<dim; ++i ) {
-    nmirtot *= (nmir[i]+1);
+  return 1;
+}
+
+/**
+ * \param lat pointer toward the lattice of the base mesh
+ * \param pf sizes of the replicated mesh
+ * \param adja 1 if the adjacency of the tetra is replicated too
+ *
+ * \return 1 if the replicated mesh can be built, 0 otherwise.
+ *
+ * The replicated mesh is counted in 64 bits but the entities of a Mmg mesh
+ * are indexed by integers of at most \ref MIRRORMESH_MESH_INTMAX, the
+ * adjacency storing 4*k+i for the face i of the tetra k. Larger meshes can
+ * only be written on the fly (\ref MIRRORMESH_saveLattice).
+ *
+ */
+int MIRRORMESH_fitMesh(MIRRORMESH_pLattice lat,MIRRORMESH_pPreflight pf,
+                       int adja) {
+  MMG5_pMesh     mesh = lat->mesh;
+  MIRRORMESH_int nmax;
+
+  nmax = MG_MAX(MG_MAX(pf->np,pf->ne),MG_MAX(pf->nt,pf->na));
+  if ( mesh->xpoint ) {
+    nmax = MG_MAX(nmax,(MIRRORMESH_int)lat->ncopy*mesh->xp);
+  }
+  if ( mesh->xtetra ) {
+    nmax = MG_MAX(nmax,(MIRRORMESH_int)lat->ncopy*mesh->xt);
   }
+  if ( adja ) {
+    nmax = MG_MAX(nmax,4*pf->ne+4);
+  }
+
+  return nmax < MIRRORMESH_MESH_INTMAX;
+}
 
-  /* Reallocation of point array */
-  /* MMG5_ADD_MEM(mesh,(nmirtot*npinit-(mesh->npmax)) *sizeof(MMG5_Point), */
-  /*                  "larger point array",return 0); */
+/**
+ * \param lat pointer toward the lattice of the base mesh
+ * \param pf sizes of the replicated mesh
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Reallocate the point, tetra, triangle and edge arrays, the boundary data
+ * (xpoints and xtetra of a mesh analysed by Mmg) and the values of the fields
+ * at their final size. Fail before any reallocation if the replicated mesh
+ * doesn't fit in the memory allowed for the mesh (\a -m option).
+ *
+ */
+static
+int MIRRORMESH_alloc_mesh(MIRRORMESH_pLattice lat,MIRRORMESH_pPreflight pf) {
+  MMG5_pMesh     mesh = lat->mesh;
+  MMG5_pSol      psl;
+  MIRRORMESH_int n;
+  int            l;
+
+  if ( mesh->memMax && pf->mem + pf->work > mesh->memMax ) {
+    fprintf(stderr,"\n  ## Error: %s: replicated mesh too large: %zu MB"
+            " needed, %zu MB allowed (see the -m option).\n",__func__,
+            (pf->mem+pf->work)/MMG5_MILLION,mesh->memMax/MMG5_MILLION);
+    return 0;
+  }
 
-  MMG5_SAFE_RECALLOC(mesh->point,(mesh->npmax+1),nmirtot*npinit+1,
+  /* Points */
+  if ( pf->np > mesh->npmax ) {
+    MMG5_ADD_MEM(mesh,(size_t)(pf->np-mesh->npmax)*sizeof(MMG5_Point),
+                 "replicated points",return 0);
+  }
+  else {
+    mesh->memCur -= (size_t)(mesh->npmax-pf->np)*sizeof(MMG5_Point);
+  }
+  MMG5_SAFE_RECALLOC(mesh->point,(mesh->npmax+1),pf->np+1,
                      MMG5_Point,"larger point array",return 0);
+  mesh->npmax = pf->np;
+  mesh->npnil = 0;
 
-  mesh->npmax = nmirtot*npinit;
+  /* Tetra */
+  if ( pf->ne > mesh->nemax ) {
+    MMG5_ADD_MEM(mesh,(size_t)(pf->ne-mesh->nemax)*sizeof(MMG5_Tetra),
+                 "replicated tetra",return 0);
+  }
+  else {
+    mesh->memCur -= (size_t)(mesh->nemax-pf->ne)*sizeof(MMG5_Tetra);
+  }
+  MMG5_SAFE_RECALLOC(mesh->tetra,(mesh->nemax+1),pf->ne+1,
+                     MMG5_Tetra,"larger tetra array",return 0);
+  mesh->nemax = pf->ne;
+  mesh->nenil = 0;
 
-  /* Bounding box computation */
-  if ( !MMG5_boundingBox(mesh) ) {
-    return 0;
+  /* Triangles */
+  if ( pf->nt > mesh->nt ) {
+    MMG5_ADD_MEM(mesh,(size_t)(pf->nt-mesh->nt)*sizeof(MMG5_Tria),
+                 "replicated triangles",return 0);
+  }
+  else {
+    mesh->memCur -= (size_t)(mesh->nt-pf->nt)*sizeof(MMG5_Tria);
   }
+  MMG5_SAFE_RECALLOC(mesh->tria,(mesh->nt+1),pf->nt+1,
+                     MMG5_Tria,"larger triangle array",return 0);
 
-  int npcur = npinit;
+  /* Edges */
+  if ( pf->na > mesh->na ) {
+    MMG5_ADD_MEM(mesh,(size_t)(pf->na-mesh->na)*sizeof(MMG5_Edge),
+                 "replicated edges",return 0);
+  }
+  else {
+    mesh->memCur -= (size_t)(mesh->na-pf->na)*sizeof(MMG5_Edge);
+  }
+  MMG5_SAFE_RECALLOC(mesh->edge,(mesh->na+1),pf->na+1,
+                     MMG5_Edge,"larger edge array",return 0);
+  mesh->namax = pf->na;
+  mesh->nanil = 0;
+
+  /* Boundary data: one block per copy */
+  if ( mesh->xpoint ) {
+    n = lat->ncopy*mesh->xp;
+    if ( n > mesh->xpmax ) {
+      MMG5_ADD_MEM(mesh,(size_t)(n-mesh->xpmax)*sizeof(MMG5_xPoint),
+                   "replicated xpoints",return 0);
+    }
+    else {
+      mesh->memCur -= (size_t)(mesh->xpmax-n)*sizeof(MMG5_xPoint);
+    }
+    MMG5_SAFE_RECALLOC(mesh->xpoint,(mesh->xpmax+1),n+1,
+                       MMG5_xPoint,"larger xpoint array",return 0);
+    mesh->xpmax = n;
+  }
 
-  int k;
-  for (k=1; k<=npinit; ++k) {
-    /* Initialization of the array to store 'true' indices of duplicated points */
-    mesh->point[k].tmp = k;
+  if ( mesh->xtetra ) {
+    n = lat->ncopy*mesh->xt;
+    if ( n > mesh->xtmax ) {
+      MMG5_ADD_MEM(mesh,(size_t)(n-mesh->xtmax)*sizeof(MMG5_xTetra),
+                   "replicated xtetra",return 0);
+    }
+    else {
+      mesh->memCur -= (size_t)(mesh->xtmax-n)*sizeof(MMG5_xTetra);
+    }
+    MMG5_SAFE_RECALLOC(mesh->xtetra,(mesh->xtmax+1),n+1,
+                       MMG5_xTetra,"larger xtetra array",return 0);
+    mesh->xtmax = n;
   }
 
-  for (i=0; i<dim; ++i ) {
-    npcur = MIRRORMESH_mirror_points_1d(mesh,dim,npcur,nmir[i],i,eps);
+  /* Fields */
+  for ( l=0; l<lat->nfld; ++l ) {
+    psl = lat->sol[l];
+    if ( pf->np > psl->npmax ) {
+      MMG5_ADD_MEM(mesh,(size_t)(pf->np-psl->npmax)*psl->size*sizeof(double),
+                   "replicated fields",return 0);
+    }
+    else {
+      mesh->memCur -= (size_t)(psl->npmax-pf->np)*psl->size*sizeof(double);
+    }
+    MMG5_SAFE_RECALLOC(psl->m,(size_t)(psl->npmax+1)*psl->size,
+                       (size_t)(pf->np+1)*psl->size,double,
+                       "larger field",return 0);
+    psl->npmax = pf->np;
   }
-  mesh->np = npcur;
 
   return 1;
 }
 
 /**
  * \param mesh mesh structure
- * \param dim working dimension
- * \param nmir number of mirrors in each direction
+ * \param lat lattice of the base mesh
+ * \param ip index of a point lying on a plane shared with a neighbouring copy
+ *
+ * Remove the tags of the point (see \ref MIRRORMESH_PLANETAG), its normal and
+ * its tangent: the plane is inside the replicated mesh. For a mesh analysed by
+ * Mmg, the vector stored in the point is kept, the restored tags telling if
+ * it is still a tangent (see \ref MIRRORMESH_tangent).
+ *
+ */
+static inline
+void MIRRORMESH_clear_planePoint(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                                 int ip) {
+  mesh->point[ip].tag &= ~MIRRORMESH_PLANETAG;
+  if ( !mesh->xpoint ) {
+    memset(mesh->point[ip].n,0,3*sizeof(double));
+  }
+  if ( lat->nfld > lat->nsol ) {
+    memset(&lat->sol[lat->nsol]->m[3*(size_t)ip],0,3*sizeof(double));
+  }
+}
+
+/**
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param nthreads number of threads to use
  *
  * \return 1 if success
  *
- * Apply mirroring to an array of points.
+ * Apply mirroring to an array of points (allocated at its final size by \ref
+ * MIRRORMESH_alloc_mesh).
  *
  * The upper boundary of the mesh bounding box is used as symmetry plane.
  *
+ * Each copy is computed directly from the base points (see \ref
+ * MIRRORMESH_set_copy) so the copies are independent and the work is shared
+ * between threads with a static schedule: the result doesn't depend on the
+ * number of threads. The image of the point \a k in the copy \a icopy is
+ * stored at its index in the numbering of the lattice (see \ref
+ * MIRRORMESH_lattice_point): a closed form for the points that don't lie on
+ * a plane shared with a previous copy, the only ones that are stored. The
+ * images welded to a point of a previous copy (duplicated points) are never
+ * created, so the point array holds exactly the points of the replicated mesh.
+ *
+ * The stored images of a run of consecutive base points have consecutive
+ * indices: the points of the run are copied at once, then their coordinates
+ * are computed from contiguous streams of the base coordinates by the
+ * vectorised kernel of the CPU (see \ref MIRRORMESH_reflect_kernel).
+ *
+ * The values of the fields are replicated in the same pass (see \ref
+ * MIRRORMESH_lattice_sol), as well as the boundary data: normal or tangent of
+ * the point and xpoint (stored at \a xp + \a pos * \a xpinit) are reflected
+ * like the coordinates. The tags of the points lying on a plane shared with
+ * a neighbouring copy are removed (see \ref MIRRORMESH_clear_planePoint), the
+ * tags of the boundary entities that remain are restored by \ref
+ * MIRRORMESH_mirror_cells.
+ *
  */
 static
-int MIRRORMESH_mirror_cells(MMG5_pMesh mesh,int dim,int *nmir) {
-  MMG5_pTetra ptn, pt;
-  int i,nmirtot,neend,naend,ntend;
-
-  /* Get initial number of tetra, tria and edges */
-  int neinit = mesh->nei;
-  int ntinit = mesh->nti;
-  int nainit = mesh->nai;
+int MIRRORMESH_mirror_points(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                             int nthreads) {
+  MIRRORMESH_Reflect reflect;
+  MIRRORMESH_int     np;
+  double             *coor;
+  const char         *kname;
+  int                c,k,l,nchunk,icopy;
+
+  /* Get initial number of points and xpoints */
+  int npinit = mesh->npi;
+  int xpinit = mesh->xpoint ? mesh->xp : 0;
+  int dim    = lat->dim;
+  int mask   = lat->copies[0].itfmask;
 
-  /* Compute total number of mirrors */
-  nmirtot = 1;
-  for (i=0; i<dim; ++i ) {
-    nmirtot *= (nmir[i]+1);
+  reflect = MIRRORMESH_reflect_kernel(&kname);
+  if ( abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     Reflection kernel: %s\n",kname);
   }
 
-  /* Reallocation of tetra */
-  /* MMG5_ADD_MEM(mesh,(nmirtot*neinit-(mesh->nemax))*sizeof(MMG5_Tetra), */
-  /*                  "larger tetra array",return 0); */
-
-  MMG5_SAFE_RECALLOC(mesh->tetra,(mesh->nemax+1),nmirtot*neinit+1,
-                     MMG5_Tetra,"larger tetra array",return 0);
-  mesh->nemax = mesh->ne = nmirtot*neinit+1;
-
-  /* Reallocation of triangles */
-  /* MMG5_ADD_MEM(mesh,(nmirtot*ntinit-(mesh->nt))*sizeof(MMG5_Tria), */
-  /*                  "larger triangle array",return 0); */
-
-  MMG5_SAFE_RECALLOC(mesh->tria,(mesh->nt+1),nmirtot*ntinit+1,
-                     MMG5_Tria,"larger triangle array",return 0);
-  mesh->nt = nmirtot*ntinit+1;
-
-  /* Reallocation of edges */
-  /* MMG5_ADD_MEM(mesh,(nmirtot*nainit-(mesh->na))*sizeof(MMG5_Edge), */
-  /*                  "larger edge array",return 0); */
+  /* Coordinates of the base points as contiguous x, y and z streams */
+  MMG5_ADD_MEM(mesh,(size_t)dim*npinit*sizeof(double),"coordinate streams",
+               return 0);
+  MMG5_SAFE_MALLOC(coor,(size_t)dim*npinit,double,return 0);
 
-  MMG5_SAFE_RECALLOC(mesh->edge,(mesh->na+1),nmirtot*nainit+1,
-                     MMG5_Edge,"larger edge array",return 0);
-  mesh->na = nmirtot*nainit+1;
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( k=0; k<npinit; ++k ) {
+    int i;
+    for ( i=0; i<dim; ++i ) {
+      coor[(size_t)i*npinit+k] = mesh->point[k+1].c[i];
+    }
+  }
 
-  int npcur  = mesh->npi;
+  nchunk = (npinit + MIRRORMESH_CHUNK - 1) / MIRRORMESH_CHUNK;
+
+#pragma omp parallel for collapse(2) num_threads(nthreads) schedule(static) \
+  private(k,l)
+  for ( icopy=1; icopy<lat->ncopy; ++icopy ) {
+    for ( c=0; c<nchunk; ++c ) {
+      MIRRORMESH_pCopy copy = &lat->copies[icopy];
+      int              kend = MG_MIN(npinit,(c+1)*MIRRORMESH_CHUNK);
+      int              i,j,n,ip;
+
+      for ( k=c*MIRRORMESH_CHUNK+1; k<=kend; k+=n ) {
+        if ( lat->itf.face[k] & copy->dupmask ) {
+          /* Duplicated point */
+          n = 1;
+          continue;
+        }
 
-  /* Tetra */
-  int necur  = neinit;
-  int ntcur  = ntinit;
-  int nacur  = nainit;
-
-  int idim;
-  for (idim=0; idim<dim; ++idim ) {
-    int imir;
-    for ( imir = 0; imir < nmir[idim]; ++imir) {
-
-      /* Tetra replication */
-      int k;
-      for (k=1; k<=necur; ++k) {
-        pt  = &mesh->tetra[k];
-
-        int8_t dup = 1;
-        if ( pt->v[0]>0 ) {
-          for ( i=0; i<4; ++i) {
-            if ( MG_VOK(&mesh->point[pt->v[i]+(imir+1)*(npcur)]) ) {
-              dup = 0;
-              break;
-            }
+        /* Run of stored points: consecutive indices in the replicated mesh */
+        for ( n=1; k+n<=kend && !(lat->itf.face[k+n] & copy->dupmask); ++n );
+        ip = (int)MIRRORMESH_lattice_point(lat,icopy,k);
+
+        /* Bulk copy of the points, then coordinates and normals */
+        memcpy(&mesh->point[ip],&mesh->point[k],n*sizeof(MMG5_Point));
+        reflect(copy,dim,n,&coor[k-1],npinit,&mesh->point[ip]);
+
+        /* Boundary data */
+        for ( j=0; xpinit && j<n; ++j ) {
+          MMG5_pPoint  pptn = &mesh->point[ip+j];
+          MMG5_pxPoint pxp,pxpn;
+
+          if ( !pptn->xp ) continue;
+          pxp  = &mesh->xpoint[pptn->xp];
+          pxpn = &mesh->xpoint[pptn->xp+copy->pos*xpinit];
+          memcpy(pxpn,pxp,sizeof(MMG5_xPoint));
+          for ( i=0; i<dim; ++i) {
+            pxpn->n1[i] = copy->sign[i]*pxp->n1[i];
+            pxpn->n2[i] = copy->sign[i]*pxp->n2[i];
           }
+          pptn->xp += copy->pos*xpinit;
         }
 
-        ptn = &mesh->tetra[k+(imir+1)*(necur)];
-        memcpy(ptn,pt,sizeof(MMG5_Tetra));
+        /* Fields: scalars are copied, vectors and tensors reflected */
+        for ( l=0; l<lat->nfld; ++l ) {
+          MMG5_pSol psl = lat->sol[l];
 
-        if ( dup ) {
-          /* Duplicated element */
-          ptn->v[0] = 0;
-        }
-        else {
-          for ( i=0; i<4; ++i) {
-            ptn->v[i] = mesh->point[pt->v[i]+(imir+1)*(npcur)].tmp;
+          if ( psl->type == MMG5_Scalar ) {
+            memcpy(&psl->m[(size_t)ip*psl->size],&psl->m[(size_t)k*psl->size],
+                   (size_t)n*psl->size*sizeof(double));
+            continue;
           }
-          if ( imir%2==0 ) {
-            /* Reorientation */
-            int tmp = ptn->v[3];
-            ptn->v[3] = ptn->v[2];
-            ptn->v[2] = tmp;
+          for ( j=0; j<n; ++j ) {
+            MIRRORMESH_lattice_sol(copy,psl,k+j,
+                                   &psl->m[(size_t)(ip+j)*psl->size]);
           }
         }
-      }
 
-      /* Tria replication */
-      for (k=1; k<=ntcur; ++k) {
-        MMG5_pTria ptt  = &mesh->tria[k];
-
-        int8_t dup = 1;
-        if ( ptt->v[0]>0 ) {
-          for ( i=0; i<3; ++i) {
-            if ( MG_VOK(&mesh->point[ptt->v[i]+(imir+1)*(npcur)]) ) {
-              dup = 0;
-              break;
-            }
+        for ( j=0; copy->itfmask && j<n; ++j ) {
+          if ( lat->itf.face[k+j] & copy->itfmask ) {
+            MIRRORMESH_clear_planePoint(mesh,lat,ip+j);
           }
         }
+      }
+    }
+  }
 
-        MMG5_pTria pttn = &mesh->tria[k+(imir+1)*(ntcur)];
-        memcpy(pttn,ptt,sizeof(MMG5_Tria));
+  MMG5_DEL_MEM(mesh,coor);
 
-        if ( dup ) {
-          /* Duplicated element */
-          pttn->v[0] = 0;
-        }
-        else {
-          for ( i=0; i<3; ++i) {
-            pttn->v[i] = mesh->point[ptt->v[i]+(imir+1)*(npcur)].tmp;
-          }
-          if ( imir%2==0 ) {
-            /* Reorientation */
-            int tmp = pttn->v[2];
-            pttn->v[2] = pttn->v[1];
-            pttn->v[1] = tmp;
-          }
-        }
+  /* Base copy, once the other ones are computed */
+  if ( mask ) {
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for ( k=1; k<=npinit; ++k ) {
+      if ( lat->itf.face[k] & mask ) {
+        MIRRORMESH_clear_planePoint(mesh,lat,k);
       }
+    }
+  }
 
-      /* Edges replication */
-      for (k=1; k<=nacur; ++k) {
-        MMG5_pEdge pa  = &mesh->edge[k];
+  MIRRORMESH_Get_latticeSize(lat,&np,NULL,NULL,NULL);
+  mesh->np = (int)np;
+  if ( xpinit ) {
+    mesh->xp = lat->ncopy*xpinit;
+  }
+  for ( l=0; l<lat->nfld; ++l ) {
+    lat->sol[l]->np = mesh->np;
+  }
 
-        int8_t dup = 1;
-        if ( pa->a>0 ) {
-          if ( MG_VOK(&mesh->point[pa->a+(imir+1)*(npcur)]) ) {
-            dup = 0;
-          }
-          if ( MG_VOK(&mesh->point[pa->b+(imir+1)*(npcur)]) ) {
-            dup = 0;
-          }
-        }
+  return 1;
+}
 
-        MMG5_pEdge pan = &mesh->edge[k+(imir+1)*(nacur)];
-        memcpy(pan,pa,sizeof(MMG5_Edge));
+/**
+ * \param mesh pointer toward the mesh
+ * \param ip index of a point of the replicated mesh
+ * \param tag tags to add
+ *
+ * Add tags to a point, that may be shared with other copies.
+ *
+ */
+static inline
+void MIRRORMESH_add_tag(MMG5_pMesh mesh,int ip,int16_t tag) {
+  if ( !tag ) return;
+#pragma omp atomic
+  mesh->point[ip].tag |= tag;
+}
 
-        if ( dup ) {
-          /* Duplicated element */
-          pan->a = 0;
-        }
-        else {
-          pan->a = mesh->point[pa->a+(imir+1)*(npcur)].tmp;
-          pan->b = mesh->point[pa->b+(imir+1)*(npcur)].tmp;
-          if ( imir%2==0 ) {
-            /* Reorientation */
-            int tmp = pan->b;
-            pan->b = pan->a;
-            pan->a = tmp;
-          }
-        }
+/**
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param copy copy of the element
+ * \param vb base vertices of the image of the tetra (in its vertex order)
+ * \param ptn image of the tetra, its xtetra being the copy of the base one
+ *
+ * Adapt the xtetra of the image of a tetra to the copy: faces and edges are
+ * permuted if the tetra is reoriented (exchange of vertices 2 and 3), the
+ * tags of the faces and edges lying on planes shared with a neighbouring copy
+ * are removed, the tags of the remaining boundary faces and edges are given
+ * back to their vertices lying on these planes.
+ *
+ */
+static
+void MIRRORMESH_mirror_xtetra(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                              MIRRORMESH_pCopy copy,int *vb,MMG5_pTetra ptn) {
+  MMG5_pxTetra pxt = &mesh->xtetra[ptn->xt];
+  int8_t       face[4];
+  int16_t      tag;
+  int          i,j,a,b,tmp;
+
+  if ( copy->reorient ) {
+    /* Faces 2 and 3, edges 01-02 <-> 01-03 and 12 <-> 13 */
+    tmp = pxt->ref[2];  pxt->ref[2]  = pxt->ref[3];  pxt->ref[3]  = tmp;
+    tmp = pxt->ftag[2]; pxt->ftag[2] = pxt->ftag[3]; pxt->ftag[3] = tmp;
+    tmp = pxt->edg[1];  pxt->edg[1]  = pxt->edg[2];  pxt->edg[2]  = tmp;
+    tmp = pxt->edg[3];  pxt->edg[3]  = pxt->edg[4];  pxt->edg[4]  = tmp;
+    tmp = pxt->tag[1];  pxt->tag[1]  = pxt->tag[2];  pxt->tag[2]  = tmp;
+    tmp = pxt->tag[3];  pxt->tag[3]  = pxt->tag[4];  pxt->tag[4]  = tmp;
+    tmp = pxt->ori & ~12;
+    if ( pxt->ori & 4 ) tmp |= 8;
+    if ( pxt->ori & 8 ) tmp |= 4;
+    pxt->ori = tmp;
+  }
+
+  if ( !copy->itfmask ) return;
+
+  for ( i=0; i<4; ++i ) {
+    face[i] = lat->itf.face[vb[i]] & copy->itfmask;
+  }
+
+  /* Faces (face i is opposite to vertex i) */
+  for ( i=0; i<4; ++i ) {
+    if ( face[(i+1)%4] & face[(i+2)%4] & face[(i+3)%4] ) {
+      pxt->ftag[i] &= ~MIRRORMESH_PLANETAG;
+      pxt->ref[i]   = 0;
+    }
+  }
+
+  /* Edges: still boundary edges if they belong to a boundary face */
+  for ( j=0; j<6; ++j ) {
+    a = MMG5_iare[j][0];
+    b = MMG5_iare[j][1];
+    if ( face[a] & face[b] ) {
+      tag = MIRRORMESH_PLANETAG;
+      for ( i=0; i<4; ++i ) {
+        if ( i != a && i != b && (pxt->ftag[i] & MG_BDY) ) tag &= ~MG_BDY;
       }
+      pxt->tag[j] &= ~tag;
     }
+  }
 
-    necur *= (nmir[idim]+1);
-    ntcur *= (nmir[idim]+1);
-    nacur *= (nmir[idim]+1);
-    npcur *= (nmir[idim]+1);
+  /* Tags of the vertices lying on the planes */
+  for ( i=0; i<4; ++i ) {
+    if ( !(pxt->ftag[i] & MG_BDY) ) continue;
+    for ( j=1; j<4; ++j ) {
+      if ( face[(i+j)%4] ) MIRRORMESH_add_tag(mesh,ptn->v[(i+j)%4],MG_BDY);
+    }
+  }
+  for ( j=0; j<6; ++j ) {
+    tag = pxt->tag[j] & MIRRORMESH_PLANETAG & ~MG_CRN;
+    a   = MMG5_iare[j][0];
+    b   = MMG5_iare[j][1];
+    if ( face[a] ) MIRRORMESH_add_tag(mesh,ptn->v[a],tag);
+    if ( face[b] ) MIRRORMESH_add_tag(mesh,ptn->v[b],tag);
   }
-  mesh->ne = necur;
-  mesh->nt = ntcur;
-  mesh->np = npcur;
-  mesh->na = nacur;
+}
 
-  return 1;
+/**
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param copy copy of the triangle
+ * \param vb base vertices of the image of the triangle (in its vertex order)
+ * \param pttn image of the triangle
+ *
+ * Remove the tags of the edges of the image of a triangle lying on planes
+ * shared with a neighbouring copy and give back the boundary tags to its
+ * vertices lying on these planes.
+ *
+ */
+static
+void MIRRORMESH_mirror_triaTags(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                                MIRRORMESH_pCopy copy,int *vb,MMG5_pTria pttn) {
+  int8_t face[3];
+  int    i;
+
+  if ( !copy->itfmask ) return;
+
+  for ( i=0; i<3; ++i ) {
+    face[i] = lat->itf.face[vb[i]] & copy->itfmask;
+  }
+
+  /* Edge i is opposite to vertex i */
+  for ( i=0; i<3; ++i ) {
+    if ( face[(i+1)%3] & face[(i+2)%3] ) {
+      pttn->tag[i] &= ~(MIRRORMESH_PLANETAG & ~MG_BDY);
+    }
+  }
+
+  for ( i=0; i<3; ++i ) {
+    if ( !face[i] ) continue;
+    MIRRORMESH_add_tag(mesh,pttn->v[i],MG_BDY |
+                       ((pttn->tag[(i+1)%3] | pttn->tag[(i+2)%3])
+                        & MIRRORMESH_PLANETAG & ~MG_CRN));
+  }
 }
 
 /**
- * \param mesh pointer toward the mesh structure
+ * \param n number of base entities
+ * \param ntile number of tiles
+ * \param t index of a tile
  *
- * \return 1 if success, 0 if fail.
+ * \return the index of the last base entity preceding the tile \a t.
+ *
+ * The base entities of each type are split in \a ntile ranges of balanced
+ * sizes, the tile \a t gathering the entities \a start(t)+1 to \a
+ * start(t+1).
  *
- * Pack the sparse triangles
- * Don't preserve numbering order.
+ */
+static inline
+int MIRRORMESH_tile_start(int n,int ntile,int t) {
+  return (int)((long long)t*n/ntile);
+}
+
+/**
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param icopy index of the copy (not the base copy)
+ * \param kbeg first base tetra to replicate
+ * \param kend last base tetra to replicate
+ * \param xtinit number of base xtetra
+ *
+ * Build the images of the base tetra \a kbeg to \a kend in the copy \a icopy.
  *
  */
 static
-int MIRRORMESH_pack_edges(MMG5_pMesh mesh) {
-  MMG5_pEdge   pt,pt1;
-  int          k;
+void MIRRORMESH_mirror_tetra(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,int icopy,
+                             int kbeg,int kend,int xtinit) {
+  MIRRORMESH_pCopy copy = &lat->copies[icopy];
+  MIRRORMESH_Walk  walk;
+  MIRRORMESH_int   idx;
+  int              i,k;
+
+  if ( kbeg > kend ) return;
+
+  MIRRORMESH_walk_init(lat,&lat->tetra,icopy,kbeg,&walk);
 
-  if ( !mesh->na ) {
-    return 1;
+  for ( k=kbeg; k<=kend; ++k ) {
+    MMG5_pTetra pt = &mesh->tetra[k];
+    MMG5_pTetra ptn;
+    int         vb[4];
+
+    if ( !(idx = MIRRORMESH_walk_next(&walk,k)) ) {
+      /* Duplicated element */
+      continue;
+    }
+
+    ptn = &mesh->tetra[idx];
+    memcpy(ptn,pt,sizeof(MMG5_Tetra));
+
+    for ( i=0; i<4; ++i) {
+      vb[i]     = pt->v[i];
+      ptn->v[i] = MIRRORMESH_lattice_point(lat,icopy,pt->v[i]);
+    }
+    if ( copy->reorient ) {
+      /* Reorientation */
+      int tmp = ptn->v[3];
+      ptn->v[3] = ptn->v[2];
+      ptn->v[2] = tmp;
+      vb[2] = pt->v[3];
+      vb[3] = pt->v[2];
+    }
+
+    if ( xtinit && pt->xt ) {
+      ptn->xt = pt->xt + copy->pos*xtinit;
+      memcpy(&mesh->xtetra[ptn->xt],&mesh->xtetra[pt->xt],sizeof(MMG5_xTetra));
+      MIRRORMESH_mirror_xtetra(mesh,lat,copy,vb,ptn);
+    }
   }
+}
 
-  if ( mesh->edge ) {
-    k = 1;
-    do {
-      pt = &mesh->edge[k];
-      if ( !pt->a ) {
-        while ( (!mesh->edge[mesh->na].a) && mesh->na > k ) {
-          --mesh->na;
-        }
-        if ( mesh->na == k ) {
-          break;
-        }
+/**
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param tria base triangles
+ * \param icopy index of the copy
+ * \param kbeg first base triangle to replicate
+ * \param kend last base triangle to replicate
+ *
+ * Build the images of the base triangles \a kbeg to \a kend in the copy \a
+ * icopy.
+ *
+ */
+static
+void MIRRORMESH_mirror_tria(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                            MMG5_pTria tria,int icopy,int kbeg,int kend) {
+  MIRRORMESH_pCopy copy = &lat->copies[icopy];
+  MIRRORMESH_Walk  walk;
+  MIRRORMESH_int   idx;
+  int              i,k;
+
+  if ( kbeg > kend ) return;
+
+  MIRRORMESH_walk_init(lat,&lat->tria,icopy,kbeg,&walk);
+
+  for ( k=kbeg; k<=kend; ++k ) {
+    MMG5_pTria ptt = &tria[k];
+    MMG5_pTria pttn;
+    int        vb[3];
 
-        pt1 = &mesh->edge[mesh->na];
-        assert( pt && pt1 && pt1->a );
-        memcpy(pt,pt1,sizeof(MMG5_Edge));
-        pt1->a = 0;
+    if ( !(idx = MIRRORMESH_walk_next(&walk,k)) ) {
+      /* Duplicated or internal element */
+      continue;
+    }
+
+    pttn = &mesh->tria[idx];
+    memcpy(pttn,ptt,sizeof(MMG5_Tria));
+
+    for ( i=0; i<3; ++i) {
+      vb[i]      = ptt->v[i];
+      pttn->v[i] = MIRRORMESH_lattice_point(lat,icopy,ptt->v[i]);
+    }
+    if ( copy->reorient ) {
+      /* Reorientation (with the edges opposite to vertices 1 and 2) */
+      int tmp = pttn->v[2];
+      pttn->v[2] = pttn->v[1];
+      pttn->v[1] = tmp;
+      vb[1] = ptt->v[2];
+      vb[2] = ptt->v[1];
+      pttn->tag[1] = ptt->tag[2];
+      pttn->tag[2] = ptt->tag[1];
+      pttn->edg[1] = ptt->edg[2];
+      pttn->edg[2] = ptt->edg[1];
+    }
+    MIRRORMESH_mirror_triaTags(mesh,lat,copy,vb,pttn);
+  }
+}
+
+/**
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param edge base edges
+ * \param icopy index of the copy
+ * \param kbeg first base edge to replicate
+ * \param kend last base edge to replicate
+ *
+ * Build the images of the base edges \a kbeg to \a kend in the copy \a icopy.
+ *
+ */
+static
+void MIRRORMESH_mirror_edge(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                            MMG5_pEdge edge,int icopy,int kbeg,int kend) {
+  MIRRORMESH_pCopy copy = &lat->copies[icopy];
+  MIRRORMESH_Walk  walk;
+  MIRRORMESH_int   idx;
+  int              k;
+
+  if ( kbeg > kend ) return;
+
+  MIRRORMESH_walk_init(lat,&lat->edge,icopy,kbeg,&walk);
+
+  for ( k=kbeg; k<=kend; ++k ) {
+    MMG5_pEdge pa = &edge[k];
+    MMG5_pEdge pan;
+
+    if ( !(idx = MIRRORMESH_walk_next(&walk,k)) ) {
+      /* Duplicated or internal element */
+      continue;
+    }
+
+    pan = &mesh->edge[idx];
+    memcpy(pan,pa,sizeof(MMG5_Edge));
+
+    pan->a = MIRRORMESH_lattice_point(lat,icopy,pa->a);
+    pan->b = MIRRORMESH_lattice_point(lat,icopy,pa->b);
+
+    /* Tags of the ends lying on the interior planes */
+    if ( lat->itf.face[pa->a] & copy->itfmask ) {
+      MIRRORMESH_add_tag(mesh,pan->a,pa->tag & MIRRORMESH_PLANETAG & ~MG_CRN);
+    }
+    if ( lat->itf.face[pa->b] & copy->itfmask ) {
+      MIRRORMESH_add_tag(mesh,pan->b,pa->tag & MIRRORMESH_PLANETAG & ~MG_CRN);
+    }
+
+    if ( copy->reorient ) {
+      /* Reorientation */
+      int tmp = pan->b;
+      pan->b = pan->a;
+      pan->a = tmp;
+    }
+  }
+}
+
+/**
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param nthreads number of threads to use
+ * \param tile size in kB of the tiles of base elements (0: default, -1: no
+ * tiling)
+ *
+ * \return 1 if success
+ *
+ * Apply mirroring to the arrays of tetra, triangles and edges (allocated at
+ * their final size by \ref MIRRORMESH_alloc_mesh).
+ *
+ * The image of the element \a k in the copy \a icopy is built from the base
+ * element: its vertices are the images of the base vertices in the copy and
+ * its orientation is reversed if the copy has an odd number of reflections.
+ * Elements lying on a plane shared with a previous copy are not created, nor
+ * the triangles and edges lying on a plane shared with a neighbouring copy
+ * (in the base copy too): they would be internal surfaces of the replicated
+ * mesh. The other elements are stored at their index in the numbering of the lattice
+ * (copy by copy, in the order of the base mesh).
+ *
+ * The base elements are split in tiles of about \a tile kB (\ref
+ * MIRRORMESH_TILE bytes if \a tile is 0), each one holding a range of tetra,
+ * of triangles and of edges: all the copies of a tile are built before moving
+ * to the next one, so the base elements are read from memory once instead of
+ * once per copy and entity type. If \a tile is -1, the base mesh is a single
+ * tile and is replicated copy by copy.
+ *
+ * The boundary data of the tetra (xtetra, stored at \a xt + \a pos * \a
+ * xtinit) and the edge tags of the triangles follow the elements, so a mesh
+ * analysed by Mmg stays consistent (see \ref MIRRORMESH_mirror_xtetra). The
+ * xtetra of the base copy are updated in place once the other copies are
+ * built.
+ *
+ */
+static
+int MIRRORMESH_mirror_cells(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                            int nthreads,int tile) {
+  MIRRORMESH_pCopy copy0 = &lat->copies[0];
+  MMG5_pTria       tria;
+  MMG5_pEdge       edge;
+  MIRRORMESH_int   ne,nt,na;
+  size_t           bytes,size;
+  int              k,t,ntile,icopy;
+
+  /* Get initial number of tetra, xtetra, tria and edges */
+  int neinit = mesh->nei;
+  int xtinit = mesh->xtetra ? mesh->xt : 0;
+  int ntinit = mesh->nti;
+  int nainit = mesh->nai;
+
+  /* Number of tiles of base elements */
+  bytes = (size_t)neinit*sizeof(MMG5_Tetra) + (size_t)xtinit*sizeof(MMG5_xTetra)
+    + (size_t)ntinit*sizeof(MMG5_Tria) + (size_t)nainit*sizeof(MMG5_Edge);
+  if ( tile < 0 ) {
+    ntile = 1;
+  }
+  else {
+    size  = tile ? (size_t)tile*MMG5_KB : MIRRORMESH_TILE;
+    ntile = (int)MG_MAX(1,(bytes + size - 1) / size);
+  }
+
+  /* Base triangles and edges: if some of them are removed from the base copy,
+   * the next copies overwrite them before they are read, so they are read
+   * from a copy */
+  tria = mesh->tria;
+  edge = mesh->edge;
+  if ( copy0->itfmask ) {
+    MMG5_ADD_MEM(mesh,(size_t)(ntinit+1)*sizeof(MMG5_Tria)
+                 +(size_t)(nainit+1)*sizeof(MMG5_Edge),"base elements",
+                 return 0);
+    MMG5_SAFE_MALLOC(tria,ntinit+1,MMG5_Tria,return 0);
+    MMG5_SAFE_MALLOC(edge,nainit+1,MMG5_Edge,MMG5_DEL_MEM(mesh,tria);return 0);
+    memcpy(tria,mesh->tria,(size_t)(ntinit+1)*sizeof(MMG5_Tria));
+    memcpy(edge,mesh->edge,(size_t)(nainit+1)*sizeof(MMG5_Edge));
+  }
+
+  /* Replication of the tiles: the static schedule gives consecutive copies of
+   * a tile to the same thread */
+#pragma omp parallel for collapse(2) num_threads(nthreads) schedule(static)
+  for ( t=0; t<ntile; ++t ) {
+    for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+      int e0 = MIRRORMESH_tile_start(neinit,ntile,t);
+      int e1 = MIRRORMESH_tile_start(neinit,ntile,t+1);
+      int t0 = MIRRORMESH_tile_start(ntinit,ntile,t);
+      int t1 = MIRRORMESH_tile_start(ntinit,ntile,t+1);
+      int a0 = MIRRORMESH_tile_start(nainit,ntile,t);
+      int a1 = MIRRORMESH_tile_start(nainit,ntile,t+1);
+
+      if ( !icopy ) {
+        if ( !copy0->itfmask ) {
+          /* Base copy, unchanged */
+          continue;
+        }
+      }
+      else {
+        MIRRORMESH_mirror_tetra(mesh,lat,icopy,e0+1,e1,xtinit);
       }
+      MIRRORMESH_mirror_tria(mesh,lat,tria,icopy,t0+1,t1);
+      MIRRORMESH_mirror_edge(mesh,lat,edge,icopy,a0+1,a1);
     }
-    while ( ++k < mesh->na );
+  }
 
-    if ( !mesh->edge[mesh->na].a ) {
-      --mesh->na;
+  if ( xtinit && copy0->itfmask ) {
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for ( k=1; k<=neinit; ++k ) {
+      MMG5_pTetra pt = &mesh->tetra[k];
+      if ( pt->xt ) MIRRORMESH_mirror_xtetra(mesh,lat,copy0,pt->v,pt);
     }
+  }
 
-    /* Recreate nil chain */
-    if ( mesh->na >= mesh->namax-1 )
-      mesh->nanil = 0;
-    else
-      mesh->nanil = mesh->na + 1;
+  if ( tria != mesh->tria ) {
+    MMG5_DEL_MEM(mesh,tria);
+    MMG5_DEL_MEM(mesh,edge);
+  }
 
-    if ( mesh->nanil )
-      for(k=mesh->nanil; k<mesh->namax-1; k++)
-        mesh->edge[k].a = 0;
+  MIRRORMESH_Get_latticeSize(lat,NULL,&ne,&nt,&na);
+  mesh->ne = (int)ne;
+  mesh->nt = (int)nt;
+  mesh->na = (int)na;
+  if ( xtinit ) {
+    mesh->xt = lat->ncopy*xtinit;
   }
-  mesh->nai = mesh->na;
 
   return 1;
 }
 
 /**
- * \param mesh pointer toward the mesh structure
+ * \param mesh mesh structure
+ * \param lat lattice of the base mesh
+ * \param nthreads number of threads to use
  *
  * \return 1 if success, 0 if fail.
  *
- * Pack the sparse triangles
- * Don't preserve numbering order.
+ * Build the adjacency of the replicated tetra from the adjacency of the base
+ * mesh (\a mesh->adja, built before the replication), without hashing the
+ * faces of the replicated mesh.
+ *
+ * Inside a copy, the neighbours are the images of the base neighbours (faces
+ * 2 and 3 being exchanged in the reoriented copies). A boundary face of the
+ * base mesh lying on a plane shared with a neighbouring copy is glued to its
+ * own image in this copy, which is the mirror of the copy across the plane,
+ * or to the image of the matching face of the opposite boundary along a
+ * translation axis (see \ref MIRRORMESH_neighbour).
  *
  */
 static
-int MIRRORMESH_pack_tria(MMG5_pMesh mesh) {
-  MMG5_pTria   pt,pt1;
-  int          k;
+int MIRRORMESH_mirror_adja(MMG5_pMesh mesh,MIRRORMESH_pLattice lat,
+                           int nthreads) {
+  int    *adja,*adjb;
+  size_t nadj;
+  int    k,icopy,ier;
 
-  if ( !mesh->nt ) {
-    return 1;
-  }
+  int neinit = mesh->nei;
 
-  if ( mesh->tria ) {
-    k = 1;
-    do {
-      pt = &mesh->tria[k];
-      if ( !MG_EOK(pt) ) {
-        while ( (!MG_EOK(&mesh->tria[mesh->nt])) && mesh->nt > k ) {
-          --mesh->nt;
+  adjb = mesh->adja;
+  nadj = 4*(size_t)mesh->ne+5;
+  MMG5_ADD_MEM(mesh,nadj*sizeof(int),"replicated adjacency",return 0);
+  MMG5_SAFE_CALLOC(adja,nadj,int,return 0);
+
+  ier = 1;
+#pragma omp parallel for collapse(2) num_threads(nthreads) schedule(static) \
+  reduction(min:ier)
+  for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+    for (k=1; k<=neinit; ++k) {
+      MIRRORMESH_pCopy copy = &lat->copies[icopy];
+      MMG5_pTetra      pt   = &mesh->tetra[k];
+      int8_t           face;
+      int              i,j,ia,adj,kn,kf,jcopy;
+
+      if ( MIRRORMESH_lattice_skip(lat,&lat->tetra,icopy,4,pt->v) ) continue;
+
+      ia = 4*(MIRRORMESH_lattice_index(lat,&lat->tetra,icopy,k)-1)+1;
+
+      for ( i=0; i<4; ++i ) {
+        adj = adjb[4*(k-1)+1+i];
+
+        if ( adj ) {
+          /* Neighbour inside the copy */
+          kn = adj/4;
+          if ( MIRRORMESH_lattice_skip(lat,&lat->tetra,icopy,4,
+                                       mesh->tetra[kn].v) ) continue;
+          adja[ia+MIRRORMESH_face(copy,i)] =
+            4*MIRRORMESH_lattice_index(lat,&lat->tetra,icopy,kn)
+            + MIRRORMESH_face(copy,adj%4);
+          continue;
         }
-        if ( mesh->nt == k ) {
-          break;
+
+        /* Boundary face: glued to its image in the copy across its plane */
+        face = copy->itfmask;
+        for ( j=1; j<4; ++j ) {
+          face &= lat->itf.face[pt->v[(i+j)%4]];
         }
-        pt1 = &mesh->tria[mesh->nt];
-        assert( pt && pt1 && MG_EOK(pt1) );
-        memcpy(pt,pt1,sizeof(MMG5_Tria));
-        pt1->v[0] = 0;
+        if ( !face ) continue;
+
+        kf    = 4*k+i;
+        jcopy = MIRRORMESH_neighbour(lat->dim,lat->nmir,&lat->itf,copy,face,&kf);
+        if ( jcopy < -1 ) {
+          ier = 0;
+          continue;
+        }
+        if ( jcopy < 0 ||
+             MIRRORMESH_lattice_skip(lat,&lat->tetra,jcopy,4,
+                                     mesh->tetra[kf/4].v) ) continue;
+
+        adja[ia+MIRRORMESH_face(copy,i)] =
+          4*MIRRORMESH_lattice_index(lat,&lat->tetra,jcopy,kf/4)
+          + MIRRORMESH_face(&lat->copies[jcopy],kf%4);
       }
     }
-    while ( ++k < mesh->nt );
   }
 
-  if ( !MG_EOK(&mesh->tria[mesh->nt]) ) {
-    --mesh->nt;
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## Error: %s: boundary face without matching face on"
+            " the opposite boundary.\n",__func__);
+    MMG5_DEL_MEM(mesh,adja);
+    return 0;
   }
 
-  mesh->nti = mesh->nt;
+  MMG5_DEL_MEM(mesh,mesh->adja);
+  mesh->adja = adja;
 
   return 1;
 }
 
+/* Validity of the entities of the base mesh */
+static int MIRRORMESH_tetraOK(void *p) { return MG_EOK((MMG5_pTetra)p); }
+static int MIRRORMESH_triaOK(void *p)  { return MG_EOK((MMG5_pTria)p); }
+static int MIRRORMESH_edgeOK(void *p)  { return ((MMG5_pEdge)p)->a > 0; }
+
 /**
  * \param mesh pointer toward the mesh structure
+ * \param array array of entities (entity \a k at position \a k)
+ * \param size size of an entity
+ * \param n number of entities
+ * \param valid function returning 0 for a deleted entity
+ * \param nthreads number of threads
  *
- * \return 1 if success, 0 if fail.
+ * \return the number of valid entities, -1 if fail.
  *
- * Pack the sparse tetra.
- * Don't preserve numbering order.
+ * Stable compaction of an array of entities: valid entities are moved to the
+ * beginning of the array, keeping their relative order (and thus the
+ * locality of the numbering). The array is split into chunks, a first pass
+ * counts the valid entities of each chunk, a prefix sum gives the position
+ * of the first valid entity of each chunk and the chunks are then copied in
+ * parallel in a temporary array. Nothing is moved if there is no deleted
+ * entity.
  *
  */
-int MIRRORMESH_pack_tetra(MMG5_pMesh mesh) {
-  MMG5_pTetra   pt,pt1;
-  int           k;
+static
+int MIRRORMESH_compact(MMG5_pMesh mesh,void *array,size_t size,int n,
+                       int (*valid)(void*),int nthreads) {
+  char *buf,*base = (char*)array;
+  int  *pos,nchunk,c,nvalid;
+
+  if ( !n ) return 0;
 
-  if ( !mesh->ne ) {
-    return 1;
+  nchunk = (n-1)/MIRRORMESH_CHUNK + 1;
+
+  MMG5_ADD_MEM(mesh,(nchunk+1)*sizeof(int),"compaction chunks",return -1);
+  MMG5_SAFE_CALLOC(pos,nchunk+1,int,return -1);
+
+  /* Number of valid entities of each chunk */
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( c=0; c<nchunk; ++c ) {
+    int k,kend = MG_MIN(n,(c+1)*MIRRORMESH_CHUNK);
+
+    for ( k=c*MIRRORMESH_CHUNK+1; k<=kend; ++k ) {
+      if ( valid(base+k*size) ) ++pos[c+1];
+    }
+  }
+  for ( c=0; c<nchunk; ++c ) {
+    pos[c+1] += pos[c];
   }
+  nvalid = pos[nchunk];
 
-  if ( mesh->tetra ) {
-    k = 1;
-    do {
-      pt = &mesh->tetra[k];
-      if ( !MG_EOK(pt) ) {
-        while ( (!MG_EOK(&mesh->tetra[mesh->ne])) && mesh->ne > k ) {
-          --mesh->ne;
-        }
-        if ( mesh->ne == k ) {
-          break;
+  if ( nvalid == n ) {
+    MMG5_DEL_MEM(mesh,pos);
+    return n;
+  }
+
+  /* Stable copy of the valid entities (buf[0] stores the entity 1) */
+  if ( nvalid ) {
+    MMG5_ADD_MEM(mesh,(size_t)nvalid*size,"compacted entities",
+                 MMG5_DEL_MEM(mesh,pos);return -1);
+    MMG5_SAFE_MALLOC(buf,(size_t)nvalid*size,char,
+                     MMG5_DEL_MEM(mesh,pos);return -1);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for ( c=0; c<nchunk; ++c ) {
+      int k,kend = MG_MIN(n,(c+1)*MIRRORMESH_CHUNK);
+      int j      = pos[c];
+
+      for ( k=c*MIRRORMESH_CHUNK+1; k<=kend; ++k ) {
+        if ( valid(base+k*size) ) {
+          memcpy(buf+(j++)*size,base+k*size,size);
         }
-        pt1 = &mesh->tetra[mesh->ne];
-        assert( pt && pt1 && MG_EOK(pt1) );
-        memcpy(pt,pt1,sizeof(MMG5_Tetra));
-        /* Delete element */
-        pt1->v[0] = 0;
       }
     }
-    while ( ++k < mesh->ne );
 
-    if ( !MG_EOK(&mesh->tetra[mesh->ne]) ) {
-      --mesh->ne;
-    }
+    memcpy(base+size,buf,(size_t)nvalid*size);
+    MMG5_DEL_MEM(mesh,buf);
+  }
 
-    /* Recreate nil chain */
-    if ( mesh->ne >= mesh->nemax-1 )
-      mesh->nenil = 0;
-    else
-      mesh->nenil = mesh->ne + 1;
+  /* Deleted entities */
+  memset(base+(nvalid+1)*size,0,(size_t)(n-nvalid)*size);
 
-    if ( mesh->nenil )
-      for(k=mesh->nenil; k<mesh->nemax-1; k++)
-        mesh->tetra[k].v[0] = 0;
-  }
-  mesh->nei = mesh->ne;
+  MMG5_DEL_MEM(mesh,pos);
 
-  return 1;
+  return nvalid;
 }
 
 /**
  * \param mesh pointer toward the mesh structure
+ * \param nthreads number of threads
  *
  * \return 1 if success, 0 if fail.
  *
- * Pack the sparse mesh elements (tria, tetra and edges).
+ * Remove the deleted elements (tetra, tria and edges) of the base mesh,
+ * preserving the numbering order (see \ref MIRRORMESH_compact).
  *
  */
 static
-int MIRRORMESH_packMesh(MMG5_pMesh mesh) {
+int MIRRORMESH_packMesh(MMG5_pMesh mesh,int nthreads) {
+  int n;
 
-  if ( !MIRRORMESH_pack_tetra(mesh) ) return 0;
+  if ( mesh->tetra ) {
+    n = MIRRORMESH_compact(mesh,mesh->tetra,sizeof(MMG5_Tetra),mesh->ne,
+                           MIRRORMESH_tetraOK,nthreads);
+    if ( n < 0 ) return 0;
+    mesh->ne = mesh->nei = n;
+  }
 
-  if ( !MIRRORMESH_pack_tria(mesh) ) return 0;
+  /* The triangle and edge arrays are allocated at their number of entities:
+   * shrink them */
+  if ( mesh->tria ) {
+    n = MIRRORMESH_compact(mesh,mesh->tria,sizeof(MMG5_Tria),mesh->nt,
+                           MIRRORMESH_triaOK,nthreads);
+    if ( n < 0 ) return 0;
+    if ( n < mesh->nt ) {
+      MMG5_SAFE_REALLOC(mesh->tria,mesh->nt+1,n+1,MMG5_Tria,
+                        "smaller triangle array",return 0);
+      mesh->memCur -= (size_t)(mesh->nt-n)*sizeof(MMG5_Tria);
+    }
+    mesh->nt = mesh->nti = n;
+  }
 
-  if ( !MIRRORMESH_pack_edges(mesh) ) return 0;
+  if ( mesh->edge ) {
+    n = MIRRORMESH_compact(mesh,mesh->edge,sizeof(MMG5_Edge),mesh->na,
+                           MIRRORMESH_edgeOK,nthreads);
+    if ( n < 0 ) return 0;
+    if ( n < mesh->na ) {
+      MMG5_SAFE_REALLOC(mesh->edge,mesh->na+1,n+1,MMG5_Edge,
+                        "smaller edge array",return 0);
+      mesh->memCur -= (size_t)(mesh->na-n)*sizeof(MMG5_Edge);
+    }
+    mesh->na = mesh->nai = n;
+  }
 
   return 1;
 }
 
 int MIRRORMESH_mirror(MMG5_pMesh mesh,int nx, int ny, int nz) {
-  mytime ctim[TIMEMAX];
-  char   stim[32];
+  MIRRORMESH_Info info;
+
+  MIRRORMESH_Init_parameters(&info);
+  info.nmir[0] = nx;
+  info.nmir[1] = ny;
+  info.nmir[2] = nz;
+
+  return MIRRORMESH_mirrorlib(mesh,&info);
+}
+
+int MIRRORMESH_mirrorlib(MMG5_pMesh mesh,MIRRORMESH_pInfo info) {
+
+  return MIRRORMESH_mirrorlibSols(mesh,NULL,NULL,info);
+}
+
+int MIRRORMESH_mirrorlibSols(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,
+                             MIRRORMESH_pInfo info) {
+  MIRRORMESH_Chrono     ctim;
+  MIRRORMESH_PhaseStats *ph;
+  char                  stim[32];
+  int                   l;
 
   /** In debug mode, check that all structures are allocated */
   assert ( mesh );
   assert ( mesh->point );
+  assert ( info );
 
   if ( mesh->info.imprim >= 0 ) {
     fprintf(stdout,"\n  %s\n   MODULE MIRRORMESH: %s (%s)\n  %s\n",
             MG_STR,MIRRORMESH_VERSION_RELEASE,MIRRORMESH_RELEASE_DATE,MG_STR);
   }
 
-  tminit(ctim,TIMEMAX);
-  chrono(ON,&(ctim[0]));
+  /* Measures of the previous replication */
+  for ( l=MIRRORMESH_PHASE_preflight; l<=MIRRORMESH_PHASE_cells; ++l ) {
+    memset(&info->stats.phase[l],0,sizeof(MIRRORMESH_PhaseStats));
+  }
 
   /* Check options */
-  if ( nx < 0 || ny < 0 || nz < 0) {
+  if ( info->nmir[0] < 0 || info->nmir[1] < 0 || info->nmir[2] < 0) {
     fprintf(stdout,"\n  ## ERROR: NUMBER OF MIRRORINGS MUST BE POSOTIVE.\n");
     return MMG5_LOWFAILURE;
   }
 
-  /* Point mirroring */
+  /* Number of threads */
+  const int nthreads = MIRRORMESH_NTHREADS(info);
+
+  /* Preflight */
   if ( mesh->info.imprim > 0 ) {
-    fprintf(stdout,"\n  -- PHASE 1 : POINT MIRRORING\n");
+    fprintf(stdout,"\n  -- PHASE 0 : PREFLIGHT\n");
+  }
+  MIRRORMESH_stats_start(mesh,&ctim);
+
+  /* Removal of the deleted elements of the base mesh: the lattice numbering
+   * is built from the packed base mesh and the replication only creates valid
+   * elements, so no packing is needed afterwards */
+  int iermesh = MIRRORMESH_packMesh(mesh,nthreads);
+  if ( !iermesh ) {
+    fprintf(stderr,"  ## Error: unable to pack the initial mesh.\n");
+    return MMG5_LOWFAILURE;
   }
-  chrono(ON,&(ctim[4]));
-
-  int nmir[3];
-  nmir[0] = nx;
-  nmir[1] = ny;
-  nmir[2] = nz;
 
-  /* Working dimension */
-  const int dim = 3;
-  /* Tolerance over coordinates to consider a point as replicated */
-  const double eps = 1e-14;
+  /* The adjacency of the input mesh doesn't survive the packing, the
+   * renumbering and the replication */
+  if ( mesh->adja ) {
+    MMG5_DEL_MEM(mesh,mesh->adja);
+  }
 
-  struct rusage usage;
-  double tu, ts, tt;
+  /* Exact sizes of the replicated mesh */
+  MIRRORMESH_Lattice   lat;
+  MIRRORMESH_Preflight pf;
+  if ( !MIRRORMESH_build_lattice(mesh,met,sol,info,&lat) ) {
+    fprintf(stderr,"  ## Error: unable to build the replicated mesh.\n");
+    return MMG5_LOWFAILURE;
+  }
+  MIRRORMESH_preflight(&lat,&pf,info->adja);
 
-  if(getrusage(RUSAGE_SELF, &usage)){
-    printf("getrusage failed: no resource usage data\n");
-  }else{
-    tu = (double)usage.ru_utime.tv_sec + 1e-6*usage.ru_utime.tv_usec;
-    ts = (double)usage.ru_stime.tv_sec + 1e-6*usage.ru_stime.tv_usec;
-    tt = tu+ts;
-    printf("memory usage (max resident set size) : %.3f GB\n",
-	   (double)usage.ru_maxrss/1024/1024);
-    printf("cputime : %.1f seconds (%.1f user, %.1f system)\n", tt, tu, ts);
+  /* Adjacency of the base mesh, replicated with the tetra */
+  if ( info->adja && !MMG3D_hashTetra(mesh,0) ) {
+    fprintf(stderr,"  ## Error: unable to build the adjacency of the base"
+            " mesh.\n");
+    MIRRORMESH_free_lattice(&lat);
+    return MMG5_LOWFAILURE;
   }
 
-  int ier = MIRRORMESH_mirror_points(mesh,dim,nmir,eps);
+  if ( abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MIRRORMESH_PRId "\n",pf.np);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8" MIRRORMESH_PRId "\n",pf.ne);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MIRRORMESH_PRId "\n",pf.nt);
+    fprintf(stdout,"     NUMBER OF EDGES      %8" MIRRORMESH_PRId "\n",pf.na);
+    fprintf(stdout,"     MEMORY NEEDED        %8zu MB\n",
+            (pf.mem+pf.work)/MMG5_MILLION);
+  }
 
+  /* Overflow of the indices of the mesh, checked before any allocation */
+  if ( !MIRRORMESH_fitMesh(&lat,&pf,info->adja) ) {
+    fprintf(stderr,"\n  ## Error: %s: replicated mesh too large to be"
+            " built: more than %" MIRRORMESH_PRId " entities (see the -stream"
+            " option).\n",__func__,MIRRORMESH_MESH_INTMAX-1);
+    MIRRORMESH_free_lattice(&lat);
+    return MMG5_LOWFAILURE;
+  }
 
-  if(getrusage(RUSAGE_SELF, &usage)){
-    printf("getrusage failed: no resource usage data\n");
-  }else{
-    tu = (double)usage.ru_utime.tv_sec + 1e-6*usage.ru_utime.tv_usec;
-    ts = (double)usage.ru_stime.tv_sec + 1e-6*usage.ru_stime.tv_usec;
-    tt = tu+ts;
-    printf("memory usage (max resident set size) : %.3f GB\n",
-	   (double)usage.ru_maxrss/1024/1024);
-    printf("cputime : %.1f seconds (%.1f user, %.1f system)\n", tt, tu, ts);
+  /* Single allocation of the arrays at their final size */
+  if ( !MIRRORMESH_alloc_mesh(&lat,&pf) ) {
+    MIRRORMESH_free_lattice(&lat);
+    return MMG5_STRONGFAILURE;
   }
 
-  chrono(OFF,&(ctim[4]));
-  printim(ctim[4].gdif,stim);
+  ph = MIRRORMESH_stats_stop(mesh,&ctim,info,MIRRORMESH_PHASE_preflight);
+  printim(ph->wall,stim);
   if ( mesh->info.imprim > 0 )
-    fprintf(stdout,"  -- PHASE 1 COMPLETED.     %s\n",stim);
+    fprintf(stdout,"  -- PHASE 0 COMPLETED.     %s\n",stim);
 
-  /* Mesh compression */
+  /* Point mirroring */
   if ( mesh->info.imprim > 0 ) {
-    fprintf(stdout,"\n  -- PHASE 3 : MESH PACKING\n");
+    fprintf(stdout,"\n  -- PHASE 1 : POINT MIRRORING\n");
   }
-  chrono(ON,&(ctim[6]));
+  MIRRORMESH_stats_start(mesh,&ctim);
 
-  int iermesh = MIRRORMESH_packMesh(mesh);
-  if ( iermesh < 0 ) {
-    fprintf(stderr,"  ## Error: unable to pack the final mesh.\n");
+  int ier = MIRRORMESH_mirror_points(mesh,&lat,nthreads);
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: unable to mirror the points.\n");
+    MIRRORMESH_free_lattice(&lat);
     return MMG5_LOWFAILURE;
   }
 
-  chrono(OFF,&(ctim[6]));
-  printim(ctim[6].gdif,stim);
+  ph = MIRRORMESH_stats_stop(mesh,&ctim,info,MIRRORMESH_PHASE_points);
+  ph->nweld = (MIRRORMESH_int)lat.ncopy*mesh->npi - mesh->np;
+  printim(ph->wall,stim);
   if ( mesh->info.imprim > 0 )
-    fprintf(stdout,"  -- PHASE 3 COMPLETED.     %s\n",stim);
+    fprintf(stdout,"  -- PHASE 1 COMPLETED.     %s\n",stim);
 
   /* Cells mirroring */
   if ( mesh->info.imprim > 0 ) {
     fprintf(stdout,"\n  -- PHASE 2 : ELEMENT MIRRORING\n");
   }
-  chrono(ON,&(ctim[5]));
+  MIRRORMESH_stats_start(mesh,&ctim);
 
-  iermesh = MIRRORMESH_mirror_cells(mesh,dim,nmir);
-  if ( iermesh < 0 ) {
+  iermesh = MIRRORMESH_mirror_cells(mesh,&lat,nthreads,info->tile);
+  if ( iermesh && info->adja ) {
+    iermesh = MIRRORMESH_mirror_adja(mesh,&lat,nthreads);
+  }
+  MIRRORMESH_free_lattice(&lat);
+  if ( !iermesh ) {
     fprintf(stderr,"  ## Error: unable to mirror the mesh.\n");
     return MMG5_LOWFAILURE;
   }
 
-  chrono(OFF,&(ctim[5]));
-  printim(ctim[5].gdif,stim);
+  ph = MIRRORMESH_stats_stop(mesh,&ctim,info,MIRRORMESH_PHASE_cells);
+  printim(ph->wall,stim);
   if ( mesh->info.imprim > 0 )
     fprintf(stdout,"  -- PHASE 2 COMPLETED.     %s\n",stim);
 
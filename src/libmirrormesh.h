@@ -54,16 +54,644 @@ extern "C" {
  *
  * Mesh mirroring: replicates a mesh by mirroring along each direction.
  *
- * \remark Fortran interface:
- * >   SUBROUTINE MIRRORMESH_mirror(mesh,nx,ny,nz,retval)\n
- * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: nx,ny,nz\n
- * >     INTEGER, INTENT(OUT)          :: retval\n
- * >   END SUBROUTINE\n
- *
  **/
 int MIRRORMESH_mirror(MMG5_pMesh mesh,int nx, int ny, int nz);
 
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ *
+ * \return 1 if success.
+ *
+ * Initialization of the mirrormesh parameters to their default values (1
+ * mirror along each direction, runtime default number of threads, welding
+ * tolerance of \f$10^{-8}\f$ times the bounding box size).
+ *
+ **/
+int MIRRORMESH_Init_parameters(MIRRORMESH_pInfo info);
+
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param iparam integer parameter to set (see \ref MIRRORMESH_Param for a
+ *                list of parameters that can be set).
+ * \param val value for the parameter.
+ *
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set integer parameter \a iparam at value \a val.
+ *
+ **/
+int MIRRORMESH_Set_iparameter(MIRRORMESH_pInfo info,int iparam,int val);
+
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param dparam double parameter to set (see \ref MIRRORMESH_Param for a
+ *                list of parameters that can be set).
+ * \param val value for the parameter.
+ *
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set double parameter \a dparam at value \a val.
+ *
+ **/
+int MIRRORMESH_Set_dparameter(MIRRORMESH_pInfo info,int dparam,double val);
+
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param nx number of mirrors along the x-axis of the previous replication.
+ * \param ny number of mirrors along the y-axis of the previous replication.
+ * \param nz number of mirrors along the z-axis of the previous replication.
+ *
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Declare that the replication extends a previous replication of the same
+ * base mesh with the same parameters (modes, renumbering and welding
+ * tolerance). The previous replications are added from the smallest one and
+ * must be nested in the replication. The copies of each previous replication
+ * are numbered first, in the order they had in it: the vertices and the
+ * tetrahedra of the previous replicated mesh keep their indices and only the
+ * new copies have to be generated (see \ref MIRRORMESH_saveLatticeGrowth).
+ *
+ **/
+int MIRRORMESH_Add_stage(MIRRORMESH_pInfo info,int nx,int ny,int nz);
+
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param stats pointer toward the structure to fill.
+ *
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Get the measures of the phases of the last replication performed with \a
+ * info (see \ref MIRRORMESH_Phase): wall and CPU time, peak memory of the
+ * process and memory allocated for the mesh, sizes of the mesh at the end of
+ * the phase and number of welded vertices. The entries of the phases that
+ * haven't run have their \a done field set to 0.
+ *
+ **/
+int MIRRORMESH_Get_stats(MIRRORMESH_pInfo info,MIRRORMESH_pStats stats);
+
+/**
+ * \param mesh pointer toward a MMG5_Mesh mesh structure
+ *       (that can be initialized using the Mmg API)
+ * \param info pointer toward the mirrormesh parameters structure
+ *       (initialized with \ref MIRRORMESH_Init_parameters).
+ *
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but we can
+ * save a conformal mesh \ref MMG5_STRONGFAILURE if fail and
+ * we can't save a conformal mesh.
+ *
+ * Mesh mirroring using the parameters stored in \a info.
+ *
+ * By default, the input mesh is the first copy of the replicated mesh: its
+ * vertices and elements keep their indices. If \a MIRRORMESH_IPARAM_renum is
+ * set, the input mesh is first renumbered for locality and the copies are
+ * numbered along a Hilbert curve over the lattice of copies, so the indices
+ * of the input entities are not kept.
+ *
+ * If \a MIRRORMESH_IPARAM_adja is set, the adjacency of the replicated tetra
+ * (\a mesh->adja, Mmg convention) is built from the adjacency of the base
+ * mesh: the faces of the replicated mesh are never hashed. Otherwise, any
+ * adjacency array of the input mesh is freed.
+ *
+ * Along the axes whose mode (\a MIRRORMESH_IPARAM_modex, \a modey, \a modez)
+ * is \a MIRRORMESH_TRANSLATE, the copies are translated instead of mirrored:
+ * the base mesh must then be periodic along these axes (the vertices of its
+ * lower boundary plane match the vertices of its upper one), and
+ * MMG5_LOWFAILURE is returned otherwise.
+ *
+ **/
+int MIRRORMESH_mirrorlib(MMG5_pMesh mesh,MIRRORMESH_pInfo info);
+
+/**
+ * \param mesh pointer toward a MMG5_Mesh mesh structure
+ *       (that can be initialized using the Mmg API)
+ * \param met pointer toward the metric (may be NULL or empty).
+ * \param sol array of \a mesh->nsols solution fields (as loaded by \a
+ *       MMG3D_loadAllSols, may be NULL).
+ * \param info pointer toward the mirrormesh parameters structure
+ *       (initialized with \ref MIRRORMESH_Init_parameters).
+ *
+ * \return \ref MMG5_SUCCESS if success, \ref MMG5_LOWFAILURE if fail but we can
+ * save a conformal mesh \ref MMG5_STRONGFAILURE if fail and
+ * we can't save a conformal mesh.
+ *
+ * Mesh mirroring using the parameters stored in \a info: the scalar, vector
+ * and symmetric tensor fields defined at the vertices of the mesh are
+ * replicated with the points. Vectors and tensors are reflected with the
+ * copies and the welded points keep the values of the point they are welded
+ * to.
+ *
+ **/
+int MIRRORMESH_mirrorlibSols(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,
+                             MIRRORMESH_pInfo info);
+
+
+/**
+ * \param mesh pointer toward the base mesh (it must be kept unchanged while
+ * the lattice is in use).
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param lattice pointer toward the handle to allocate and fill.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Build a lightweight handle toward the replicated mesh without materialising
+ * it: vertices and elements of the replicated mesh are computed on demand from
+ * the base mesh and their position in the lattice of copies. The memory used
+ * by the handle only depends on the size of the base mesh (and on the number
+ * of copies for the copy offsets). Entities are numbered as in the mesh
+ * produced by \ref MIRRORMESH_mirrorlib.
+ *
+ * If the renumbering is enabled (\a MIRRORMESH_IPARAM_renum, off by
+ * default), the handle renumbers a copy of the base mesh that it owns (the
+ * mesh of the caller is left unchanged) and the copies are numbered along a
+ * Hilbert curve over the lattice of copies: the base vertex \a k is then not
+ * the vertex \a k of the replicated mesh.
+ *
+ **/
+int MIRRORMESH_Init_lattice(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                            MIRRORMESH_pLattice *lattice);
+
+/**
+ * \param mesh pointer toward the base mesh (it must be kept unchanged while
+ * the lattice is in use).
+ * \param met pointer toward the metric (may be NULL or empty).
+ * \param sol array of \a mesh->nsols solution fields (may be NULL).
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param lattice pointer toward the handle to allocate and fill.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Same as \ref MIRRORMESH_Init_lattice, the fields defined at the vertices
+ * of the base mesh being replicated with the mesh (the metric first, then
+ * the solution fields). The fields must be kept unchanged while the lattice
+ * is in use; if the renumbering is enabled, the handle renumbers copies of
+ * them, with its copy of the base mesh.
+ *
+ **/
+int MIRRORMESH_Init_latticeSols(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol sol,
+                                MIRRORMESH_pInfo info,
+                                MIRRORMESH_pLattice *lattice);
+
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param layout layout of the arrays (\ref MIRRORMESH_Layout).
+ * \param isize integer type of the connectivity arrays (\ref
+ * MIRRORMESH_IndexSize).
+ * \param np number of vertices of the base mesh.
+ * \param vertices array of size 3*np of the vertices coordinates.
+ * \param vrefs array of size np of the vertices references (may be NULL).
+ * \param ne number of tetrahedra of the base mesh.
+ * \param tetra array of size 4*ne of the tetrahedra vertices (from 1).
+ * \param erefs array of size ne of the tetrahedra references (may be NULL).
+ * \param nt number of triangles of the base mesh.
+ * \param tria array of size 3*nt of the triangles vertices (may be NULL if
+ * \a nt is 0).
+ * \param trefs array of size nt of the triangles references (may be NULL).
+ * \param na number of edges of the base mesh.
+ * \param edges array of size 2*na of the edges extremities (may be NULL if
+ * \a na is 0).
+ * \param arefs array of size na of the edges references (may be NULL).
+ * \param lattice pointer toward the handle to allocate and fill.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Same as \ref MIRRORMESH_Init_lattice, the base mesh being given by arrays
+ * owned by the caller instead of a Mmg mesh. The arrays are copied in a base
+ * mesh owned by the handle (its size is the one of the base mesh, not of the
+ * replicated mesh) and may be freed or modified once the handle is built.
+ * The replicated mesh is then written in arrays of the caller by \ref
+ * MIRRORMESH_Get_latticeArrays or given by chunks to \ref
+ * MIRRORMESH_Get_latticeChunks, so neither the base mesh nor the replicated
+ * mesh have to be converted from or to Mmg structures.
+ *
+ **/
+int MIRRORMESH_Init_latticeArrays(MIRRORMESH_pInfo info,int layout,int isize,
+                                  int np,const double *vertices,
+                                  const int *vrefs,int ne,const void *tetra,
+                                  const int *erefs,int nt,const void *tria,
+                                  const int *trefs,int na,const void *edges,
+                                  const int *arefs,
+                                  MIRRORMESH_pLattice *lattice);
+
+/**
+ * \param lattice pointer toward the handle to free.
+ *
+ * \return 1 if success.
+ *
+ * Free the handle toward the replicated mesh (the base mesh is not freed,
+ * unless it was built from arrays by \ref MIRRORMESH_Init_latticeArrays).
+ *
+ **/
+int MIRRORMESH_Free_lattice(MIRRORMESH_pLattice *lattice);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param np pointer toward the number of vertices (may be NULL).
+ * \param ne pointer toward the number of tetrahedra (may be NULL).
+ * \param nt pointer toward the number of triangles (may be NULL).
+ * \param na pointer toward the number of edges (may be NULL).
+ *
+ * \return 1.
+ *
+ * Get the number of entities of the replicated mesh. The entities of the
+ * replicated mesh are counted and numbered in 64 bits (\ref MIRRORMESH_int).
+ *
+ **/
+int MIRRORMESH_Get_latticeSize(MIRRORMESH_pLattice lattice,MIRRORMESH_int *np,
+                               MIRRORMESH_int *ne,MIRRORMESH_int *nt,
+                               MIRRORMESH_int *na);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param k index of the vertex (from 1 to np).
+ * \param c0 pointer toward the first coordinate of the vertex.
+ * \param c1 pointer toward the second coordinate of the vertex.
+ * \param c2 pointer toward the third coordinate of the vertex.
+ * \param ref pointer toward the vertex reference (may be NULL).
+ *
+ * \return 1 if success, 0 if \a k is out of range.
+ *
+ * Get the coordinates and the reference of the vertex \a k of the replicated
+ * mesh (random access: cost logarithmic in the size of the base mesh).
+ *
+ **/
+int MIRRORMESH_Get_latticeVertex(MIRRORMESH_pLattice lattice,MIRRORMESH_int k,
+                                 double *c0,double *c1,double *c2,int *ref);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param isol index of the field (from 0, the metric being the first field
+ * if it was provided).
+ * \param k index of the vertex (from 1 to np).
+ * \param s array to fill with the value of the field at the vertex (1, 3 or
+ * 6 reals for scalar, vector or symmetric tensor fields).
+ *
+ * \return 1 if success, 0 if \a isol or \a k is out of range.
+ *
+ * Get the value of a field at the vertex \a k of the replicated mesh.
+ *
+ **/
+int MIRRORMESH_Get_latticeSol(MIRRORMESH_pLattice lattice,int isol,
+                              MIRRORMESH_int k,double *s);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param kstart index of the first vertex to get.
+ * \param kend index of the last vertex to get.
+ * \param vertices array of size 3*(kend-kstart+1) to fill with the vertices
+ * coordinates.
+ * \param refs array of size kend-kstart+1 to fill with the vertices
+ * references (may be NULL).
+ *
+ * \return 1 if success, 0 if the range is invalid.
+ *
+ * Iterate over the vertices \a kstart to \a kend of the replicated mesh.
+ *
+ **/
+int MIRRORMESH_Get_latticeVertices(MIRRORMESH_pLattice lattice,
+                                   MIRRORMESH_int kstart,MIRRORMESH_int kend,
+                                   double *vertices,int *refs);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param k index of the tetrahedron (from 1 to ne).
+ * \param v0 pointer toward the first vertex of the tetrahedron.
+ * \param v1 pointer toward the second vertex of the tetrahedron.
+ * \param v2 pointer toward the third vertex of the tetrahedron.
+ * \param v3 pointer toward the fourth vertex of the tetrahedron.
+ * \param ref pointer toward the tetrahedron reference (may be NULL).
+ *
+ * \return 1 if success, 0 if \a k is out of range.
+ *
+ * Get the vertices and the reference of the tetrahedron \a k of the
+ * replicated mesh.
+ *
+ **/
+int MIRRORMESH_Get_latticeTetrahedron(MIRRORMESH_pLattice lattice,
+                                      MIRRORMESH_int k,MIRRORMESH_int *v0,
+                                      MIRRORMESH_int *v1,MIRRORMESH_int *v2,
+                                      MIRRORMESH_int *v3,int *ref);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param kstart index of the first tetrahedron to get.
+ * \param kend index of the last tetrahedron to get.
+ * \param tetra array of size 4*(kend-kstart+1) to fill with the tetrahedra
+ * vertices.
+ * \param refs array of size kend-kstart+1 to fill with the tetrahedra
+ * references (may be NULL).
+ *
+ * \return 1 if success, 0 if the range is invalid.
+ *
+ * Iterate over the tetrahedra \a kstart to \a kend of the replicated mesh.
+ *
+ **/
+int MIRRORMESH_Get_latticeTetrahedra(MIRRORMESH_pLattice lattice,
+                                     MIRRORMESH_int kstart,MIRRORMESH_int kend,
+                                     MIRRORMESH_int *tetra,int *refs);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param k index of the triangle (from 1 to nt).
+ * \param v0 pointer toward the first vertex of the triangle.
+ * \param v1 pointer toward the second vertex of the triangle.
+ * \param v2 pointer toward the third vertex of the triangle.
+ * \param ref pointer toward the triangle reference (may be NULL).
+ *
+ * \return 1 if success, 0 if \a k is out of range.
+ *
+ * Get the vertices and the reference of the triangle \a k of the replicated
+ * mesh.
+ *
+ **/
+int MIRRORMESH_Get_latticeTriangle(MIRRORMESH_pLattice lattice,
+                                   MIRRORMESH_int k,MIRRORMESH_int *v0,
+                                   MIRRORMESH_int *v1,MIRRORMESH_int *v2,
+                                   int *ref);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param k index of the edge (from 1 to na).
+ * \param e0 pointer toward the first extremity of the edge.
+ * \param e1 pointer toward the second extremity of the edge.
+ * \param ref pointer toward the edge reference (may be NULL).
+ *
+ * \return 1 if success, 0 if \a k is out of range.
+ *
+ * Get the extremities and the reference of the edge \a k of the replicated
+ * mesh.
+ *
+ **/
+int MIRRORMESH_Get_latticeEdge(MIRRORMESH_pLattice lattice,MIRRORMESH_int k,
+                               MIRRORMESH_int *e0,MIRRORMESH_int *e1,int *ref);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param layout layout of the arrays (\ref MIRRORMESH_Layout).
+ * \param isize integer type of the connectivity arrays (\ref
+ * MIRRORMESH_IndexSize).
+ * \param vertices array of size 3*np to fill with the vertices coordinates
+ * (may be NULL).
+ * \param vrefs array of size np to fill with the vertices references (may be
+ * NULL).
+ * \param tetra array of size 4*ne to fill with the tetrahedra vertices (may
+ * be NULL).
+ * \param erefs array of size ne to fill with the tetrahedra references (may
+ * be NULL).
+ * \param tria array of size 3*nt to fill with the triangles vertices (may be
+ * NULL).
+ * \param trefs array of size nt to fill with the triangles references (may be
+ * NULL).
+ * \param edges array of size 2*na to fill with the edges extremities (may be
+ * NULL).
+ * \param arefs array of size na to fill with the edges references (may be
+ * NULL).
+ *
+ * \return 1 if success, 0 if the format is invalid or if the vertex indices
+ * do not fit in \a isize.
+ *
+ * Write the whole replicated mesh in arrays owned by the caller (sizes given
+ * by \ref MIRRORMESH_Get_latticeSize): each entity is computed from the base
+ * mesh and stored in place, in parallel, without intermediate copy.
+ *
+ **/
+int MIRRORMESH_Get_latticeArrays(MIRRORMESH_pLattice lattice,int layout,
+                                 int isize,double *vertices,int *vrefs,
+                                 void *tetra,int *erefs,void *tria,int *trefs,
+                                 void *edges,int *arefs);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param layout layout of the chunks (\ref MIRRORMESH_Layout).
+ * \param isize integer type of the connectivity of the chunks (\ref
+ * MIRRORMESH_IndexSize).
+ * \param sink function receiving the chunks (\ref MIRRORMESH_Sink).
+ * \param user pointer given back to \a sink.
+ *
+ * \return 1 if success, 0 if the format is invalid, if the vertex indices do
+ * not fit in \a isize or if \a sink returns 0.
+ *
+ * Give the replicated mesh to \a sink by chunks of consecutive entities: the
+ * vertices, then the tetrahedra, the triangles and the edges, each type in
+ * increasing order of index. The chunks are computed in parallel in buffers of
+ * the library whose size only depends on the number of threads; \a sink is
+ * called by one thread at a time and must copy the data it keeps.
+ *
+ **/
+int MIRRORMESH_Get_latticeChunks(MIRRORMESH_pLattice lattice,int layout,
+                                 int isize,MIRRORMESH_Sink sink,void *user);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param filename name of the output file.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the replicated mesh at Medit or Gmsh ASCII format (depending on the
+ * extension of \a filename) without building it: the entities of each copy
+ * are computed from the base mesh while being written. The file is the same
+ * as the one obtained by saving the mesh produced by \ref
+ * MIRRORMESH_mirrorlib.
+ *
+ **/
+int MIRRORMESH_saveLattice(MIRRORMESH_pLattice lattice,const char *filename);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param filename name of the output file.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the fields of the replicated mesh in a Medit ASCII solution file
+ * without building them (see \ref MIRRORMESH_Init_latticeSols). The file is
+ * the same as the one written by \ref MIRRORMESH_saveAllSols for the fields
+ * produced by \ref MIRRORMESH_mirrorlibSols.
+ *
+ **/
+int MIRRORMESH_saveLatticeSols(MIRRORMESH_pLattice lattice,
+                               const char *filename);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param nparts number of partitions (between 1 and the number of copies).
+ * \param meshname name of the output mesh file.
+ * \param solname name of the output solution file (may be NULL).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the replicated mesh in \a nparts Medit ASCII files without building
+ * it, nor any of its partitions: the copies are split in \a nparts blocks
+ * of consecutive copies in the numbering order and the partition \a p is
+ * written in the file \a meshname with the index \a p inserted before the
+ * extension (name.p.mesh), with a local numbering of its entities. The faces
+ * shared with other partitions are appended to the triangles of the
+ * partition and the communicators of the shared vertices and faces are
+ * written at the format of the distributed meshes of ParMmg (\a
+ * ParallelVertexCommunicators and \a ParallelTriangleCommunicators
+ * sections). The global index of a vertex is its index in the replicated
+ * mesh. If \a solname is given, the fields of the lattice are written in
+ * the same way (name.p.sol).
+ *
+ **/
+int MIRRORMESH_saveLatticeParts(MIRRORMESH_pLattice lattice,int nparts,
+                                const char *meshname,const char *solname);
+
+/**
+ * \param lattice handle toward the replicated mesh.
+ * \param meshname name of the file in which the replicated mesh is saved.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the description of the replicated mesh next to its file (\a
+ * meshname with the .mirror extension): sizes of the base mesh, numbers of
+ * mirrors, parameters, previous replications and sizes of the replicated
+ * mesh. It allows to extend the replicated mesh later (see \ref
+ * MIRRORMESH_loadGrowth).
+ *
+ **/
+int MIRRORMESH_saveGrowth(MIRRORMESH_pLattice lattice,const char *meshname);
+
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param meshname name of a replicated mesh file (or of its .mirror
+ * description).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the description of a replicated mesh written by \ref
+ * MIRRORMESH_saveGrowth and set the parameters so that the next replication
+ * extends it: modes, renumbering, welding tolerance and previous replications
+ * (see \ref MIRRORMESH_Add_stage). The numbers of mirrors are not changed and
+ * must be at least the ones of the previous replication.
+ *
+ **/
+int MIRRORMESH_loadGrowth(MIRRORMESH_pInfo info,const char *meshname);
+
+/**
+ * \param lattice handle toward the replicated mesh, extending the previous
+ * one (see \ref MIRRORMESH_loadGrowth).
+ * \param prevname name of the previous replicated mesh (Medit ASCII format,
+ * with its .mirror description).
+ * \param filename name of the output file (Medit ASCII format).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the replicated mesh as \ref MIRRORMESH_saveLattice does, reusing the
+ * previous replicated mesh: its vertices and tetrahedra (and the required
+ * ones) are copied from \a prevname without being computed nor formatted
+ * again, and only the new copies, welded to the previous ones, are generated.
+ * The corners, triangles and edges, some of which become interior to the
+ * extended mesh, are generated for the whole lattice. The file is the same as
+ * the one written by \ref MIRRORMESH_saveLattice.
+ *
+ **/
+int MIRRORMESH_saveLatticeGrowth(MIRRORMESH_pLattice lattice,
+                                 const char *prevname,const char *filename);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param info pointer toward the mirrormesh parameters structure (for the
+ * number of threads and the tangents read with the mesh).
+ * \param filename name of the output file.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Save the mesh at Medit ASCII format. The sections of the file are
+ * formatted in parallel by chunks of entities and written in order, so the
+ * file doesn't depend on the number of threads. Reals are written with the
+ * shortest representation that reads back to the same value. The normals and
+ * tangents at the vertices are the ones written by \a MMG3D_saveMesh for a
+ * mesh analysed by Mmg, the ones read with the mesh otherwise (see \ref
+ * MIRRORMESH_loadMesh).
+ *
+ **/
+int MIRRORMESH_saveMesh(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                        const char *filename);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol array of \a mesh->nsols solution fields.
+ * \param info pointer toward the mirrormesh parameters structure (for the
+ * number of threads).
+ * \param filename name of the output file.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Save the solution fields at Medit ASCII format, in parallel as \ref
+ * MIRRORMESH_saveMesh (the vertices are numbered as in the mesh file).
+ *
+ **/
+int MIRRORMESH_saveAllSols(MMG5_pMesh mesh,MMG5_pSol sol,MIRRORMESH_pInfo info,
+                           const char *filename);
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param info pointer toward the mirrormesh parameters structure (for the
+ * number of threads).
+ * \param filename name of the input file.
+ *
+ * \return 1 if success, 0 if the file is not found, -1 if fail.
+ *
+ * Read a mesh at Medit ASCII format. The file is mapped in memory and its
+ * numeric sections are parsed in parallel by line-aligned chunks. The mesh
+ * is filled as by \a MMG3D_loadMesh (vertices, tetrahedra, triangles, edges,
+ * references, corners, ridges, required entities and normals at the
+ * vertices). The tangents at the vertices, that Mmg doesn't read, are stored
+ * in \a info->tangent (a vector field replicated with the mesh, to free by
+ * \ref MIRRORMESH_Free_tangents). Files with other sections (prisms...) or in
+ * binary format are read by \a MMG3D_loadMesh.
+ *
+ **/
+int MIRRORMESH_loadMesh(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                        const char *filename);
+
+/**
+ * \param mesh pointer toward the mesh structure (for memory accounting).
+ * \param info pointer toward the mirrormesh parameters structure.
+ *
+ * \return 1.
+ *
+ * Free the tangents read with the mesh by \ref MIRRORMESH_loadMesh.
+ *
+ **/
+int MIRRORMESH_Free_tangents(MMG5_pMesh mesh,MIRRORMESH_pInfo info);
+
+/**
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param filename name of the output file.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the measures of the phases of the last replication (see \ref
+ * MIRRORMESH_Get_stats) in a JSON file: the parameters of the replication
+ * and one object per phase that has run.
+ *
+ **/
+int MIRRORMESH_saveStats(MIRRORMESH_pInfo info,const char *filename);
+
+/**
+ * \param mesh pointer toward a mesh structure holding the verbosity and the
+ * memory options of the run (its mesh is not used).
+ * \param info pointer toward the mirrormesh parameters structure.
+ * \param filename name of the batch file.
+ *
+ * \return 1 if success, 0 if a job (or the reading of the batch) failed.
+ *
+ * Run the replications listed in a batch file, one job "input nx ny nz
+ * output" per line, the end of a line from a '#' being ignored. Each distinct
+ * input mesh is loaded once and the part of the replication that only
+ * depends on it (renumbering, interface points and entities) is shared by
+ * its jobs. The outputs are written on the fly as \ref
+ * MIRRORMESH_saveLattice does, \a info->njobs jobs at once (see \ref
+ * MIRRORMESH_IPARAM_njobs), each one with a share of the threads and of the
+ * memory left by the input meshes (the memory limit of \a mesh being the one
+ * of the whole run). The other parameters of \a info apply to all the jobs;
+ * the fields and the extension of a previous replication are not available
+ * in batch mode.
+ *
+ **/
+int MIRRORMESH_runBatch(MMG5_pMesh mesh,MIRRORMESH_pInfo info,
+                        const char *filename);
+
 
 #if defined(c_plusplus) || defined(__cplusplus)
 }
@@ -31,8 +31,169 @@
 #ifndef _LIBMIRRORMESHTYPES_H
 #define _LIBMIRRORMESHTYPES_H
 
+#include <stdint.h>
+#include <inttypes.h>
+
 #include "mmg/mmg3d/libmmgtypes.h"
 #include "mirrormeshversion.h"
 
+/**
+ * \typedef MIRRORMESH_int
+ * \brief Index and number of entities of a replicated mesh.
+ *
+ * A lattice of copies of a small base mesh may hold more than 2^31 entities:
+ * the indices of the replicated mesh are 64-bit integers. The indices of the
+ * base mesh, and of a replicated mesh built in memory, keep the integer type
+ * of the Mmg mesh.
+ */
+typedef int64_t MIRRORMESH_int;
+
+/** printf format of a \ref MIRRORMESH_int */
+#define MIRRORMESH_PRId PRId64
+
+/** Maximal number of previous replications extended by a replication (see
+ * \ref MIRRORMESH_Add_stage) */
+#define MIRRORMESH_NSTAGE 16
+
+/**
+ * \enum MIRRORMESH_Param
+ * \brief Input parameters for the mirrormesh library.
+ *
+ * Input parameters for the mirrormesh library. Options prefixed by \a
+ * MIRRORMESH_IPARAM asks for integers values, options prefixed by \a
+ * MIRRORMESH_DPARAM asks for real values.
+ *
+ */
+enum MIRRORMESH_Param {
+  MIRRORMESH_IPARAM_nx,              /*!< [n], Number of mirrors along x-axis */
+  MIRRORMESH_IPARAM_ny,              /*!< [n], Number of mirrors along y-axis */
+  MIRRORMESH_IPARAM_nz,              /*!< [n], Number of mirrors along z-axis */
+  MIRRORMESH_IPARAM_nthreads,        /*!< [n], Number of threads (0: runtime default) */
+  MIRRORMESH_IPARAM_renum,           /*!< [1/0], Turn on/off the locality-aware renumbering (off by default) */
+  MIRRORMESH_IPARAM_adja,            /*!< [1/0], Build the adjacency of the replicated tetra */
+  MIRRORMESH_IPARAM_modex,           /*!< [MIRRORMESH_Mode], Replication mode along x-axis */
+  MIRRORMESH_IPARAM_modey,           /*!< [MIRRORMESH_Mode], Replication mode along y-axis */
+  MIRRORMESH_IPARAM_modez,           /*!< [MIRRORMESH_Mode], Replication mode along z-axis */
+  MIRRORMESH_IPARAM_njobs,           /*!< [n], Number of jobs of a batch run concurrently (0: as many as threads) */
+  MIRRORMESH_IPARAM_tile,            /*!< [n/-1], Size in kB of the tiles of base elements replicated together (0: default, -1: no tiling) */
+  MIRRORMESH_IPARAM_int32max,        /*!< [n], Largest index written with 32-bit integers, the 64-bit formats being used beyond (0: 2^31-1, lower values to test these formats) */
+  MIRRORMESH_DPARAM_weldTol,         /*!< [val], Tolerance (relative to the bounding box) to weld points */
+};
+
+/**
+ * \enum MIRRORMESH_Mode
+ * \brief Replication mode along an axis.
+ */
+enum MIRRORMESH_Mode {
+  MIRRORMESH_MIRROR,    /*!< Each copy is the mirror image of the previous one (default) */
+  MIRRORMESH_TRANSLATE, /*!< Each copy is the previous one translated by the size of the bounding box (periodic tiling) */
+};
+
+/**
+ * \enum MIRRORMESH_Layout
+ * \brief Layout of the arrays exchanged with \ref
+ * MIRRORMESH_Init_latticeArrays, \ref MIRRORMESH_Get_latticeArrays and \ref
+ * MIRRORMESH_Get_latticeChunks.
+ */
+enum MIRRORMESH_Layout {
+  MIRRORMESH_AOS, /*!< Entity by entity: x1 y1 z1 x2 y2 z2 ... (C arrays c[n][3]) */
+  MIRRORMESH_SOA, /*!< Component by component: x1 x2 ... y1 y2 ... z1 z2 ... (Fortran arrays c(n,3)) */
+};
+
+/**
+ * \enum MIRRORMESH_IndexSize
+ * \brief Integer type of the connectivity arrays exchanged with the library.
+ */
+enum MIRRORMESH_IndexSize {
+  MIRRORMESH_INDEX32, /*!< 32-bit indices (int32_t, INTEGER) */
+  MIRRORMESH_INDEX64, /*!< 64-bit indices (int64_t, INTEGER(KIND=8)) */
+};
+
+/**
+ * \enum MIRRORMESH_Phase
+ * \brief Phases of a replication, measured in \ref MIRRORMESH_Stats.
+ */
+enum MIRRORMESH_Phase {
+  MIRRORMESH_PHASE_load,      /*!< Reading of the base mesh (application only) */
+  MIRRORMESH_PHASE_preflight, /*!< Packing of the base mesh, numbering of the lattice and allocation */
+  MIRRORMESH_PHASE_points,    /*!< Point mirroring and welding */
+  MIRRORMESH_PHASE_cells,     /*!< Element mirroring (and adjacency) */
+  MIRRORMESH_PHASE_save,      /*!< Writing of the replicated mesh (application only) */
+  MIRRORMESH_NPHASE
+};
+
+/**
+ * \struct MIRRORMESH_PhaseStats
+ * \brief Measures of a phase of the replication.
+ */
+typedef struct {
+  double         wall; /*!< wall-clock time (s) */
+  double         cpu; /*!< CPU time of the process, user and system, all threads included (s) */
+  size_t         rss; /*!< peak resident set size of the process at the end of the phase (bytes) */
+  size_t         drss; /*!< growth of the peak resident set size during the phase (bytes) */
+  size_t         mem; /*!< memory allocated for the mesh at the end of the phase (bytes) */
+  long long      dmem; /*!< memory allocated (or freed if negative) for the mesh during the phase (bytes) */
+  MIRRORMESH_int np; /*!< number of points at the end of the phase */
+  MIRRORMESH_int ne; /*!< number of tetra at the end of the phase */
+  MIRRORMESH_int nt; /*!< number of triangles at the end of the phase */
+  MIRRORMESH_int na; /*!< number of edges at the end of the phase */
+  MIRRORMESH_int nweld; /*!< number of welded vertices (images of base points shared with a previous copy) */
+  int            done; /*!< 1 if the phase has run */
+} MIRRORMESH_PhaseStats;
+
+/**
+ * \struct MIRRORMESH_Stats
+ * \brief Measures of the phases of the last replication (see \ref
+ * MIRRORMESH_Get_stats).
+ */
+typedef struct {
+  MIRRORMESH_PhaseStats phase[MIRRORMESH_NPHASE]; /*!< measures of each phase (\ref MIRRORMESH_Phase) */
+} MIRRORMESH_Stats;
+typedef MIRRORMESH_Stats * MIRRORMESH_pStats;
+
+/**
+ * \struct MIRRORMESH_Info
+ * \brief Store the parameters of the mirroring.
+ */
+typedef struct {
+  double weldTol; /*!< tolerance, relative to the bounding box size, to weld points */
+  int nmir[3]; /*!< number of mirrors along each direction */
+  int mode[3]; /*!< replication mode along each direction (\ref MIRRORMESH_Mode) */
+  int nthreads; /*!< number of threads (0 to let the runtime choose) */
+  int njobs; /*!< number of jobs of a batch run concurrently (0: as many as threads) */
+  int tile; /*!< size in kB of the tiles of base elements (0: \ref MIRRORMESH_TILE, -1: no tiling) */
+  int int32max; /*!< largest index written with 32-bit integers (0: 2^31-1) */
+  int renum; /*!< 1 to renumber the base mesh and order the copies along a space-filling curve */
+  int adja; /*!< 1 to build the adjacency of the replicated tetra from the base one */
+  int nstage; /*!< number of previous replications extended by this one */
+  int stage[MIRRORMESH_NSTAGE][3]; /*!< numbers of mirrors of the previous replications, from the smallest */
+  int stream; /*!< application only: write the replicated mesh on the fly */
+  int nparts; /*!< application only: number of partitions written on the fly (0: none) */
+  int dryrun; /*!< application only: print the sizes of the replicated mesh */
+  char *statsname; /*!< application only: file in which the measures are written (JSON) */
+  char *growname; /*!< application only: previous replicated mesh extended by this one */
+  char *batchname; /*!< application only: file listing the replications to run (see \ref MIRRORMESH_runBatch) */
+  MMG5_pSol tangent; /*!< tangents at the vertices read with the mesh, replicated with it (see \ref MIRRORMESH_loadMesh, NULL if none) */
+  MIRRORMESH_Stats stats; /*!< measures of the phases of the last replication */
+} MIRRORMESH_Info;
+typedef MIRRORMESH_Info * MIRRORMESH_pInfo;
+
+/**
+ * \brief Handle toward a replicated mesh that is not materialised (see \ref
+ * MIRRORMESH_Init_lattice).
+ */
+typedef struct MIRRORMESH_Lattice * MIRRORMESH_pLattice;
+
+/**
+ * \brief Receiver of the chunks of the replicated mesh (see \ref
+ * MIRRORMESH_Get_latticeChunks): \a n entities of type \a type (\ref
+ * MMG5_entities), the first one being the entity \a kstart of the replicated
+ * mesh. \a data holds the coordinates (doubles) or the vertices (indices) of
+ * the entities, \a refs their references. It returns 0 to stop the output.
+ */
+typedef int (*MIRRORMESH_Sink)(void *user,int type,MIRRORMESH_int kstart,
+                               MIRRORMESH_int n,const void *data,
+                               const int *refs);
+
 
 #endif
@@ -34,6 +34,16 @@
 
 mytime         MMG5_ctim[TIMEMAX];
 
+/** Free the solution fields, the tangents read with the mesh and the Mmg
+ * structures and return \a val */
+#define MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,info,val) do { \
+    if ( sol ) {                                                        \
+      MMG3D_Free_allSols(mesh,&sol);                                    \
+    }                                                                   \
+    MIRRORMESH_Free_tangents(mesh,info);                                \
+    MMG5_RETURN_AND_FREE(mesh,met,ls,disp,val);                         \
+  }while(0)
+
 /**
  *
  * Print elapsed time at end of process.
@@ -55,15 +65,42 @@ int MIRRORMESH_usage(char *prog) {
   fprintf(stdout,"-h        Print this message\n");
   fprintf(stdout,"-v [n]    Tune level of verbosity, [-1..10]\n");
   fprintf(stdout,"-m [n]    Set maximal memory size to n Mbytes\n");
+  fprintf(stdout,"-nt [n]   Number of threads (default is the OpenMP default)\n");
 
   fprintf(stdout,"\n**  File specifications\n");
   fprintf(stdout,"-in  file  input triangulation\n");
   fprintf(stdout,"-out file  output triangulation\n");
+  fprintf(stdout,"-sol file  input solution fields (metric, scalar, vector or\n"
+          "           tensor fields at the vertices) to replicate with the mesh\n");
+  fprintf(stdout,"-stream    write the output mesh on the fly, without building it\n"
+          "           (Medit and Gmsh ASCII formats only)\n");
+  fprintf(stdout,"-nparts n  write the output mesh on the fly in n files of blocks\n"
+          "           of copies, with their communicators (Medit ASCII format)\n");
+  fprintf(stdout,"-stats file  write the time, memory and sizes of each phase in\n"
+          "           file (JSON)\n");
+  fprintf(stdout,"-grow file  extend the replicated mesh file (written with\n"
+          "           -stream or -grow, with its .mirror description) to the\n"
+          "           new numbers of mirrors: only the new copies are generated\n");
+  fprintf(stdout,"-batch file  run the replications listed in file, one job\n"
+          "           \"input nx ny nz output\" per line ('#' starts a comment):\n"
+          "           each input mesh is loaded once for all its jobs\n");
+  fprintf(stdout,"-jobs n    number of jobs of a batch run concurrently (default\n"
+          "           is the number of threads)\n");
+  fprintf(stdout,"-dry-run   print the size of the output mesh and the mesh\n"
+          "           memory accounted to build it (as for -m), without\n"
+          "           building it\n");
 
   fprintf(stdout,"\n**  Parameters\n");
   fprintf(stdout,"-nx       Number of mirrors along x-axis (default is 1) \n");
   fprintf(stdout,"-ny       Number of mirrors along y-axis (default is 1) \n");
   fprintf(stdout,"-nz       Number of mirrors along z-axis (default is 1) \n");
+  fprintf(stdout,"-tol val  Tolerance to weld points on symmetry planes, relative\n"
+          "          to the bounding box size (default is 1e-8) \n");
+  fprintf(stdout,"-periodic axes  Translate the mesh instead of mirroring it along\n"
+          "          the given axes (e.g. xz); the base mesh must be periodic\n"
+          "          along these axes\n");
+  fprintf(stdout,"-rn [n]   Turn on or off the locality-aware renumbering [1/0]"
+          " (default is 0)\n");
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -71,9 +108,9 @@ int MIRRORMESH_usage(char *prog) {
 
 
 int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
-                      MMG5_pSol met,MMG5_pSol ls,int *nx, int *ny, int *nz) {
+                      MMG5_pSol met,MMG5_pSol ls,MIRRORMESH_pInfo info) {
   MMG5_pSol tmp = NULL;
-  int     i;
+  int     i,j;
   char    namein[128];
 
   /* Second step: read all other arguments. */
@@ -85,6 +122,53 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
         MIRRORMESH_usage(argv[0]);
         return 0;
 
+      case 'b':
+        if ( !strcmp(argv[i],"-batch") ) {
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            info->batchname = argv[i];
+          }
+          else {
+            fprintf(stderr,"Missing filname for %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
+
+      case 'd':
+        if ( !strcmp(argv[i],"-dry-run") ) {
+          info->dryrun = 1;
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
+
+      case 'g':
+        if ( !strcmp(argv[i],"-grow") ) {
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            info->growname = argv[i];
+          }
+          else {
+            fprintf(stderr,"Missing filname for %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
+
       case 'h':
         MIRRORMESH_usage(argv[0]);
         return 0;
@@ -108,6 +192,25 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
         }
         break;
 
+      case 'j':
+        if ( !strcmp(argv[i],"-jobs") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_njobs,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unexpected argument option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
+
       case 'm':
         if ( !strcmp(argv[i],"-m") ) {
           /* memory */
@@ -130,7 +233,8 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
       case 'n':
         if ( !strcmp(argv[i],"-nx") ) {
           if ( ++i < argc && isdigit(argv[i][0]) ) {
-            *nx = atoi(argv[i]);
+            if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_nx,atoi(argv[i])) )
+              return 0;
           }
           else if ( i == argc ) {
             fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
@@ -146,7 +250,8 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
         }
         else if ( !strcmp(argv[i],"-ny") ) {
           if ( ++i < argc && isdigit(argv[i][0]) ) {
-            *ny = atoi(argv[i]);
+            if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_ny,atoi(argv[i])) )
+              return 0;
           }
           else if ( i == argc ) {
             fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
@@ -162,7 +267,8 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
         }
         else if ( !strcmp(argv[i],"-nz") ) {
           if ( ++i < argc && isdigit(argv[i][0]) ) {
-            *nz = atoi(argv[i]);
+            if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_nz,atoi(argv[i])) )
+              return 0;
           }
           else if ( i == argc ) {
             fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
@@ -176,6 +282,27 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
             return 0;
           }
         }
+        else if ( !strcmp(argv[i],"-nparts") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) && atoi(argv[i]) > 0 ) {
+            info->nparts = atoi(argv[i]);
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else if ( !strcmp(argv[i],"-nt") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_nthreads,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
         else {
           fprintf(stderr,"Unexpected argument option %s\n",argv[i]);
           MIRRORMESH_usage(argv[0]);
@@ -201,6 +328,95 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
           return 0;
         }
         break;
+      case 'p':
+        if ( !strcmp(argv[i],"-periodic") ) {
+          if ( ++i < argc && argv[i][0] && strspn(argv[i],"xyz")==strlen(argv[i]) ) {
+            for ( j=0; argv[i][j]; j++ ) {
+              if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_modex+argv[i][j]-'x',
+                                              MIRRORMESH_TRANSLATE) )
+                return 0;
+            }
+          }
+          else {
+            fprintf(stderr,"Missing or invalid axes for %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
+      case 'r':
+        if ( !strcmp(argv[i],"-rn") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MIRRORMESH_Set_iparameter(info,MIRRORMESH_IPARAM_renum,atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
+
+      case 's':
+        if ( !strcmp(argv[i],"-sol") ) {
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            if ( !MMG3D_Set_inputSolName(mesh,met,argv[i]) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing filname for %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else if ( !strcmp(argv[i],"-stream") ) {
+          info->stream = 1;
+        }
+        else if ( !strcmp(argv[i],"-stats") ) {
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            info->statsname = argv[i];
+          }
+          else {
+            fprintf(stderr,"Missing filname for %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
+      case 't':
+        if ( !strcmp(argv[i],"-tol") ) {
+          if ( ++i < argc && (isdigit(argv[i][0]) || argv[i][0]=='.') ) {
+            if ( !MIRRORMESH_Set_dparameter(info,MIRRORMESH_DPARAM_weldTol,atof(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MIRRORMESH_usage(argv[0]);
+            return 0;
+          }
+        }
+        else {
+          fprintf(stderr,"Unrecognized option %s\n",argv[i]);
+          MIRRORMESH_usage(argv[0]);
+          return 0;
+        }
+        break;
       case 'v':
         if ( ++i < argc ) {
           if ( isdigit(argv[i][0]) ||
@@ -256,6 +472,9 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
       return 0;
   }
 
+  /* The meshes of a batch are the ones of its jobs */
+  if ( info->batchname ) return 1;
+
   if ( mesh->namein == NULL ) {
     fprintf(stdout,"  -- INPUT MESH NAME ?\n");
     fflush(stdin);
@@ -284,9 +503,12 @@ int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh mesh,
  */
 int main(int argc,char *argv[]) {
 
-  MMG5_pMesh      mesh;
-  MMG5_pSol       sol,met,disp,ls;
-  int             ier,ierSave,fmtin,fmtout;
+  MMG5_pMesh            mesh;
+  MMG5_pSol             sol,met,disp,ls;
+  MIRRORMESH_Info       info;
+  MIRRORMESH_Chrono     phase;
+  MIRRORMESH_PhaseStats *ph;
+  int                   ier,ierSave,fmtin,fmtout;
   char            stim[32],*ptr;
 
   fprintf(stdout,"  -- MIRRORMESH, Release %s (%s) \n",
@@ -305,9 +527,11 @@ int main(int argc,char *argv[]) {
 
   /* assign default values */
   mesh = NULL;
+  sol  = NULL;
   met  = NULL;
   disp = NULL;
   ls   = NULL;
+  MIRRORMESH_Init_parameters(&info);
 
   MMG3D_Init_mesh(MMG5_ARG_start,
                   MMG5_ARG_ppMesh,&mesh,MMG5_ARG_ppMet,&met,
@@ -326,18 +550,29 @@ int main(int argc,char *argv[]) {
 
   /* Set default metric size */
   if ( !MMG3D_Set_solSize(mesh,met,MMG5_Vertex,0,MMG5_Scalar) )
-    MMG5_RETURN_AND_FREE(mesh,met,ls,disp,MMG5_STRONGFAILURE);
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
 
   /* command line */
-  int nx,ny,nz;
-  nx = ny = nz = 1;
-  if ( !MIRRORMESH_parsar(argc,argv,mesh,met,ls,&nx,&ny,&nz) )
+  if ( !MIRRORMESH_parsar(argc,argv,mesh,met,ls,&info) )
     return MMG5_STRONGFAILURE;
 
+  if ( info.batchname ) {
+    /** Replications listed in a file, sharing their base meshes */
+    if ( info.growname || info.nparts || met->namein ) {
+      fprintf(stderr,"\n  ## Error: the -grow, -nparts and -sol options are"
+              " not available in batch mode.\n");
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+    }
+    ier = MIRRORMESH_runBatch(mesh,&info,info.batchname);
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,
+                               ier ? MMG5_SUCCESS : MMG5_STRONGFAILURE);
+  }
+
   /* load data */
   if ( mesh->info.imprim >= 0 )
     fprintf(stdout,"\n  -- INPUT DATA\n");
   chrono(ON,&MMG5_ctim[1]);
+  MIRRORMESH_stats_start(mesh,&phase);
 
   /* read mesh/sol files */
   ptr   = MMG5_Get_filenameExt(mesh->namein);
@@ -346,24 +581,31 @@ int main(int argc,char *argv[]) {
   switch ( fmtin ) {
 
   case ( MMG5_FMT_GmshASCII ): case ( MMG5_FMT_GmshBinary ):
-    ier = MMG3D_loadMshMesh(mesh,sol,mesh->namein);
+    ier = MMG3D_loadMshMesh(mesh,met,mesh->namein);
     break;
 
   case ( MMG5_FMT_VtkVtu ):
-    ier = MMG3D_loadVtuMesh(mesh,sol,mesh->namein);
+    ier = MMG3D_loadVtuMesh(mesh,met,mesh->namein);
     break;
 
   case ( MMG5_FMT_VtkVtk ):
-    ier = MMG3D_loadVtkMesh(mesh,sol,mesh->namein);
+    ier = MMG3D_loadVtkMesh(mesh,met,mesh->namein);
     break;
 
-  case ( MMG5_FMT_MeditASCII ): case ( MMG5_FMT_MeditBinary ):
+  case ( MMG5_FMT_MeditASCII ):
+    if ( ptr ) {
+      /* Parallel reader (Mmg searches the .meshb/.mesh files otherwise) */
+      ier = MIRRORMESH_loadMesh(mesh,&info,mesh->namein);
+      break;
+    }
+    /* no break */
+  case ( MMG5_FMT_MeditBinary ):
     ier = MMG3D_loadMesh(mesh,mesh->namein);
     break;
 
   default:
     fprintf(stderr,"  ** I/O AT FORMAT %s NOT IMPLEMENTED.\n",MMG5_Get_formatName(fmtin) );
-    MMG5_RETURN_AND_FREE(mesh,met,ls,disp,MMG5_STRONGFAILURE);
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
   }
 
   if ( ier<1 ) {
@@ -371,7 +613,19 @@ int main(int argc,char *argv[]) {
       fprintf(stderr,"  ** %s  NOT FOUND.\n",mesh->namein);
       fprintf(stderr,"  ** UNABLE TO OPEN INPUT FILE.\n");
     }
-    MMG5_RETURN_AND_FREE(mesh,met,ls,disp,MMG5_STRONGFAILURE);
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+  }
+
+  /* read the solution fields */
+  if ( met->namein ) {
+    ier = MMG3D_loadAllSols(mesh,&sol,met->namein);
+    if ( ier<1 ) {
+      if ( ier==0 ) {
+        fprintf(stderr,"  ** %s  NOT FOUND.\n",met->namein);
+      }
+      fprintf(stderr,"  ** UNABLE TO READ THE SOLUTION FIELDS.\n");
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+    }
   }
 
   /* Check input data */
@@ -379,27 +633,136 @@ int main(int argc,char *argv[]) {
     if ( met->namein ) {
       fprintf(stdout,"  ## WARNING: MESH ADAPTATION UNAVAILABLE IN"
               " LAGRANGIAN MODE. METRIC IGNORED.\n");
-      MMG5_RETURN_AND_FREE(mesh,met,ls,disp,MMG5_STRONGFAILURE);
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
     }
   }
   else if ( mesh->info.iso ) {
      if ( ls == NULL || ls->m == NULL ) {
       fprintf(stderr,"\n  ## ERROR: NO ISOVALUE DATA.\n");
-      MMG5_RETURN_AND_FREE(mesh,met,ls,disp,MMG5_STRONGFAILURE);
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
     }
   }
 
+  MIRRORMESH_stats_stop(mesh,&phase,&info,MIRRORMESH_PHASE_load);
   chrono(OFF,&MMG5_ctim[1]);
   if ( mesh->info.imprim >= 0 ) {
     printim(MMG5_ctim[1].gdif,stim);
     fprintf(stdout,"  -- DATA READING COMPLETED.     %s\n",stim);
   }
 
-  ier = MIRRORMESH_mirror(mesh,nx,ny,nz);
+  /* Extension of a previous replication: same numbering for its copies */
+  if ( info.growname && !MIRRORMESH_loadGrowth(&info,info.growname) )
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+
+  if ( info.dryrun ) {
+    /** Print the sizes of the replicated mesh without building it */
+    MIRRORMESH_pLattice  lattice = NULL;
+    MIRRORMESH_Preflight pf;
+    int                  fit;
+
+    /* The sizes don't depend on the numbering: the base mesh is not copied
+     * to be renumbered, the memory is the one of a replication in place */
+    info.renum = 0;
+    if ( !MIRRORMESH_Init_latticeSols(mesh,met,sol,&info,&lattice) )
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+
+    MIRRORMESH_preflight(lattice,&pf,info.adja);
+    fit = MIRRORMESH_fitMesh(lattice,&pf,info.adja);
+    MIRRORMESH_Free_lattice(&lattice);
+
+    fprintf(stdout,"\n  -- DRY RUN\n");
+    fprintf(stdout,"     NUMBER OF VERTICES   %12" MIRRORMESH_PRId "\n",pf.np);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %12" MIRRORMESH_PRId "\n",pf.ne);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %12" MIRRORMESH_PRId "\n",pf.nt);
+    fprintf(stdout,"     NUMBER OF EDGES      %12" MIRRORMESH_PRId "\n",pf.na);
+    /* Memory accounted by Mmg for the mesh and its fields, not the resident
+     * memory of the process: once replicated, and at the peak of the
+     * replication (checked against -m) */
+    fprintf(stdout,"     ACCOUNTED MESH MEMORY %11zu MB (%zu bytes)\n",
+            pf.mem/MMG5_MILLION,pf.mem);
+    fprintf(stdout,"     PEAK MESH MEMORY      %11zu MB (%zu bytes,"
+            " %zu MB allowed)\n",(pf.mem+pf.work)/MMG5_MILLION,
+            pf.mem+pf.work,mesh->memMax/MMG5_MILLION);
+    fprintf(stdout,"     MEDIT OUTPUT SIZE    %12zu MB (estimated)\n",
+            pf.fsize/MMG5_MILLION);
+
+    if ( mesh->memMax && pf.mem + pf.work > mesh->memMax ) {
+      fprintf(stdout,"  ## Warning: the replicated mesh doesn't fit in the"
+              " allowed memory (see the -m option).\n");
+    }
+    if ( !fit ) {
+      fprintf(stdout,"  ## Warning: the replicated mesh is too large to be"
+              " built, it can only be streamed (see the -stream option).\n");
+    }
+
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_SUCCESS);
+  }
+
+  if ( info.stream || info.nparts || info.growname ) {
+    /** Write the replicated mesh on the fly, without building it */
+    MIRRORMESH_pLattice lattice = NULL;
+
+    chrono(ON,&MMG5_ctim[1]);
+    MIRRORMESH_stats_start(mesh,&phase);
+    if ( mesh->info.imprim > 0 )
+      fprintf(stdout,"\n  -- WRITING DATA FILE %s (STREAMING)\n",mesh->nameout);
+
+    if ( !MIRRORMESH_Init_latticeSols(mesh,met,sol,&info,&lattice) )
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+
+    if ( info.nparts ) {
+      /* One file per block of copies */
+      ierSave = ( !lattice->nsol || MMG3D_Set_outputSolName(mesh,met,"") ) &&
+        MIRRORMESH_saveLatticeParts(lattice,info.nparts,mesh->nameout,
+                                    lattice->nsol ? met->nameout : NULL);
+    }
+    else {
+      if ( info.growname ) {
+        /* Only the new copies are generated */
+        ierSave = MIRRORMESH_saveLatticeGrowth(lattice,info.growname,
+                                               mesh->nameout);
+      }
+      else {
+        ierSave = MIRRORMESH_saveLattice(lattice,mesh->nameout);
+      }
+      if ( ierSave && lattice->nsol ) {
+        /* All the fields are written in the same solution file */
+        ierSave = MMG3D_Set_outputSolName(mesh,met,"") &&
+          MIRRORMESH_saveLatticeSols(lattice,met->nameout);
+      }
+
+      /* Description of the replicated mesh, to extend it later */
+      ptr = MMG5_Get_filenameExt(mesh->nameout);
+      if ( ierSave && MMG5_Get_format(ptr,MMG5_FMT_MeditASCII) ==
+           MMG5_FMT_MeditASCII ) {
+        ierSave = MIRRORMESH_saveGrowth(lattice,mesh->nameout);
+      }
+    }
+
+    /* The sizes are the ones of the streamed mesh */
+    ph = MIRRORMESH_stats_stop(mesh,&phase,&info,MIRRORMESH_PHASE_save);
+    MIRRORMESH_Get_latticeSize(lattice,&ph->np,&ph->ne,&ph->nt,&ph->na);
+    MIRRORMESH_Free_lattice(&lattice);
+
+    if ( !ierSave )
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+
+    chrono(OFF,&MMG5_ctim[1]);
+    if ( mesh->info.imprim > 0 )
+      fprintf(stdout,"  -- WRITING COMPLETED\n");
+
+    if ( info.statsname && !MIRRORMESH_saveStats(&info,info.statsname) )
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_LOWFAILURE);
+
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_SUCCESS);
+  }
+
+  ier = MIRRORMESH_mirrorlibSols(mesh,met,sol,&info);
 
   if ( ier != MMG5_STRONGFAILURE ) {
     /** Save files at medit or Gmsh format */
     chrono(ON,&MMG5_ctim[1]);
+    MIRRORMESH_stats_start(mesh,&phase);
     if ( mesh->info.imprim > 0 )
       fprintf(stdout,"\n  -- WRITING DATA FILE %s\n",mesh->nameout);
 
@@ -415,10 +778,23 @@ int main(int argc,char *argv[]) {
     case ( MMG5_FMT_VtkVtk ):
       ierSave = MMG3D_saveVtkMesh(mesh,met,mesh->nameout);
       break;
+    case ( MMG5_FMT_MeditASCII ):
+      if ( ptr ) {
+        /* Parallel writer */
+        ierSave = MIRRORMESH_saveMesh(mesh,&info,mesh->nameout);
+        if ( !ierSave ) {
+          MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
+        }
+        if ( met && met->np ) {
+          ierSave = MMG3D_saveSol(mesh,met,met->nameout);
+        }
+        break;
+      }
+      /* No extension: let Mmg build the file name */
     default:
       ierSave = MMG3D_saveMesh(mesh,mesh->nameout);
       if ( !ierSave ) {
-        MMG5_RETURN_AND_FREE(mesh,met,ls,disp,MMG5_STRONGFAILURE);
+        MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
       }
       if ( met && met->np ) {
         ierSave = MMG3D_saveSol(mesh,met,met->nameout);
@@ -426,14 +802,24 @@ int main(int argc,char *argv[]) {
       break;
     }
 
+    if ( ierSave && sol ) {
+      /* Solution fields */
+      ierSave = MMG3D_Set_outputSolName(mesh,&sol[0],"") &&
+        MIRRORMESH_saveAllSols(mesh,sol,&info,sol[0].nameout);
+    }
+
     if ( !ierSave )
-      MMG5_RETURN_AND_FREE(mesh,met,ls,disp,MMG5_STRONGFAILURE);
+      MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_STRONGFAILURE);
 
+    MIRRORMESH_stats_stop(mesh,&phase,&info,MIRRORMESH_PHASE_save);
     chrono(OFF,&MMG5_ctim[1]);
     if ( mesh->info.imprim > 0 )
       fprintf(stdout,"  -- WRITING COMPLETED\n");
   }
 
+  if ( info.statsname && !MIRRORMESH_saveStats(&info,info.statsname) )
+    MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,MMG5_LOWFAILURE);
+
   /* free mem */
-  MMG5_RETURN_AND_FREE(mesh,met,ls,disp,ier);
+  MIRRORMESH_RETURN_AND_FREE(mesh,met,ls,disp,sol,&info,ier);
 }
@@ -35,14 +35,426 @@
 
 #include "mmg3d.h"
 #include "mirrormeshversion.h"
+#include "libmirrormeshtypes.h"
+#include <limits.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh,MMG5_pSol,MMG5_pSol,int*,int*,int* );
+/** Get the number of threads to use from the \a info structure */
+#ifdef _OPENMP
+#define MIRRORMESH_NTHREADS(info) \
+  ( ((info)->nthreads > 0) ? (info)->nthreads : omp_get_max_threads() )
+#else
+#define MIRRORMESH_NTHREADS(info) 1
+#endif
+
+/**
+ * \struct MIRRORMESH_Copy
+ * \brief Transformation that maps the base mesh on one copy of the lattice.
+ *
+ * Along axis \a i, the coordinate of the image of a point of coordinate \a x
+ * is \a sign[i] * \a x + \a shift[i].
+ */
+typedef struct {
+  double sign[3]; /*!< -1 along the directions in which the copy is reflected */
+  double shift[3]; /*!< translation applied after the reflection */
+  int    idx[3]; /*!< position of the copy in the lattice */
+  int    pos; /*!< position of the copy in the numbering of the entities */
+  int8_t dupmask; /*!< planes shared with the previous copies (see \ref MIRRORMESH_Interface) */
+  int8_t itfmask; /*!< planes shared with the previous or the next copies */
+  int8_t reorient; /*!< 1 if the copy has an odd number of reflections */
+  int8_t periodic; /*!< bit i set if the copies are translated along axis i */
+} MIRRORMESH_Copy;
+typedef MIRRORMESH_Copy * MIRRORMESH_pCopy;
+
+/** Bit of the plane that the copy of index \a idx along axis \a i shares
+ * with the previous copy (lower) or with the next one (upper), \a per being
+ * set if the copies are translated along this axis */
+#define MIRRORMESH_LOWER(per,i,idx) ( ((per) || !((idx)%2)) ? (i) : (i)+3 )
+#define MIRRORMESH_UPPER(per,i,idx) ( ((per) || !((idx)%2)) ? (i)+3 : (i) )
+
+/* Index of the face i of a tetra in its image in a copy */
+static inline
+int MIRRORMESH_face(MIRRORMESH_pCopy copy,int i) {
+  return ( copy->reorient && i > 1 ) ? 5-i : i;
+}
+
+/** Number of entities per chunk when writing an ASCII file in parallel */
+#define MIRRORMESH_CHUNK 8192
+
+/** Size (in bytes) of the tiles of base elements replicated together */
+#define MIRRORMESH_TILE (256*1024)
+
+/** Maximal length of a formatted real, integer, vertex line and cell line */
+#define MIRRORMESH_DBLLEN  32
+#define MIRRORMESH_INTLEN  21
+#define MIRRORMESH_VERTLEN (3*MIRRORMESH_DBLLEN+2*MIRRORMESH_INTLEN)
+#define MIRRORMESH_CELLLEN (10*MIRRORMESH_INTLEN)
+
+/** Largest number of entities of a mesh built in memory (integer type of the
+ * Mmg mesh, 64 bits if Mmg is built with 64-bit integers) */
+#ifdef MMG5_INTMAX
+#define MIRRORMESH_MESH_INTMAX ((MIRRORMESH_int)MMG5_INTMAX)
+#else
+#define MIRRORMESH_MESH_INTMAX ((MIRRORMESH_int)INT_MAX)
+#endif
+
+/** Largest index of the 32-bit variants of the output formats */
+#define MIRRORMESH_INT32MAX ((MIRRORMESH_int)INT32_MAX)
+
+/** Largest index written with the 32-bit variants of the output formats
+ * (lowered by \ref MIRRORMESH_IPARAM_int32max to test the 64-bit ones) */
+#define MIRRORMESH_INT32(info) \
+  ( ((info)->int32max > 0) ? (MIRRORMESH_int)(info)->int32max \
+    : MIRRORMESH_INT32MAX )
+
+/** Size (in bytes) of the chunks of a section parsed by one thread */
+#define MIRRORMESH_RDCHUNK (1<<20)
+
+/** Number of masks of planes of the bounding box (6 bits) */
+#define MIRRORMESH_NMASK 64
+
+/** Tags of the boundary entities lying on a symmetry plane that becomes
+ * interior to the replicated mesh */
+#define MIRRORMESH_PLANETAG (MG_BDY|MG_REF|MG_GEO|MG_NOM|MG_CRN)
+
+/**
+ * \struct MIRRORMESH_Interface
+ * \brief Base points lying on the boundary planes of the bounding box.
+ *
+ * Index \a i of the \a list and \a nlist arrays refers to the lower boundary
+ * along axis \a i, index \a i+3 to the upper boundary. Along the axes of
+ * translation, the points and the faces of the lower boundary are matched
+ * with the ones of the upper boundary.
+ */
+typedef struct {
+  double tol; /*!< absolute tolerance to consider that a point lies on a plane */
+  int8_t *face; /*!< face[k]: bit l is set if point k belongs to list l */
+  int    *list[6]; /*!< points lying on each plane */
+  int    nlist[6]; /*!< number of points lying on each plane */
+  int    *per[3]; /*!< per[i][k]: point matching k on the opposite plane along axis i (translation only) */
+  int    *fper[3]; /*!< pairs (4*k+j, 4*k'+j') of tetra faces matching on the opposite planes along axis i, sorted */
+  int    nfper[3]; /*!< number of pairs in fper[i] */
+} MIRRORMESH_Interface;
+typedef MIRRORMESH_Interface * MIRRORMESH_pInterface;
+
+/**
+ * \struct MIRRORMESH_Numbering
+ * \brief Numbering of the entities of one type over the lattice of copies.
+ *
+ * The entities of a copy are numbered after the entities of the copies that
+ * precede it in the numbering order (see \ref MIRRORMESH_Lattice), in the
+ * order of the base mesh, skipping the duplicated ones. If \a plane is set,
+ * the entities lying on a plane shared with a neighbouring copy (\a itfmask
+ * of the copy) are skipped, otherwise the entities lying on a plane shared
+ * with a previous copy (\a dupmask of the copy). For a mask of planes \a m,
+ * \a ndup[m][r] is the number of skipped entities among the \a r first
+ * interface entities. The prefix counts only depend on the base mesh and are
+ * computed on demand from \a face (see \ref MIRRORMESH_set_copies).
+ */
+typedef struct {
+  int nbase; /*!< number of entities of the base mesh */
+  int nitf; /*!< number of interface entities */
+  int plane; /*!< 1 if the entities lying on interior planes are skipped */
+  int *itf; /*!< sorted indices of the interface entities */
+  int8_t *face; /*!< planes shared by the vertices of each interface entity */
+  int *ndup[MIRRORMESH_NMASK]; /*!< prefix count of skipped interface entities */
+  MIRRORMESH_int *offset; /*!< offset[pos]: number of entities in the copies numbered before the copy at position pos */
+} MIRRORMESH_Numbering;
+typedef MIRRORMESH_Numbering * MIRRORMESH_pNumbering;
+
+/**
+ * \struct MIRRORMESH_Walk
+ * \brief Walk through the base entities of one copy, by increasing index
+ * (see \ref MIRRORMESH_walk_init and \ref MIRRORMESH_walk_next). The skipped
+ * entities and the indices of the images are found by following the sorted
+ * interface entities, without search nor access to the vertices.
+ */
+typedef struct {
+  MIRRORMESH_pNumbering num; /*!< numbering of the entity type */
+  int                   mask; /*!< mask of the planes of the copy */
+  int                   r; /*!< rank of the first interface entity not lower than the current entity */
+  MIRRORMESH_int        offset; /*!< index of the first entity of the copy minus one */
+} MIRRORMESH_Walk;
+typedef MIRRORMESH_Walk * MIRRORMESH_pWalk;
+
+/**
+ * \param w pointer toward the walk
+ * \param k index of the base entity, greater than the previous one
+ *
+ * \return the index of the image of the base entity \a k in the copy of the
+ * walk, 0 if the image is skipped.
+ */
+static inline
+MIRRORMESH_int MIRRORMESH_walk_next(MIRRORMESH_pWalk w,int k) {
+  MIRRORMESH_pNumbering num = w->num;
+
+  while ( w->r < num->nitf && num->itf[w->r] < k ) ++w->r;
+
+  if ( w->r < num->nitf && num->itf[w->r] == k &&
+       (num->face[w->r] & w->mask) ) {
+    return 0;
+  }
+  return w->offset + k - num->ndup[w->mask][w->r];
+}
+
+/**
+ * \struct MIRRORMESH_Buffer
+ * \brief Work buffers of \ref MIRRORMESH_writeSection, that may be kept
+ * from one section (or one replication) to the next one. They only grow and
+ * are released by \ref MIRRORMESH_free_buffer.
+ */
+typedef struct {
+  MIRRORMESH_int *cnt; /*!< prefix counts of the items of each chunk */
+  MIRRORMESH_int ncnt; /*!< size of \a cnt */
+  char           *out; /*!< formatted lines of the chunks */
+  size_t         nout; /*!< size of \a out (bytes) */
+  size_t         *len; /*!< length of the formatted lines of each chunk */
+  int            nlen; /*!< size of \a len */
+} MIRRORMESH_Buffer;
+typedef MIRRORMESH_Buffer * MIRRORMESH_pBuffer;
+
+/**
+ * \struct MIRRORMESH_Lattice
+ * \brief Closed-form description of the replicated mesh.
+ */
+struct MIRRORMESH_Lattice {
+  MMG5_pMesh           mesh; /*!< base mesh */
+  int                  dim; /*!< working dimension */
+  int                  nmir[3]; /*!< number of mirrors in each direction */
+  int                  mode[3]; /*!< replication mode in each direction */
+  int                  renum; /*!< 1 if the base mesh is renumbered and the copies ordered along a space-filling curve */
+  double               weldTol; /*!< relative tolerance used to weld the points */
+  int                  nstage; /*!< number of previous replications extended by the lattice */
+  int                  stage[MIRRORMESH_NSTAGE][3]; /*!< numbers of mirrors of the previous replications */
+  int                  ncopy; /*!< number of copies */
+  int                  nthreads; /*!< number of threads */
+  MIRRORMESH_int       int32max; /*!< largest index written with the 32-bit variants of the output formats */
+  MIRRORMESH_Copy      *copies; /*!< transformation of each copy */
+  MMG5_pSol            *sol; /*!< fields defined at the vertices of the base mesh */
+  int                  nsol; /*!< number of fields */
+  int                  nfld; /*!< number of fields replicated with the mesh: the \a nsol fields, then the tangents read with the mesh if any (see \ref MIRRORMESH_loadMesh) */
+  int                  *order; /*!< order[pos]: copy at position pos in the numbering */
+  MIRRORMESH_Interface itf; /*!< base points lying on the symmetry planes */
+  int                  *rank; /*!< rank[k]: number of interface points before k */
+  MIRRORMESH_Numbering point; /*!< numbering of the points */
+  MIRRORMESH_Numbering tetra; /*!< numbering of the tetra */
+  MIRRORMESH_Numbering tria; /*!< numbering of the triangles */
+  MIRRORMESH_Numbering edge; /*!< numbering of the edges */
+  MIRRORMESH_pBuffer   buf; /*!< work buffers reused by the writers (NULL: allocated for each section) */
+  int                  ownmesh; /*!< 1 if the base mesh is owned by the lattice (see \ref MIRRORMESH_Init_latticeArrays and \ref MIRRORMESH_copy_base) */
+  MMG5_pSol            solcopy; /*!< copies of the fields owned by the lattice with its base mesh (NULL if none) */
+};
+typedef struct MIRRORMESH_Lattice MIRRORMESH_Lattice;
+
+/**
+ * \struct MIRRORMESH_Preflight
+ * \brief Sizes of the replicated mesh, computed before building it.
+ */
+typedef struct {
+  MIRRORMESH_int np; /*!< number of points (duplicated points excluded) */
+  MIRRORMESH_int ne; /*!< number of tetra */
+  MIRRORMESH_int nt; /*!< number of triangles */
+  MIRRORMESH_int na; /*!< number of edges */
+  size_t         mem; /*!< memory used by the mesh once replicated, adjacency of the base mesh included (bytes) */
+  size_t         work; /*!< memory of the work arrays, added to \a mem at the peak of the replication (bytes) */
+  size_t         fsize; /*!< estimated size of the Medit ASCII output (bytes) */
+} MIRRORMESH_Preflight;
+typedef MIRRORMESH_Preflight * MIRRORMESH_pPreflight;
+
+/**
+ * \struct MIRRORMESH_Chrono
+ * \brief State of the process at the beginning of a measured phase (see \ref
+ * MIRRORMESH_stats_start).
+ */
+typedef struct {
+  double wall; /*!< wall-clock time (s) */
+  double cpu; /*!< CPU time of the process (s) */
+  size_t rss; /*!< peak resident set size of the process (bytes) */
+  size_t mem; /*!< memory allocated for the mesh (bytes) */
+} MIRRORMESH_Chrono;
+typedef MIRRORMESH_Chrono * MIRRORMESH_pChrono;
+
+/**
+ * \struct MIRRORMESH_Section
+ * \brief Description of a section of an ASCII mesh file (see \ref
+ * MIRRORMESH_writeSection).
+ *
+ * Items \a first+1 to \a n are visited in order. Skipped items are not part
+ * of the section numbering; among the other ones, only the selected items are
+ * written, \a format receiving their index in the numbering.
+ */
+typedef struct {
+  void           *data; /*!< context passed to the callbacks */
+  MIRRORMESH_int n; /*!< number of items */
+  MIRRORMESH_int first; /*!< number of leading items that are not visited (already written) */
+  MIRRORMESH_int offset; /*!< index of the first item minus one */
+  int            lmax; /*!< maximal length of the line of an item */
+  int            (*skip)(void*,MIRRORMESH_int); /*!< 1 if the item is skipped (NULL: none) */
+  int            (*select)(void*,MIRRORMESH_int); /*!< 1 if the item is written (NULL: all) */
+  int            (*format)(void*,MIRRORMESH_int,MIRRORMESH_int,char*); /*!< format an item, return its length */
+  MIRRORMESH_pBuffer buf; /*!< work buffers to reuse (NULL: allocated for the section) */
+} MIRRORMESH_Section;
+typedef MIRRORMESH_Section * MIRRORMESH_pSection;
+
+/** Sections of a Medit file handled by the parallel reader */
+enum MIRRORMESH_MeditSection {
+  MIRRORMESH_SEC_Vertices,
+  MIRRORMESH_SEC_Tetrahedra,
+  MIRRORMESH_SEC_Triangles,
+  MIRRORMESH_SEC_Edges,
+  MIRRORMESH_SEC_Corners,
+  MIRRORMESH_SEC_RequiredVertices,
+  MIRRORMESH_SEC_Ridges,
+  MIRRORMESH_SEC_RequiredEdges,
+  MIRRORMESH_SEC_RequiredTriangles,
+  MIRRORMESH_SEC_RequiredTetrahedra,
+  MIRRORMESH_SEC_Normals,
+  MIRRORMESH_SEC_NormalAtVertices,
+  MIRRORMESH_SEC_Tangents,
+  MIRRORMESH_SEC_TangentAtVertices,
+  MIRRORMESH_NSEC
+};
+
+/**
+ * \struct MIRRORMESH_MeditFile
+ * \brief Numeric sections of a Medit file mapped in memory.
+ */
+typedef struct {
+  const char *beg[MIRRORMESH_NSEC]; /*!< first character of the data of each section */
+  const char *end[MIRRORMESH_NSEC]; /*!< end of the data of each section */
+  int        n[MIRRORMESH_NSEC]; /*!< number of entities of each section */
+  char       *data; /*!< mapped file (see \ref MIRRORMESH_mapMedit) */
+  size_t     size; /*!< size of the mapped file */
+} MIRRORMESH_MeditFile;
+typedef MIRRORMESH_MeditFile * MIRRORMESH_pMeditFile;
+
+/**
+ * \struct MIRRORMESH_Growth
+ * \brief Description of a replicated mesh stored next to it, to extend it
+ * later (see \ref MIRRORMESH_saveGrowth).
+ */
+typedef struct {
+  int            nbase[4]; /*!< numbers of points, tetra, triangles and edges of the base mesh */
+  int            nmir[3]; /*!< number of mirrors in each direction */
+  int            mode[3]; /*!< replication mode in each direction */
+  int            renum; /*!< renumbering of the base mesh and of the copies */
+  double         weldTol; /*!< relative tolerance used to weld the points */
+  int            nstage; /*!< number of previous replications */
+  int            stage[MIRRORMESH_NSTAGE][3]; /*!< numbers of mirrors of the previous replications */
+  MIRRORMESH_int size[4]; /*!< numbers of points, tetra, triangles and edges of the replicated mesh */
+} MIRRORMESH_Growth;
+typedef MIRRORMESH_Growth * MIRRORMESH_pGrowth;
+
+int MIRRORMESH_parsar(int argc,char *argv[],MMG5_pMesh,MMG5_pSol,MMG5_pSol,MIRRORMESH_pInfo);
 int MIRRORMESH_usage( char * );
+int MIRRORMESH_Init_parameters(MIRRORMESH_pInfo info);
+int MIRRORMESH_Set_iparameter(MIRRORMESH_pInfo info,int iparam,int val);
+int MIRRORMESH_Set_dparameter(MIRRORMESH_pInfo info,int dparam,double val);
+int MIRRORMESH_Add_stage(MIRRORMESH_pInfo info,int nx,int ny,int nz);
+int MIRRORMESH_Get_stats(MIRRORMESH_pInfo info,MIRRORMESH_pStats stats);
 int MIRRORMESH_mirror(MMG5_pMesh mesh,int nx,int ny,int nz);
+int MIRRORMESH_mirrorlib(MMG5_pMesh mesh,MIRRORMESH_pInfo info);
+int MIRRORMESH_mirrorlibSols(MMG5_pMesh,MMG5_pSol,MMG5_pSol,MIRRORMESH_pInfo);
+int MIRRORMESH_preflight(MIRRORMESH_pLattice,MIRRORMESH_pPreflight,int);
+int MIRRORMESH_fitMesh(MIRRORMESH_pLattice,MIRRORMESH_pPreflight,int);
+int MIRRORMESH_Init_lattice(MMG5_pMesh,MIRRORMESH_pInfo,MIRRORMESH_pLattice*);
+int MIRRORMESH_Init_latticeSols(MMG5_pMesh,MMG5_pSol,MMG5_pSol,MIRRORMESH_pInfo,
+                                MIRRORMESH_pLattice*);
+int MIRRORMESH_Free_lattice(MIRRORMESH_pLattice*);
+int MIRRORMESH_Get_latticeSize(MIRRORMESH_pLattice,MIRRORMESH_int*,
+                               MIRRORMESH_int*,MIRRORMESH_int*,MIRRORMESH_int*);
+int MIRRORMESH_saveLattice(MIRRORMESH_pLattice,const char*);
+int MIRRORMESH_saveLatticeSols(MIRRORMESH_pLattice,const char*);
+int MIRRORMESH_saveLatticeParts(MIRRORMESH_pLattice,int,const char*,
+                                const char*);
+int MIRRORMESH_saveLatticeGrowth(MIRRORMESH_pLattice,const char*,const char*);
+int MIRRORMESH_loadGrowth(MIRRORMESH_pInfo,const char*);
+int MIRRORMESH_saveGrowth(MIRRORMESH_pLattice,const char*);
+int MIRRORMESH_saveMesh(MMG5_pMesh,MIRRORMESH_pInfo,const char*);
+int MIRRORMESH_saveAllSols(MMG5_pMesh,MMG5_pSol,MIRRORMESH_pInfo,const char*);
+int MIRRORMESH_loadMesh(MMG5_pMesh,MIRRORMESH_pInfo,const char*);
+int MIRRORMESH_Free_tangents(MMG5_pMesh,MIRRORMESH_pInfo);
+int MIRRORMESH_init_base(MMG5_pMesh,int);
+int MIRRORMESH_saveStats(MIRRORMESH_pInfo,const char*);
+int MIRRORMESH_runBatch(MMG5_pMesh,MIRRORMESH_pInfo,const char*);
+
+/* ASCII output */
+int MIRRORMESH_fmtInt(char*,MIRRORMESH_int);
+int MIRRORMESH_fmtDouble(char*,double);
+int MIRRORMESH_fmtVertex(char*,double[3],int);
+int MIRRORMESH_fmtCell(char*,int,MIRRORMESH_int*,MIRRORMESH_int);
+int MIRRORMESH_fmtSol(char*,MMG5_pSol,double*);
+int MIRRORMESH_fmtVector(char*,const double*);
+const double *MIRRORMESH_normal(MMG5_pMesh,int);
+const double *MIRRORMESH_tangent(MMG5_pMesh,MMG5_pSol,int);
+int MIRRORMESH_meditVersion(MIRRORMESH_int,MIRRORMESH_int);
+MIRRORMESH_int MIRRORMESH_writeSection(MMG5_pMesh,FILE*,const char*,
+                                       MIRRORMESH_pSection,int);
+void MIRRORMESH_free_buffer(MMG5_pMesh,MIRRORMESH_pBuffer);
+int MIRRORMESH_writeSols(MMG5_pMesh,FILE*,MIRRORMESH_int,MIRRORMESH_int,
+                         MMG5_pSol*,int,MIRRORMESH_pSection,int);
+
+/* Growth of a previous replication */
+int  MIRRORMESH_mapMedit(const char*,MIRRORMESH_pMeditFile,int);
+void MIRRORMESH_unmapMedit(MIRRORMESH_pMeditFile);
+int  MIRRORMESH_readGrowth(const char*,MIRRORMESH_pGrowth);
+
+/* Lattice */
+void MIRRORMESH_set_copy(MMG5_pMesh,int,int*,int*,int,MIRRORMESH_pCopy);
+int  MIRRORMESH_build_lattice(MMG5_pMesh,MMG5_pSol,MMG5_pSol,MIRRORMESH_pInfo,
+                              MIRRORMESH_pLattice);
+void MIRRORMESH_free_lattice(MIRRORMESH_pLattice);
+int  MIRRORMESH_copy_base(MMG5_pMesh,MMG5_pSol,MMG5_pSol,MMG5_pSol,
+                          MMG5_pMesh*,MMG5_pSol*);
+void MIRRORMESH_free_solCopy(MMG5_pMesh,MMG5_pSol*);
+int  MIRRORMESH_build_base(MMG5_pMesh,MMG5_pSol,MMG5_pSol,MIRRORMESH_pInfo,
+                           MIRRORMESH_pLattice);
+int  MIRRORMESH_set_copies(MIRRORMESH_pLattice,const int[3],
+                           MIRRORMESH_pLattice);
+void MIRRORMESH_free_copies(MIRRORMESH_pLattice);
+MIRRORMESH_int MIRRORMESH_lattice_point(MIRRORMESH_pLattice,int,int);
+int  MIRRORMESH_lattice_locate(MIRRORMESH_pLattice,MIRRORMESH_pNumbering,
+                               MIRRORMESH_int,int*);
+MIRRORMESH_int MIRRORMESH_lattice_index(MIRRORMESH_pLattice,
+                                        MIRRORMESH_pNumbering,int,int);
+void MIRRORMESH_walk_init(MIRRORMESH_pLattice,MIRRORMESH_pNumbering,int,int,
+                         MIRRORMESH_pWalk);
+void MIRRORMESH_lattice_coor(MIRRORMESH_pLattice,MIRRORMESH_pCopy,int,double[3]);
+void MIRRORMESH_lattice_sol(MIRRORMESH_pCopy,MMG5_pSol,int,double*);
+int  MIRRORMESH_lattice_skip(MIRRORMESH_pLattice,MIRRORMESH_pNumbering,int,int,
+                             int*);
+void MIRRORMESH_lattice_tetra(MIRRORMESH_pLattice,int,int,MIRRORMESH_int[4]);
+void MIRRORMESH_lattice_tria(MIRRORMESH_pLattice,int,int,MIRRORMESH_int[3]);
+void MIRRORMESH_lattice_edge(MIRRORMESH_pLattice,int,int,MIRRORMESH_int[2]);
+
+/* Reflection kernels */
+typedef void (*MIRRORMESH_Reflect)(MIRRORMESH_pCopy,int,int,const double*,int,
+                                   MMG5_pPoint);
+MIRRORMESH_Reflect MIRRORMESH_reflect_kernel(const char**);
+
+/* Instrumentation */
+void MIRRORMESH_stats_start(MMG5_pMesh,MIRRORMESH_pChrono);
+MIRRORMESH_PhaseStats *MIRRORMESH_stats_stop(MMG5_pMesh,MIRRORMESH_pChrono,
+                                             MIRRORMESH_pInfo,int);
+
+/* Renumbering */
+void MIRRORMESH_order_copies(MIRRORMESH_pLattice);
+int  MIRRORMESH_renum_base(MMG5_pMesh,MMG5_pSol*,int,int);
+
+/* Welding */
+int  MIRRORMESH_build_interfaces(MMG5_pMesh,int,int*,double,MIRRORMESH_pInterface);
+void MIRRORMESH_free_interfaces(MMG5_pMesh,MIRRORMESH_pInterface);
+int  MIRRORMESH_owner(int,int*,MIRRORMESH_pInterface,MIRRORMESH_pCopy,int*);
+int  MIRRORMESH_neighbour(int,int*,MIRRORMESH_pInterface,MIRRORMESH_pCopy,int8_t,
+                          int*);
+int  MIRRORMESH_sharing(int,int*,MIRRORMESH_pCopy,int8_t,int*);
 
 #ifdef __cplusplus
 }
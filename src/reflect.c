@@ -0,0 +1,128 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+
+/**
+ * \file reflect.c
+ * \brief Kernels transforming the coordinates of runs of points.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The coordinates of the base points are read as contiguous x, y and z
+ * streams and transformed by the affine map of a copy (a sign and a shift
+ * for each axis). The kernel is compiled for AVX-512 and AVX2 on x86 and
+ * picked at run time from the CPU features (see \ref
+ * MIRRORMESH_reflect_kernel), the portable version being used otherwise.
+ * The signs being +1 or -1, the products are exact and all the kernels give
+ * the same coordinates.
+ *
+ */
+#include "mirrormesh.h"
+
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER) && \
+  (defined(__x86_64__) || defined(__i386__))
+#define MIRRORMESH_X86_DISPATCH
+#define MIRRORMESH_INLINE static inline __attribute__((always_inline))
+#else
+#define MIRRORMESH_INLINE static inline
+#endif
+
+/**
+ * \param copy transformation of the copy
+ * \param dim working dimension
+ * \param n number of points of the run
+ * \param coor coordinates of the run: component i of the point j is
+ * coor[i*ld+j]
+ * \param ld leading dimension of \a coor
+ * \param ppt first point of the run in the replicated mesh, holding a copy of
+ * the base points
+ *
+ * Compute the coordinates of the images of a run of base points and reflect
+ * their normals.
+ *
+ */
+MIRRORMESH_INLINE
+void MIRRORMESH_reflect_run(MIRRORMESH_pCopy copy,int dim,int n,
+                            const double *restrict coor,int ld,
+                            MMG5_pPoint restrict ppt) {
+  int i,j;
+
+  for ( i=0; i<dim; ++i ) {
+    const double *restrict x = &coor[(size_t)i*ld];
+    const double           s = copy->sign[i];
+    const double           t = copy->shift[i];
+
+#pragma omp simd
+    for ( j=0; j<n; ++j ) {
+      ppt[j].c[i] = s*x[j] + t;
+      ppt[j].n[i] = s*ppt[j].n[i];
+    }
+  }
+}
+
+static void MIRRORMESH_reflect_generic(MIRRORMESH_pCopy copy,int dim,int n,
+                                       const double *coor,int ld,
+                                       MMG5_pPoint ppt) {
+  MIRRORMESH_reflect_run(copy,dim,n,coor,ld,ppt);
+}
+
+#ifdef MIRRORMESH_X86_DISPATCH
+__attribute__((target("avx2,fma")))
+static void MIRRORMESH_reflect_avx2(MIRRORMESH_pCopy copy,int dim,int n,
+                                    const double *coor,int ld,
+                                    MMG5_pPoint ppt) {
+  MIRRORMESH_reflect_run(copy,dim,n,coor,ld,ppt);
+}
+
+__attribute__((target("avx512f")))
+static void MIRRORMESH_reflect_avx512(MIRRORMESH_pCopy copy,int dim,int n,
+                                      const double *coor,int ld,
+                                      MMG5_pPoint ppt) {
+  MIRRORMESH_reflect_run(copy,dim,n,coor,ld,ppt);
+}
+#endif
+
+/**
+ * \param name pointer toward the name of the kernel (may be NULL)
+ *
+ * \return the reflection kernel for the instruction sets of the CPU.
+ *
+ */
+MIRRORMESH_Reflect MIRRORMESH_reflect_kernel(const char **name) {
+
+#ifdef MIRRORMESH_X86_DISPATCH
+  __builtin_cpu_init();
+  if ( __builtin_cpu_supports("avx512f") ) {
+    if ( name ) *name = "avx512";
+    return MIRRORMESH_reflect_avx512;
+  }
+  if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ) {
+    if ( name ) *name = "avx2";
+    return MIRRORMESH_reflect_avx2;
+  }
+#endif
+
+  if ( name ) *name = "generic";
+  return MIRRORMESH_reflect_generic;
+}
@@ -0,0 +1,542 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file renum.c
+ * \brief Locality-aware numbering of the replicated mesh.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The replicated mesh is never renumbered as a whole: the base mesh is
+ * renumbered once (by SCOTCH if available, along a Hilbert curve otherwise)
+ * and the copies are numbered one after the other along a Hilbert curve over
+ * the lattice of copies, so consecutive copies share a symmetry plane.
+ *
+ */
+#include "mirrormesh.h"
+
+#ifdef USE_SCOTCH
+#include <scotch.h>
+#endif
+
+/** Number of bits per axis of the Hilbert keys of the base points */
+#define MIRRORMESH_HILBERT_BITS 21
+
+/**
+ * \param x coordinates of the cell (modified)
+ * \param nbits number of bits per coordinate
+ *
+ * \return the index of the cell along the 3D Hilbert curve of order \a nbits
+ * starting at the origin.
+ *
+ * Skilling's algorithm (AIP Conf. Proc. 707, 2004): the coordinates are
+ * transformed in place into the transposed Hilbert index, whose bits are then
+ * interleaved.
+ *
+ */
+static
+uint64_t MIRRORMESH_hilbertKey(uint32_t x[3],int nbits) {
+  uint32_t m,p,q,t;
+  uint64_t key;
+  int      i,j;
+
+  m = 1u << (nbits-1);
+
+  /* Inverse undo */
+  for ( q=m; q>1; q>>=1 ) {
+    p = q-1;
+    for ( i=0; i<3; ++i ) {
+      if ( x[i] & q ) {
+        x[0] ^= p;
+      }
+      else {
+        t     = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  /* Gray encode */
+  for ( i=1; i<3; ++i ) {
+    x[i] ^= x[i-1];
+  }
+  t = 0;
+  for ( q=m; q>1; q>>=1 ) {
+    if ( x[2] & q ) t ^= q-1;
+  }
+  for ( i=0; i<3; ++i ) {
+    x[i] ^= t;
+  }
+
+  /* Interleave the bits of the transposed index */
+  key = 0;
+  for ( j=nbits-1; j>=0; --j ) {
+    for ( i=0; i<3; ++i ) {
+      key = (key << 1) | ((x[i] >> j) & 1);
+    }
+  }
+  return key;
+}
+
+/** Sort keys of the entities: key first, then index (stable order) */
+typedef struct {
+  uint64_t key;
+  int      idx;
+} MIRRORMESH_Key;
+
+static int MIRRORMESH_cmpKey(const void *a,const void *b) {
+  const MIRRORMESH_Key *ka = (const MIRRORMESH_Key*)a;
+  const MIRRORMESH_Key *kb = (const MIRRORMESH_Key*)b;
+
+  if ( ka->key != kb->key ) return ka->key < kb->key ? -1 : 1;
+  return ka->idx - kb->idx;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param copy copy of the lattice
+ *
+ * \return the first previous replication of the lattice that contains the
+ * copy (\a lat->nstage if none does).
+ *
+ */
+static inline
+int MIRRORMESH_copyStage(MIRRORMESH_pLattice lat,MIRRORMESH_pCopy copy) {
+  int s,i;
+
+  for ( s=0; s<lat->nstage; ++s ) {
+    for ( i=0; i<lat->dim; ++i ) {
+      if ( copy->idx[i] > lat->stage[s][i] ) break;
+    }
+    if ( i == lat->dim ) break;
+  }
+  return s;
+}
+
+/**
+ * \param lat pointer toward the lattice (copies already computed)
+ *
+ * Order the copies along a Hilbert curve over the lattice of copies (or in
+ * the lattice order if \a lat->renum is not set). The curve starts at the
+ * base mesh, so the copy 0 is always numbered first.
+ *
+ * If the lattice extends previous replications, the copies of each previous
+ * lattice are numbered before the new ones, in the order they had in this
+ * lattice: the points and the tetra of the previous replications keep their
+ * indices.
+ *
+ */
+void MIRRORMESH_order_copies(MIRRORMESH_pLattice lat) {
+  MIRRORMESH_pCopy copy;
+  MIRRORMESH_Key   *keys;
+  uint32_t         x[3];
+  int              cnt[MIRRORMESH_NSTAGE+2];
+  int              *box,i,s,icopy,nbits,nmax,lin;
+
+  /* Lattice order if the keys can't be allocated */
+  for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+    lat->order[icopy]       = icopy;
+    lat->copies[icopy].pos = icopy;
+  }
+  MMG5_ADD_MEM(lat->mesh,(size_t)lat->ncopy*sizeof(MIRRORMESH_Key),
+               "copy keys",return);
+  MMG5_SAFE_MALLOC(keys,lat->ncopy,MIRRORMESH_Key,return);
+
+  /* Copies sorted by previous replication (counting sort) */
+  memset(cnt,0,sizeof(cnt));
+  for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+    ++cnt[MIRRORMESH_copyStage(lat,&lat->copies[icopy])+1];
+  }
+  for ( s=0; s<=lat->nstage; ++s ) {
+    cnt[s+1] += cnt[s];
+  }
+
+  for ( icopy=0; icopy<lat->ncopy; ++icopy ) {
+    copy = &lat->copies[icopy];
+    s    = MIRRORMESH_copyStage(lat,copy);
+    box  = s < lat->nstage ? lat->stage[s] : lat->nmir;
+
+    /* Key in the lattice of the replication, whatever the next ones */
+    if ( lat->renum ) {
+      nmax = 1;
+      for ( i=0; i<lat->dim; ++i ) {
+        nmax = MG_MAX(nmax,box[i]+1);
+      }
+      nbits = 1;
+      while ( (1 << nbits) < nmax ) ++nbits;
+
+      for ( i=0; i<3; ++i ) {
+        x[i] = i < lat->dim ? copy->idx[i] : 0;
+      }
+      keys[cnt[s]].key = MIRRORMESH_hilbertKey(x,nbits);
+    }
+    else {
+      lin = 0;
+      for ( i=lat->dim-1; i>=0; --i ) {
+        lin = lin*(box[i]+1) + copy->idx[i];
+      }
+      keys[cnt[s]].key = lin;
+    }
+    keys[cnt[s]++].idx = icopy;
+  }
+
+  /* Key order within each replication (cnt[s]: end of the copies of s) */
+  for ( s=0; s<=lat->nstage; ++s ) {
+    i = s ? cnt[s-1] : 0;
+    qsort(&keys[i],cnt[s]-i,sizeof(MIRRORMESH_Key),MIRRORMESH_cmpKey);
+  }
+
+  for ( i=0; i<lat->ncopy; ++i ) {
+    lat->order[i]                = keys[i].idx;
+    lat->copies[keys[i].idx].pos = i;
+  }
+  assert ( lat->order[0] == 0 );
+
+  MMG5_DEL_MEM(lat->mesh,keys);
+}
+
+#ifdef USE_SCOTCH
+/**
+ * \param mesh pointer toward the mesh
+ * \param perm computed permutation (\a perm[k] is the new index of point \a k)
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Order the points by a nested dissection of the vertex graph of the mesh
+ * (built from the edges of the tetra, or of the triangles for a surface
+ * mesh) computed by SCOTCH.
+ *
+ */
+static
+int MIRRORMESH_scotchOrder(MMG5_pMesh mesh,int *perm) {
+  SCOTCH_Graph graph;
+  SCOTCH_Strat strat;
+  SCOTCH_Num   *verttab,*edgetab,*permtab;
+  int          *deg,k,i,j,l,a,b,nv,nelt,nedg,ier;
+  int          *v;
+
+  static const int ted[6][2] = { {0,1},{0,2},{0,3},{1,2},{1,3},{2,3} };
+
+  if ( mesh->nei ) {
+    nelt = mesh->nei;
+    nv   = 4;
+    nedg = 6;
+  }
+  else if ( mesh->nti ) {
+    nelt = mesh->nti;
+    nv   = 3;
+    nedg = 3;
+  }
+  else {
+    return 0;
+  }
+
+  MMG5_ADD_MEM(mesh,((size_t)mesh->npi+2)*sizeof(int),"vertex degrees",
+               return 0);
+  MMG5_SAFE_CALLOC(deg,mesh->npi+2,int,return 0);
+  MMG5_ADD_MEM(mesh,((size_t)mesh->npi+1)*sizeof(SCOTCH_Num)
+               +(size_t)2*nedg*nelt*sizeof(SCOTCH_Num)
+               +(size_t)mesh->npi*sizeof(SCOTCH_Num),"vertex graph",
+               MMG5_DEL_MEM(mesh,deg);return 0);
+  MMG5_SAFE_CALLOC(verttab,mesh->npi+1,SCOTCH_Num,
+                   MMG5_DEL_MEM(mesh,deg);return 0);
+  MMG5_SAFE_MALLOC(edgetab,(size_t)2*nedg*nelt,SCOTCH_Num,
+                   MMG5_DEL_MEM(mesh,deg);MMG5_DEL_MEM(mesh,verttab);return 0);
+  MMG5_SAFE_MALLOC(permtab,mesh->npi,SCOTCH_Num,
+                   MMG5_DEL_MEM(mesh,deg);MMG5_DEL_MEM(mesh,verttab);
+                   MMG5_DEL_MEM(mesh,edgetab);return 0);
+
+  /* Adjacency lists, with repetitions */
+  for ( k=1; k<=nelt; ++k ) {
+    v = nv == 4 ? mesh->tetra[k].v : mesh->tria[k].v;
+    for ( l=0; l<nedg; ++l ) {
+      ++deg[v[ted[l][0]]+1];
+      ++deg[v[ted[l][1]]+1];
+    }
+  }
+  for ( k=1; k<=mesh->npi; ++k ) {
+    deg[k+1] += deg[k];
+  }
+  for ( k=1; k<=nelt; ++k ) {
+    v = nv == 4 ? mesh->tetra[k].v : mesh->tria[k].v;
+    for ( l=0; l<nedg; ++l ) {
+      a = v[ted[l][0]];
+      b = v[ted[l][1]];
+      edgetab[deg[a]++] = b-1;
+      edgetab[deg[b]++] = a-1;
+    }
+  }
+
+  /* Remove the repeated neighbours (deg[k] is now the end of row k) */
+  j = 0;
+  b = 0;
+  for ( k=1; k<=mesh->npi; ++k ) {
+    a            = j;
+    verttab[k-1] = j;
+    for ( i=b; i<deg[k]; ++i ) {
+      for ( l=a; l<j; ++l ) {
+        if ( edgetab[l] == edgetab[i] ) break;
+      }
+      if ( l == j ) edgetab[j++] = edgetab[i];
+    }
+    b = deg[k];
+  }
+  verttab[mesh->npi] = j;
+  MMG5_DEL_MEM(mesh,deg);
+
+  ier = 0;
+  if ( !SCOTCH_graphInit(&graph) ) {
+    if ( !SCOTCH_graphBuild(&graph,0,mesh->npi,verttab,NULL,NULL,NULL,
+                            j,edgetab,NULL) ) {
+      SCOTCH_stratInit(&strat);
+      if ( !SCOTCH_graphOrder(&graph,&strat,permtab,NULL,NULL,NULL,NULL) ) {
+        for ( k=1; k<=mesh->npi; ++k ) {
+          perm[k] = (int)permtab[k-1]+1;
+        }
+        ier = 1;
+      }
+      SCOTCH_stratExit(&strat);
+    }
+    SCOTCH_graphExit(&graph);
+  }
+
+  MMG5_DEL_MEM(mesh,verttab);
+  MMG5_DEL_MEM(mesh,edgetab);
+  MMG5_DEL_MEM(mesh,permtab);
+
+  return ier;
+}
+#endif
+
+/**
+ * \param mesh pointer toward the mesh (with up to date bounding box)
+ * \param perm computed permutation (\a perm[k] is the new index of point \a k)
+ * \param nthreads number of threads
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Order the points along a Hilbert curve over the bounding box.
+ *
+ */
+static
+int MIRRORMESH_hilbertOrder(MMG5_pMesh mesh,int *perm,int nthreads) {
+  MIRRORMESH_Key *keys;
+  double         scale[3];
+  int            i,k;
+
+  MMG5_ADD_MEM(mesh,(size_t)mesh->npi*sizeof(MIRRORMESH_Key),"Hilbert keys",
+               return 0);
+  MMG5_SAFE_MALLOC(keys,mesh->npi,MIRRORMESH_Key,return 0);
+
+  for ( i=0; i<3; ++i ) {
+    double len = mesh->info.max[i] - mesh->info.min[i];
+    scale[i] = len > 0. ? ((1u << MIRRORMESH_HILBERT_BITS)-1) / len : 0.;
+  }
+
+#pragma omp parallel for num_threads(nthreads) schedule(static) private(i)
+  for ( k=1; k<=mesh->npi; ++k ) {
+    uint32_t x[3];
+    for ( i=0; i<3; ++i ) {
+      x[i] = (uint32_t)((mesh->point[k].c[i]-mesh->info.min[i])*scale[i]);
+    }
+    keys[k-1].key = MIRRORMESH_hilbertKey(x,MIRRORMESH_HILBERT_BITS);
+    keys[k-1].idx = k;
+  }
+  qsort(keys,mesh->npi,sizeof(MIRRORMESH_Key),MIRRORMESH_cmpKey);
+
+  for ( k=1; k<=mesh->npi; ++k ) {
+    perm[keys[k-1].idx] = k;
+  }
+
+  MMG5_DEL_MEM(mesh,keys);
+
+  return 1;
+}
+
+/**
+ * \param array array of entities (entity \a k at position \a k)
+ * \param size size of an entity
+ * \param n number of entities
+ * \param key key of each entity (\a key[k] in [1,nkey])
+ * \param nkey maximal key
+ * \param cnt work array of \a nkey+2 integers
+ * \param buf work array of \a n entities
+ *
+ * Sort the entities by increasing keys, entities of same key keeping their
+ * relative order (counting sort).
+ *
+ */
+static
+void MIRRORMESH_sortByKey(void *array,size_t size,int n,int *key,int nkey,
+                          int *cnt,char *buf) {
+  char *base = (char*)array;
+  int  k;
+
+  if ( !n ) return;
+
+  memset(cnt,0,((size_t)nkey+2)*sizeof(int));
+  for ( k=1; k<=n; ++k ) {
+    ++cnt[key[k]+1];
+  }
+  for ( k=1; k<=nkey; ++k ) {
+    cnt[k+1] += cnt[k];
+  }
+  for ( k=1; k<=n; ++k ) {
+    memcpy(buf+(size_t)(cnt[key[k]]++)*size,base+k*size,size);
+  }
+  memcpy(base+size,buf,(size_t)n*size);
+}
+
+/**
+ * \param mesh pointer toward the base mesh (packed, with up to date bounding
+ * box)
+ * \param sol fields defined at the vertices of the base mesh
+ * \param nsol number of fields
+ * \param nthreads number of threads
+ *
+ * \return 1 if success, 0 if fail (the mesh is then left unchanged).
+ *
+ * Renumber the base mesh to improve the locality of the numbering: points are
+ * ordered by SCOTCH (if available) or along a Hilbert curve, then tetra,
+ * triangles and edges are sorted by their smallest vertex. The values of the
+ * fields follow their vertex. The work arrays are counted in the memory of
+ * the mesh and allocated before modifying it.
+ *
+ */
+int MIRRORMESH_renum_base(MMG5_pMesh mesh,MMG5_pSol *sol,int nsol,
+                          int nthreads) {
+  MMG5_pPoint point;
+  double      *m;
+  size_t      bsize;
+  char        *buf;
+  int         *perm,*key,*cnt,k,i,l,ier,size,nelt;
+
+  MMG5_ADD_MEM(mesh,((size_t)mesh->npi+1)*sizeof(int),"point permutation",
+               return 0);
+  MMG5_SAFE_CALLOC(perm,mesh->npi+1,int,return 0);
+
+  ier = 0;
+#ifdef USE_SCOTCH
+  ier = MIRRORMESH_scotchOrder(mesh,perm);
+#endif
+  if ( !ier && !MIRRORMESH_hilbertOrder(mesh,perm,nthreads) ) {
+    MMG5_DEL_MEM(mesh,perm);
+    return 0;
+  }
+
+  /* Work arrays, all allocated before the mesh is modified */
+  ier   = 0;
+  point = NULL;
+  key   = cnt = NULL;
+  m     = NULL;
+  buf   = NULL;
+
+  nelt  = MG_MAX(MG_MAX(mesh->nei,mesh->nti),mesh->nai);
+  bsize = MG_MAX((size_t)mesh->nei*sizeof(MMG5_Tetra),
+                 (size_t)mesh->nti*sizeof(MMG5_Tria));
+  bsize = MG_MAX(bsize,(size_t)mesh->nai*sizeof(MMG5_Edge)) + 1;
+  size  = 1;
+  for ( l=0; l<nsol; ++l ) {
+    size = MG_MAX(size,sol[l]->size);
+  }
+
+  MMG5_ADD_MEM(mesh,((size_t)mesh->npi+1)*sizeof(MMG5_Point),
+               "renumbered points",goto fail);
+  MMG5_SAFE_MALLOC(point,mesh->npi+1,MMG5_Point,goto fail);
+  MMG5_ADD_MEM(mesh,((size_t)nelt+1)*sizeof(int),"element keys",goto fail);
+  MMG5_SAFE_MALLOC(key,nelt+1,int,goto fail);
+  MMG5_ADD_MEM(mesh,((size_t)mesh->npi+2)*sizeof(int),"key counts",goto fail);
+  MMG5_SAFE_MALLOC(cnt,mesh->npi+2,int,goto fail);
+  MMG5_ADD_MEM(mesh,bsize,"sorted elements",goto fail);
+  MMG5_SAFE_MALLOC(buf,bsize,char,goto fail);
+  MMG5_ADD_MEM(mesh,((size_t)mesh->npi+1)*size*sizeof(double),
+               "renumbered fields",goto fail);
+  MMG5_SAFE_MALLOC(m,((size_t)mesh->npi+1)*size,double,goto fail);
+
+  /* Points */
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( k=1; k<=mesh->npi; ++k ) {
+    memcpy(&point[perm[k]],&mesh->point[k],sizeof(MMG5_Point));
+  }
+  memcpy(&mesh->point[1],&point[1],mesh->npi*sizeof(MMG5_Point));
+
+  /* Fields */
+  for ( l=0; l<nsol; ++l ) {
+    size = sol[l]->size;
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+    for ( k=1; k<=mesh->npi; ++k ) {
+      memcpy(&m[(size_t)perm[k]*size],&sol[l]->m[(size_t)k*size],
+             size*sizeof(double));
+    }
+    memcpy(&sol[l]->m[size],&m[size],(size_t)mesh->npi*size*sizeof(double));
+  }
+
+  /* Elements, sorted by smallest vertex */
+#pragma omp parallel for num_threads(nthreads) schedule(static) private(i)
+  for ( k=1; k<=mesh->nei; ++k ) {
+    MMG5_pTetra pt = &mesh->tetra[k];
+    key[k] = mesh->npi;
+    for ( i=0; i<4; ++i ) {
+      pt->v[i] = perm[pt->v[i]];
+      key[k]   = MG_MIN(key[k],pt->v[i]);
+    }
+  }
+  MIRRORMESH_sortByKey(mesh->tetra,sizeof(MMG5_Tetra),mesh->nei,key,mesh->npi,
+                       cnt,buf);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static) private(i)
+  for ( k=1; k<=mesh->nti; ++k ) {
+    MMG5_pTria pt = &mesh->tria[k];
+    key[k] = mesh->npi;
+    for ( i=0; i<3; ++i ) {
+      pt->v[i] = perm[pt->v[i]];
+      key[k]   = MG_MIN(key[k],pt->v[i]);
+    }
+  }
+  MIRRORMESH_sortByKey(mesh->tria,sizeof(MMG5_Tria),mesh->nti,key,mesh->npi,
+                       cnt,buf);
+
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+  for ( k=1; k<=mesh->nai; ++k ) {
+    MMG5_pEdge pa = &mesh->edge[k];
+    pa->a  = perm[pa->a];
+    pa->b  = perm[pa->b];
+    key[k] = MG_MIN(pa->a,pa->b);
+  }
+  MIRRORMESH_sortByKey(mesh->edge,sizeof(MMG5_Edge),mesh->nai,key,mesh->npi,
+                       cnt,buf);
+  ier = 1;
+
+fail:
+  if ( m )     MMG5_DEL_MEM(mesh,m);
+  if ( buf )   MMG5_DEL_MEM(mesh,buf);
+  if ( cnt )   MMG5_DEL_MEM(mesh,cnt);
+  if ( key )   MMG5_DEL_MEM(mesh,key);
+  if ( point ) MMG5_DEL_MEM(mesh,point);
+  MMG5_DEL_MEM(mesh,perm);
+
+  return ier;
+}
@@ -0,0 +1,166 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file stats.c
+ * \brief Measures of the phases of the replication.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * Each phase is measured between \ref MIRRORMESH_stats_start and \ref
+ * MIRRORMESH_stats_stop, which stores its wall and CPU time, the peak memory
+ * of the process, the memory allocated for the mesh and the sizes of the
+ * mesh in the \a stats field of the parameters structure.
+ *
+ */
+#include "mirrormesh.h"
+
+#include <sys/resource.h>
+#include <time.h>
+
+/** Names of the phases in the JSON output */
+static const char *MIRRORMESH_phaseName[MIRRORMESH_NPHASE] = {
+  "load","preflight","points","cells","save"
+};
+
+/**
+ * \param c state of the process to fill
+ *
+ * Get the wall time, the CPU time and the peak resident set size of the
+ * process.
+ *
+ */
+static void MIRRORMESH_process_state(MIRRORMESH_pChrono c) {
+  struct timespec t;
+  struct rusage   usage;
+
+  clock_gettime(CLOCK_MONOTONIC,&t);
+  c->wall = t.tv_sec + 1.e-9*t.tv_nsec;
+
+  c->cpu = 0.;
+  c->rss = 0;
+  if ( !getrusage(RUSAGE_SELF,&usage) ) {
+    c->cpu = usage.ru_utime.tv_sec + 1.e-6*usage.ru_utime.tv_usec
+      + usage.ru_stime.tv_sec + 1.e-6*usage.ru_stime.tv_usec;
+#ifdef __APPLE__
+    c->rss = (size_t)usage.ru_maxrss;
+#else
+    c->rss = (size_t)usage.ru_maxrss*1024;
+#endif
+  }
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param c state of the process at the beginning of the phase
+ *
+ * Start the measure of a phase.
+ *
+ */
+void MIRRORMESH_stats_start(MMG5_pMesh mesh,MIRRORMESH_pChrono c) {
+  MIRRORMESH_process_state(c);
+  c->mem = mesh->memCur;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param c state of the process at the beginning of the phase
+ * \param info pointer toward the parameters (storing the measures)
+ * \param phase measured phase (\ref MIRRORMESH_Phase)
+ *
+ * \return the measures of the phase.
+ *
+ * Stop the measure of a phase: the sizes of the mesh are the current ones and
+ * the number of welded vertices is reset, the caller may update them.
+ *
+ */
+MIRRORMESH_PhaseStats *MIRRORMESH_stats_stop(MMG5_pMesh mesh,
+                                             MIRRORMESH_pChrono c,
+                                             MIRRORMESH_pInfo info,int phase) {
+  MIRRORMESH_PhaseStats *ph = &info->stats.phase[phase];
+  MIRRORMESH_Chrono     end;
+
+  MIRRORMESH_process_state(&end);
+
+  ph->wall  = end.wall - c->wall;
+  ph->cpu   = end.cpu - c->cpu;
+  ph->rss   = end.rss;
+  ph->drss  = end.rss - c->rss;
+  ph->mem   = mesh->memCur;
+  ph->dmem  = (long long)mesh->memCur - (long long)c->mem;
+  ph->np    = mesh->np;
+  ph->ne    = mesh->ne;
+  ph->nt    = mesh->nt;
+  ph->na    = mesh->na;
+  ph->nweld = 0;
+  ph->done  = 1;
+
+  return ph;
+}
+
+int MIRRORMESH_saveStats(MIRRORMESH_pInfo info,const char *filename) {
+  MIRRORMESH_PhaseStats *ph;
+  FILE                  *out;
+  double                wall,cpu;
+  int                   l,first;
+
+  out = fopen(filename,"w");
+  if ( !out ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    return 0;
+  }
+
+  fprintf(out,"{\n  \"version\": \"%s\",\n",MIRRORMESH_VERSION_RELEASE);
+  fprintf(out,"  \"nmir\": [%d, %d, %d],\n",info->nmir[0],info->nmir[1],
+          info->nmir[2]);
+  fprintf(out,"  \"nthreads\": %d,\n",MIRRORMESH_NTHREADS(info));
+  fprintf(out,"  \"phases\": [");
+
+  wall  = cpu = 0.;
+  first = 1;
+  for ( l=0; l<MIRRORMESH_NPHASE; ++l ) {
+    ph = &info->stats.phase[l];
+    if ( !ph->done ) continue;
+
+    fprintf(out,"%s\n    {\"name\": \"%s\", \"wall_s\": %.6f, \"cpu_s\": %.6f,"
+            " \"peak_rss_bytes\": %zu, \"delta_peak_rss_bytes\": %zu,"
+            " \"mem_bytes\": %zu, \"delta_mem_bytes\": %lld,"
+            " \"np\": %" MIRRORMESH_PRId ", \"ne\": %" MIRRORMESH_PRId ","
+            " \"nt\": %" MIRRORMESH_PRId ", \"na\": %" MIRRORMESH_PRId ","
+            " \"nweld\": %" MIRRORMESH_PRId "}",
+            first ? "" : ",",MIRRORMESH_phaseName[l],ph->wall,ph->cpu,ph->rss,
+            ph->drss,ph->mem,ph->dmem,ph->np,ph->ne,ph->nt,ph->na,ph->nweld);
+    wall += ph->wall;
+    cpu  += ph->cpu;
+    first = 0;
+  }
+  fprintf(out,"\n  ],\n");
+  fprintf(out,"  \"total\": {\"wall_s\": %.6f, \"cpu_s\": %.6f}\n}\n",wall,cpu);
+
+  if ( fclose(out) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,filename);
+    return 0;
+  }
+  return 1;
+}
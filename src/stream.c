@@ -0,0 +1,1831 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file stream.c
+ * \brief Generate-on-write output of the replicated mesh.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The replicated mesh is written section by section without being built: the
+ * entities of each copy are computed from the base mesh (see \ref lattice.c)
+ * while the chunks of the section are formatted (see \ref
+ * MIRRORMESH_writeSection), so the memory used only depends on the size of
+ * the base mesh and of the output buffers. The replicated mesh can also be
+ * written in several files of blocks of copies, with the communicators
+ * between the blocks (see \ref MIRRORMESH_saveLatticeParts).
+ *
+ */
+#include "mirrormesh.h"
+
+#include <ctype.h>
+
+/* Callbacks to write the sections of the replicated mesh: item k of a section
+ * is the image of the base entity (k-1)%nbase+1 in the copy at position
+ * (k-1)/nbase in the numbering order */
+static int MIRRORMESH_skipLatPoint(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->npi;
+  int                 cp  = lat->order[(k-1)/nb];
+  return lat->itf.face[(k-1)%nb+1] & lat->copies[cp].dupmask;
+}
+static int MIRRORMESH_skipLatTetra(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->nei;
+  int                 cp  = lat->order[(k-1)/nb];
+  return MIRRORMESH_lattice_skip(lat,&lat->tetra,cp,4,
+                                 lat->mesh->tetra[(k-1)%nb+1].v);
+}
+static int MIRRORMESH_skipLatTria(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->nti;
+  int                 cp  = lat->order[(k-1)/nb];
+  return MIRRORMESH_lattice_skip(lat,&lat->tria,cp,3,
+                                 lat->mesh->tria[(k-1)%nb+1].v);
+}
+static int MIRRORMESH_skipLatEdge(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  MMG5_pEdge          pa  = &lat->mesh->edge[(k-1)%lat->mesh->nai+1];
+  int                 v[2];
+
+  v[0] = pa->a;
+  v[1] = pa->b;
+  return MIRRORMESH_lattice_skip(lat,&lat->edge,
+                                 lat->order[(k-1)/lat->mesh->nai],2,v);
+}
+static int MIRRORMESH_isLatCorner(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->npi;
+  int                 cp  = lat->order[(k-1)/nb];
+  /* Corners lying on interior planes are removed */
+  return (lat->mesh->point[(k-1)%nb+1].tag & MG_CRN) &&
+    !(lat->itf.face[(k-1)%nb+1] & lat->copies[cp].itfmask);
+}
+static int MIRRORMESH_isLatReqPoint(void *data,MIRRORMESH_int k) {
+  MMG5_pMesh mesh = ((MIRRORMESH_pLattice)data)->mesh;
+  return mesh->point[(k-1)%mesh->npi+1].tag & MG_REQ;
+}
+static int MIRRORMESH_isLatReqTetra(void *data,MIRRORMESH_int k) {
+  MMG5_pMesh mesh = ((MIRRORMESH_pLattice)data)->mesh;
+  return mesh->tetra[(k-1)%mesh->nei+1].tag & MG_REQ;
+}
+static int MIRRORMESH_isLatReqTria(void *data,MIRRORMESH_int k) {
+  MMG5_pMesh mesh = ((MIRRORMESH_pLattice)data)->mesh;
+  MMG5_pTria pt   = &mesh->tria[(k-1)%mesh->nti+1];
+  return (pt->tag[0] & MG_REQ) && (pt->tag[1] & MG_REQ) && (pt->tag[2] & MG_REQ);
+}
+static int MIRRORMESH_isLatRidge(void *data,MIRRORMESH_int k) {
+  MMG5_pMesh mesh = ((MIRRORMESH_pLattice)data)->mesh;
+  return mesh->edge[(k-1)%mesh->nai+1].tag & MG_GEO;
+}
+static int MIRRORMESH_isLatReqEdge(void *data,MIRRORMESH_int k) {
+  MMG5_pMesh mesh = ((MIRRORMESH_pLattice)data)->mesh;
+  return mesh->edge[(k-1)%mesh->nai+1].tag & MG_REQ;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param tangent 1 for the tangent, 0 for the normal
+ * \param k index of the item (point)
+ * \param v computed vector at the point (may be NULL)
+ *
+ * \return 1 if the point has a vector, 0 otherwise.
+ *
+ * Normal or tangent at the image of a base point, reflected as the
+ * coordinates. Like the corners, the vectors of the points lying on interior
+ * planes are removed.
+ *
+ */
+static
+int MIRRORMESH_latVector(MIRRORMESH_pLattice lat,int tangent,MIRRORMESH_int k,
+                         double v[3]) {
+  MMG5_pMesh       mesh = lat->mesh;
+  int              nb   = mesh->npi;
+  int              kb   = (int)((k-1)%nb+1);
+  MIRRORMESH_pCopy copy = &lat->copies[lat->order[(k-1)/nb]];
+  const double     *u;
+  int              i;
+
+  if ( lat->itf.face[kb] & copy->itfmask ) return 0;
+
+  if ( tangent ) {
+    u = MIRRORMESH_tangent(mesh,lat->nfld > lat->nsol ? lat->sol[lat->nsol] :
+                           NULL,kb);
+  }
+  else {
+    u = MIRRORMESH_normal(mesh,kb);
+  }
+  if ( !u ) return 0;
+
+  for ( i=0; v && i<3; ++i ) {
+    v[i] = copy->sign[i]*u[i];
+  }
+  return 1;
+}
+
+/* Normals and tangents: the points without vector are skipped, so the index
+ * of an item is the index of its vector */
+static int MIRRORMESH_skipLatNormal(void *data,MIRRORMESH_int k) {
+  return MIRRORMESH_skipLatPoint(data,k) ||
+    !MIRRORMESH_latVector((MIRRORMESH_pLattice)data,0,k,NULL);
+}
+static int MIRRORMESH_skipLatTangent(void *data,MIRRORMESH_int k) {
+  return MIRRORMESH_skipLatPoint(data,k) ||
+    !MIRRORMESH_latVector((MIRRORMESH_pLattice)data,1,k,NULL);
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param type type of entity (\ref MMG5_entities)
+ * \param k index of the item
+ * \param v computed vertices of the entity in the replicated mesh
+ *
+ * \return the reference of the entity.
+ *
+ */
+static
+int MIRRORMESH_latEntity(MIRRORMESH_pLattice lat,int type,MIRRORMESH_int k,
+                         MIRRORMESH_int *v) {
+  MMG5_pMesh mesh = lat->mesh;
+  int        kb;
+
+  switch ( type ) {
+  case MMG5_Tetrahedron:
+    kb = (int)((k-1)%mesh->nei+1);
+    MIRRORMESH_lattice_tetra(lat,lat->order[(k-1)/mesh->nei],kb,v);
+    return mesh->tetra[kb].ref;
+  case MMG5_Triangle:
+    kb = (int)((k-1)%mesh->nti+1);
+    MIRRORMESH_lattice_tria(lat,lat->order[(k-1)/mesh->nti],kb,v);
+    return mesh->tria[kb].ref;
+  default:
+    kb = (int)((k-1)%mesh->nai+1);
+    MIRRORMESH_lattice_edge(lat,lat->order[(k-1)/mesh->nai],kb,v);
+    return mesh->edge[kb].ref;
+  }
+}
+
+static int MIRRORMESH_fmtLatPoint(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->npi;
+  double              c[3];
+
+  MIRRORMESH_lattice_coor(lat,&lat->copies[lat->order[(k-1)/nb]],(k-1)%nb+1,
+                          c);
+  return MIRRORMESH_fmtVertex(buf,c,abs(lat->mesh->point[(k-1)%nb+1].ref));
+}
+static int MIRRORMESH_fmtLatSol(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                char *buf) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->npi;
+  double              m[6];
+  int                 l,len;
+
+  len = 0;
+  for ( l=0; l<lat->nsol; ++l ) {
+    MIRRORMESH_lattice_sol(&lat->copies[lat->order[(k-1)/nb]],lat->sol[l],
+                           (k-1)%nb+1,m);
+    len += MIRRORMESH_fmtSol(buf+len,lat->sol[l],m);
+  }
+  buf[len-1] = '\n';
+
+  return len;
+}
+static int MIRRORMESH_fmtLatTetra(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_int v[4];
+  int            ref;
+
+  ref = MIRRORMESH_latEntity((MIRRORMESH_pLattice)data,MMG5_Tetrahedron,k,v);
+  return MIRRORMESH_fmtCell(buf,4,v,ref);
+}
+static int MIRRORMESH_fmtLatTria(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                 char *buf) {
+  MIRRORMESH_int v[3];
+  int            ref;
+
+  ref = MIRRORMESH_latEntity((MIRRORMESH_pLattice)data,MMG5_Triangle,k,v);
+  return MIRRORMESH_fmtCell(buf,3,v,ref);
+}
+static int MIRRORMESH_fmtLatEdge(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                 char *buf) {
+  MIRRORMESH_int v[2];
+  int            ref;
+
+  ref = MIRRORMESH_latEntity((MIRRORMESH_pLattice)data,MMG5_Edg,k,v);
+  return MIRRORMESH_fmtCell(buf,2,v,ref);
+}
+static int MIRRORMESH_fmtLatIndex(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  return MIRRORMESH_fmtCell(buf,0,NULL,idx);
+}
+static int MIRRORMESH_fmtLatNormal(void *data,MIRRORMESH_int k,
+                                   MIRRORMESH_int idx,char *buf) {
+  double v[3];
+
+  MIRRORMESH_latVector((MIRRORMESH_pLattice)data,0,k,v);
+  return MIRRORMESH_fmtVector(buf,v);
+}
+static int MIRRORMESH_fmtLatTangent(void *data,MIRRORMESH_int k,
+                                    MIRRORMESH_int idx,char *buf) {
+  double v[3];
+
+  MIRRORMESH_latVector((MIRRORMESH_pLattice)data,1,k,v);
+  return MIRRORMESH_fmtVector(buf,v);
+}
+static int MIRRORMESH_fmtLatAtVertex(void *data,MIRRORMESH_int k,
+                                     MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->npi;
+  MIRRORMESH_int      ip;
+
+  ip = MIRRORMESH_lattice_point(lat,lat->order[(k-1)/nb],(int)((k-1)%nb+1));
+  return MIRRORMESH_fmtCell(buf,1,&ip,idx);
+}
+
+/* Gmsh lines: "idx x y z" for nodes, "idx type 2 ref ref v..." for elements */
+static int MIRRORMESH_fmtMshNode(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                 char *buf) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->npi;
+  double              c[3];
+  int                 i,len;
+
+  MIRRORMESH_lattice_coor(lat,&lat->copies[lat->order[(k-1)/nb]],(k-1)%nb+1,
+                          c);
+
+  len = MIRRORMESH_fmtInt(buf,idx);
+  for ( i=0; i<3; ++i ) {
+    buf[len++] = ' ';
+    len += MIRRORMESH_fmtDouble(buf+len,c[i]);
+  }
+  buf[len++] = '\n';
+
+  return len;
+}
+static int MIRRORMESH_fmtMshElt(char *buf,MIRRORMESH_int idx,int type,int ref,
+                                int nv,MIRRORMESH_int *v) {
+  MIRRORMESH_int w[9];
+  int            i;
+
+  w[0] = idx;
+  w[1] = type;
+  w[2] = 2;
+  w[3] = ref;
+  w[4] = ref;
+  for ( i=0; i<nv; ++i ) {
+    w[5+i] = v[i];
+  }
+  return MIRRORMESH_fmtCell(buf,4+nv,w,w[4+nv]);
+}
+static int MIRRORMESH_fmtMshPoint(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MMG5_pMesh mesh = ((MIRRORMESH_pLattice)data)->mesh;
+  int        ref  = abs(mesh->point[(k-1)%mesh->npi+1].ref);
+
+  /* Points are the first elements: element idx is node idx */
+  return MIRRORMESH_fmtMshElt(buf,idx,15,ref,1,&idx);
+}
+static int MIRRORMESH_fmtMshTetra(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_int v[4];
+  int            ref;
+
+  ref = MIRRORMESH_latEntity((MIRRORMESH_pLattice)data,MMG5_Tetrahedron,k,v);
+  return MIRRORMESH_fmtMshElt(buf,idx,4,ref,4,v);
+}
+static int MIRRORMESH_fmtMshTria(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                 char *buf) {
+  MIRRORMESH_int v[3];
+  int            ref;
+
+  ref = MIRRORMESH_latEntity((MIRRORMESH_pLattice)data,MMG5_Triangle,k,v);
+  return MIRRORMESH_fmtMshElt(buf,idx,2,ref,3,v);
+}
+static int MIRRORMESH_fmtMshEdge(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                 char *buf) {
+  MIRRORMESH_int v[2];
+  int            ref;
+
+  ref = MIRRORMESH_latEntity((MIRRORMESH_pLattice)data,MMG5_Edg,k,v);
+  return MIRRORMESH_fmtMshElt(buf,idx,1,ref,2,v);
+}
+
+/**
+ * \struct MIRRORMESH_MshBlock
+ *
+ * \brief Gmsh 4.1 element block: the replicated entities of a given type and
+ * reference.
+ *
+ */
+typedef struct {
+  MIRRORMESH_pLattice lat; /*!< lattice */
+  int                 dim; /*!< dimension of the entities (0 for points) */
+  int                 ref; /*!< reference of the entities of the block */
+} MIRRORMESH_MshBlock;
+
+/* Type and Gmsh element type of the entities of dimension 0 to 3 */
+static const int MIRRORMESH_mshType[4] = {MMG5_Noentity,MMG5_Edg,MMG5_Triangle,
+                                          MMG5_Tetrahedron};
+static const int MIRRORMESH_mshElt[4]  = {15,1,2,4};
+
+static int MIRRORMESH_mshNbase(MMG5_pMesh mesh,int dim) {
+  switch ( dim ) {
+  case 0:  return mesh->npi;
+  case 1:  return mesh->nai;
+  case 2:  return mesh->nti;
+  default: return mesh->nei;
+  }
+}
+static int MIRRORMESH_mshRef(MMG5_pMesh mesh,int dim,int kb) {
+  switch ( dim ) {
+  case 0:  return abs(mesh->point[kb].ref);
+  case 1:  return mesh->edge[kb].ref;
+  case 2:  return mesh->tria[kb].ref;
+  default: return mesh->tetra[kb].ref;
+  }
+}
+static int MIRRORMESH_compareRef(const void *a,const void *b) {
+  return (*(const int*)a > *(const int*)b) - (*(const int*)a < *(const int*)b);
+}
+
+static int MIRRORMESH_skipMshBlock(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_MshBlock *blk = (MIRRORMESH_MshBlock*)data;
+
+  switch ( blk->dim ) {
+  case 0:  return MIRRORMESH_skipLatPoint(blk->lat,k);
+  case 1:  return MIRRORMESH_skipLatEdge(blk->lat,k);
+  case 2:  return MIRRORMESH_skipLatTria(blk->lat,k);
+  default: return MIRRORMESH_skipLatTetra(blk->lat,k);
+  }
+}
+static int MIRRORMESH_isMshBlock(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_MshBlock *blk  = (MIRRORMESH_MshBlock*)data;
+  MMG5_pMesh          mesh = blk->lat->mesh;
+  int                 nb   = MIRRORMESH_mshNbase(mesh,blk->dim);
+
+  return MIRRORMESH_mshRef(mesh,blk->dim,(int)((k-1)%nb+1)) == blk->ref;
+}
+static int MIRRORMESH_fmtMshBlock(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_MshBlock *blk = (MIRRORMESH_MshBlock*)data;
+  MIRRORMESH_int      w[5];
+
+  /* "idx v...": a point is its own node */
+  w[0] = idx;
+  if ( !blk->dim ) {
+    w[1] = idx;
+    return MIRRORMESH_fmtCell(buf,1,w,w[1]);
+  }
+  MIRRORMESH_latEntity(blk->lat,MIRRORMESH_mshType[blk->dim],k,&w[1]);
+  return MIRRORMESH_fmtCell(buf,blk->dim+1,w,w[blk->dim+1]);
+}
+static int MIRRORMESH_fmtMshCoor(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                 char *buf) {
+  MIRRORMESH_pLattice lat = (MIRRORMESH_pLattice)data;
+  int                 nb  = lat->mesh->npi;
+  double              c[3];
+  int                 i,len;
+
+  MIRRORMESH_lattice_coor(lat,&lat->copies[lat->order[(k-1)/nb]],(k-1)%nb+1,
+                          c);
+
+  len = 0;
+  for ( i=0; i<3; ++i ) {
+    len += MIRRORMESH_fmtDouble(buf+len,c[i]);
+    buf[len++] = ' ';
+  }
+  buf[len-1] = '\n';
+
+  return len;
+}
+
+/**
+ * \param mesh pointer toward the base mesh (for memory accounting)
+ * \param inm pointer toward the output file
+ * \param keyword keyword of the section
+ * \param sec description of the section (its \a first items being the ones
+ * of the previous file)
+ * \param prev previous replicated mesh (NULL if none)
+ * \param id section of the previous file
+ * \param nthreads number of threads
+ *
+ * \return the number of written entities, -1 if fail.
+ *
+ * Write a section of a Medit file: the entities of the previous replicated
+ * mesh are copied from its file without being formatted again, then the
+ * items of the new copies are generated.
+ *
+ */
+static
+MIRRORMESH_int MIRRORMESH_writeGrown(MMG5_pMesh mesh,FILE *inm,
+                                     const char *keyword,
+                                     MIRRORMESH_pSection sec,
+                                     MIRRORMESH_pMeditFile prev,int id,
+                                     int nthreads) {
+  MIRRORMESH_int nnew;
+  const char     *p,*end;
+
+  if ( !prev ) {
+    return MIRRORMESH_writeSection(mesh,inm,keyword,sec,nthreads);
+  }
+
+  nnew = MIRRORMESH_writeSection(mesh,NULL,keyword,sec,nthreads);
+  if ( nnew < 0 ) return -1;
+  if ( !(prev->n[id] + nnew) ) return 0;
+
+  fprintf(inm,"\n\n%s\n%" MIRRORMESH_PRId "\n",keyword,prev->n[id] + nnew);
+
+  if ( prev->n[id] ) {
+    /* Lines of the section, without the size and the trailing blanks */
+    p   = prev->beg[id];
+    end = prev->end[id];
+    while ( p < end && *p != '\n' ) ++p;
+    if ( p < end ) ++p;
+    while ( end > p && isspace((unsigned char)end[-1]) ) --end;
+
+    if ( fwrite(p,1,end-p,inm) != (size_t)(end-p) || fputc('\n',inm) == EOF ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to write the %s section.\n",
+              __func__,keyword);
+      return -1;
+    }
+  }
+
+  if ( nnew && MIRRORMESH_writeSection(mesh,inm,NULL,sec,nthreads) < 0 )
+    return -1;
+
+  return prev->n[id] + nnew;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param inm pointer toward the output file
+ * \param prev previous replicated mesh (NULL if none)
+ * \param nold number of copies of the previous replicated mesh
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the replicated mesh at Medit ASCII format, with the same sections
+ * as \ref MIRRORMESH_saveMesh. The version of the file is 4 (64-bit
+ * integers) if the replicated mesh has more than 2^31-1 entities of a type.
+ *
+ * If \a prev is given, its copies are the \a nold first ones of the lattice:
+ * their vertices and tetra (and the required ones) are copied from \a prev.
+ * The corners, triangles, edges, normals and tangents depend on the
+ * neighbours of the copies and are generated for the whole lattice.
+ *
+ */
+static
+int MIRRORMESH_streamMedit(MIRRORMESH_pLattice lat,FILE *inm,
+                           MIRRORMESH_pMeditFile prev,int nold) {
+  MMG5_pMesh         mesh = lat->mesh;
+  MIRRORMESH_Section sec;
+  MIRRORMESH_int     np,ne,nt,na;
+  int                nthreads = lat->nthreads;
+
+  MIRRORMESH_Get_latticeSize(lat,&np,&ne,&nt,&na);
+
+  fprintf(inm,"MeshVersionFormatted %d\n",
+          MIRRORMESH_meditVersion(MG_MAX(MG_MAX(np,ne),MG_MAX(nt,na)),
+                                  lat->int32max));
+  fprintf(inm,"\n\nDimension 3\n");
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.buf  = lat->buf;
+  sec.data = lat;
+
+  /* Vertices */
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->npi;
+  sec.first  = (MIRRORMESH_int)nold*mesh->npi;
+  sec.offset = lat->point.offset[nold];
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipLatPoint;
+  sec.format = MIRRORMESH_fmtLatPoint;
+  if ( MIRRORMESH_writeGrown(mesh,inm,"Vertices",&sec,prev,
+                             MIRRORMESH_SEC_Vertices,nthreads) < 0 )
+    return 0;
+
+  sec.first  = 0;
+  sec.offset = 0;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  sec.select = MIRRORMESH_isLatCorner;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Corners",&sec,nthreads) < 0 )
+    return 0;
+
+  sec.first  = (MIRRORMESH_int)nold*mesh->npi;
+  sec.offset = lat->point.offset[nold];
+  sec.select = MIRRORMESH_isLatReqPoint;
+  if ( MIRRORMESH_writeGrown(mesh,inm,"RequiredVertices",&sec,prev,
+                             MIRRORMESH_SEC_RequiredVertices,nthreads) < 0 )
+    return 0;
+
+  /* Tetrahedra */
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->nei;
+  sec.first  = (MIRRORMESH_int)nold*mesh->nei;
+  sec.offset = lat->tetra.offset[nold];
+  sec.skip   = MIRRORMESH_skipLatTetra;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtLatTetra;
+  if ( MIRRORMESH_writeGrown(mesh,inm,"Tetrahedra",&sec,prev,
+                             MIRRORMESH_SEC_Tetrahedra,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isLatReqTetra;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  if ( MIRRORMESH_writeGrown(mesh,inm,"RequiredTetrahedra",&sec,prev,
+                             MIRRORMESH_SEC_RequiredTetrahedra,nthreads) < 0 )
+    return 0;
+
+  /* Triangles */
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->nti;
+  sec.first  = 0;
+  sec.offset = 0;
+  sec.skip   = MIRRORMESH_skipLatTria;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtLatTria;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Triangles",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isLatReqTria;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredTriangles",&sec,nthreads) < 0 )
+    return 0;
+
+  /* Edges */
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->nai;
+  sec.skip   = MIRRORMESH_skipLatEdge;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtLatEdge;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Edges",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isLatRidge;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Ridges",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isLatReqEdge;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredEdges",&sec,nthreads) < 0 )
+    return 0;
+
+  /* Normals and tangents, then their vertices */
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->npi;
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipLatNormal;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtLatNormal;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Normals",&sec,nthreads) < 0 )
+    return 0;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtLatAtVertex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"NormalAtVertices",&sec,nthreads) < 0 )
+    return 0;
+
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipLatTangent;
+  sec.format = MIRRORMESH_fmtLatTangent;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Tangents",&sec,nthreads) < 0 )
+    return 0;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtLatAtVertex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"TangentAtVertices",&sec,nthreads) < 0 )
+    return 0;
+
+  fprintf(inm,"\n\nEnd\n");
+
+  return 1;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param inm pointer toward the output file
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the replicated mesh at Gmsh ASCII format, version 4.1 (64-bit
+ * numbering). The elements of each dimension and reference form a block of
+ * an entity whose physical tag is the reference, points being written as
+ * elements of type 15 as in the version 2.2.
+ *
+ */
+static
+int MIRRORMESH_streamMsh4(MIRRORMESH_pLattice lat,FILE *inm) {
+  MMG5_pMesh          mesh = lat->mesh;
+  MIRRORMESH_Section  sec;
+  MIRRORMESH_MshBlock blk;
+  MIRRORMESH_int      np,ne,nt,na,ntot,offset[4],*cnt,c;
+  int                 *ref,nref[4],start[5],nblk,dim,nodim,i,k,nb,ier;
+  int                 nthreads = lat->nthreads;
+
+  MIRRORMESH_Get_latticeSize(lat,&np,&ne,&nt,&na);
+  ntot      = np+na+nt+ne;
+  offset[0] = 0;
+  offset[1] = np;
+  offset[2] = np+na;
+  offset[3] = np+na+nt;
+
+  /* Distinct references of the base entities of each dimension */
+  nb = mesh->npi+mesh->nai+mesh->nti+mesh->nei;
+  MMG5_ADD_MEM(mesh,(nb+1)*(sizeof(int)+sizeof(MIRRORMESH_int)),"gmsh blocks",
+               return 0);
+  MMG5_SAFE_MALLOC(ref,nb+1,int,return 0);
+  MMG5_SAFE_CALLOC(cnt,nb+1,MIRRORMESH_int,MMG5_DEL_MEM(mesh,ref);return 0);
+
+  start[0] = 0;
+  for ( dim=0; dim<4; ++dim ) {
+    nb = MIRRORMESH_mshNbase(mesh,dim);
+    for ( k=1; k<=nb; ++k ) {
+      ref[start[dim]+k-1] = MIRRORMESH_mshRef(mesh,dim,k);
+    }
+    qsort(&ref[start[dim]],nb,sizeof(int),MIRRORMESH_compareRef);
+    nref[dim] = 0;
+    for ( k=0; k<nb; ++k ) {
+      if ( nref[dim] && ref[start[dim]+k] == ref[start[dim]+nref[dim]-1] )
+        continue;
+      ref[start[dim]+nref[dim]++] = ref[start[dim]+k];
+    }
+    start[dim+1] = start[dim]+nref[dim];
+  }
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.buf    = lat->buf;
+  sec.select = MIRRORMESH_isMshBlock;
+  sec.skip   = MIRRORMESH_skipMshBlock;
+  sec.format = MIRRORMESH_fmtMshBlock;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.data   = &blk;
+  blk.lat    = lat;
+
+  /* Number of elements of each block */
+  ier  = 1;
+  nblk = 0;
+  for ( dim=0; dim<4 && ier; ++dim ) {
+    blk.dim  = dim;
+    sec.n    = (MIRRORMESH_int)lat->ncopy*MIRRORMESH_mshNbase(mesh,dim);
+    for ( i=start[dim]; i<start[dim+1]; ++i ) {
+      blk.ref = ref[i];
+      cnt[i]  = MIRRORMESH_writeSection(mesh,NULL,NULL,&sec,nthreads);
+      if ( cnt[i] < 0 ) ier = 0;
+      if ( cnt[i] > 0 ) ++nblk;
+    }
+  }
+
+  /* Entities: one for each reference, with the reference as physical tag */
+  fprintf(inm,"$MeshFormat\n4.1 0 8\n$EndMeshFormat\n");
+  fprintf(inm,"$Entities\n%d %d %d %d\n",nref[0],nref[1],nref[2],nref[3]);
+  nodim = 0;
+  for ( dim=0; dim<4; ++dim ) {
+    if ( nref[dim] ) nodim = dim;
+    for ( i=start[dim]; i<start[dim+1]; ++i ) {
+      if ( !dim ) {
+        fprintf(inm,"%d 0 0 0 1 %d\n",i-start[dim]+1,ref[i]);
+      }
+      else {
+        fprintf(inm,"%d 0 0 0 0 0 0 1 %d 0\n",i-start[dim]+1,ref[i]);
+      }
+    }
+  }
+  fprintf(inm,"$EndEntities\n");
+
+  /* Nodes: a single block in the first entity of the highest dimension, the
+   * tags then the coordinates */
+  if ( ier ) {
+    fprintf(inm,"$Nodes\n1 %" MIRRORMESH_PRId " 1 %" MIRRORMESH_PRId "\n"
+            "%d 1 0 %" MIRRORMESH_PRId "\n",np,np,nodim,np);
+    memset(&sec,0,sizeof(MIRRORMESH_Section));
+    sec.buf    = lat->buf;
+    sec.data   = lat;
+    sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->npi;
+    sec.lmax   = MIRRORMESH_VERTLEN;
+    sec.skip   = MIRRORMESH_skipLatPoint;
+    sec.format = MIRRORMESH_fmtLatIndex;
+    ier = MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads) >= 0;
+  }
+  if ( ier ) {
+    sec.format = MIRRORMESH_fmtMshCoor;
+    ier = MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads) >= 0;
+    fprintf(inm,"$EndNodes\n");
+  }
+
+  /* Elements: one block for each dimension and reference, numbered as in
+   * the version 2.2 */
+  if ( ier ) {
+    fprintf(inm,"$Elements\n%d %" MIRRORMESH_PRId " 1 %" MIRRORMESH_PRId "\n",
+            nblk,ntot,ntot);
+    sec.select = MIRRORMESH_isMshBlock;
+    sec.skip   = MIRRORMESH_skipMshBlock;
+    sec.format = MIRRORMESH_fmtMshBlock;
+    sec.lmax   = MIRRORMESH_CELLLEN;
+    sec.data   = &blk;
+  }
+  for ( dim=0; dim<4 && ier; ++dim ) {
+    blk.dim    = dim;
+    sec.n      = (MIRRORMESH_int)lat->ncopy*MIRRORMESH_mshNbase(mesh,dim);
+    sec.offset = offset[dim];
+    for ( i=start[dim]; i<start[dim+1] && ier; ++i ) {
+      if ( !cnt[i] ) continue;
+      blk.ref = ref[i];
+      fprintf(inm,"%d %d %d %" MIRRORMESH_PRId "\n",dim,i-start[dim]+1,
+              MIRRORMESH_mshElt[dim],cnt[i]);
+      c   = MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads);
+      ier = ( c == cnt[i] );
+    }
+  }
+  if ( ier ) {
+    fprintf(inm,"$EndElements\n");
+  }
+
+  MMG5_DEL_MEM(mesh,cnt);
+  MMG5_DEL_MEM(mesh,ref);
+
+  return ier;
+}
+
+/**
+ * \param lat pointer toward the lattice
+ * \param inm pointer toward the output file
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the replicated mesh at Gmsh ASCII format (version 2.2). Points are
+ * also written as elements of type 15 to store their references. If the
+ * replicated mesh has more than 2^31-1 entities (\ref
+ * MIRRORMESH_IPARAM_int32max), the elements can't be numbered in 32 bits
+ * and the version 4.1 is written instead.
+ *
+ */
+static
+int MIRRORMESH_streamMsh(MIRRORMESH_pLattice lat,FILE *inm) {
+  MMG5_pMesh         mesh = lat->mesh;
+  MIRRORMESH_Section sec;
+  MIRRORMESH_int     np,ne,nt,na;
+  int                nthreads = lat->nthreads;
+
+  MIRRORMESH_Get_latticeSize(lat,&np,&ne,&nt,&na);
+
+  if ( np+na+nt+ne > lat->int32max ) {
+    return MIRRORMESH_streamMsh4(lat,inm);
+  }
+
+  fprintf(inm,"$MeshFormat\n2.2 0 8\n$EndMeshFormat\n");
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.buf  = lat->buf;
+  sec.data = lat;
+
+  /* Nodes */
+  fprintf(inm,"$Nodes\n%" MIRRORMESH_PRId "\n",np);
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->npi;
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipLatPoint;
+  sec.format = MIRRORMESH_fmtMshNode;
+  if ( MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads) < 0 )
+    return 0;
+  fprintf(inm,"$EndNodes\n");
+
+  /* Elements: points, edges, triangles then tetra */
+  fprintf(inm,"$Elements\n%" MIRRORMESH_PRId "\n",np+na+nt+ne);
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtMshPoint;
+  if ( MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads) < 0 )
+    return 0;
+
+  sec.offset = np;
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->nai;
+  sec.skip   = MIRRORMESH_skipLatEdge;
+  sec.format = MIRRORMESH_fmtMshEdge;
+  if ( MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads) < 0 )
+    return 0;
+
+  sec.offset = np+na;
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->nti;
+  sec.skip   = MIRRORMESH_skipLatTria;
+  sec.format = MIRRORMESH_fmtMshTria;
+  if ( MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads) < 0 )
+    return 0;
+
+  sec.offset = np+na+nt;
+  sec.n      = (MIRRORMESH_int)lat->ncopy*mesh->nei;
+  sec.skip   = MIRRORMESH_skipLatTetra;
+  sec.format = MIRRORMESH_fmtMshTetra;
+  if ( MIRRORMESH_writeSection(mesh,inm,NULL,&sec,nthreads) < 0 )
+    return 0;
+  fprintf(inm,"$EndElements\n");
+
+  return 1;
+}
+
+int MIRRORMESH_saveLattice(MIRRORMESH_pLattice lattice,const char *filename) {
+  MMG5_pMesh     mesh = lattice->mesh;
+  MIRRORMESH_int np,ne,nt,na;
+  FILE           *inm;
+  char           *name,*ptr;
+  int            fmt,ier;
+
+  /* Output format */
+  MMG5_SAFE_CALLOC(name,strlen(filename)+1,char,return 0);
+  strcpy(name,filename);
+  ptr = MMG5_Get_filenameExt(name);
+  fmt = MMG5_Get_format(ptr,MMG5_FMT_MeditASCII);
+  MMG5_SAFE_FREE(name);
+
+  if ( fmt != MMG5_FMT_MeditASCII && fmt != MMG5_FMT_GmshASCII ) {
+    fprintf(stderr,"\n  ## Error: %s: format %s not available in streaming"
+            " mode (only Medit and Gmsh ASCII formats are).\n",__func__,
+            MMG5_Get_formatName(fmt));
+    return 0;
+  }
+
+  inm = fopen(filename,"w");
+  if ( !inm ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    return 0;
+  }
+  if ( mesh->info.imprim >= 0 )
+    fprintf(stdout,"  %%%% %s OPENED\n",filename);
+
+  if ( fmt == MMG5_FMT_GmshASCII ) {
+    ier = MIRRORMESH_streamMsh(lattice,inm);
+  }
+  else {
+    ier = MIRRORMESH_streamMedit(lattice,inm,NULL,0);
+  }
+
+  if ( ferror(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write %s.\n",__func__,filename);
+    ier = 0;
+  }
+  if ( fclose(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,filename);
+    ier = 0;
+  }
+
+  if ( ier && abs(mesh->info.imprim) > 4 ) {
+    MIRRORMESH_Get_latticeSize(lattice,&np,&ne,&nt,&na);
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MIRRORMESH_PRId "\n",np);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8" MIRRORMESH_PRId "\n",ne);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MIRRORMESH_PRId "\n",nt);
+    fprintf(stdout,"     NUMBER OF EDGES      %8" MIRRORMESH_PRId "\n",na);
+  }
+
+  return ier;
+}
+
+int MIRRORMESH_saveLatticeSols(MIRRORMESH_pLattice lattice,
+                               const char *filename) {
+  MMG5_pMesh         mesh = lattice->mesh;
+  MIRRORMESH_Section sec;
+  MIRRORMESH_int     np;
+  FILE               *inm;
+  int                ier;
+
+  if ( !lattice->nsol ) {
+    fprintf(stderr,"\n  ## Error: %s: no field to save.\n",__func__);
+    return 0;
+  }
+
+  inm = fopen(filename,"w");
+  if ( !inm ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    return 0;
+  }
+  if ( mesh->info.imprim >= 0 )
+    fprintf(stdout,"  %%%% %s OPENED\n",filename);
+
+  MIRRORMESH_Get_latticeSize(lattice,&np,NULL,NULL,NULL);
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.buf    = lattice->buf;
+  sec.data   = lattice;
+  sec.n      = (MIRRORMESH_int)lattice->ncopy*mesh->npi;
+  sec.skip   = MIRRORMESH_skipLatPoint;
+  sec.format = MIRRORMESH_fmtLatSol;
+  ier = MIRRORMESH_writeSols(mesh,inm,np,lattice->int32max,lattice->sol,
+                             lattice->nsol,&sec,lattice->nthreads);
+
+  if ( ferror(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write %s.\n",__func__,filename);
+    ier = 0;
+  }
+  if ( fclose(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,filename);
+    ier = 0;
+  }
+
+  if ( ier && abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     NUMBER OF SOLUTIONS  %8d   VERTICES %8" MIRRORMESH_PRId
+            "\n",lattice->nsol,np);
+  }
+
+  return ier;
+}
+
+int MIRRORMESH_saveLatticeGrowth(MIRRORMESH_pLattice lattice,
+                                 const char *prevname,const char *filename) {
+  MMG5_pMesh           mesh = lattice->mesh;
+  MIRRORMESH_MeditFile prev;
+  MIRRORMESH_Growth    grow;
+  FILE                 *inm;
+  char                 *name,*ptr;
+  int                  *last,nold,i,s,ier;
+
+  /* Output format */
+  MMG5_SAFE_CALLOC(name,strlen(filename)+1,char,return 0);
+  strcpy(name,filename);
+  ptr = MMG5_Get_filenameExt(name);
+  ier = MMG5_Get_format(ptr,MMG5_FMT_MeditASCII);
+  MMG5_SAFE_FREE(name);
+
+  if ( ier != MMG5_FMT_MeditASCII ) {
+    fprintf(stderr,"\n  ## Error: %s: a replicated mesh can only be extended"
+            " at Medit ASCII format.\n",__func__);
+    return 0;
+  }
+  if ( !strcmp(prevname,filename) ) {
+    fprintf(stderr,"\n  ## Error: %s: the extended mesh can't be written in"
+            " the previous file %s.\n",__func__,prevname);
+    return 0;
+  }
+
+  /* The previous replication must be the last stage of the lattice, with the
+   * same base mesh and parameters */
+  if ( !MIRRORMESH_readGrowth(prevname,&grow) ) return 0;
+
+  ier  = lattice->nstage == grow.nstage+1;
+  ier  = ier && mesh->npi == grow.nbase[0] && mesh->nei == grow.nbase[1] &&
+    mesh->nti == grow.nbase[2] && mesh->nai == grow.nbase[3];
+  ier  = ier && lattice->renum == grow.renum &&
+    lattice->weldTol == grow.weldTol;
+  last = lattice->stage[lattice->nstage-1];
+  for ( i=0; ier && i<3; ++i ) {
+    ier = lattice->mode[i] == grow.mode[i] && last[i] == grow.nmir[i];
+    for ( s=0; ier && s<grow.nstage; ++s ) {
+      ier = lattice->stage[s][i] == grow.stage[s][i];
+    }
+  }
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## Error: %s: %s is not a previous replication of"
+            " the lattice (base mesh or parameters differ).\n",__func__,
+            prevname);
+    return 0;
+  }
+
+  /* The copies of the previous replication are numbered first */
+  nold = 1;
+  for ( i=0; i<lattice->dim; ++i ) {
+    nold *= last[i]+1;
+  }
+
+  if ( !MIRRORMESH_mapMedit(prevname,&prev,lattice->nthreads) ) return 0;
+
+  if ( prev.n[MIRRORMESH_SEC_Vertices] != lattice->point.offset[nold] ||
+       prev.n[MIRRORMESH_SEC_Tetrahedra] != lattice->tetra.offset[nold] ) {
+    fprintf(stderr,"\n  ## Error: %s: sizes of %s don't match its"
+            " description.\n",__func__,prevname);
+    MIRRORMESH_unmapMedit(&prev);
+    return 0;
+  }
+
+  inm = fopen(filename,"w");
+  if ( !inm ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    MIRRORMESH_unmapMedit(&prev);
+    return 0;
+  }
+  if ( mesh->info.imprim >= 0 )
+    fprintf(stdout,"  %%%% %s OPENED\n",filename);
+
+  ier = MIRRORMESH_streamMedit(lattice,inm,&prev,nold);
+  MIRRORMESH_unmapMedit(&prev);
+
+  if ( ferror(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write %s.\n",__func__,filename);
+    ier = 0;
+  }
+  if ( fclose(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,filename);
+    ier = 0;
+  }
+
+  if ( ier && abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     COPIES REUSED        %8d / %d\n",nold,lattice->ncopy);
+  }
+
+  return ier;
+}
+
+/**
+ * \struct MIRRORMESH_Part
+ * \brief Partition of the replicated mesh made of the copies at positions \a
+ * pos0 to \a pos1-1 in the numbering order.
+ *
+ * The local vertices are the points owned by the copies of the partition, in
+ * the order of the replicated mesh, then the points of the copies owned by
+ * other partitions, by increasing global index. The local triangles are the
+ * triangles of the copies, then the faces shared with other partitions.
+ */
+typedef struct {
+  MIRRORMESH_pLattice lat; /*!< lattice of the replicated mesh */
+  int                 pos0,pos1; /*!< positions of the copies of the partition */
+  MIRRORMESH_int      np; /*!< number of points owned by the partition */
+  MIRRORMESH_int      nfor; /*!< number of points owned by other partitions */
+  MIRRORMESH_int      *fglob; /*!< global indices of the points owned by other partitions */
+  MIRRORMESH_int      *fraw; /*!< stream items of the points owned by other partitions */
+  MIRRORMESH_int      nt; /*!< number of triangles of the copies */
+  MIRRORMESH_int      nifc; /*!< number of faces shared with other partitions */
+  MIRRORMESH_int      *ifc; /*!< ifc[2l]: stream item of the tetra, ifc[2l+1]: face in the base tetra */
+  int                 nbfc; /*!< number of faces of the base tetra lying on a plane */
+  int                 *bfc; /*!< faces of the base tetra lying on a plane (4*k+i) */
+} MIRRORMESH_Part;
+typedef MIRRORMESH_Part * MIRRORMESH_pPart;
+
+/** Item of a communicator: partition, global and local indices */
+typedef struct {
+  int            color;
+  MIRRORMESH_int glob,loc;
+} MIRRORMESH_CommItem;
+
+static int MIRRORMESH_compareInt(const void *a,const void *b) {
+  MIRRORMESH_int ia = *(const MIRRORMESH_int*)a, ib = *(const MIRRORMESH_int*)b;
+  return (ia > ib) - (ia < ib);
+}
+static int MIRRORMESH_compareCommItem(const void *a,const void *b) {
+  const MIRRORMESH_CommItem *ia = a, *ib = b;
+  if ( ia->color != ib->color ) return (ia->color > ib->color) - (ia->color < ib->color);
+  return (ia->glob > ib->glob) - (ia->glob < ib->glob);
+}
+
+/* Partition of the copy at position pos when the ncopy copies are split in
+ * nparts blocks, the block p starting at position p*ncopy/nparts */
+static inline
+int MIRRORMESH_partOf(MIRRORMESH_pLattice lat,int nparts,int pos) {
+  return (int)(((int64_t)(pos+1)*nparts-1)/lat->ncopy);
+}
+
+/* Local index of the point g of the replicated mesh in the partition (the
+ * point must belong to the partition) */
+static MIRRORMESH_int MIRRORMESH_partPoint(MIRRORMESH_pPart part,
+                                           MIRRORMESH_int g) {
+  MIRRORMESH_int g0 = part->lat->point.offset[part->pos0];
+  MIRRORMESH_int *f;
+
+  if ( g > g0 && g <= g0+part->np ) return g-g0;
+
+  f = bsearch(&g,part->fglob,part->nfor,sizeof(MIRRORMESH_int),
+              MIRRORMESH_compareInt);
+  assert ( f );
+  return part->np + (f-part->fglob) + 1;
+}
+
+/* Stream item of the local vertex k */
+static MIRRORMESH_int MIRRORMESH_rawPartPoint(MIRRORMESH_pPart part,
+                                              MIRRORMESH_int k) {
+  MIRRORMESH_int nb   = part->lat->mesh->npi;
+  MIRRORMESH_int nraw = (part->pos1-part->pos0)*nb;
+
+  return k <= nraw ? k+part->pos0*nb : part->fraw[k-nraw-1];
+}
+
+/* Callbacks to write the sections of a partition: items of the copies of the
+ * partition, then the extra items (points owned by other partitions and
+ * faces shared with other partitions) */
+static int MIRRORMESH_skipPartPoint(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_skipLatPoint(part->lat,MIRRORMESH_rawPartPoint(part,k));
+}
+static int MIRRORMESH_skipPartTetra(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_int   nb   = part->lat->mesh->nei;
+  return MIRRORMESH_skipLatTetra(part->lat,k+part->pos0*nb);
+}
+static int MIRRORMESH_skipPartTria(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_int   nb   = part->lat->mesh->nti;
+  return k <= (part->pos1-part->pos0)*nb &&
+    MIRRORMESH_skipLatTria(part->lat,k+part->pos0*nb);
+}
+static int MIRRORMESH_skipPartEdge(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_int   nb   = part->lat->mesh->nai;
+  return MIRRORMESH_skipLatEdge(part->lat,k+part->pos0*nb);
+}
+static int MIRRORMESH_isPartCorner(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_isLatCorner(part->lat,MIRRORMESH_rawPartPoint(part,k));
+}
+static int MIRRORMESH_isPartReqPoint(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_isLatReqPoint(part->lat,MIRRORMESH_rawPartPoint(part,k));
+}
+static int MIRRORMESH_isPartReqTetra(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_int   nb   = part->lat->mesh->nei;
+  return MIRRORMESH_isLatReqTetra(part->lat,k+part->pos0*nb);
+}
+static int MIRRORMESH_isPartReqTria(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_int   nb   = part->lat->mesh->nti;
+  return k <= (part->pos1-part->pos0)*nb &&
+    MIRRORMESH_isLatReqTria(part->lat,k+part->pos0*nb);
+}
+static int MIRRORMESH_isPartRidge(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_int   nb   = part->lat->mesh->nai;
+  return MIRRORMESH_isLatRidge(part->lat,k+part->pos0*nb);
+}
+static int MIRRORMESH_isPartReqEdge(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_int   nb   = part->lat->mesh->nai;
+  return MIRRORMESH_isLatReqEdge(part->lat,k+part->pos0*nb);
+}
+static int MIRRORMESH_skipPartNormal(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_skipLatNormal(part->lat,MIRRORMESH_rawPartPoint(part,k));
+}
+static int MIRRORMESH_skipPartTangent(void *data,MIRRORMESH_int k) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_skipLatTangent(part->lat,MIRRORMESH_rawPartPoint(part,k));
+}
+
+static int MIRRORMESH_fmtPartPoint(void *data,MIRRORMESH_int k,
+                                   MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_fmtLatPoint(part->lat,MIRRORMESH_rawPartPoint(part,k),idx,
+                                buf);
+}
+static int MIRRORMESH_fmtPartSol(void *data,MIRRORMESH_int k,MIRRORMESH_int idx,
+                                 char *buf) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_fmtLatSol(part->lat,MIRRORMESH_rawPartPoint(part,k),idx,
+                              buf);
+}
+static int MIRRORMESH_fmtPartNormal(void *data,MIRRORMESH_int k,
+                                    MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_fmtLatNormal(part->lat,MIRRORMESH_rawPartPoint(part,k),idx,
+                                 buf);
+}
+static int MIRRORMESH_fmtPartTangent(void *data,MIRRORMESH_int k,
+                                     MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_pPart part = (MIRRORMESH_pPart)data;
+  return MIRRORMESH_fmtLatTangent(part->lat,MIRRORMESH_rawPartPoint(part,k),
+                                  idx,buf);
+}
+static int MIRRORMESH_fmtPartAtVertex(void *data,MIRRORMESH_int k,
+                                      MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_pPart    part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_pLattice lat  = part->lat;
+  MIRRORMESH_int      nb   = lat->mesh->npi;
+  MIRRORMESH_int      r    = MIRRORMESH_rawPartPoint(part,k);
+  MIRRORMESH_int      ip;
+
+  ip = MIRRORMESH_lattice_point(lat,lat->order[(r-1)/nb],(int)((r-1)%nb+1));
+  ip = MIRRORMESH_partPoint(part,ip);
+  return MIRRORMESH_fmtCell(buf,1,&ip,idx);
+}
+static int MIRRORMESH_fmtPartCell(MIRRORMESH_pPart part,int type,int nv,
+                                  MIRRORMESH_int k,char *buf) {
+  MMG5_pMesh     mesh = part->lat->mesh;
+  MIRRORMESH_int v[4],nb;
+  int            ref,i;
+
+  nb  = type == MMG5_Tetrahedron ? mesh->nei :
+    ( type == MMG5_Triangle ? mesh->nti : mesh->nai );
+  ref = MIRRORMESH_latEntity(part->lat,type,k+part->pos0*nb,v);
+  for ( i=0; i<nv; ++i ) {
+    v[i] = MIRRORMESH_partPoint(part,v[i]);
+  }
+  return MIRRORMESH_fmtCell(buf,nv,v,ref);
+}
+static int MIRRORMESH_fmtPartTetra(void *data,MIRRORMESH_int k,
+                                   MIRRORMESH_int idx,char *buf) {
+  return MIRRORMESH_fmtPartCell((MIRRORMESH_pPart)data,MMG5_Tetrahedron,4,k,buf);
+}
+static int MIRRORMESH_fmtPartTria(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  MIRRORMESH_pPart    part = (MIRRORMESH_pPart)data;
+  MIRRORMESH_pLattice lat  = part->lat;
+  MIRRORMESH_int      nb   = lat->mesh->nei;
+  MIRRORMESH_int      nt   = part->pos1-part->pos0;
+  MIRRORMESH_int      v[4],w[3],*ifc;
+  int                 f,i;
+
+  nt *= lat->mesh->nti;
+  if ( k <= nt ) {
+    return MIRRORMESH_fmtPartCell(part,MMG5_Triangle,3,k,buf);
+  }
+
+  /* Face shared with another partition: face of the image of the tetra */
+  ifc = &part->ifc[2*(k-nt-1)];
+  MIRRORMESH_lattice_tetra(lat,lat->order[(ifc[0]-1)/nb],(int)((ifc[0]-1)%nb+1),
+                           v);
+  f = MIRRORMESH_face(&lat->copies[lat->order[(ifc[0]-1)/nb]],(int)ifc[1]);
+  for ( i=0; i<3; ++i ) {
+    w[i] = MIRRORMESH_partPoint(part,v[MMG5_idir[f][i]]);
+  }
+  return MIRRORMESH_fmtCell(buf,3,w,0);
+}
+static int MIRRORMESH_fmtPartEdge(void *data,MIRRORMESH_int k,
+                                  MIRRORMESH_int idx,char *buf) {
+  return MIRRORMESH_fmtPartCell((MIRRORMESH_pPart)data,MMG5_Edg,2,k,buf);
+}
+
+/**
+ * \param part pointer toward the partition
+ * \param nparts number of partitions
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Collect the points of the copies of the partition owned by other
+ * partitions and the faces of the copies shared with other partitions.
+ *
+ */
+static
+int MIRRORMESH_build_part(MIRRORMESH_pPart part,int nparts) {
+  MIRRORMESH_pLattice lat  = part->lat;
+  MMG5_pMesh          mesh = lat->mesh;
+  MIRRORMESH_pCopy    copy;
+  MMG5_pTetra         pt;
+  MIRRORMESH_int      *glob,g,l,nfor;
+  int8_t              face;
+  int                 pos,p,i,j,k,kf,n,jcopy;
+
+  p  = MIRRORMESH_partOf(lat,nparts,part->pos0);
+  n  = part->pos1-part->pos0;
+  part->np = lat->point.offset[part->pos1]-lat->point.offset[part->pos0];
+  part->nt = lat->tria.offset[part->pos1]-lat->tria.offset[part->pos0];
+
+  /* Points owned by other partitions: duplicated interface points */
+  MMG5_ADD_MEM(mesh,(2*(size_t)n*lat->point.nitf+1)*sizeof(MIRRORMESH_int),
+               "partition points",return 0);
+  MMG5_SAFE_MALLOC(glob,2*(size_t)n*lat->point.nitf+1,MIRRORMESH_int,return 0);
+  nfor = 0;
+  for ( pos=part->pos0; pos<part->pos1; ++pos ) {
+    copy = &lat->copies[lat->order[pos]];
+    for ( l=0; l<lat->point.nitf; ++l ) {
+      k = lat->point.itf[l];
+      if ( !(lat->itf.face[k] & copy->dupmask) ) continue;
+
+      g = MIRRORMESH_lattice_point(lat,lat->order[pos],k);
+      if ( g > lat->point.offset[part->pos0] &&
+           g <= lat->point.offset[part->pos1] ) continue;
+
+      jcopy = MIRRORMESH_owner(lat->dim,lat->nmir,&lat->itf,copy,&k);
+      glob[2*nfor]   = g;
+      glob[2*nfor+1] = (MIRRORMESH_int)lat->copies[jcopy].pos*mesh->npi + k;
+      ++nfor;
+    }
+  }
+  qsort(glob,nfor,2*sizeof(MIRRORMESH_int),MIRRORMESH_compareInt);
+
+  part->nfor = 0;
+  for ( l=0; l<nfor; ++l ) {
+    if ( part->nfor && glob[2*l] == glob[2*(part->nfor-1)] ) continue;
+    glob[2*part->nfor]   = glob[2*l];
+    glob[2*part->nfor+1] = glob[2*l+1];
+    ++part->nfor;
+  }
+
+  MMG5_ADD_MEM(mesh,2*((size_t)part->nfor+1)*sizeof(MIRRORMESH_int),
+               "partition points",MMG5_DEL_MEM(mesh,glob);return 0);
+  MMG5_SAFE_MALLOC(part->fglob,part->nfor+1,MIRRORMESH_int,
+                   MMG5_DEL_MEM(mesh,glob);return 0);
+  MMG5_SAFE_MALLOC(part->fraw,part->nfor+1,MIRRORMESH_int,
+                   MMG5_DEL_MEM(mesh,glob);return 0);
+  for ( l=0; l<part->nfor; ++l ) {
+    part->fglob[l] = glob[2*l];
+    part->fraw[l]  = glob[2*l+1];
+  }
+  MMG5_DEL_MEM(mesh,glob);
+
+  /* Faces shared with other partitions: boundary faces of the copies lying on
+   * a plane shared with a copy of another partition */
+  for ( j=0; j<2; ++j ) {
+    part->nifc = 0;
+    for ( pos=part->pos0; pos<part->pos1; ++pos ) {
+      copy = &lat->copies[lat->order[pos]];
+      for ( l=0; l<part->nbfc; ++l ) {
+        k  = part->bfc[l]/4;
+        i  = part->bfc[l]%4;
+        pt = &mesh->tetra[k];
+        face = copy->itfmask & lat->itf.face[pt->v[MMG5_idir[i][0]]]
+          & lat->itf.face[pt->v[MMG5_idir[i][1]]]
+          & lat->itf.face[pt->v[MMG5_idir[i][2]]];
+        if ( !face ) continue;
+
+        kf    = part->bfc[l];
+        jcopy = MIRRORMESH_neighbour(lat->dim,lat->nmir,&lat->itf,copy,face,&kf);
+        if ( jcopy < -1 ) {
+          fprintf(stderr,"\n  ## Error: %s: boundary face without matching"
+                  " face on the opposite boundary.\n",__func__);
+          return 0;
+        }
+        if ( jcopy < 0 ||
+             MIRRORMESH_partOf(lat,nparts,lat->copies[jcopy].pos) == p ||
+             MIRRORMESH_lattice_skip(lat,&lat->tetra,lat->order[pos],4,pt->v) ||
+             MIRRORMESH_lattice_skip(lat,&lat->tetra,jcopy,4,
+                                     mesh->tetra[kf/4].v) ) continue;
+
+        if ( j ) {
+          part->ifc[2*part->nifc]   = (MIRRORMESH_int)pos*mesh->nei + k;
+          part->ifc[2*part->nifc+1] = i;
+        }
+        ++part->nifc;
+      }
+    }
+    if ( !j ) {
+      MMG5_ADD_MEM(mesh,(2*(size_t)part->nifc+1)*sizeof(MIRRORMESH_int),
+                   "partition faces",return 0);
+      MMG5_SAFE_MALLOC(part->ifc,2*part->nifc+1,MIRRORMESH_int,return 0);
+    }
+  }
+
+  return 1;
+}
+
+static
+void MIRRORMESH_free_part(MIRRORMESH_pPart part) {
+  MMG5_pMesh mesh = part->lat->mesh;
+
+  if ( part->fglob ) {
+    MMG5_DEL_MEM(mesh,part->fglob);
+  }
+  if ( part->fraw ) {
+    MMG5_DEL_MEM(mesh,part->fraw);
+  }
+  if ( part->ifc ) {
+    MMG5_DEL_MEM(mesh,part->ifc);
+  }
+}
+
+/**
+ * \param inm pointer toward the output file
+ * \param kw name of the entities (Vertex or Triangle)
+ * \param kwitem name of the entities, plural (Vertices or Triangles)
+ * \param item items of the communicators, sorted by partition
+ * \param nitem number of items
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the communicators of a partition at the format of the distributed
+ * meshes of ParMmg: the partitions sharing entities with the partition and
+ * the number of shared entities, then the local and global indices of the
+ * shared entities and the index of their communicator.
+ *
+ */
+static
+int MIRRORMESH_writeComm(FILE *inm,const char *kw,const char *kwitem,
+                         MIRRORMESH_CommItem *item,MIRRORMESH_int nitem) {
+  MIRRORMESH_int l,l0;
+  int            ncomm;
+
+  ncomm = 0;
+  for ( l=0; l<nitem; ++l ) {
+    if ( !l || item[l].color != item[l-1].color ) ++ncomm;
+  }
+  if ( !ncomm ) return 1;
+
+  fprintf(inm,"\n\nParallel%sCommunicators\n%d\n",kw,ncomm);
+  for ( l0=0; l0<nitem; l0=l ) {
+    for ( l=l0; l<nitem && item[l].color == item[l0].color; ++l );
+    fprintf(inm,"%d %" MIRRORMESH_PRId "\n",item[l0].color,l-l0);
+  }
+
+  fprintf(inm,"\n\nParallelCommunicator%s\n",kwitem);
+  ncomm = -1;
+  for ( l=0; l<nitem; ++l ) {
+    if ( !l || item[l].color != item[l-1].color ) ++ncomm;
+    fprintf(inm,"%" MIRRORMESH_PRId " %" MIRRORMESH_PRId " %d\n",item[l].loc,
+            item[l].glob,ncomm);
+  }
+
+  return 1;
+}
+
+/**
+ * \param part pointer toward the partition
+ * \param nparts number of partitions
+ * \param inm pointer toward the output file
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the communicators of the vertices and faces shared with other
+ * partitions. The global index of a vertex is its index in the replicated
+ * mesh, the global index of a face is the smallest index 4*k+i of the faces
+ * of the replicated tetra that share it.
+ *
+ */
+static
+int MIRRORMESH_writePartComm(MIRRORMESH_pPart part,int nparts,FILE *inm) {
+  MIRRORMESH_pLattice lat  = part->lat;
+  MMG5_pMesh          mesh = lat->mesh;
+  MIRRORMESH_pCopy    copy,jcp;
+  MIRRORMESH_CommItem *item;
+  MIRRORMESH_int      g,g1,loc,l,nitem;
+  int8_t              face;
+  int                 list[8],nl,p,q,pos,m,j,k,kf,ier;
+
+  p = MIRRORMESH_partOf(lat,nparts,part->pos0);
+
+  /* Vertices: each interface point is shared with at most 7 other copies */
+  nitem = (MIRRORMESH_int)(part->pos1-part->pos0)*lat->point.nitf;
+  nitem = 7*(nitem+part->nfor);
+  MMG5_ADD_MEM(mesh,(size_t)(nitem+1)*sizeof(MIRRORMESH_CommItem),
+               "communicators",return 0);
+  MMG5_SAFE_MALLOC(item,nitem+1,MIRRORMESH_CommItem,return 0);
+
+  /* Interface points of the copies owned by the partition (pos < pos1),
+   * then points owned by other partitions (pos == pos1) */
+  nitem = 0;
+  for ( pos=part->pos0; pos<=part->pos1; ++pos ) {
+    for ( l=0; l<(pos<part->pos1 ? lat->point.nitf : part->nfor); ++l ) {
+      if ( pos < part->pos1 ) {
+        /* Interface point owned by the partition */
+        copy = &lat->copies[lat->order[pos]];
+        k    = lat->point.itf[l];
+        if ( lat->itf.face[k] & copy->dupmask ) continue;
+        g    = MIRRORMESH_lattice_point(lat,lat->order[pos],k);
+        loc  = g - lat->point.offset[part->pos0];
+      }
+      else {
+        /* Point owned by another partition */
+        copy = &lat->copies[lat->order[(part->fraw[l]-1)/mesh->npi]];
+        k    = (int)((part->fraw[l]-1)%mesh->npi+1);
+        g    = part->fglob[l];
+        loc  = part->np+l+1;
+      }
+      face = lat->itf.face[k] & copy->itfmask;
+      if ( !face ) continue;
+
+      nl = MIRRORMESH_sharing(lat->dim,lat->nmir,copy,face,list);
+      for ( m=0; m<nl; ++m ) {
+        q = MIRRORMESH_partOf(lat,nparts,lat->copies[list[m]].pos);
+        if ( q == p ) continue;
+        for ( j=0; j<m; ++j ) {
+          if ( MIRRORMESH_partOf(lat,nparts,lat->copies[list[j]].pos) == q ) break;
+        }
+        if ( j < m ) continue;
+
+        item[nitem].color = q;
+        item[nitem].glob  = g;
+        item[nitem].loc   = loc;
+        ++nitem;
+      }
+    }
+  }
+  qsort(item,nitem,sizeof(MIRRORMESH_CommItem),MIRRORMESH_compareCommItem);
+  ier = MIRRORMESH_writeComm(inm,"Vertex","Vertices",item,nitem);
+  MMG5_DEL_MEM(mesh,item);
+  if ( !ier ) return 0;
+
+  /* Faces */
+  MMG5_ADD_MEM(mesh,(size_t)(part->nifc+1)*sizeof(MIRRORMESH_CommItem),
+               "communicators",return 0);
+  MMG5_SAFE_MALLOC(item,part->nifc+1,MIRRORMESH_CommItem,return 0);
+  for ( l=0; l<part->nifc; ++l ) {
+    pos  = (int)((part->ifc[2*l]-1)/mesh->nei);
+    k    = (int)((part->ifc[2*l]-1)%mesh->nei+1);
+    j    = (int)part->ifc[2*l+1];
+    copy = &lat->copies[lat->order[pos]];
+    face = copy->itfmask & lat->itf.face[mesh->tetra[k].v[MMG5_idir[j][0]]]
+      & lat->itf.face[mesh->tetra[k].v[MMG5_idir[j][1]]]
+      & lat->itf.face[mesh->tetra[k].v[MMG5_idir[j][2]]];
+    kf   = 4*k+j;
+    m    = MIRRORMESH_neighbour(lat->dim,lat->nmir,&lat->itf,copy,face,&kf);
+    if ( m < 0 ) {
+      fprintf(stderr,"\n  ## Error: %s: no copy shares the face %d of the"
+              " tetra %d.\n",__func__,j,k);
+      MMG5_DEL_MEM(mesh,item);
+      return 0;
+    }
+    jcp  = &lat->copies[m];
+
+    g  = 4*MIRRORMESH_lattice_index(lat,&lat->tetra,lat->order[pos],k)
+      + MIRRORMESH_face(copy,j);
+    g1 = 4*MIRRORMESH_lattice_index(lat,&lat->tetra,m,kf/4)
+      + MIRRORMESH_face(jcp,kf%4);
+
+    item[l].color = MIRRORMESH_partOf(lat,nparts,jcp->pos);
+    item[l].glob  = MG_MIN(g,g1);
+    item[l].loc   = part->nt+l+1;
+  }
+  qsort(item,part->nifc,sizeof(MIRRORMESH_CommItem),MIRRORMESH_compareCommItem);
+  ier = MIRRORMESH_writeComm(inm,"Triangle","Triangles",item,part->nifc);
+  MMG5_DEL_MEM(mesh,item);
+
+  return ier;
+}
+
+/**
+ * \param part pointer toward the partition
+ * \param nparts number of partitions
+ * \param inm pointer toward the output file
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write a partition of the replicated mesh at Medit ASCII format, with the
+ * same sections as \ref MIRRORMESH_streamMedit and the communicators of the
+ * partition.
+ *
+ */
+static
+int MIRRORMESH_streamPart(MIRRORMESH_pPart part,int nparts,FILE *inm) {
+  MMG5_pMesh         mesh = part->lat->mesh;
+  MIRRORMESH_Section sec;
+  MIRRORMESH_int     n = part->pos1-part->pos0;
+  MIRRORMESH_int     np,ne,nt,na;
+  int                nthreads = part->lat->nthreads;
+
+  /* The global indices of the communicators are those of the replicated
+   * mesh (4*k+i for the faces) */
+  MIRRORMESH_Get_latticeSize(part->lat,&np,&ne,&nt,&na);
+  fprintf(inm,"MeshVersionFormatted %d\n",
+          MIRRORMESH_meditVersion(MG_MAX(MG_MAX(np,4*ne+3),MG_MAX(nt,na)),
+                                  part->lat->int32max));
+  fprintf(inm,"\n\nDimension 3\n");
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.data = part;
+
+  /* Vertices */
+  sec.n      = n*mesh->npi + part->nfor;
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipPartPoint;
+  sec.format = MIRRORMESH_fmtPartPoint;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Vertices",&sec,nthreads) < 0 )
+    return 0;
+
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  sec.select = MIRRORMESH_isPartCorner;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Corners",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isPartReqPoint;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredVertices",&sec,nthreads) < 0 )
+    return 0;
+
+  /* Tetrahedra */
+  sec.n      = n*mesh->nei;
+  sec.skip   = MIRRORMESH_skipPartTetra;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtPartTetra;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Tetrahedra",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isPartReqTetra;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredTetrahedra",&sec,nthreads) < 0 )
+    return 0;
+
+  /* Triangles, then faces shared with other partitions */
+  sec.n      = n*mesh->nti + part->nifc;
+  sec.skip   = MIRRORMESH_skipPartTria;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtPartTria;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Triangles",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isPartReqTria;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredTriangles",&sec,nthreads) < 0 )
+    return 0;
+
+  /* Edges */
+  sec.n      = n*mesh->nai;
+  sec.skip   = MIRRORMESH_skipPartEdge;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtPartEdge;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Edges",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isPartRidge;
+  sec.format = MIRRORMESH_fmtLatIndex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Ridges",&sec,nthreads) < 0 )
+    return 0;
+  sec.select = MIRRORMESH_isPartReqEdge;
+  if ( MIRRORMESH_writeSection(mesh,inm,"RequiredEdges",&sec,nthreads) < 0 )
+    return 0;
+
+  /* Normals and tangents, then their vertices (local indices) */
+  sec.n      = n*mesh->npi + part->nfor;
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipPartNormal;
+  sec.select = NULL;
+  sec.format = MIRRORMESH_fmtPartNormal;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Normals",&sec,nthreads) < 0 )
+    return 0;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtPartAtVertex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"NormalAtVertices",&sec,nthreads) < 0 )
+    return 0;
+
+  sec.lmax   = MIRRORMESH_VERTLEN;
+  sec.skip   = MIRRORMESH_skipPartTangent;
+  sec.format = MIRRORMESH_fmtPartTangent;
+  if ( MIRRORMESH_writeSection(mesh,inm,"Tangents",&sec,nthreads) < 0 )
+    return 0;
+  sec.lmax   = MIRRORMESH_CELLLEN;
+  sec.format = MIRRORMESH_fmtPartAtVertex;
+  if ( MIRRORMESH_writeSection(mesh,inm,"TangentAtVertices",&sec,nthreads) < 0 )
+    return 0;
+
+  /* Communicators */
+  if ( !MIRRORMESH_writePartComm(part,nparts,inm) ) return 0;
+
+  fprintf(inm,"\n\nEnd\n");
+
+  return 1;
+}
+
+/**
+ * \param part pointer toward the partition
+ * \param inm pointer toward the output file
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the fields at the vertices of a partition.
+ *
+ */
+static
+int MIRRORMESH_streamPartSols(MIRRORMESH_pPart part,FILE *inm) {
+  MIRRORMESH_pLattice lat = part->lat;
+  MIRRORMESH_Section  sec;
+
+  memset(&sec,0,sizeof(MIRRORMESH_Section));
+  sec.data   = part;
+  sec.n      = (MIRRORMESH_int)(part->pos1-part->pos0)*lat->mesh->npi
+    + part->nfor;
+  sec.skip   = MIRRORMESH_skipPartPoint;
+  sec.format = MIRRORMESH_fmtPartSol;
+  return MIRRORMESH_writeSols(lat->mesh,inm,part->np+part->nfor,lat->int32max,
+                              lat->sol,lat->nsol,&sec,lat->nthreads);
+}
+
+/**
+ * \param filename name of the file of the replicated mesh
+ * \param p index of the partition
+ * \param name computed name of the file of the partition
+ *
+ * Name of the file of the partition \a p: the index of the partition is
+ * inserted before the extension of \a filename (name.p.mesh).
+ *
+ */
+static
+void MIRRORMESH_partName(const char *filename,int p,char *name) {
+  char *ptr;
+
+  strcpy(name,filename);
+  ptr = MMG5_Get_filenameExt(name);
+  if ( !ptr ) ptr = name+strlen(name);
+  sprintf(ptr,".%d%s",p,filename+(ptr-name));
+}
+
+/**
+ * \param part pointer toward the partition
+ * \param nparts number of partitions
+ * \param filename name of the output file
+ * \param sol 1 to write the fields, 0 to write the mesh
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ */
+static
+int MIRRORMESH_savePart(MIRRORMESH_pPart part,int nparts,const char *filename,
+                        int sol) {
+  MMG5_pMesh mesh = part->lat->mesh;
+  FILE       *inm;
+  int        ier;
+
+  inm = fopen(filename,"w");
+  if ( !inm ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    return 0;
+  }
+  if ( abs(mesh->info.imprim) > 4 )
+    fprintf(stdout,"  %%%% %s OPENED\n",filename);
+
+  if ( sol ) {
+    ier = MIRRORMESH_streamPartSols(part,inm);
+  }
+  else {
+    ier = MIRRORMESH_streamPart(part,nparts,inm);
+  }
+
+  if ( ferror(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to write %s.\n",__func__,filename);
+    ier = 0;
+  }
+  if ( fclose(inm) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to close %s.\n",__func__,filename);
+    ier = 0;
+  }
+
+  return ier;
+}
+
+int MIRRORMESH_saveLatticeParts(MIRRORMESH_pLattice lattice,int nparts,
+                                const char *meshname,const char *solname) {
+  MMG5_pMesh      mesh = lattice->mesh;
+  MIRRORMESH_Part part;
+  MMG5_pTetra     pt;
+  char            *name,*ptr;
+  int             *bfc,nbfc,p,i,j,k,ier;
+
+  if ( nparts < 1 || nparts > lattice->ncopy ) {
+    fprintf(stderr,"\n  ## Error: %s: the number of partitions must be between"
+            " 1 and the number of copies (%d).\n",__func__,lattice->ncopy);
+    return 0;
+  }
+
+  /* Output format */
+  MMG5_SAFE_CALLOC(name,strlen(meshname)+MIRRORMESH_INTLEN+2,char,return 0);
+  strcpy(name,meshname);
+  ptr = MMG5_Get_filenameExt(name);
+  if ( MMG5_Get_format(ptr,MMG5_FMT_MeditASCII) != MMG5_FMT_MeditASCII ) {
+    fprintf(stderr,"\n  ## Error: %s: partitioned output only available at"
+            " Medit ASCII format.\n",__func__);
+    MMG5_SAFE_FREE(name);
+    return 0;
+  }
+  MMG5_SAFE_FREE(name);
+
+  /* Faces of the base tetra lying on a plane of the bounding box */
+  bfc  = NULL;
+  nbfc = 0;
+  for ( j=0; j<2; ++j ) {
+    for ( k=1; k<=mesh->nei; ++k ) {
+      pt = &mesh->tetra[k];
+      for ( i=0; i<4; ++i ) {
+        if ( !(lattice->itf.face[pt->v[MMG5_idir[i][0]]]
+               & lattice->itf.face[pt->v[MMG5_idir[i][1]]]
+               & lattice->itf.face[pt->v[MMG5_idir[i][2]]]) ) continue;
+        if ( j ) bfc[nbfc] = 4*k+i;
+        ++nbfc;
+      }
+    }
+    if ( !j ) {
+      MMG5_ADD_MEM(mesh,(size_t)(nbfc+1)*sizeof(int),"boundary faces",
+                   return 0);
+      MMG5_SAFE_MALLOC(bfc,nbfc+1,int,
+                       mesh->memCur -= (size_t)(nbfc+1)*sizeof(int);return 0);
+      nbfc = 0;
+    }
+  }
+
+  ier = 1;
+  for ( p=0; p<nparts && ier; ++p ) {
+    memset(&part,0,sizeof(MIRRORMESH_Part));
+    part.lat  = lattice;
+    part.nbfc = nbfc;
+    part.bfc  = bfc;
+    part.pos0 = (int)((int64_t)p*lattice->ncopy/nparts);
+    part.pos1 = (int)((int64_t)(p+1)*lattice->ncopy/nparts);
+
+    ier = MIRRORMESH_build_part(&part,nparts);
+
+    if ( ier ) {
+      MMG5_SAFE_CALLOC(name,strlen(meshname)+MIRRORMESH_INTLEN+2,char,
+                       MIRRORMESH_free_part(&part);
+                       if ( bfc ) MMG5_DEL_MEM(mesh,bfc);
+                       return 0);
+      MIRRORMESH_partName(meshname,p,name);
+      ier = MIRRORMESH_savePart(&part,nparts,name,0);
+      MMG5_SAFE_FREE(name);
+    }
+    if ( ier && solname && lattice->nsol ) {
+      MMG5_SAFE_CALLOC(name,strlen(solname)+MIRRORMESH_INTLEN+2,char,
+                       MIRRORMESH_free_part(&part);
+                       if ( bfc ) MMG5_DEL_MEM(mesh,bfc);
+                       return 0);
+      MIRRORMESH_partName(solname,p,name);
+      ier = MIRRORMESH_savePart(&part,nparts,name,1);
+      MMG5_SAFE_FREE(name);
+    }
+    MIRRORMESH_free_part(&part);
+  }
+  if ( bfc ) {
+    MMG5_DEL_MEM(mesh,bfc);
+  }
+
+  if ( ier && abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     NUMBER OF PARTITIONS %8d\n",nparts);
+  }
+
+  return ier;
+}
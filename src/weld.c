@@ -0,0 +1,506 @@
+/* =============================================================================
+**  This file is part of the mirrormesh software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/CNRS/Inria/UBordeaux/UPMC, 2004-
+**
+**  mirrormesh is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mirrormesh is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mirrormesh (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mirrormesh distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file weld.c
+ * \brief Detection of the points shared by neighbouring copies.
+ * \author Algiane Froehly (Inria)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The points lying on a symmetry plane are shared by the two copies separated
+ * by this plane. They are collected once on the base mesh, in one band of
+ * points per boundary plane of the bounding box: the image of such a point in
+ * a copy is welded to its image in the previous copy that owns it (see \ref
+ * MIRRORMESH_owner) and is never created. Along a translation axis, the copies
+ * share the lower boundary of one copy with the upper boundary of the other
+ * one: the points and the faces of the two bands are matched once.
+ *
+ */
+#include "mirrormesh.h"
+
+/* Point of a boundary plane and its coordinates in the plane */
+typedef struct {
+  double c[2];
+  int    k;
+} MIRRORMESH_PlanePoint;
+
+/* Face of a boundary plane: sorted vertices and index 4*k+j of the face */
+typedef struct {
+  int v[3];
+  int kf;
+} MIRRORMESH_PlaneFace;
+
+static int MIRRORMESH_comparePlanePoint(const void *a,const void *b) {
+  const MIRRORMESH_PlanePoint *pa = a, *pb = b;
+  int i;
+
+  for ( i=0; i<2; ++i ) {
+    if ( pa->c[i] != pb->c[i] ) return pa->c[i] < pb->c[i] ? -1 : 1;
+  }
+  return 0;
+}
+static int MIRRORMESH_comparePlaneFace(const void *a,const void *b) {
+  const MIRRORMESH_PlaneFace *fa = a, *fb = b;
+  int i;
+
+  for ( i=0; i<3; ++i ) {
+    if ( fa->v[i] != fb->v[i] ) return fa->v[i] < fb->v[i] ? -1 : 1;
+  }
+  return 0;
+}
+static int MIRRORMESH_compareFacePair(const void *a,const void *b) {
+  int ia = *(const int*)a, ib = *(const int*)b;
+  return (ia > ib) - (ia < ib);
+}
+
+/**
+ * \param mesh pointer toward the base mesh
+ * \param i axis
+ * \param itf pointer toward the interface structure (with filled bands)
+ * \param l band of the plane (\a i or \a i+3)
+ * \param fc computed faces of the tetra lying on the plane (allocated with
+ * 4*nei+1 items)
+ *
+ * \return the number of faces lying on the plane. The vertices of the faces
+ * of the lower plane are replaced by the matching points of the upper plane.
+ *
+ */
+static
+int MIRRORMESH_plane_faces(MMG5_pMesh mesh,int i,MIRRORMESH_pInterface itf,
+                           int l,MIRRORMESH_PlaneFace *fc) {
+  MMG5_pTetra pt;
+  int         k,j,m,n,tmp;
+
+  n = 0;
+  for ( k=1; k<=mesh->nei; ++k ) {
+    pt = &mesh->tetra[k];
+    for ( j=0; j<4; ++j ) {
+      for ( m=0; m<3; ++m ) {
+        fc[n].v[m] = pt->v[MMG5_idir[j][m]];
+        if ( !(itf->face[fc[n].v[m]] & (1 << l)) ) break;
+        if ( l == i ) fc[n].v[m] = itf->per[i][fc[n].v[m]];
+      }
+      if ( m < 3 ) continue;
+
+      /* Sorted vertices */
+      for ( m=0; m<2; ++m ) {
+        if ( fc[n].v[m] > fc[n].v[m+1] ) {
+          tmp = fc[n].v[m]; fc[n].v[m] = fc[n].v[m+1]; fc[n].v[m+1] = tmp;
+        }
+      }
+      if ( fc[n].v[0] > fc[n].v[1] ) {
+        tmp = fc[n].v[0]; fc[n].v[0] = fc[n].v[1]; fc[n].v[1] = tmp;
+      }
+      fc[n++].kf = 4*k+j;
+    }
+  }
+  qsort(fc,n,sizeof(MIRRORMESH_PlaneFace),MIRRORMESH_comparePlaneFace);
+
+  return n;
+}
+
+/**
+ * \param mesh pointer toward the base mesh
+ * \param i axis of translation
+ * \param itf pointer toward the interface structure (with filled bands)
+ *
+ * \return 1 if success, 0 if the two boundaries along axis \a i don't match.
+ *
+ * Match the points and the tetra faces of the lower boundary along axis \a i
+ * with the ones of the upper boundary. The points of the upper band are
+ * sorted by their coordinates in the plane: each point of the lower band is
+ * paired with the closest free point of the upper band whose coordinates
+ * match its own ones within the welding tolerance, searched in the window of
+ * the sorted points whose first coordinate is in this tolerance. The faces
+ * are then paired through their matched vertices.
+ *
+ */
+static
+int MIRRORMESH_match_planes(MMG5_pMesh mesh,int i,MIRRORMESH_pInterface itf) {
+  MIRRORMESH_PlanePoint *pp[2];
+  MIRRORMESH_PlaneFace  *fc[2];
+  double                d,dmin;
+  int                   npl,nf[2],l,j,k,lo,hi,mid,jmin;
+
+  npl = itf->nlist[i];
+  if ( npl != itf->nlist[i+3] ) return 0;
+
+  /* Points */
+  MMG5_ADD_MEM(mesh,(2*npl+1)*sizeof(MIRRORMESH_PlanePoint),"plane points",
+               return 0);
+  MMG5_SAFE_MALLOC(pp[0],2*npl+1,MIRRORMESH_PlanePoint,return 0);
+  pp[1] = pp[0]+npl;
+  for ( l=0; l<2; ++l ) {
+    for ( k=0; k<npl; ++k ) {
+      pp[l][k].k    = itf->list[i+3*l][k];
+      pp[l][k].c[0] = mesh->point[pp[l][k].k].c[(i+1)%3];
+      pp[l][k].c[1] = mesh->point[pp[l][k].k].c[(i+2)%3];
+    }
+  }
+  qsort(pp[1],npl,sizeof(MIRRORMESH_PlanePoint),MIRRORMESH_comparePlanePoint);
+
+  MMG5_ADD_MEM(mesh,(mesh->npi+1)*sizeof(int),"periodic points",
+               MMG5_DEL_MEM(mesh,pp[0]);return 0);
+  MMG5_SAFE_CALLOC(itf->per[i],mesh->npi+1,int,
+                   MMG5_DEL_MEM(mesh,pp[0]);return 0);
+  for ( k=0; k<npl; ++k ) {
+    /* First upper point whose first coordinate is in the tolerance */
+    lo = 0;
+    hi = npl;
+    while ( lo < hi ) {
+      mid = lo + (hi-lo)/2;
+      if ( pp[1][mid].c[0] < pp[0][k].c[0]-itf->tol ) lo = mid+1;
+      else hi = mid;
+    }
+
+    /* Closest free point of the window */
+    jmin = -1;
+    dmin = 0.;
+    for ( j=lo; j<npl && pp[1][j].c[0] <= pp[0][k].c[0]+itf->tol; ++j ) {
+      if ( itf->per[i][pp[1][j].k] ) continue;
+      if ( fabs(pp[1][j].c[1]-pp[0][k].c[1]) > itf->tol ) continue;
+      d = (pp[1][j].c[0]-pp[0][k].c[0])*(pp[1][j].c[0]-pp[0][k].c[0])
+        + (pp[1][j].c[1]-pp[0][k].c[1])*(pp[1][j].c[1]-pp[0][k].c[1]);
+      if ( jmin < 0 || d < dmin ) {
+        jmin = j;
+        dmin = d;
+      }
+    }
+    if ( jmin < 0 ) break;
+
+    itf->per[i][pp[0][k].k]    = pp[1][jmin].k;
+    itf->per[i][pp[1][jmin].k] = pp[0][k].k;
+  }
+  MMG5_DEL_MEM(mesh,pp[0]);
+  if ( k < npl ) return 0;
+
+  /* Faces */
+  MMG5_ADD_MEM(mesh,(8*(size_t)mesh->nei+1)*sizeof(MIRRORMESH_PlaneFace),
+               "plane faces",return 0);
+  MMG5_SAFE_MALLOC(fc[0],8*(size_t)mesh->nei+1,MIRRORMESH_PlaneFace,return 0);
+  fc[1] = fc[0]+4*mesh->nei;
+  for ( l=0; l<2; ++l ) {
+    nf[l] = MIRRORMESH_plane_faces(mesh,i,itf,i+3*l,fc[l]);
+  }
+  if ( nf[0] != nf[1] ) {
+    MMG5_DEL_MEM(mesh,fc[0]);
+    return 0;
+  }
+
+  itf->nfper[i] = 2*nf[0];
+  MMG5_ADD_MEM(mesh,(4*(size_t)nf[0]+1)*sizeof(int),"periodic faces",
+               MMG5_DEL_MEM(mesh,fc[0]);return 0);
+  MMG5_SAFE_MALLOC(itf->fper[i],4*(size_t)nf[0]+1,int,
+                   MMG5_DEL_MEM(mesh,fc[0]);return 0);
+  for ( j=0; j<nf[0]; ++j ) {
+    if ( MIRRORMESH_comparePlaneFace(&fc[0][j],&fc[1][j]) ) break;
+    itf->fper[i][4*j]   = fc[0][j].kf;
+    itf->fper[i][4*j+1] = fc[1][j].kf;
+    itf->fper[i][4*j+2] = fc[1][j].kf;
+    itf->fper[i][4*j+3] = fc[0][j].kf;
+  }
+  MMG5_DEL_MEM(mesh,fc[0]);
+  if ( j < nf[0] ) return 0;
+
+  qsort(itf->fper[i],itf->nfper[i],2*sizeof(int),MIRRORMESH_compareFacePair);
+
+  return 1;
+}
+
+/**
+ * \param itf pointer toward the interface structure
+ * \param i axis of translation
+ * \param kf face of the base mesh (4*k+j) lying on a boundary plane along \a i
+ *
+ * \return the face of the opposite boundary matching \a kf, 0 if \a kf has no
+ * matching face.
+ *
+ */
+static
+int MIRRORMESH_periodic_face(MIRRORMESH_pInterface itf,int i,int kf) {
+  int *f;
+
+  f = bsearch(&kf,itf->fper[i],itf->nfper[i],2*sizeof(int),
+              MIRRORMESH_compareFacePair);
+  return f ? f[1] : 0;
+}
+
+/**
+ * \param mesh pointer toward the base mesh (with up to date bounding box)
+ * \param dim working dimension
+ * \param mode replication mode in each direction (\ref MIRRORMESH_Mode)
+ * \param reltol tolerance, relative to the bounding box size, to consider
+ * that a point lies on a plane
+ * \param itf pointer toward the interface structure to fill
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Collect the base points lying on the boundary planes of the bounding box. A
+ * point lies on a plane if its distance to the plane is smaller than \a
+ * reltol times the largest dimension of the bounding box. Along the
+ * translation axes, the two boundaries are matched (see \ref
+ * MIRRORMESH_match_planes).
+ *
+ */
+int MIRRORMESH_build_interfaces(MMG5_pMesh mesh,int dim,int *mode,
+                                double reltol,MIRRORMESH_pInterface itf) {
+  MMG5_pPoint ppt;
+  int         i,k,l,npinit;
+
+  npinit = mesh->npi;
+
+  memset(itf,0,sizeof(MIRRORMESH_Interface));
+  itf->tol = reltol * mesh->info.delta;
+
+  MMG5_ADD_MEM(mesh,(npinit+1)*sizeof(int8_t),"interface points",return 0);
+  MMG5_SAFE_CALLOC(itf->face,npinit+1,int8_t,return 0);
+
+  /* First pass: mark and count the points of each plane */
+  for ( k=1; k<=npinit; ++k ) {
+    ppt = &mesh->point[k];
+
+    for ( i=0; i<dim; ++i ) {
+      if ( fabs(ppt->c[i]-mesh->info.min[i]) <= itf->tol ) {
+        itf->face[k] |= (1 << i);
+        ++itf->nlist[i];
+      }
+      if ( fabs(mesh->info.max[i]-ppt->c[i]) <= itf->tol ) {
+        itf->face[k] |= (1 << (i+3));
+        ++itf->nlist[i+3];
+      }
+    }
+  }
+
+  /* Second pass: fill the bands */
+  for ( l=0; l<6; ++l ) {
+    if ( !itf->nlist[l] ) continue;
+
+    MMG5_ADD_MEM(mesh,itf->nlist[l]*sizeof(int),"interface points",
+                 MIRRORMESH_free_interfaces(mesh,itf);return 0);
+    MMG5_SAFE_MALLOC(itf->list[l],itf->nlist[l],int,
+                     MIRRORMESH_free_interfaces(mesh,itf);return 0);
+    itf->nlist[l] = 0;
+  }
+
+  for ( k=1; k<=npinit; ++k ) {
+    if ( !itf->face[k] ) continue;
+
+    for ( l=0; l<6; ++l ) {
+      if ( itf->face[k] & (1 << l) ) {
+        itf->list[l][itf->nlist[l]++] = k;
+      }
+    }
+  }
+
+  if ( abs(mesh->info.imprim) > 4 ) {
+    fprintf(stdout,"     Welding tolerance %e\n",itf->tol);
+    for ( i=0; i<dim; ++i ) {
+      fprintf(stdout,"     Axis %d: %d points on lower plane,"
+              " %d points on upper plane\n",i,itf->nlist[i],itf->nlist[i+3]);
+    }
+  }
+
+  for ( i=0; i<dim; ++i ) {
+    if ( mode[i] != MIRRORMESH_TRANSLATE ) continue;
+
+    if ( !MIRRORMESH_match_planes(mesh,i,itf) ) {
+      fprintf(stderr,"\n  ## Error: %s: the base mesh is not periodic along"
+              " axis %d: unable to translate it.\n",__func__,i);
+      MIRRORMESH_free_interfaces(mesh,itf);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh
+ * \param itf pointer toward the interface structure
+ *
+ * Free the interface structure.
+ *
+ */
+void MIRRORMESH_free_interfaces(MMG5_pMesh mesh,MIRRORMESH_pInterface itf) {
+  int l;
+
+  if ( itf->face ) {
+    MMG5_DEL_MEM(mesh,itf->face);
+  }
+  for ( l=0; l<6; ++l ) {
+    if ( itf->list[l] ) {
+      MMG5_DEL_MEM(mesh,itf->list[l]);
+    }
+    itf->nlist[l] = 0;
+  }
+  for ( l=0; l<3; ++l ) {
+    if ( itf->per[l] ) {
+      MMG5_DEL_MEM(mesh,itf->per[l]);
+    }
+    if ( itf->fper[l] ) {
+      MMG5_DEL_MEM(mesh,itf->fper[l]);
+    }
+    itf->nfper[l] = 0;
+  }
+}
+
+/**
+ * \param dim working dimension
+ * \param nmir number of mirrors in each direction
+ * \param itf interface points of the base mesh (the bit \a i of \a face is
+ * set if the point lies on the lower boundary along axis \a i, bit \a i+3 for
+ * the upper boundary)
+ * \param copy transformation of the copy
+ * \param k pointer toward the index of the base point, updated with the base
+ * point whose image in the owner is the image of \a k in \a copy
+ *
+ * \return the index of the copy that owns the image of the point in \a copy.
+ *
+ * A point lying on the symmetry plane shared by two consecutive copies along
+ * one direction is a duplicate of its image in the previous copy. The upper
+ * boundary of the base mesh is shared between copies of index \f$i-1\f$ and
+ * \f$i\f$ if \f$i\f$ is odd, the lower boundary if \f$i\f$ is even. Along
+ * a translation axis, the lower boundary of the copy \f$i\f$ is the upper
+ * boundary of the copy \f$i-1\f$: the point is replaced by the matching
+ * point of the upper boundary.
+ *
+ */
+int MIRRORMESH_owner(int dim,int *nmir,MIRRORMESH_pInterface itf,
+                     MIRRORMESH_pCopy copy,int *k) {
+  int i,idx,per,owner;
+
+  owner = 0;
+  for ( i=dim-1; i>=0; --i ) {
+    idx = copy->idx[i];
+    per = copy->periodic & (1 << i);
+    while ( idx > 0 &&
+            (itf->face[*k] & (1 << MIRRORMESH_LOWER(per,i,idx))) ) {
+      --idx;
+      if ( per ) *k = itf->per[i][*k];
+    }
+    owner = owner*(nmir[i]+1) + idx;
+  }
+  return owner;
+}
+
+/**
+ * \param dim working dimension
+ * \param nmir number of mirrors in each direction
+ * \param itf interface points of the base mesh
+ * \param copy transformation of the copy
+ * \param face symmetry planes on which lies a base face (same bits as in
+ * \ref MIRRORMESH_owner)
+ * \param kf pointer toward the base face (4*k+j for the face j of the tetra
+ * k), updated with the base face whose image in the returned copy is glued
+ * to the image of \a kf in \a copy
+ *
+ * \return the index of the copy that shares the image of the face with \a
+ * copy, -1 if the image of the face lies on the boundary of the lattice, -2
+ * if the face has no matching face on the opposite boundary of a translation
+ * axis.
+ *
+ * Along axis \a i, the copy of index \f$i\f$ shares its lower plane with the
+ * copy \f$i-1\f$ and its upper plane with the copy \f$i+1\f$: the upper
+ * boundary of the base mesh is its upper plane if \f$i\f$ is even, its lower
+ * plane if \f$i\f$ is odd, or always along a translation axis (the face is
+ * then glued to the matching face of the opposite boundary).
+ *
+ */
+int MIRRORMESH_neighbour(int dim,int *nmir,MIRRORMESH_pInterface itf,
+                         MIRRORMESH_pCopy copy,int8_t face,int *kf) {
+  int i,j,idx,per,jcopy;
+
+  for ( i=0; i<dim; ++i ) {
+    idx = copy->idx[i];
+    per = copy->periodic & (1 << i);
+    if ( idx > 0 && (face & (1 << MIRRORMESH_LOWER(per,i,idx))) ) {
+      --idx;
+    }
+    else if ( idx < nmir[i] && (face & (1 << MIRRORMESH_UPPER(per,i,idx))) ) {
+      ++idx;
+    }
+    else {
+      continue;
+    }
+
+    if ( per ) {
+      *kf = MIRRORMESH_periodic_face(itf,i,*kf);
+      if ( !*kf ) return -2;
+    }
+
+    jcopy = 0;
+    for ( j=dim-1; j>=0; --j ) {
+      jcopy = jcopy*(nmir[j]+1) + (j == i ? idx : copy->idx[j]);
+    }
+    return jcopy;
+  }
+  return -1;
+}
+
+/**
+ * \param dim working dimension
+ * \param nmir number of mirrors in each direction
+ * \param copy transformation of the copy
+ * \param face symmetry planes on which lies a base point (same bits as in
+ * \ref MIRRORMESH_owner)
+ * \param list computed indices of the copies (at most 8)
+ *
+ * \return the number of copies that share the image of the point with \a
+ * copy, \a copy included.
+ *
+ * Along each axis, the copies sharing the point are the copy itself and its
+ * neighbours across the planes of \a face (see \ref MIRRORMESH_neighbour).
+ *
+ */
+int MIRRORMESH_sharing(int dim,int *nmir,MIRRORMESH_pCopy copy,int8_t face,
+                       int *list) {
+  int i,l,n,nl,idx,per,nidx[2],j,nn;
+
+  list[0] = 0;
+  n       = 1;
+  for ( i=dim-1; i>=0; --i ) {
+    idx = copy->idx[i];
+    nn  = 0;
+    per = copy->periodic & (1 << i);
+    if ( idx > 0 && (face & (1 << MIRRORMESH_LOWER(per,i,idx))) ) {
+      nidx[nn++] = idx-1;
+    }
+    if ( idx < nmir[i] && (face & (1 << MIRRORMESH_UPPER(per,i,idx))) ) {
+      nidx[nn++] = idx+1;
+    }
+
+    /* Neighbours along axis i of the copies found along the upper axes */
+    nl = n;
+    for ( j=0; j<nn; ++j ) {
+      for ( l=0; l<n; ++l ) {
+        list[nl++] = list[l]*(nmir[i]+1) + nidx[j];
+      }
+    }
+    for ( l=0; l<n; ++l ) {
+      list[l] = list[l]*(nmir[i]+1) + idx;
+    }
+    n = nl;
+  }
+  return n;
+}